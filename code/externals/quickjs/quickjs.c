@@ -654,6 +654,8 @@ typedef struct JSArrayBuffer {
     int byte_length; /* 0 if detached */
     uint8_t detached;
     uint8_t shared; /* if shared, the array buffer cannot be detached */
+    int pin_count; /* if > 0, the data is in use by native code and the
+                      array buffer cannot be detached */
     uint8_t *data; /* NULL if detached */
     struct list_head array_list;
     void *opaque;
@@ -1171,6 +1173,7 @@ static JSValue js_typed_array_constructor(JSContext *ctx,
 static BOOL typed_array_is_detached(JSContext *ctx, JSObject *p);
 static uint32_t typed_array_get_length(JSContext *ctx, JSObject *p);
 static JSValue JS_ThrowTypeErrorDetachedArrayBuffer(JSContext *ctx);
+static JSValue JS_ThrowTypeErrorPinnedArrayBuffer(JSContext *ctx);
 static JSVarRef *get_var_ref(JSContext *ctx, JSStackFrame *sf, int var_idx,
                              BOOL is_arg);
 static JSValue js_generator_function_call(JSContext *ctx, JSValueConst func_obj,
@@ -2351,6 +2354,13 @@ void JS_SetMaxStackSize(JSRuntime *rt, size_t stack_size)
     rt->stack_size = stack_size;
 }
 
+/* should be called when changing thread or when the runtime was
+   created deeper in the stack than where it runs */
+void JS_UpdateStackTop(JSRuntime *rt)
+{
+    rt->stack_top = js_get_stack_pointer();
+}
+
 static inline BOOL is_strict_mode(JSContext *ctx)
 {
     JSStackFrame *sf = ctx->rt->current_stack_frame;
@@ -28053,6 +28063,11 @@ JSAtom JS_GetModuleName(JSContext *ctx, JSModuleDef *m)
     return JS_DupAtom(ctx, m->module_name);
 }
 
+JSValue JS_GetModuleNamespace(JSContext *ctx, JSModuleDef *m)
+{
+    return js_get_module_ns(ctx, m);
+}
+
 JSValue JS_GetImportMeta(JSContext *ctx, JSModuleDef *m)
 {
     JSValue obj;
@@ -33613,6 +33628,7 @@ typedef enum BCTagEnum {
     BC_TAG_DATE,
     BC_TAG_OBJECT_VALUE,
     BC_TAG_OBJECT_REFERENCE,
+    BC_TAG_TRANSFER_ARRAY_BUFFER,
 } BCTagEnum;
 
 #ifdef CONFIG_BIGNUM
@@ -33643,6 +33659,9 @@ typedef struct BCWriterState {
     uint8_t **sab_tab;
     int sab_tab_len;
     int sab_tab_size;
+    /* ArrayBuffers written by pointer instead of by copy */
+    JSValueConst *transfer;
+    int transfer_len;
     /* list of referenced objects (used if allow_reference = TRUE) */
     JSObjectList object_list;
 } BCWriterState;
@@ -33671,6 +33690,7 @@ static const char * const bc_tag_str[] = {
     "Date",
     "ObjectValue",
     "ObjectReference",
+    "TransferArrayBuffer",
 };
 #endif
 
@@ -34260,10 +34280,19 @@ static int JS_WriteArrayBuffer(BCWriterState *s, JSValueConst obj)
 {
     JSObject *p = JS_VALUE_GET_OBJ(obj);
     JSArrayBuffer *abuf = p->u.array_buffer;
+    int i;
     if (abuf->detached) {
         JS_ThrowTypeErrorDetachedArrayBuffer(s->ctx);
         return -1;
     }
+    for(i = 0; i < s->transfer_len; i++) {
+        if (JS_VALUE_GET_OBJ(s->transfer[i]) == p) {
+            bc_put_u8(s, BC_TAG_TRANSFER_ARRAY_BUFFER);
+            bc_put_leb128(s, abuf->byte_length);
+            bc_put_u64(s, (uintptr_t)abuf->data);
+            return 0;
+        }
+    }
     bc_put_u8(s, BC_TAG_ARRAY_BUFFER);
     bc_put_leb128(s, abuf->byte_length);
     dbuf_put(&s->dbuf, abuf->data, abuf->byte_length);
@@ -34515,6 +34544,131 @@ uint8_t *JS_WriteObject(JSContext *ctx, size_t *psize, JSValueConst obj,
     return JS_WriteObject2(ctx, psize, obj, flags, NULL, NULL);
 }
 
+static void js_array_buffer_free(JSRuntime *rt, void *opaque, void *ptr);
+
+/* Detach the ArrayBuffer without freeing its data, which is no longer
+   accounted to 'rt'. */
+static uint8_t *js_array_buffer_steal(JSContext *ctx, JSValueConst obj)
+{
+    JSRuntime *rt = ctx->rt;
+    JSArrayBuffer *abuf = JS_VALUE_GET_OBJ(obj)->u.array_buffer;
+    uint8_t *data = abuf->data;
+
+    rt->malloc_state.malloc_count--;
+    rt->malloc_state.malloc_size -= js_malloc_usable_size_rt(rt, data) + MALLOC_OVERHEAD;
+    abuf->free_func = NULL;
+    JS_DetachArrayBuffer(ctx, obj);
+    return data;
+}
+
+/* Same as JS_WriteObject2() with JS_WRITE_OBJ_REFERENCE, except that
+   the ArrayBuffers of 'transfer' are written as a pointer to their
+   data and detached. Their data pointers are returned in 'ptransfer_tab'
+   (to be freed with js_free()); ownership passes to the runtime that
+   reads the output with JS_READ_OBJ_TRANSFER. Both runtimes must use
+   the same allocator. */
+uint8_t *JS_WriteObjectTransfer(JSContext *ctx, size_t *psize, JSValueConst obj,
+                                int flags, uint8_t ***psab_tab, size_t *psab_tab_len,
+                                JSValueConst *transfer, int transfer_len,
+                                uint8_t ***ptransfer_tab, size_t *ptransfer_tab_len)
+{
+    BCWriterState ss, *s = &ss;
+    uint8_t **tab = NULL;
+    size_t tab_len = 0;
+    JSArrayBuffer *abuf;
+    JSObject *p;
+    int i, j;
+
+    *psize = 0;
+    if (psab_tab)
+        *psab_tab = NULL;
+    if (psab_tab_len)
+        *psab_tab_len = 0;
+    *ptransfer_tab = NULL;
+    *ptransfer_tab_len = 0;
+    for(i = 0; i < transfer_len; i++) {
+        if (JS_VALUE_GET_TAG(transfer[i]) != JS_TAG_OBJECT ||
+            JS_VALUE_GET_OBJ(transfer[i])->class_id != JS_CLASS_ARRAY_BUFFER) {
+            JS_ThrowTypeError(ctx, "only ArrayBuffers can be transferred");
+            return NULL;
+        }
+        abuf = JS_VALUE_GET_OBJ(transfer[i])->u.array_buffer;
+        if (abuf->detached) {
+            JS_ThrowTypeErrorDetachedArrayBuffer(ctx);
+            return NULL;
+        }
+        if (abuf->free_func != js_array_buffer_free) {
+            JS_ThrowTypeError(ctx, "ArrayBuffer is not transferable");
+            return NULL;
+        }
+        if (abuf->pin_count > 0) {
+            JS_ThrowTypeErrorPinnedArrayBuffer(ctx);
+            return NULL;
+        }
+        for(j = 0; j < i; j++) {
+            if (JS_VALUE_GET_OBJ(transfer[j]) == JS_VALUE_GET_OBJ(transfer[i])) {
+                JS_ThrowTypeError(ctx, "ArrayBuffer is transferred more than once");
+                return NULL;
+            }
+        }
+    }
+    if (transfer_len > 0) {
+        tab = js_malloc(ctx, sizeof(tab[0]) * transfer_len);
+        if (!tab)
+            return NULL;
+    }
+
+    memset(s, 0, sizeof(*s));
+    s->ctx = ctx;
+    s->byte_swap = ((flags & JS_WRITE_OBJ_BSWAP) != 0);
+    s->allow_bytecode = ((flags & JS_WRITE_OBJ_BYTECODE) != 0);
+    s->allow_sab = ((flags & JS_WRITE_OBJ_SAB) != 0);
+    /* each transferred buffer must be written only once */
+    s->allow_reference = TRUE;
+    s->transfer = transfer;
+    s->transfer_len = transfer_len;
+    if (s->allow_bytecode)
+        s->first_atom = JS_ATOM_END;
+    else
+        s->first_atom = 1;
+    js_dbuf_init(ctx, &s->dbuf);
+    js_object_list_init(&s->object_list);
+
+    if (JS_WriteObjectRec(s, obj))
+        goto fail;
+    if (JS_WriteObjectAtoms(s))
+        goto fail;
+    /* buffers that are not part of the message are simply detached */
+    for(i = 0; i < transfer_len; i++) {
+        p = JS_VALUE_GET_OBJ(transfer[i]);
+        if (js_object_list_find(ctx, &s->object_list, p) >= 0)
+            tab[tab_len++] = js_array_buffer_steal(ctx, transfer[i]);
+        else
+            JS_DetachArrayBuffer(ctx, transfer[i]);
+    }
+    js_object_list_end(ctx, &s->object_list);
+    js_free(ctx, s->atom_to_idx);
+    js_free(ctx, s->idx_to_atom);
+    *psize = s->dbuf.size;
+    if (psab_tab)
+        *psab_tab = s->sab_tab;
+    else
+        js_free(ctx, s->sab_tab);
+    if (psab_tab_len)
+        *psab_tab_len = s->sab_tab_len;
+    *ptransfer_tab = tab;
+    *ptransfer_tab_len = tab_len;
+    return s->dbuf.buf;
+ fail:
+    js_object_list_end(ctx, &s->object_list);
+    js_free(ctx, s->atom_to_idx);
+    js_free(ctx, s->idx_to_atom);
+    js_free(ctx, s->sab_tab);
+    dbuf_free(&s->dbuf);
+    js_free(ctx, tab);
+    return NULL;
+}
+
 typedef struct BCReaderState {
     JSContext *ctx;
     const uint8_t *buf_start, *ptr, *buf_end;
@@ -34526,6 +34680,7 @@ typedef struct BCReaderState {
     BOOL allow_bytecode : 8;
     BOOL is_rom_data : 8;
     BOOL allow_reference : 8;
+    BOOL allow_transfer : 8;
     /* object references */
     JSObject **objects;
     int objects_count;
@@ -35393,6 +35548,39 @@ static JSValue JS_ReadArrayBuffer(BCReaderState *s)
     return JS_EXCEPTION;
 }
 
+/* the reader takes ownership of the transferred data */
+static JSValue JS_ReadTransferArrayBuffer(BCReaderState *s)
+{
+    JSContext *ctx = s->ctx;
+    JSRuntime *rt = ctx->rt;
+    uint32_t byte_length;
+    uint8_t *data_ptr;
+    JSValue obj;
+    uint64_t u64;
+
+    if (bc_get_leb128(s, &byte_length))
+        return JS_EXCEPTION;
+    if (bc_get_u64(s, &u64))
+        return JS_EXCEPTION;
+    data_ptr = (uint8_t *)(uintptr_t)u64;
+    rt->malloc_state.malloc_count++;
+    rt->malloc_state.malloc_size += js_malloc_usable_size_rt(rt, data_ptr) + MALLOC_OVERHEAD;
+    obj = js_array_buffer_constructor3(ctx, JS_UNDEFINED, byte_length,
+                                       JS_CLASS_ARRAY_BUFFER,
+                                       data_ptr,
+                                       js_array_buffer_free, NULL, FALSE);
+    if (JS_IsException(obj)) {
+        js_free_rt(rt, data_ptr);
+        return JS_EXCEPTION;
+    }
+    if (BC_add_object_ref(s, obj))
+        goto fail;
+    return obj;
+ fail:
+    JS_FreeValue(ctx, obj);
+    return JS_EXCEPTION;
+}
+
 static JSValue JS_ReadSharedArrayBuffer(BCReaderState *s)
 {
     JSContext *ctx = s->ctx;
@@ -35548,6 +35736,11 @@ static JSValue JS_ReadObjectRec(BCReaderState *s)
             goto invalid_tag;
         obj = JS_ReadSharedArrayBuffer(s);
         break;
+    case BC_TAG_TRANSFER_ARRAY_BUFFER:
+        if (!s->allow_transfer)
+            goto invalid_tag;
+        obj = JS_ReadTransferArrayBuffer(s);
+        break;
     case BC_TAG_DATE:
         obj = JS_ReadDate(s);
         break;
@@ -35656,6 +35849,7 @@ JSValue JS_ReadObject(JSContext *ctx, const uint8_t *buf, size_t buf_len,
     s->is_rom_data = ((flags & JS_READ_OBJ_ROM_DATA) != 0);
     s->allow_sab = ((flags & JS_READ_OBJ_SAB) != 0);
     s->allow_reference = ((flags & JS_READ_OBJ_REFERENCE) != 0);
+    s->allow_transfer = ((flags & JS_READ_OBJ_TRANSFER) != 0);
     if (s->allow_bytecode)
         s->first_atom = JS_ATOM_END;
     else
@@ -50778,6 +50972,7 @@ static JSValue js_array_buffer_constructor3(JSContext *ctx,
     init_list_head(&abuf->array_list);
     abuf->detached = FALSE;
     abuf->shared = (class_id == JS_CLASS_SHARED_ARRAY_BUFFER);
+    abuf->pin_count = 0;
     abuf->opaque = opaque;
     abuf->free_func = free_func;
     if (alloc_flag && buf)
@@ -50899,6 +51094,11 @@ static JSValue JS_ThrowTypeErrorDetachedArrayBuffer(JSContext *ctx)
     return JS_ThrowTypeError(ctx, "ArrayBuffer is detached");
 }
 
+static JSValue JS_ThrowTypeErrorPinnedArrayBuffer(JSContext *ctx)
+{
+    return JS_ThrowTypeError(ctx, "ArrayBuffer is in use");
+}
+
 static JSValue js_array_buffer_get_byteLength(JSContext *ctx,
                                               JSValueConst this_val,
                                               int class_id)
@@ -50911,13 +51111,18 @@ static JSValue js_array_buffer_get_byteLength(JSContext *ctx,
     return JS_NewUint32(ctx, abuf->byte_length);
 }
 
-void JS_DetachArrayBuffer(JSContext *ctx, JSValueConst obj)
+/* return -1 and throw if the ArrayBuffer is pinned */
+int JS_DetachArrayBuffer(JSContext *ctx, JSValueConst obj)
 {
     JSArrayBuffer *abuf = JS_GetOpaque(obj, JS_CLASS_ARRAY_BUFFER);
     struct list_head *el;
 
     if (!abuf || abuf->detached)
-        return;
+        return 0;
+    if (abuf->pin_count > 0) {
+        JS_ThrowTypeErrorPinnedArrayBuffer(ctx);
+        return -1;
+    }
     if (abuf->free_func)
         abuf->free_func(ctx->rt, abuf->opaque, abuf->data);
     abuf->data = NULL;
@@ -50936,6 +51141,32 @@ void JS_DetachArrayBuffer(JSContext *ctx, JSValueConst obj)
             p->u.array.u.ptr = NULL;
         }
     }
+    return 0;
+}
+
+/* Keep the data of an ArrayBuffer in place while native code (e.g. a
+   pending write) uses it: it cannot be detached or transferred until
+   the matching JS_UnpinArrayBuffer(). Other values are ignored. */
+void JS_PinArrayBuffer(JSContext *ctx, JSValueConst obj)
+{
+    JSArrayBuffer *abuf = JS_GetOpaque(obj, JS_CLASS_ARRAY_BUFFER);
+    if (abuf)
+        abuf->pin_count++;
+}
+
+void JS_UnpinArrayBuffer(JSContext *ctx, JSValueConst obj)
+{
+    JSArrayBuffer *abuf = JS_GetOpaque(obj, JS_CLASS_ARRAY_BUFFER);
+    if (abuf) {
+        assert(abuf->pin_count > 0);
+        abuf->pin_count--;
+    }
+}
+
+JS_BOOL JS_IsArrayBufferPinned(JSValueConst obj)
+{
+    JSArrayBuffer *abuf = JS_GetOpaque(obj, JS_CLASS_ARRAY_BUFFER);
+    return abuf && abuf->pin_count > 0;
 }
 
 /* get an ArrayBuffer or SharedArrayBuffer */
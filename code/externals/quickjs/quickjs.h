@@ -335,6 +335,7 @@ IJ_API void JS_SetRuntimeInfo(JSRuntime *rt, const char *info);
 IJ_API void JS_SetMemoryLimit(JSRuntime *rt, size_t limit);
 IJ_API void JS_SetGCThreshold(JSRuntime *rt, size_t gc_threshold);
 IJ_API void JS_SetMaxStackSize(JSRuntime *rt, size_t stack_size);
+IJ_API void JS_UpdateStackTop(JSRuntime *rt);
 IJ_API JSRuntime *JS_NewRuntime2(const JSMallocFunctions *mf, void *opaque);
 IJ_API void JS_FreeRuntime(JSRuntime *rt);
 IJ_API void *JS_GetRuntimeOpaque(JSRuntime *rt);
@@ -810,7 +811,10 @@ IJ_API JSValue JS_NewArrayBuffer(JSContext *ctx, uint8_t *buf, size_t len,
                           JSFreeArrayBufferDataFunc *free_func, void *opaque,
                           JS_BOOL is_shared);
 IJ_API JSValue JS_NewArrayBufferCopy(JSContext *ctx, const uint8_t *buf, size_t len);
-IJ_API void JS_DetachArrayBuffer(JSContext *ctx, JSValueConst obj);
+IJ_API int JS_DetachArrayBuffer(JSContext *ctx, JSValueConst obj);
+IJ_API void JS_PinArrayBuffer(JSContext *ctx, JSValueConst obj);
+IJ_API void JS_UnpinArrayBuffer(JSContext *ctx, JSValueConst obj);
+IJ_API JS_BOOL JS_IsArrayBufferPinned(JSValueConst obj);
 IJ_API uint8_t *JS_GetArrayBuffer(JSContext *ctx, size_t *psize, JSValueConst obj);
 IJ_API JSValue JS_GetTypedArrayBuffer(JSContext *ctx, JSValueConst obj,
                                size_t *pbyte_offset,
@@ -858,6 +862,7 @@ IJ_API void JS_SetModuleLoaderFunc(JSRuntime *rt,
                             JSModuleLoaderFunc *module_loader, void *opaque);
 /* return the import.meta object of a module */
 IJ_API JSValue JS_GetImportMeta(JSContext *ctx, JSModuleDef *m);
+IJ_API JSValue JS_GetModuleNamespace(JSContext *ctx, JSModuleDef *m);
 IJ_API JSAtom JS_GetModuleName(JSContext *ctx, JSModuleDef *m);
 
 /* JS Job support */
@@ -879,11 +884,16 @@ IJ_API uint8_t *JS_WriteObject(JSContext *ctx, size_t *psize, JSValueConst obj,
                         int flags);
 IJ_API uint8_t *JS_WriteObject2(JSContext *ctx, size_t *psize, JSValueConst obj,
                          int flags, uint8_t ***psab_tab, size_t *psab_tab_len);
+IJ_API uint8_t *JS_WriteObjectTransfer(JSContext *ctx, size_t *psize, JSValueConst obj,
+                                int flags, uint8_t ***psab_tab, size_t *psab_tab_len,
+                                JSValueConst *transfer, int transfer_len,
+                                uint8_t ***ptransfer_tab, size_t *ptransfer_tab_len);
 
 #define JS_READ_OBJ_BYTECODE  (1 << 0) /* allow function/module */
 #define JS_READ_OBJ_ROM_DATA  (1 << 1) /* avoid duplicating 'buf' data */
 #define JS_READ_OBJ_SAB       (1 << 2) /* allow SharedArrayBuffer */
 #define JS_READ_OBJ_REFERENCE (1 << 3) /* allow object references */
+#define JS_READ_OBJ_TRANSFER  (1 << 4) /* adopt transferred ArrayBuffers */
 IJ_API JSValue JS_ReadObject(JSContext *ctx, const uint8_t *buf, size_t buf_len,
                       int flags);
 
@@ -893,13 +893,29 @@ static ssize_t uv__fs_sendfile(uv_fs_t* req) {
       static int copy_file_range_support = 1;
 
       if (copy_file_range_support) {
-        r = uv__fs_copy_file_range(in_fd, NULL, out_fd, &off, req->bufsml[0].len, 0);
+        r = uv__fs_copy_file_range(in_fd, &off, out_fd, NULL, req->bufsml[0].len, 0);
 
-        if (r == -1 && errno == ENOSYS) {
-          errno = 0;
-          copy_file_range_support = 0;
-        } else {
+        if (r != -1)
           goto ok;
+
+        switch (errno) {
+          case EACCES:
+          case EBADF:
+          case EINVAL:
+          case EIO:
+          case EOPNOTSUPP:
+          case EPERM:
+          case ETXTBSY:
+          case EXDEV:
+            /* Fall back to sendfile(), e.g. when out_fd is a socket. */
+            errno = 0;
+            break;
+          case ENOSYS:
+            errno = 0;
+            copy_file_range_support = 0;
+            break;
+          default:
+            goto ok;
         }
       }
     }
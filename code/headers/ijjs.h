@@ -39,9 +39,19 @@
 #include <unistd.h>
 #endif
 
+enum {
+    IJJS_LANE_FS = 0,
+    IJJS_LANE_DB,
+    IJJS_LANE_CPU,
+    IJJS_LANE_DNS,
+    IJJS_LANE_COUNT
+};
+
 typedef struct IJJSRunOptions {
     IJBool abort_on_unhandled_rejection;
     size_t stack_size;
+    IJBool io_uring;
+    IJU32 threads[IJJS_LANE_COUNT];
 } IJJSRunOptions;
 
 typedef struct IJJSRuntime {
@@ -67,8 +77,67 @@ typedef struct IJJSRuntime {
     struct {
         JSValue u8array_ctor;
     } builtins;
+    struct {
+        IJVoid* slabs[IJJS_READ_POOL_SLABS];
+        IJS32 count;
+        IJBool closed;
+        IJU64 hits;
+        IJU64 misses;
+        IJU64 copied;
+        IJU64 handed;
+    } pool;
+    struct IJJSMapping* maps;
+    struct IJJSUring* uring;
+    struct list_head timers;
+    struct {
+        uv_async_t async;
+        uv_mutex_t lock;
+        struct list_head done;
+        IJU32 pending;
+    } exec;
 } IJJSRuntime;
 
+typedef struct IJJSWork {
+    IJVoid* data;
+    struct list_head link;
+    IJJSRuntime* qrt;
+    IJS32 lane;
+    IJU64 queued_at;
+    IJVoid (*work_cb)(struct IJJSWork* req);
+    IJVoid (*after_work_cb)(struct IJJSWork* req, IJS32 status);
+} IJJSWork;
+
+typedef IJVoid (*IJJSWorkCb)(IJJSWork* req);
+typedef IJVoid (*IJJSAfterWorkCb)(IJJSWork* req, IJS32 status);
+
+typedef struct IJJSPortEnd IJJSPortEnd;
+typedef struct IJJSChannelMsg IJJSChannelMsg;
+
+typedef struct IJJSMessage {
+    IJU8* data;
+    size_t len;
+    IJBool transfer;
+    IJU8** shared;
+    size_t nshared;
+    IJU8** buffers;
+    size_t nbuffers;
+    IJJSPortEnd** ports;
+    size_t nports;
+} IJJSMessage;
+
+typedef struct IJJSLaneStats {
+    const IJAnsi* name;
+    IJU32 threads;
+    IJU32 queued;
+    IJU32 max_queued;
+    IJU32 busy;
+    IJU64 submitted;
+    IJU64 completed;
+    IJU64 wait_ns;
+    IJU64 max_wait_ns;
+    IJU64 run_ns;
+} IJJSLaneStats;
+
 typedef struct IJJSAssertionInfo {
     const IJAnsi* file_line;  // filename:line
     const IJAnsi* message;
@@ -86,6 +155,17 @@ typedef struct {
     IJVoid (*done_cb)(void*, IJVoid*);
 } IJJSCurl;
 
+typedef struct {
+    JSValue value;
+    const IJAnsi* cstr;
+} IJJSWriteBuf;
+
+#define IJJS_TCP_REUSEPORT 0x100
+
+typedef struct IJJSStreamOwner {
+    IJVoid (*closed)(struct IJJSStreamOwner* owner);
+} IJJSStreamOwner;
+
 IJ_API const IJAnsi* ijVersion();
 
 IJ_API IJVoid ijDefaultOptions(
@@ -185,6 +265,13 @@ IJ_API IJVoid ijSettlePromise(
     IJS32 argc, 
     JSValueConst* argv);
 
+IJ_API IJVoid ijSettlePromiseLater(
+    JSContext* ctx, 
+    IJJSPromise* p, 
+    IJBool is_reject, 
+    IJS32 argc, 
+    JSValueConst* argv);
+
 IJ_API IJVoid ijResolvePromise(
     JSContext* ctx, 
     IJJSPromise* p, 
@@ -212,6 +299,30 @@ IJ_API JSValue ijNewUint8Array(
     IJU8* data, 
     size_t size);
 
+IJ_API IJU8* ijReadBufAlloc(
+    JSContext* ctx, 
+    size_t size);
+
+IJ_API IJVoid ijReadBufFree(
+    JSContext* ctx, 
+    IJU8* data, 
+    size_t size);
+
+IJ_API IJU8* ijReadBufShrink(
+    JSContext* ctx, 
+    IJU8* data, 
+    size_t size, 
+    size_t nread);
+
+IJ_API JSValue ijNewReadBuffer(
+    JSContext* ctx, 
+    IJU8* data, 
+    size_t size, 
+    size_t nread);
+
+IJ_API IJVoid ijReadBufPoolFree(
+    IJJSRuntime* qrt);
+
 IJ_API IJVoid ijCurlInit(IJVoid);
 
 IJ_API IJS32 ijCurlLoadHttp(
@@ -293,6 +404,9 @@ IJ_API IJVoid ijModTimersExport(
     JSContext* ctx, 
     JSModuleDef* m);
 
+IJ_API IJVoid ijTimersClose(
+    IJJSRuntime* qrt);
+
 IJ_API IJVoid ijModUdpInit(
     JSContext* ctx, 
     JSModuleDef* m);
@@ -325,6 +439,63 @@ IJ_API IJVoid ijModWorkerExport(
     JSContext* ctx, 
     JSModuleDef* m);
 
+IJ_API IJVoid ijModChannelInit(
+    JSContext* ctx, 
+    JSModuleDef* m);
+
+IJ_API IJVoid ijModChannelExport(
+    JSContext* ctx, 
+    JSModuleDef* m);
+
+IJ_API IJS32 ijMessageWrite(
+    JSContext* ctx,
+    JSValueConst message,
+    JSValueConst transfer,
+    IJJSPortEnd* source,
+    IJJSMessage* msg);
+
+IJ_API IJVoid ijMessageFree(
+    JSRuntime* rt,
+    IJJSMessage* msg,
+    IJBool delivered);
+
+IJ_API JSValue ijMessageRead(
+    JSContext* ctx,
+    const IJU8* data,
+    size_t len,
+    IJBool transfer,
+    const IJU8* shared,
+    size_t nshared,
+    const IJU8* ports,
+    size_t nports,
+    JSValue* pports);
+
+IJ_API JSValue ijNewMessagePort(
+    JSContext* ctx,
+    IJJSPortEnd* end);
+
+IJ_API IJVoid ijPortEndRelease(
+    IJJSPortEnd* end);
+
+IJ_API IJJSChannelMsg* ijChannelMsgNew(
+    IJJSMessage* msg);
+
+IJ_API IJVoid ijChannelMsgDrop(
+    IJJSChannelMsg* m);
+
+IJ_API JSValue ijChannelMsgRead(
+    JSContext* ctx,
+    IJJSChannelMsg* m,
+    JSValue* pports);
+
+IJ_API IJVoid ijModPoolInit(
+    JSContext* ctx, 
+    JSModuleDef* m);
+
+IJ_API IJVoid ijModPoolExport(
+    JSContext* ctx, 
+    JSModuleDef* m);
+
 IJ_API IJVoid ijModXhrInit(
     JSContext* ctx, 
     JSModuleDef* m);
@@ -341,6 +512,22 @@ IJ_API IJVoid ijModKcpExport(
     JSContext* ctx, 
     JSModuleDef* m);
 
+IJ_API IJVoid ijModHttpInit(
+    JSContext* ctx, 
+    JSModuleDef* m);
+
+IJ_API IJVoid ijModHttpExport(
+    JSContext* ctx, 
+    JSModuleDef* m);
+
+IJ_API IJVoid ijModTlsInit(
+    JSContext* ctx, 
+    JSModuleDef* m);
+
+IJ_API IJVoid ijModTlsExport(
+    JSContext* ctx, 
+    JSModuleDef* m);
+
 IJ_API JSValue ijNewError(
     JSContext* ctx, 
     IJS32 err);
@@ -356,6 +543,150 @@ IJ_API uv_stream_t* ijPipeGetStream(
     JSContext *ctx, 
     JSValueConst obj);
 
+IJ_API JSValue ijNewTcp(
+    JSContext *ctx, 
+    IJS32 af);
+
+IJ_API uv_stream_t* ijSocketGetStream(
+    JSContext *ctx, 
+    JSValueConst obj);
+
+IJ_API uv_file ijFileGetFd(
+    JSValueConst obj);
+
+IJ_API IJS32 ijFileAcquire(
+    JSValueConst obj, 
+    uv_file* fd);
+
+IJ_API IJVoid ijFileRelease(
+    JSValueConst obj);
+
+IJ_API uv_stream_t* ijStreamAcquire(
+    JSContext* ctx, 
+    JSValueConst obj, 
+    IJJSStreamOwner* owner);
+
+IJ_API IJVoid ijStreamRelease(
+    uv_stream_t* handle, 
+    IJJSStreamOwner* owner);
+
+IJ_API IJJSStreamOwner* ijStreamGetOwner(
+    uv_stream_t* handle);
+
+IJ_API uv_stream_t* ijStreamAcquireWriter(
+    JSContext* ctx, 
+    JSValueConst obj);
+
+IJ_API IJVoid ijStreamReleaseWriter(
+    uv_stream_t* handle);
+
+IJ_API IJS32 ijTcpSetReusePort(
+    uv_tcp_t* tcp, 
+    IJS32 family);
+
+IJ_API IJS32 ijStreamGetData(
+    JSContext* ctx, 
+    JSValueConst val, 
+    uv_buf_t* b, 
+    IJJSWriteBuf* pin);
+
+IJ_API IJVoid ijStreamReleaseBufs(
+    JSContext* ctx, 
+    IJJSWriteBuf* bufs, 
+    IJS32 nbufs);
+
+IJ_API IJVoid ijExecInit(
+    IJJSRuntime* qrt);
+
+IJ_API IJVoid ijExecFree(
+    IJJSRuntime* qrt);
+
+IJ_API IJVoid ijExecConfigure(
+    const IJU32* threads);
+
+IJ_API IJS32 ijLaneFromName(
+    const IJAnsi* name, 
+    size_t len);
+
+IJ_API IJS32 ijQueueWork(
+    JSContext* ctx, 
+    IJS32 lane, 
+    IJJSWork* req, 
+    IJJSWorkCb work_cb, 
+    IJJSAfterWorkCb after_work_cb);
+
+IJ_API IJVoid ijExecStats(
+    IJS32 lane, 
+    IJJSLaneStats* stats);
+
+IJ_API IJVoid ijUringInit(
+    IJJSRuntime* qrt);
+
+IJ_API IJVoid ijUringFree(
+    IJJSRuntime* qrt);
+
+IJ_API const IJAnsi* ijUringEngine(
+    JSContext* ctx);
+
+IJ_API IJBool ijUringSupported(IJVoid);
+
+IJ_API IJS32 ijUringOpen(
+    JSContext* ctx, 
+    uv_fs_t* req, 
+    const IJAnsi* path, 
+    IJS32 flags, 
+    IJS32 mode, 
+    uv_fs_cb cb);
+
+IJ_API IJS32 ijUringClose(
+    JSContext* ctx, 
+    uv_fs_t* req, 
+    uv_file fd, 
+    uv_fs_cb cb);
+
+IJ_API IJS32 ijUringRead(
+    JSContext* ctx, 
+    uv_fs_t* req, 
+    uv_file fd, 
+    const uv_buf_t bufs[], 
+    IJU32 nbufs, 
+    IJS64 off, 
+    uv_fs_cb cb);
+
+IJ_API IJS32 ijUringWrite(
+    JSContext* ctx, 
+    uv_fs_t* req, 
+    uv_file fd, 
+    const uv_buf_t bufs[], 
+    IJU32 nbufs, 
+    IJS64 off, 
+    uv_fs_cb cb);
+
+IJ_API IJS32 ijUringStat(
+    JSContext* ctx, 
+    uv_fs_t* req, 
+    const IJAnsi* path, 
+    uv_fs_cb cb);
+
+IJ_API IJS32 ijUringLstat(
+    JSContext* ctx, 
+    uv_fs_t* req, 
+    const IJAnsi* path, 
+    uv_fs_cb cb);
+
+IJ_API IJS32 ijUringFstat(
+    JSContext* ctx, 
+    uv_fs_t* req, 
+    uv_file fd, 
+    uv_fs_cb cb);
+
+IJ_API IJS32 ijUringFsync(
+    JSContext* ctx, 
+    uv_fs_t* req, 
+    uv_file fd, 
+    IJBool datasync, 
+    uv_fs_cb cb);
+
 IJ_API IJVoid ijExecuteJobs(
     JSContext* ctx);
 
@@ -410,4 +741,12 @@ IJ_API IJJSRuntime* ijNewRuntimeInternal(
     IJBool is_worker, 
     IJJSRunOptions* options);
 
+IJ_API IJVoid ijSabFree(
+    IJVoid* opaque,
+    IJVoid* ptr);
+
+IJ_API IJVoid ijSabDup(
+    IJVoid* opaque,
+    IJVoid* ptr);
+
 #endif
@@ -65,6 +65,13 @@
 #define IJJS_DEFAULT_STACK_SIZE 1048576
 
 #define IJJS_DEFAULt_READ_SIZE 65536
+#define IJJS_DEFAULT_HIGH_WATER_MARK (16 * IJJS_DEFAULt_READ_SIZE)
+
+#define IJJS_READ_POOL_SLABS 64
+
+#define IJJS_MAX_WRITEV_BUFS 1024
+
+#define IJJS_ACCEPT_QUEUE_SIZE 128
 
 #define STDIN_FILENO 0
 
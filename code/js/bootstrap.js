@@ -34,6 +34,7 @@ const noExport = [
     'alert',
     'XMLHttpRequest',
     'Worker',
+    'newMessageChannel',
     'signal',
     'random',
     'args',
@@ -1,6 +1,6 @@
 import { AbortController, AbortSignal } from '@ijjs/abort-controller';
 import { Console } from '@ijjs/console';
-import { XMLHttpRequest as XHR, Worker as _Worker } from '@ijjs/core';
+import { XMLHttpRequest as XHR, Worker as _Worker, newMessageChannel } from '@ijjs/core';
 import { defineEventAttribute, EventTarget, Event, CustomEvent } from '@ijjs/event-target';
 import { Performance } from '@ijjs/performance';
 
@@ -42,17 +42,23 @@ class ErrorEvent extends Event {
 }
 
 const kMessageEventData = Symbol('kMessageEventData');
+const kMessageEventPorts = Symbol('kMessageEventPorts');
 
 class MessageEvent extends Event {
-    constructor(eventTye, data) {
+    constructor(eventTye, data, ports = []) {
         super(eventTye);
 
         this[kMessageEventData] = data;
+        this[kMessageEventPorts] = ports;
     }
 
     get data() {
         return this[kMessageEventData];
     }
+
+    get ports() {
+        return this[kMessageEventPorts];
+    }
 }
 
 const kPromiseRejectionReason = Symbol('kPromiseRejectionReason');
@@ -134,6 +140,100 @@ Object.defineProperty(window, 'AbortSignal', {
     writable: true,
     value: AbortSignal
 });
+const kPort = Symbol('kPort');
+const kPortToken = Symbol('kPortToken');
+
+class MessagePort extends EventTarget {
+    constructor(token, port) {
+        if (token !== kPortToken) {
+            throw new TypeError('Illegal constructor');
+        }
+
+        super();
+
+        port.onmessage = (msg, ports) => {
+            this.dispatchEvent(new MessageEvent('message', msg, wrapPorts(ports)));
+        };
+        port.onmessageerror = msgerror => {
+            this.dispatchEvent(new MessageEvent('messageerror', msgerror));
+        };
+
+        this[kPort] = port;
+    }
+
+    postMessage(message, transfer) {
+        this[kPort].postMessage(message, unwrapTransfer(transfer));
+    }
+
+    start() {
+        this[kPort].start();
+    }
+
+    close() {
+        this[kPort].close();
+    }
+}
+
+const portProto = MessagePort.prototype;
+defineEventAttribute(portProto, 'message');
+defineEventAttribute(portProto, 'messageerror');
+
+// Setting onmessage starts the port, like it does in browsers.
+const onmessageDesc = Object.getOwnPropertyDescriptor(portProto, 'onmessage');
+Object.defineProperty(portProto, 'onmessage', {
+    ...onmessageDesc,
+    set(value) {
+        onmessageDesc.set.call(this, value);
+        this.start();
+    }
+});
+
+function wrapPorts(ports) {
+    if (!ports) {
+        return [];
+    }
+
+    return ports.map(port => new MessagePort(kPortToken, port));
+}
+
+function unwrapTransfer(transfer) {
+    const unwrap = list => list.map(item => item instanceof MessagePort ? item[kPort] : item);
+
+    if (Array.isArray(transfer)) {
+        return unwrap(transfer);
+    }
+
+    if (transfer && Array.isArray(transfer.transfer)) {
+        return { transfer: unwrap(transfer.transfer) };
+    }
+
+    return transfer;
+}
+
+class MessageChannel {
+    constructor() {
+        const [ port1, port2 ] = newMessageChannel();
+
+        this.port1 = new MessagePort(kPortToken, port1);
+        this.port2 = new MessagePort(kPortToken, port2);
+    }
+}
+
+Object.defineProperties(window, {
+    MessageChannel: {
+        enumerable: true,
+        configurable: true,
+        writable: true,
+        value: MessageChannel
+    },
+    MessagePort: {
+        enumerable: true,
+        configurable: true,
+        writable: true,
+        value: MessagePort
+    }
+});
+
 const kWorker = Symbol('kWorker');
 
 class Worker extends EventTarget {
@@ -141,8 +241,8 @@ class Worker extends EventTarget {
         super();
 
         const worker = new _Worker(path);
-        worker.onmessage = msg => {
-            this.dispatchEvent(new MessageEvent('message', msg));
+        worker.onmessage = (msg, ports) => {
+            this.dispatchEvent(new MessageEvent('message', msg, wrapPorts(ports)));
         };
         worker.onmessageerror = msgerror => {
             this.dispatchEvent(new MessageEvent('messageerror', msgerror));
@@ -150,12 +250,19 @@ class Worker extends EventTarget {
         worker.onerror = error => {
             this.dispatchEvent(new ErrorEvent(error));
         };
+        worker.onhandle = msg => {
+            this.dispatchEvent(new MessageEvent('handle', msg));
+        };
 
         this[kWorker] = worker;
     }
 
-    postMessage(...args) {
-        this[kWorker].postMessage(args);
+    postMessage(message, transfer) {
+        this[kWorker].postMessage(message, unwrapTransfer(transfer));
+    }
+
+    sendHandle(handle, message) {
+        return this[kWorker].sendHandle(handle, message).then(() => handle.close());
     }
 
     terminate() {
@@ -167,6 +274,7 @@ const workerProto = Worker.prototype;
 defineEventAttribute(workerProto, 'message');
 defineEventAttribute(workerProto, 'messageerror');
 defineEventAttribute(workerProto, 'error');
+defineEventAttribute(workerProto, 'handle');
 
 Object.defineProperty(window, 'Worker', {
     enumerable: true,
@@ -317,3 +425,5 @@ Object.defineProperty(window, 'XMLHttpRequest', {
     writable: true,
     value: XMLHttpRequest
 });
+
+export { wrapPorts, unwrapTransfer };
@@ -1,4 +1,5 @@
 
+import { wrapPorts, unwrapTransfer } from '@ijjs/bootstrap2';
 import { defineEventAttribute } from '@ijjs/event-target';
 
 // `workerThis` is a reference to a ijjs/core `Worker` objet.
@@ -9,8 +10,8 @@ const worker = globalThis.workerThis;
 delete globalThis.workerThis;
 
 self[kWorkerSelf] = worker;
-worker.onmessage = msg => {
-    self.dispatchEvent(new MessageEvent('message', msg));
+worker.onmessage = (msg, ports) => {
+    self.dispatchEvent(new MessageEvent('message', msg, wrapPorts(ports)));
 };
 worker.onmessageerror = msgerror => {
     self.dispatchEvent(new MessageEvent('messageerror', msgerror));
@@ -18,10 +19,29 @@ worker.onmessageerror = msgerror => {
 worker.onerror = error => {
     self.dispatchEvent(new ErrorEvent(error));
 };
-self.postMessage = (...args) => {
-    return self[kWorkerSelf].postMessage(...args);
+worker.onhandle = msg => {
+    self.dispatchEvent(new MessageEvent('handle', msg));
+};
+self.postMessage = (message, transfer) => {
+    return self[kWorkerSelf].postMessage(message, unwrapTransfer(transfer));
+}
+self.sendHandle = (handle, message) => {
+    return self[kWorkerSelf].sendHandle(handle, message).then(() => handle.close());
 }
 
+// Messages are written once per tick, so send what is queued before
+// the thread blocks.
+const atomicsWait = Atomics.wait;
+Object.defineProperty(Atomics, 'wait', {
+    value: function wait(typedArray, index, value, timeout) {
+        self[kWorkerSelf].flush();
+        return atomicsWait(typedArray, index, value, timeout);
+    },
+    writable: true,
+    configurable: true
+});
+
 defineEventAttribute(Object.getPrototypeOf(self), 'message');
 defineEventAttribute(Object.getPrototypeOf(self), 'messageerror');
 defineEventAttribute(Object.getPrototypeOf(self), 'error');
+defineEventAttribute(Object.getPrototypeOf(self), 'handle');
@@ -100,6 +100,22 @@ static int eval_module(JSContext* ctx, const char* filepath, char* override_file
     return ret;
 }
 
+static int parse_threads(const char* spec, IJU32* threads) {
+    while (*spec) {
+        const char* eq = strchr(spec, '=');
+        if (!eq)
+            return -1;
+        int lane = ijLaneFromName(spec, eq - spec);
+        char* end;
+        long n = strtol(eq + 1, &end, 10);
+        if (lane < 0 || n <= 0 || (*end != ',' && *end != '\0'))
+            return -1;
+        threads[lane] = (IJU32) n;
+        spec = *end == ',' ? end + 1 : end;
+    }
+    return 0;
+}
+
 static void print_help(void) {
     printf("Usage: ijjs [options] [file]\n"
            "\n"
@@ -110,8 +126,10 @@ static void print_help(void) {
            "  -l, --load FILENAME             module to preload (option can be repeated)\n"
            "  -q, --quit                      just instantiate the interpreter and quit\n"
            "  --abort-on-unhandled-rejection  abort when a rejected promise is not caught\n"
+           "  --io-uring                      use io_uring for file I/O where the kernel supports it\n"
            "  --override-filename FILENAME    override filename in error messages\n"
            "  --stack-size STACKSIZE          set max stack size\n"
+           "  --threads LANE=N[,LANE=N...]    size the fs, db, cpu and dns executor lanes\n"
            "  --strict-module-detection       only run code as a module if its extension is \".mjs\"\n");
 }
 #ifdef WIN32
@@ -562,6 +580,14 @@ int main(int argc, char** argv) {
                 exit_code = EXIT_INVALID_ARG;
                 goto exit;
             }
+            if (is_longopt(opt, "threads")) {
+                char* threads = get_option_value(arg, argc, argv, &optind);
+                if (threads && parse_threads(threads, runOptions.threads) == 0)
+                    break;
+                report_missing_argument(&opt);
+                exit_code = EXIT_INVALID_ARG;
+                goto exit;
+            }
             if (opt.key == 'q' || is_longopt(opt, "quit")) {
                 flags.empty_run = true;
                 break;
@@ -574,6 +600,10 @@ int main(int argc, char** argv) {
                 runOptions.abort_on_unhandled_rejection = true;
                 break;
             }
+            if (is_longopt(opt, "io-uring")) {
+                runOptions.io_uring = true;
+                break;
+            }
             report_unknown_option(&opt);
             exit_code = EXIT_INVALID_ARG;
             goto exit;
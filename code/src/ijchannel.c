@@ -0,0 +1,601 @@
+/*
+ ijjs javascript runtime engine
+ Copyright (C) 2010-2017 Trix
+
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include "ijjs.h"
+#include <stdatomic.h>
+
+#define IJJS_CHANNEL_RING_SIZE 1024
+#define IJJS_CHANNEL_DRAIN_MAX 1024
+
+enum {
+    PORT_EVENT_MESSAGE = 0,
+    PORT_EVENT_MESSAGE_ERROR,
+    PORT_EVENT_MAX,
+};
+
+struct IJJSChannelMsg {
+    struct IJJSChannelMsg* next;
+    size_t len;
+    IJBool transfer;
+    size_t nshared;
+    size_t nbuffers;
+    size_t nports;
+    IJU8* data;
+    IJU8* tab[];
+};
+
+typedef struct IJJSChannel IJJSChannel;
+
+struct IJJSPortEnd {
+    IJJSChannel* channel;
+    IJU32 side;
+    atomic_size_t head;
+    atomic_size_t tail;
+    IJJSChannelMsg* slots[IJJS_CHANNEL_RING_SIZE];
+    uv_mutex_t lock;
+    uv_async_t* async;
+    IJJSChannelMsg* overflow;
+    IJJSChannelMsg* overflow_tail;
+    atomic_bool overflowed;
+};
+
+struct IJJSChannel {
+    atomic_int refs;
+    atomic_bool closed;
+    IJJSPortEnd ends[2];
+};
+
+typedef struct {
+    JSContext* ctx;
+    IJJSPortEnd* end;
+    uv_async_t* async;
+    IJBool started;
+    JSValue events[PORT_EVENT_MAX];
+} IJJSPort;
+
+static JSClassID ijjs_port_class_id;
+
+static IJJSChannel* ijChannelNew(IJVoid) {
+    IJJSChannel* ch = je_calloc(1, sizeof(*ch));
+    if (!ch)
+        return NULL;
+    atomic_init(&ch->refs, 2);
+    atomic_init(&ch->closed, false);
+    for (IJU32 i = 0; i < 2; i++) {
+        IJJSPortEnd* end = &ch->ends[i];
+        end->channel = ch;
+        end->side = i;
+        atomic_init(&end->head, 0);
+        atomic_init(&end->tail, 0);
+        atomic_init(&end->overflowed, false);
+        CHECK_EQ(uv_mutex_init(&end->lock), 0);
+    }
+    return ch;
+}
+
+IJVoid ijPortEndRelease(IJJSPortEnd* end) {
+    IJJSChannel* ch = end->channel;
+    IJJSChannelMsg* m;
+    while ((m = end->overflow)) {
+        end->overflow = m->next;
+        ijChannelMsgDrop(m);
+    }
+    end->overflow_tail = NULL;
+    if (atomic_fetch_sub(&ch->refs, 1) != 1)
+        return;
+    for (IJU32 i = 0; i < 2; i++) {
+        IJJSPortEnd* e = &ch->ends[i];
+        size_t head = atomic_load(&e->head);
+        for (size_t t = atomic_load(&e->tail); t != head; t++)
+            ijChannelMsgDrop(e->slots[t % IJJS_CHANNEL_RING_SIZE]);
+        uv_mutex_destroy(&e->lock);
+    }
+    je_free(ch);
+}
+
+IJVoid ijChannelMsgDrop(IJJSChannelMsg* m) {
+    IJU8** tab = m->tab;
+    for (size_t i = 0; i < m->nshared; i++)
+        ijSabFree(NULL, *tab++);
+    for (size_t i = 0; i < m->nbuffers; i++)
+        je_free(*tab++);
+    for (size_t i = 0; i < m->nports; i++)
+        ijPortEndRelease((IJJSPortEnd*)*tab++);
+    je_free(m);
+}
+
+static IJVoid ijPortEndRing(IJJSPortEnd* end) {
+    uv_mutex_lock(&end->lock);
+    if (end->async)
+        uv_async_send(end->async);
+    uv_mutex_unlock(&end->lock);
+}
+
+static IJS32 ijRingPush(IJJSPortEnd* peer, IJJSChannelMsg* m) {
+    size_t head = atomic_load_explicit(&peer->head, memory_order_relaxed);
+    if (head - atomic_load_explicit(&peer->tail, memory_order_acquire) == IJJS_CHANNEL_RING_SIZE)
+        return -1;
+    peer->slots[head % IJJS_CHANNEL_RING_SIZE] = m;
+    atomic_store(&peer->head, head + 1);
+    if (atomic_load(&peer->tail) == head)
+        ijPortEndRing(peer);
+    return 0;
+}
+
+static IJVoid ijPortFlushOverflow(IJJSPortEnd* end) {
+    IJJSPortEnd* peer = &end->channel->ends[!end->side];
+    while (end->overflow) {
+        if (ijRingPush(peer, end->overflow) != 0)
+            return;
+        end->overflow = end->overflow->next;
+    }
+    end->overflow_tail = NULL;
+    atomic_store(&end->overflowed, false);
+}
+
+static IJVoid ijPortSend(IJJSPortEnd* end, IJJSChannelMsg* m) {
+    if (atomic_load(&end->channel->closed)) {
+        ijChannelMsgDrop(m);
+        return;
+    }
+    m->next = NULL;
+    if (!end->overflow && ijRingPush(&end->channel->ends[!end->side], m) == 0)
+        return;
+    if (end->overflow_tail)
+        end->overflow_tail->next = m;
+    else
+        end->overflow = m;
+    end->overflow_tail = m;
+    atomic_store(&end->overflowed, true);
+    ijPortFlushOverflow(end);
+}
+
+IJJSChannelMsg* ijChannelMsgNew(IJJSMessage* msg) {
+    size_t ntab = msg->nshared + msg->nbuffers + msg->nports;
+    IJJSChannelMsg* m = je_malloc(sizeof(*m) + ntab * sizeof(IJU8*) + msg->len);
+    if (!m)
+        return NULL;
+    m->len = msg->len;
+    m->transfer = msg->transfer;
+    m->nshared = msg->nshared;
+    m->nbuffers = msg->nbuffers;
+    m->nports = msg->nports;
+    IJU8** tab = m->tab;
+    for (size_t i = 0; i < msg->nshared; i++)
+        *tab++ = msg->shared[i];
+    for (size_t i = 0; i < msg->nbuffers; i++)
+        *tab++ = msg->buffers[i];
+    for (size_t i = 0; i < msg->nports; i++)
+        *tab++ = (IJU8*)msg->ports[i];
+    m->data = (IJU8*)tab;
+    memcpy(m->data, msg->data, msg->len);
+    return m;
+}
+
+static IJJSPort* ijPortGet(JSContext* ctx, JSValueConst obj) {
+    return JS_GetOpaque2(ctx, obj, ijjs_port_class_id);
+}
+
+static IJVoid uvPortCloseCb(uv_handle_t* handle) {
+    je_free(handle);
+}
+
+static IJVoid ijPortDetach(IJJSPort* p) {
+    if (!p->end)
+        return;
+    uv_mutex_lock(&p->end->lock);
+    p->end->async = NULL;
+    uv_mutex_unlock(&p->end->lock);
+    p->async->data = NULL;
+    uv_close((uv_handle_t*)p->async, uvPortCloseCb);
+    p->async = NULL;
+    p->end = NULL;
+}
+
+static JSValue ijPortEmitJob(JSContext* ctx, IJS32 argc, JSValueConst* argv) {
+    JSValue ret = JS_Call(ctx, argv[0], JS_UNDEFINED, argc - 1, argv + 1);
+    if (JS_IsException(ret))
+        ijDumpError(ctx);
+    JS_FreeValue(ctx, ret);
+    return JS_UNDEFINED;
+}
+
+static IJVoid ijPortEmit(IJJSPort* p, IJS32 event, IJS32 argc, JSValueConst* argv) {
+    JSContext* ctx = p->ctx;
+    JSValue args[3];
+    if (!JS_IsFunction(ctx, p->events[event]))
+        return;
+    args[0] = p->events[event];
+    for (IJS32 i = 0; i < argc; i++)
+        args[i + 1] = argv[i];
+    CHECK_EQ(JS_EnqueueJob(ctx, ijPortEmitJob, argc + 1, (JSValueConst*)args), 0);
+}
+
+static IJVoid ijPortDrain(IJJSPort* p) {
+    JSContext* ctx = p->ctx;
+    IJJSPortEnd* end = p->end;
+    size_t tail = atomic_load_explicit(&end->tail, memory_order_relaxed);
+    IJU32 count = 0;
+    for (;;) {
+        size_t head = atomic_load_explicit(&end->head, memory_order_acquire);
+        while (tail != head && count < IJJS_CHANNEL_DRAIN_MAX) {
+            IJJSChannelMsg* m = end->slots[tail % IJJS_CHANNEL_RING_SIZE];
+            atomic_store_explicit(&end->tail, ++tail, memory_order_release);
+            count++;
+            JSValue ports;
+            JSValue obj = ijChannelMsgRead(ctx, m, &ports);
+            if (JS_IsException(obj)) {
+                obj = JS_GetException(ctx);
+                ijPortEmit(p, PORT_EVENT_MESSAGE_ERROR, 1, (JSValueConst*)&obj);
+            } else {
+                JSValue args[2] = { obj, ports };
+                ijPortEmit(p, PORT_EVENT_MESSAGE, 2, (JSValueConst*)args);
+            }
+            JS_FreeValue(ctx, obj);
+            JS_FreeValue(ctx, ports);
+        }
+        if (count == IJJS_CHANNEL_DRAIN_MAX) {
+            uv_async_send(p->async);
+            break;
+        }
+        atomic_store(&end->tail, tail);
+        if (atomic_load(&end->head) == tail)
+            break;
+    }
+    IJJSPortEnd* peer = &end->channel->ends[!end->side];
+    if (count > 0 && atomic_load(&peer->overflowed))
+        ijPortEndRing(peer);
+}
+
+static IJVoid uvPortAsyncCb(uv_async_t* handle) {
+    IJJSPort* p = handle->data;
+    if (!p || !p->end)
+        return;
+    IJJSPortEnd* end = p->end;
+    ijPortFlushOverflow(end);
+    if (!p->started)
+        return;
+    ijPortDrain(p);
+    if (atomic_load(&end->channel->closed) && atomic_load(&end->head) == atomic_load(&end->tail)) {
+        ijPortDetach(p);
+        ijPortEndRelease(end);
+    }
+}
+
+static JSValue ijNewPortObject(JSContext* ctx, IJJSPortEnd* end) {
+    JSValue obj = JS_NewObjectClass(ctx, ijjs_port_class_id);
+    if (JS_IsException(obj))
+        return obj;
+    IJJSPort* p = js_mallocz(ctx, sizeof(*p));
+    uv_async_t* async = je_malloc(sizeof(*async));
+    if (!p || !async) {
+        js_free(ctx, p);
+        je_free(async);
+        JS_FreeValue(ctx, obj);
+        return JS_EXCEPTION;
+    }
+    CHECK_EQ(uv_async_init(ijGetLoop(ctx), async, uvPortAsyncCb), 0);
+    async->data = p;
+    uv_unref((uv_handle_t*)async);
+    p->ctx = ctx;
+    p->end = end;
+    p->async = async;
+    for (IJS32 i = 0; i < PORT_EVENT_MAX; i++)
+        p->events[i] = JS_UNDEFINED;
+    uv_mutex_lock(&end->lock);
+    end->async = async;
+    uv_mutex_unlock(&end->lock);
+    if (end->overflow)
+        uv_async_send(async);
+    JS_SetOpaque(obj, p);
+    return obj;
+}
+
+JSValue ijNewMessagePort(JSContext* ctx, IJJSPortEnd* end) {
+    JSValue obj = ijNewPortObject(ctx, end);
+    if (JS_IsException(obj))
+        ijPortEndRelease(end);
+    return obj;
+}
+
+static IJVoid ijPortFinalizer(JSRuntime* rt, JSValue val) {
+    IJJSPort* p = JS_GetOpaque(val, ijjs_port_class_id);
+    if (p) {
+        for (IJS32 i = 0; i < PORT_EVENT_MAX; i++)
+            JS_FreeValueRT(rt, p->events[i]);
+        IJJSPortEnd* end = p->end;
+        ijPortDetach(p);
+        if (end)
+            ijPortEndRelease(end);
+        js_free_rt(rt, p);
+    }
+}
+
+static IJVoid ijPortMark(JSRuntime* rt, JSValueConst val, JS_MarkFunc* mark_func) {
+    IJJSPort* p = JS_GetOpaque(val, ijjs_port_class_id);
+    if (p) {
+        for (IJS32 i = 0; i < PORT_EVENT_MAX; i++)
+            JS_MarkValue(rt, p->events[i], mark_func);
+    }
+}
+
+static JSClassDef ijjs_port_class = { "MessagePort", .finalizer = ijPortFinalizer, .gc_mark = ijPortMark };
+
+IJS32 ijMessageWrite(JSContext* ctx, JSValueConst message, JSValueConst transfer, IJJSPortEnd* source, IJJSMessage* msg) {
+    JSValue list;
+    JSValue* items = NULL;
+    IJJSPort** ports = NULL;
+    IJU32 n = 0;
+    IJU32 nitems = 0;
+    IJU32 nports = 0;
+    IJS32 ret = -1;
+    memset(msg, 0, sizeof(*msg));
+    if (JS_IsObject(transfer) && !JS_IsArray(ctx, transfer))
+        list = JS_GetPropertyStr(ctx, transfer, "transfer");
+    else
+        list = JS_DupValue(ctx, transfer);
+    if (JS_IsUndefined(list) || JS_IsNull(list)) {
+        msg->data = JS_WriteObject2(ctx, &msg->len, message, JS_WRITE_OBJ_SAB, &msg->shared, &msg->nshared);
+        if (!msg->data)
+            return -1;
+        goto done;
+    }
+    JSValue jslen = JS_GetPropertyStr(ctx, list, "length");
+    IJS32 r = JS_IsArray(ctx, list) ? JS_ToUint32(ctx, &n, jslen) : -1;
+    JS_FreeValue(ctx, jslen);
+    if (r != 0) {
+        JS_ThrowTypeError(ctx, "transfer must be an array");
+        goto fail;
+    }
+    items = js_mallocz(ctx, (n ? n : 1) * sizeof(*items));
+    ports = js_mallocz(ctx, (n ? n : 1) * sizeof(*ports));
+    if (!items || !ports)
+        goto fail;
+    for (IJU32 i = 0; i < n; i++) {
+        JSValue item = JS_GetPropertyUint32(ctx, list, i);
+        IJJSPort* p = JS_GetOpaque(item, ijjs_port_class_id);
+        if (!p) {
+            items[nitems++] = item;
+            continue;
+        }
+        JS_FreeValue(ctx, item);
+        if (!p->end) {
+            JS_ThrowTypeError(ctx, "MessagePort is closed or was transferred");
+            goto fail;
+        }
+        if (p->end == source) {
+            JS_ThrowTypeError(ctx, "a MessagePort cannot be transferred through itself");
+            goto fail;
+        }
+        for (IJU32 j = 0; j < nports; j++) {
+            if (ports[j] == p) {
+                JS_ThrowTypeError(ctx, "MessagePort is transferred more than once");
+                goto fail;
+            }
+        }
+        ports[nports++] = p;
+    }
+    if (nports > 0) {
+        msg->ports = js_malloc(ctx, nports * sizeof(*msg->ports));
+        if (!msg->ports)
+            goto fail;
+    }
+    msg->data = JS_WriteObjectTransfer(ctx, &msg->len, message, JS_WRITE_OBJ_SAB, &msg->shared, &msg->nshared,
+                                       items, nitems, &msg->buffers, &msg->nbuffers);
+    if (!msg->data) {
+        js_free(ctx, msg->ports);
+        msg->ports = NULL;
+        goto fail;
+    }
+    msg->transfer = true;
+    if (nports > 0) {
+        for (IJU32 i = 0; i < nports; i++) {
+            msg->ports[i] = ports[i]->end;
+            ijPortDetach(ports[i]);
+        }
+        msg->nports = nports;
+    }
+done:
+    for (size_t i = 0; i < msg->nshared; i++)
+        ijSabDup(NULL, msg->shared[i]);
+    ret = 0;
+fail:
+    for (IJU32 i = 0; i < nitems; i++)
+        JS_FreeValue(ctx, items[i]);
+    js_free(ctx, items);
+    js_free(ctx, ports);
+    JS_FreeValue(ctx, list);
+    return ret;
+}
+
+IJVoid ijMessageFree(JSRuntime* rt, IJJSMessage* msg, IJBool delivered) {
+    if (!delivered) {
+        for (size_t i = 0; i < msg->nshared; i++)
+            ijSabFree(NULL, msg->shared[i]);
+        for (size_t i = 0; i < msg->nbuffers; i++)
+            je_free(msg->buffers[i]);
+        for (size_t i = 0; i < msg->nports; i++)
+            ijPortEndRelease(msg->ports[i]);
+    }
+    if (rt) {
+        js_free_rt(rt, msg->data);
+        js_free_rt(rt, msg->shared);
+        js_free_rt(rt, msg->buffers);
+        js_free_rt(rt, msg->ports);
+    } else {
+        /* no runtime left to account to; its allocator is jemalloc */
+        je_free(msg->data);
+        je_free(msg->shared);
+        je_free(msg->buffers);
+        je_free(msg->ports);
+    }
+    memset(msg, 0, sizeof(*msg));
+}
+
+JSValue ijMessageRead(JSContext* ctx, const IJU8* data, size_t len, IJBool transfer,
+                      const IJU8* shared, size_t nshared, const IJU8* ports, size_t nports, JSValue* pports) {
+    IJS32 flags = JS_READ_OBJ_SAB;
+    if (transfer)
+        flags |= JS_READ_OBJ_REFERENCE | JS_READ_OBJ_TRANSFER;
+    JSValue obj = JS_ReadObject(ctx, data, len, flags);
+    for (size_t i = 0; i < nshared; i++) {
+        IJU8* ptr;
+        memcpy(&ptr, shared + i * sizeof(ptr), sizeof(ptr));
+        ijSabFree(NULL, ptr);
+    }
+    *pports = JS_UNDEFINED;
+    if (nports == 0)
+        return obj;
+    JSValue arr = JS_IsException(obj) ? JS_EXCEPTION : JS_NewArray(ctx);
+    for (size_t i = 0; i < nports; i++) {
+        IJJSPortEnd* end;
+        memcpy(&end, ports + i * sizeof(end), sizeof(end));
+        if (JS_IsException(arr)) {
+            ijPortEndRelease(end);
+            continue;
+        }
+        JSValue port = ijNewMessagePort(ctx, end);
+        if (JS_IsException(port)) {
+            JS_FreeValue(ctx, arr);
+            arr = JS_EXCEPTION;
+            continue;
+        }
+        JS_DefinePropertyValueUint32(ctx, arr, i, port, JS_PROP_C_W_E);
+    }
+    if (JS_IsException(arr)) {
+        JS_FreeValue(ctx, obj);
+        return JS_EXCEPTION;
+    }
+    *pports = arr;
+    return obj;
+}
+
+JSValue ijChannelMsgRead(JSContext* ctx, IJJSChannelMsg* m, JSValue* pports) {
+    IJU8** tab = m->tab;
+    JSValue obj = ijMessageRead(ctx, m->data, m->len, m->transfer, (const IJU8*)tab, m->nshared,
+                                (const IJU8*)(tab + m->nshared + m->nbuffers), m->nports, pports);
+    je_free(m);
+    return obj;
+}
+
+static JSValue ijPortPostMessage(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJJSPort* p = ijPortGet(ctx, this_val);
+    if (!p)
+        return JS_EXCEPTION;
+    if (!p->end)
+        return JS_UNDEFINED;
+    IJJSMessage msg;
+    if (ijMessageWrite(ctx, argv[0], argc > 1 ? argv[1] : JS_UNDEFINED, p->end, &msg) != 0)
+        return JS_EXCEPTION;
+    IJJSChannelMsg* m = ijChannelMsgNew(&msg);
+    ijMessageFree(JS_GetRuntime(ctx), &msg, m != NULL);
+    if (!m)
+        return JS_ThrowOutOfMemory(ctx);
+    ijPortSend(p->end, m);
+    return JS_UNDEFINED;
+}
+
+static JSValue ijPortStart(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJJSPort* p = ijPortGet(ctx, this_val);
+    if (!p)
+        return JS_EXCEPTION;
+    if (p->end && !p->started) {
+        p->started = true;
+        uv_ref((uv_handle_t*)p->async);
+        uv_async_send(p->async);
+    }
+    return JS_UNDEFINED;
+}
+
+static JSValue ijPortClose(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJJSPort* p = ijPortGet(ctx, this_val);
+    if (!p)
+        return JS_EXCEPTION;
+    IJJSPortEnd* end = p->end;
+    if (end) {
+        atomic_store(&end->channel->closed, true);
+        ijPortDetach(p);
+        ijPortEndRing(&end->channel->ends[!end->side]);
+        ijPortEndRelease(end);
+    }
+    return JS_UNDEFINED;
+}
+
+static JSValue ijPortEventGet(JSContext* ctx, JSValueConst this_val, IJS32 magic) {
+    IJJSPort* p = ijPortGet(ctx, this_val);
+    if (!p)
+        return JS_EXCEPTION;
+    return JS_DupValue(ctx, p->events[magic]);
+}
+
+static JSValue ijPortEventSet(JSContext* ctx, JSValueConst this_val, JSValueConst value, IJS32 magic) {
+    IJJSPort* p = ijPortGet(ctx, this_val);
+    if (!p)
+        return JS_EXCEPTION;
+    if (JS_IsFunction(ctx, value) || JS_IsUndefined(value) || JS_IsNull(value)) {
+        JS_FreeValue(ctx, p->events[magic]);
+        p->events[magic] = JS_DupValue(ctx, value);
+    }
+    return JS_UNDEFINED;
+}
+
+static JSValue ijNewMessageChannel(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJJSChannel* ch = ijChannelNew();
+    if (!ch)
+        return JS_ThrowOutOfMemory(ctx);
+    JSValue port1 = ijNewMessagePort(ctx, &ch->ends[0]);
+    if (JS_IsException(port1)) {
+        ijPortEndRelease(&ch->ends[1]);
+        return port1;
+    }
+    JSValue port2 = ijNewMessagePort(ctx, &ch->ends[1]);
+    if (JS_IsException(port2)) {
+        JS_FreeValue(ctx, port1);
+        return port2;
+    }
+    JSValue arr = JS_NewArray(ctx);
+    JS_DefinePropertyValueUint32(ctx, arr, 0, port1, JS_PROP_C_W_E);
+    JS_DefinePropertyValueUint32(ctx, arr, 1, port2, JS_PROP_C_W_E);
+    return arr;
+}
+
+static const JSCFunctionListEntry ijjs_port_proto_funcs[] = {
+    JS_CFUNC_DEF("postMessage", 1, ijPortPostMessage),
+    JS_CFUNC_DEF("start", 0, ijPortStart),
+    JS_CFUNC_DEF("close", 0, ijPortClose),
+    JS_CGETSET_MAGIC_DEF("onmessage", ijPortEventGet, ijPortEventSet, PORT_EVENT_MESSAGE),
+    JS_CGETSET_MAGIC_DEF("onmessageerror", ijPortEventGet, ijPortEventSet, PORT_EVENT_MESSAGE_ERROR),
+    JS_PROP_STRING_DEF("[Symbol.toStringTag]", "MessagePort", JS_PROP_CONFIGURABLE),
+};
+
+IJVoid ijModChannelInit(JSContext* ctx, JSModuleDef* m) {
+    JSValue proto;
+    JS_NewClassID(&ijjs_port_class_id);
+    JS_NewClass(JS_GetRuntime(ctx), ijjs_port_class_id, &ijjs_port_class);
+    proto = JS_NewObject(ctx);
+    JS_SetPropertyFunctionList(ctx, proto, ijjs_port_proto_funcs, countof(ijjs_port_proto_funcs));
+    JS_SetClassProto(ctx, ijjs_port_class_id, proto);
+    JS_SetModuleExport(ctx, m, "newMessageChannel", JS_NewCFunction(ctx, ijNewMessageChannel, "newMessageChannel", 0));
+}
+
+IJVoid ijModChannelExport(JSContext* ctx, JSModuleDef* m) {
+    JS_AddModuleExport(ctx, m, "newMessageChannel");
+}
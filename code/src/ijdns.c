@@ -23,10 +23,18 @@
 
 #include <string.h>
 
+// libuv's IDNA 2008 / Punycode encoder, uv_getaddrinfo() runs it on every
+// host name and the lane worker calls getaddrinfo() directly.
+long uv__idna_toascii(const IJAnsi* s, const IJAnsi* se, IJAnsi* d, IJAnsi* de);
 
 typedef struct {
     JSContext* ctx;
-    uv_getaddrinfo_t req;
+    IJJSWork req;
+    IJAnsi* node;
+    IJAnsi* service;
+    struct addrinfo hints;
+    struct addrinfo* res;
+    IJS32 r;
     IJJSPromise result;
 } IJJSGetAddrInfoReq;
 
@@ -67,43 +75,110 @@ static IJVoid ijObj2AddrInfo(JSContext* ctx, JSValue obj, struct addrinfo* ai) {
     JS_FreeValue(ctx, flags);
 }
 
-static IJVoid uvGetAddrInfoCb(uv_getaddrinfo_t* req, IJS32 status, struct addrinfo* res) {
+static IJS32 ijTranslateEaiError(IJS32 r) {
+    switch (r) {
+        case 0:
+            return 0;
+#ifdef EAI_ADDRFAMILY
+        case EAI_ADDRFAMILY:
+            return UV_EAI_ADDRFAMILY;
+#endif
+        case EAI_AGAIN:
+            return UV_EAI_AGAIN;
+        case EAI_BADFLAGS:
+            return UV_EAI_BADFLAGS;
+        case EAI_FAIL:
+            return UV_EAI_FAIL;
+        case EAI_FAMILY:
+            return UV_EAI_FAMILY;
+        case EAI_MEMORY:
+            return UV_EAI_MEMORY;
+#if defined(EAI_NODATA) && EAI_NODATA != EAI_NONAME
+        case EAI_NODATA:
+            return UV_EAI_NODATA;
+#endif
+        case EAI_NONAME:
+            return UV_EAI_NONAME;
+#ifdef EAI_OVERFLOW
+        case EAI_OVERFLOW:
+            return UV_EAI_OVERFLOW;
+#endif
+        case EAI_SERVICE:
+            return UV_EAI_SERVICE;
+        case EAI_SOCKTYPE:
+            return UV_EAI_SOCKTYPE;
+#ifdef EAI_SYSTEM
+        case EAI_SYSTEM:
+            return -errno;
+#endif
+        default:
+            return UV_EAI_FAIL;
+    }
+}
+
+static IJVoid ijGetAddrInfoWorkCb(IJJSWork* req) {
+    IJJSGetAddrInfoReq* gr = req->data;
+    gr->r = ijTranslateEaiError(getaddrinfo(gr->node, gr->service, &gr->hints, &gr->res));
+}
+
+static IJVoid ijGetAddrInfoAfterWorkCb(IJJSWork* req, IJS32 status) {
     IJJSGetAddrInfoReq* gr = req->data;
     CHECK_NOT_NULL(gr);
     JSContext* ctx = gr->ctx;
     JSValue arg;
-    IJBool is_reject = status != 0;
-    if (status != 0)
-        arg = ijNewError(ctx, status);
+    IJBool is_reject = gr->r != 0;
+    if (gr->r != 0)
+        arg = ijNewError(ctx, gr->r);
     else
-        arg = ijAddrInfo2Obj(ctx, res);
+        arg = ijAddrInfo2Obj(ctx, gr->res);
     ijSettlePromise(ctx, &gr->result, is_reject, 1, (JSValueConst *) &arg);
-    uv_freeaddrinfo(res);
+    if (gr->res)
+        freeaddrinfo(gr->res);
+    js_free(ctx, gr->node);
+    js_free(ctx, gr->service);
     js_free(ctx, gr);
 }
 
 static JSValue ijDnsGetAddrInfo(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
-    const IJAnsi* service = NULL;
     const IJAnsi* node = JS_ToCString(ctx, argv[0]);
     if (!node)
         return JS_EXCEPTION;
-    IJJSGetAddrInfoReq* gr = js_malloc(ctx, sizeof(*gr));
-    if (!gr)
+    IJJSGetAddrInfoReq* gr = js_mallocz(ctx, sizeof(*gr));
+    if (!gr) {
+        JS_FreeCString(ctx, node);
         return JS_EXCEPTION;
+    }
     gr->ctx = ctx;
     gr->req.data = gr;
-    struct addrinfo hints;
-    memset(&hints, 0, sizeof(hints));
+    IJAnsi node_ascii[256];
+    long rc = uv__idna_toascii(node, node + strlen(node), node_ascii, node_ascii + sizeof(node_ascii));
+    JS_FreeCString(ctx, node);
+    // The encoder stops writing once the buffer is full, the terminator is
+    // only there when the whole name fit.
+    if (rc >= 0 && (rc == 0 || node_ascii[rc - 1] != '\0'))
+        rc = UV_E2BIG;
+    if (rc < 0) {
+        js_free(ctx, gr);
+        return ijThrowErrno(ctx, (IJS32)rc);
+    }
+    gr->node = js_strdup(ctx, node_ascii);
     JSValue opts = argv[1];
     if (JS_IsObject(opts)) {
-        ijObj2AddrInfo(ctx, opts, &hints);
+        ijObj2AddrInfo(ctx, opts, &gr->hints);
         JSValue js_service = JS_GetPropertyStr(ctx, opts, "service");
-        if (!JS_IsUndefined(js_service))
-            service = JS_ToCString(ctx, js_service);
+        if (!JS_IsUndefined(js_service)) {
+            const IJAnsi* service = JS_ToCString(ctx, js_service);
+            if (service) {
+                gr->service = js_strdup(ctx, service);
+                JS_FreeCString(ctx, service);
+            }
+        }
         JS_FreeValue(ctx, js_service);
     }
-    IJS32 r = uv_getaddrinfo(ijGetLoop(ctx), &gr->req, uvGetAddrInfoCb, node, service, &hints);
+    IJS32 r = gr->node ? ijQueueWork(ctx, IJJS_LANE_DNS, &gr->req, ijGetAddrInfoWorkCb, ijGetAddrInfoAfterWorkCb) : UV_ENOMEM;
     if (r != 0) {
+        js_free(ctx, gr->node);
+        js_free(ctx, gr->service);
         js_free(ctx, gr);
         return ijThrowErrno(ctx, r);
     }
@@ -0,0 +1,214 @@
+/*
+ ijjs javascript runtime engine
+ Copyright (C) 2010-2017 Trix
+
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include "ijjs.h"
+
+#define IJJS_LANE_MAX_THREADS 128
+
+typedef struct {
+    const IJAnsi* name;
+    uv_mutex_t lock;
+    uv_cond_t cond;
+    struct list_head queue;
+    uv_thread_t* threads;
+    IJU32 nthreads;
+    IJBool started;
+    IJU32 queued;
+    IJU32 max_queued;
+    IJU32 busy;
+    IJU64 submitted;
+    IJU64 completed;
+    IJU64 wait_ns;
+    IJU64 max_wait_ns;
+    IJU64 run_ns;
+} IJJSLane;
+
+static IJJSLane ijjs_lanes[IJJS_LANE_COUNT];
+static uv_once_t ijjs_lanes_once = UV_ONCE_INIT;
+static const IJAnsi* ijjs_lane_names[IJJS_LANE_COUNT] = { "fs", "db", "cpu", "dns" };
+
+static IJU32 ijLaneDefaultThreads(IJS32 lane) {
+    uv_cpu_info_t* infos;
+    IJS32 count;
+    switch (lane) {
+        case IJJS_LANE_CPU:
+            if (uv_cpu_info(&infos, &count) != 0)
+                return 1;
+            uv_free_cpu_info(infos, count);
+            return count > 0 ? count : 1;
+        case IJJS_LANE_DNS:
+            return 2;
+        default:
+            return 4;
+    }
+}
+
+static IJVoid ijLanesInit(IJVoid) {
+    for (IJS32 i = 0; i < IJJS_LANE_COUNT; i++) {
+        IJJSLane* lane = &ijjs_lanes[i];
+        lane->name = ijjs_lane_names[i];
+        lane->nthreads = ijLaneDefaultThreads(i);
+        CHECK_EQ(uv_mutex_init(&lane->lock), 0);
+        CHECK_EQ(uv_cond_init(&lane->cond), 0);
+        init_list_head(&lane->queue);
+    }
+}
+
+IJS32 ijLaneFromName(const IJAnsi* name, size_t len) {
+    for (IJS32 i = 0; i < IJJS_LANE_COUNT; i++) {
+        if (strlen(ijjs_lane_names[i]) == len && !strncmp(ijjs_lane_names[i], name, len))
+            return i;
+    }
+    return -1;
+}
+
+IJVoid ijExecConfigure(const IJU32* threads) {
+    uv_once(&ijjs_lanes_once, ijLanesInit);
+    for (IJS32 i = 0; i < IJJS_LANE_COUNT; i++) {
+        IJJSLane* lane = &ijjs_lanes[i];
+        if (threads[i] == 0)
+            continue;
+        uv_mutex_lock(&lane->lock);
+        if (!lane->started)
+            lane->nthreads = threads[i] < IJJS_LANE_MAX_THREADS ? threads[i] : IJJS_LANE_MAX_THREADS;
+        uv_mutex_unlock(&lane->lock);
+    }
+}
+
+static IJVoid ijLaneThread(IJVoid* arg) {
+    IJJSLane* lane = arg;
+    uv_mutex_lock(&lane->lock);
+    for (;;) {
+        while (list_empty(&lane->queue))
+            uv_cond_wait(&lane->cond, &lane->lock);
+        IJJSWork* w = list_entry(lane->queue.next, IJJSWork, link);
+        list_del(&w->link);
+        lane->queued--;
+        lane->busy++;
+        IJU64 start = uv_hrtime();
+        IJU64 wait = start - w->queued_at;
+        lane->wait_ns += wait;
+        if (wait > lane->max_wait_ns)
+            lane->max_wait_ns = wait;
+        uv_mutex_unlock(&lane->lock);
+        w->work_cb(w);
+        IJU64 end = uv_hrtime();
+        IJJSRuntime* qrt = w->qrt;
+        uv_mutex_lock(&qrt->exec.lock);
+        list_add_tail(&w->link, &qrt->exec.done);
+        uv_mutex_unlock(&qrt->exec.lock);
+        uv_async_send(&qrt->exec.async);
+        uv_mutex_lock(&lane->lock);
+        lane->busy--;
+        lane->completed++;
+        lane->run_ns += end - start;
+    }
+}
+
+static IJS32 ijLaneStart(IJJSLane* lane) {
+    lane->threads = je_calloc(lane->nthreads, sizeof(*lane->threads));
+    if (!lane->threads)
+        return UV_ENOMEM;
+    for (IJU32 i = 0; i < lane->nthreads; i++)
+        CHECK_EQ(uv_thread_create(&lane->threads[i], ijLaneThread, lane), 0);
+    lane->started = true;
+    return 0;
+}
+
+static IJVoid uvExecDoneCb(uv_async_t* handle) {
+    IJJSRuntime* qrt = handle->data;
+    struct list_head done;
+    struct list_head *el, *el1;
+    init_list_head(&done);
+    uv_mutex_lock(&qrt->exec.lock);
+    list_for_each_safe(el, el1, &qrt->exec.done) {
+        list_del(el);
+        list_add_tail(el, &done);
+    }
+    uv_mutex_unlock(&qrt->exec.lock);
+    list_for_each_safe(el, el1, &done) {
+        IJJSWork* w = list_entry(el, IJJSWork, link);
+        list_del(el);
+        if (--qrt->exec.pending == 0)
+            uv_unref((uv_handle_t*)&qrt->exec.async);
+        w->after_work_cb(w, 0);
+    }
+}
+
+IJVoid ijExecInit(IJJSRuntime* qrt) {
+    uv_once(&ijjs_lanes_once, ijLanesInit);
+    CHECK_EQ(uv_mutex_init(&qrt->exec.lock), 0);
+    init_list_head(&qrt->exec.done);
+    qrt->exec.pending = 0;
+    CHECK_EQ(uv_async_init(&qrt->loop, &qrt->exec.async, uvExecDoneCb), 0);
+    qrt->exec.async.data = qrt;
+    uv_unref((uv_handle_t*)&qrt->exec.async);
+}
+
+IJVoid ijExecFree(IJJSRuntime* qrt) {
+    uv_close((uv_handle_t*)&qrt->exec.async, NULL);
+}
+
+IJS32 ijQueueWork(JSContext* ctx, IJS32 lane_id, IJJSWork* w, IJJSWorkCb work_cb, IJJSAfterWorkCb after_work_cb) {
+    if (lane_id < 0 || lane_id >= IJJS_LANE_COUNT || !work_cb || !after_work_cb)
+        return UV_EINVAL;
+    IJJSRuntime* qrt = ijGetRuntime(ctx);
+    IJJSLane* lane = &ijjs_lanes[lane_id];
+    w->qrt = qrt;
+    w->lane = lane_id;
+    w->work_cb = work_cb;
+    w->after_work_cb = after_work_cb;
+    uv_mutex_lock(&lane->lock);
+    if (!lane->started) {
+        IJS32 r = ijLaneStart(lane);
+        if (r != 0) {
+            uv_mutex_unlock(&lane->lock);
+            return r;
+        }
+    }
+    w->queued_at = uv_hrtime();
+    list_add_tail(&w->link, &lane->queue);
+    lane->submitted++;
+    if (++lane->queued > lane->max_queued)
+        lane->max_queued = lane->queued;
+    uv_cond_signal(&lane->cond);
+    uv_mutex_unlock(&lane->lock);
+    if (qrt->exec.pending++ == 0)
+        uv_ref((uv_handle_t*)&qrt->exec.async);
+    return 0;
+}
+
+IJVoid ijExecStats(IJS32 lane_id, IJJSLaneStats* stats) {
+    uv_once(&ijjs_lanes_once, ijLanesInit);
+    IJJSLane* lane = &ijjs_lanes[lane_id];
+    uv_mutex_lock(&lane->lock);
+    stats->name = lane->name;
+    stats->threads = lane->nthreads;
+    stats->queued = lane->queued;
+    stats->max_queued = lane->max_queued;
+    stats->busy = lane->busy;
+    stats->submitted = lane->submitted;
+    stats->completed = lane->completed;
+    stats->wait_ns = lane->wait_ns;
+    stats->max_wait_ns = lane->max_wait_ns;
+    stats->run_ns = lane->run_ns;
+    uv_mutex_unlock(&lane->lock);
+}
@@ -20,6 +20,11 @@
  */
 
 #include "ijjs.h"
+#if IJJS_PLATFORM != IJJS_PLATFORM_WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
 
 
 static JSClassID ijjs_file_class_id;
@@ -28,6 +33,8 @@ typedef struct {
     JSContext* ctx;
     uv_file fd;
     JSValue path;
+    IJU32 busy;
+    struct IJJSFsReq* closing;
 } IJJSFile;
 
 static IJVoid ijFileFinalizer(JSRuntime* rt, JSValue val) {
@@ -45,13 +52,33 @@ static IJVoid ijFileFinalizer(JSRuntime* rt, JSValue val) {
 
 static JSClassDef ijjs_file_class = { "File", .finalizer = ijFileFinalizer };
 
+uv_file ijFileGetFd(JSValueConst obj) {
+    IJJSFile* f = JS_GetOpaque(obj, ijjs_file_class_id);
+    return f ? f->fd : -1;
+}
+
 static JSClassID ijjs_dir_class_id;
 
+#define IJJS_DIR_DEFAULT_BATCH 32
+#define IJJS_DIR_MAX_BATCH 4096
+
+typedef struct {
+    IJS32 r;
+    uv_stat_t st;
+} IJJSDirStat;
+
 typedef struct {
     JSContext* ctx;
     uv_dir_t* dir;
-    uv_dirent_t dirent;
+    uv_dirent_t* dirents;
+    IJJSDirStat* stats;
+    IJU32 batch;
+    IJAnsi* cpath;
     JSValue path;
+    JSValue pending;
+    IJU32 pending_pos;
+    IJU32 pending_len;
+    IJBool busy;
     IJBool done;
 } IJJSDir;
 
@@ -64,13 +91,23 @@ static IJVoid ijDirFinalizer(JSRuntime* rt, JSValue val) {
             uv_fs_req_cleanup(&req);
         }
         JS_FreeValueRT(rt, d->path);
+        JS_FreeValueRT(rt, d->pending);
+        js_free_rt(rt, d->dirents);
+        js_free_rt(rt, d->stats);
+        js_free_rt(rt, d->cpath);
         js_free_rt(rt, d);
     }
 }
 
-static JSClassDef ijjs_dir_class = { "Directory", .finalizer = ijDirFinalizer };
+static IJVoid ijDirMark(JSRuntime* rt, JSValueConst val, JS_MarkFunc* mark_func) {
+    IJJSDir* d = JS_GetOpaque(val, ijjs_dir_class_id);
+    if (d)
+        JS_MarkValue(rt, d->pending, mark_func);
+}
+
+static JSClassDef ijjs_dir_class = { "Directory", .finalizer = ijDirFinalizer, .gc_mark = ijDirMark };
 
-typedef struct {
+typedef struct IJJSFsReq {
     uv_fs_t req;
     JSContext* ctx;
     JSValue obj;
@@ -88,11 +125,31 @@ typedef struct {
 } IJJSFsWriteReq;
 
 typedef struct {
-    uv_work_t req;
+    IJJSFsReq base;
+    IJU32 batch;
+    IJBool with_stats;
+} IJJSFsOpenDirReq;
+
+typedef struct {
+    IJJSWork req;
+    uv_fs_t fs;
+    JSContext* ctx;
+    JSValue obj;
+    IJJSDir* d;
+    IJS32 r;
+    IJBool flatten;
+    IJJSPromise result;
+} IJJSDirReadReq;
+
+typedef struct {
+    IJJSWork req;
     DynBuf dbuf;
     JSContext* ctx;
     IJS32 r;
     IJAnsi* filename;
+    IJBool use_mmap;
+    IJVoid* map;
+    size_t map_len;
     IJJSPromise result;
 } IJJSReadFileReq;
 
@@ -141,6 +198,8 @@ static JSValue ijNewFile(JSContext* ctx, uv_file fd, const IJAnsi* path) {
     f->path = JS_NewString(ctx, path);
     f->ctx = ctx;
     f->fd = fd;
+    f->busy = 0;
+    f->closing = NULL;
     JS_SetOpaque(obj, f);
     return obj;
 }
@@ -149,23 +208,39 @@ static IJJSFile* ijFileGet(JSContext* ctx, JSValueConst obj) {
     return JS_GetOpaque2(ctx, obj, ijjs_file_class_id);
 }
 
-static JSValue ijNewDir(JSContext* ctx, uv_dir_t* dir, const IJAnsi* path) {
+static JSValue ijNewDir(JSContext* ctx, uv_dir_t* dir, const IJAnsi* path, IJU32 batch, IJBool with_stats) {
     IJJSDir* d;
     JSValue obj;
     obj = JS_NewObjectClass(ctx, ijjs_dir_class_id);
     if (JS_IsException(obj))
-        return obj;
-    d = js_malloc(ctx, sizeof(*d));
+        goto fail;
+    d = js_mallocz(ctx, sizeof(*d));
     if (!d) {
         JS_FreeValue(ctx, obj);
-        return JS_EXCEPTION;
+        goto fail;
     }
     d->path = JS_NewString(ctx, path);
+    d->pending = JS_UNDEFINED;
     d->ctx = ctx;
     d->dir = dir;
-    d->done = false;
+    d->batch = batch;
     JS_SetOpaque(obj, d);
+    d->dirents = js_malloc(ctx, batch * sizeof(*d->dirents));
+    d->cpath = js_strdup(ctx, path);
+    if (with_stats)
+        d->stats = js_malloc(ctx, batch * sizeof(*d->stats));
+    if (!d->dirents || !d->cpath || (with_stats && !d->stats)) {
+        JS_FreeValue(ctx, obj);
+        return JS_EXCEPTION;
+    }
     return obj;
+fail:
+    {
+        uv_fs_t req;
+        uv_fs_closedir(NULL, &req, dir, NULL);
+        uv_fs_req_cleanup(&req);
+    }
+    return JS_EXCEPTION;
 }
 
 static IJJSDir* ijDirGet(JSContext* ctx, JSValueConst obj) {
@@ -225,6 +300,8 @@ static IJVoid uvFsReqCb(uv_fs_t* req) {
         case UV_FS_REALPATH:
             arg = JS_NewString(ctx, fr->req.ptr);
             break;
+        case UV_FS_FSYNC:
+        case UV_FS_FDATASYNC:
         case UV_FS_COPYFILE:
         case UV_FS_RENAME:
         case UV_FS_RMDIR:
@@ -237,9 +314,15 @@ static IJVoid uvFsReqCb(uv_fs_t* req) {
         case UV_FS_MKSTEMP:
             arg = ijNewFile(ctx, fr->req.result, fr->req.path);
             break;
-        case UV_FS_OPENDIR:
-            arg = ijNewDir(ctx, fr->req.ptr, fr->req.path);
+        case UV_FS_OPENDIR: {
+            IJJSFsOpenDirReq* dr = (IJJSFsOpenDirReq*)fr;
+            arg = ijNewDir(ctx, fr->req.ptr, fr->req.path, dr->batch, dr->with_stats);
+            if (JS_IsException(arg)) {
+                arg = JS_GetException(ctx);
+                is_reject = true;
+            }
             break;
+        }
         case UV_FS_CLOSEDIR:
             arg = JS_UNDEFINED;
             d = ijDirGet(ctx, fr->obj);
@@ -248,18 +331,6 @@ static IJVoid uvFsReqCb(uv_fs_t* req) {
             JS_FreeValue(ctx, d->path);
             d->path = JS_UNDEFINED;
             break;
-        case UV_FS_READDIR:
-            d = ijDirGet(ctx, fr->obj);
-            d->done = fr->req.result == 0;
-            arg = JS_NewObjectProto(ctx, JS_NULL);
-            JS_DefinePropertyValueStr(ctx, arg, "done", JS_NewBool(ctx, d->done), JS_PROP_C_W_E);
-            if (fr->req.result != 0) {
-                JSValue item = JS_NewObjectProto(ctx, JS_NULL);
-                JS_DefinePropertyValueStr(ctx, item, "name", JS_NewString(ctx, d->dirent.name), JS_PROP_C_W_E);
-                JS_DefinePropertyValueStr(ctx, item, "type", JS_NewInt32(ctx, d->dirent.type), JS_PROP_C_W_E);
-                JS_DefinePropertyValueStr(ctx, arg, "value", item, JS_PROP_C_W_E);
-            }
-            break;
         default:
             abort();
     }
@@ -270,6 +341,36 @@ skip:
     js_free(ctx, fr);
 }
 
+static IJVoid ijFileUnbusy(IJJSFile* f) {
+    if (--f->busy > 0 || !f->closing)
+        return;
+    IJJSFsReq* fr = f->closing;
+    f->closing = NULL;
+    IJS32 r = ijUringClose(f->ctx, &fr->req, f->fd, uvFsReqCb);
+    if (r != 0) {
+        fr->req.result = r;
+        uvFsReqCb(&fr->req);
+    }
+}
+
+// Lend the fd of a File to native code, close() waits for ijFileRelease().
+IJS32 ijFileAcquire(JSValueConst obj, uv_file* fd) {
+    IJJSFile* f = JS_GetOpaque(obj, ijjs_file_class_id);
+    if (!f)
+        return UV_EINVAL;
+    if (f->fd == -1 || f->closing)
+        return UV_EBADF;
+    f->busy++;
+    *fd = f->fd;
+    return 0;
+}
+
+IJVoid ijFileRelease(JSValueConst obj) {
+    IJJSFile* f = JS_GetOpaque(obj, ijjs_file_class_id);
+    if (f)
+        ijFileUnbusy(f);
+}
+
 static JSValue ijFileRead(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
     IJJSFile* f = ijFileGet(ctx, this_val);
     if (!f)
@@ -290,7 +391,7 @@ static JSValue ijFileRead(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSV
     }
     IJJSFsReq* fr = (IJJSFsReq*)&rr->base;
     uv_buf_t b = uv_buf_init(rr->buf, len);
-    IJS32 r = uv_fs_read(ijGetLoop(ctx), &fr->req, f->fd, &b, 1, pos, uvFsReqCb);
+    IJS32 r = ijUringRead(ctx, &fr->req, f->fd, &b, 1, pos, uvFsReqCb);
     if (r != 0) {
         js_free(ctx, rr->buf);
         js_free(ctx, rr);
@@ -342,7 +443,7 @@ static JSValue ijFileWrite(JSContext* ctx, JSValueConst this_val, IJS32 argc, JS
         JS_FreeCString(ctx, buf);
     IJJSFsReq* fr = (IJJSFsReq*)&wr->base;
     uv_buf_t b = uv_buf_init(wr->data, size);
-    IJS32 r = uv_fs_write(ijGetLoop(ctx), &fr->req, f->fd, &b, 1, pos, uvFsReqCb);
+    IJS32 r = ijUringWrite(ctx, &fr->req, f->fd, &b, 1, pos, uvFsReqCb);
     if (r != 0) {
         js_free(ctx, wr);
         return ijThrowErrno(ctx, r);
@@ -351,14 +452,99 @@ static JSValue ijFileWrite(JSContext* ctx, JSValueConst this_val, IJS32 argc, JS
     return fr->result.p;
 }
 
+typedef struct {
+    uv_fs_t req;
+    JSContext* ctx;
+    JSValue obj;
+    IJJSFile* f;
+    IJS32 nbufs;
+    uv_buf_t* bufs;
+    IJJSPromise result;
+    IJJSWriteBuf pins[];
+} IJJSFileVecReq;
+
+static IJVoid uvFileVecCb(uv_fs_t* req) {
+    IJJSFileVecReq* vr = req->data;
+    JSContext* ctx = vr->ctx;
+    IJBool is_reject = req->result < 0;
+    JSValue arg = is_reject ? ijNewError(ctx, req->result) : JS_NewInt64(ctx, req->result);
+    uv_fs_req_cleanup(req);
+    ijFileUnbusy(vr->f);
+    ijSettlePromise(ctx, &vr->result, is_reject, 1, (JSValueConst*)&arg);
+    ijStreamReleaseBufs(ctx, vr->pins, vr->nbufs);
+    JS_FreeValue(ctx, vr->obj);
+    js_free(ctx, vr);
+}
+
+static JSValue ijFileVec(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv, IJS32 magic) {
+    IJJSFile* f = ijFileGet(ctx, this_val);
+    if (!f)
+        return JS_EXCEPTION;
+    if (f->closing)
+        return ijThrowErrno(ctx, UV_EBADF);
+    IJS64 pos = -1;
+    if (!JS_IsUndefined(argv[1]) && JS_ToInt64(ctx, &pos, argv[1]))
+        return JS_EXCEPTION;
+    IJU32 n;
+    JSValue v = JS_GetPropertyStr(ctx, argv[0], "length");
+    IJS32 r = JS_ToUint32(ctx, &n, v);
+    JS_FreeValue(ctx, v);
+    if (r)
+        return JS_EXCEPTION;
+    if (n == 0 || n > INT32_MAX / sizeof(IJJSWriteBuf))
+        return ijThrowErrno(ctx, UV_EINVAL);
+    IJJSFileVecReq* vr = js_mallocz(ctx, sizeof(*vr) + n * (sizeof(IJJSWriteBuf) + sizeof(uv_buf_t)));
+    if (!vr)
+        return JS_EXCEPTION;
+    vr->bufs = (uv_buf_t*)&vr->pins[n];
+    for (IJU32 i = 0; i < n; i++) {
+        v = JS_GetPropertyUint32(ctx, argv[0], i);
+        if (magic && JS_IsString(v)) {
+            JS_FreeValue(ctx, v);
+            JS_ThrowTypeError(ctx, "readv() needs typed arrays");
+            goto fail;
+        }
+        r = ijStreamGetData(ctx, v, &vr->bufs[i], &vr->pins[i]);
+        JS_FreeValue(ctx, v);
+        if (r)
+            goto fail;
+        vr->nbufs++;
+    }
+    vr->ctx = ctx;
+    vr->f = f;
+    vr->req.data = vr;
+    if (magic)
+        r = ijUringRead(ctx, &vr->req, f->fd, vr->bufs, n, pos, uvFileVecCb);
+    else
+        r = ijUringWrite(ctx, &vr->req, f->fd, vr->bufs, n, pos, uvFileVecCb);
+    if (r != 0) {
+        ijStreamReleaseBufs(ctx, vr->pins, vr->nbufs);
+        js_free(ctx, vr);
+        return ijThrowErrno(ctx, r);
+    }
+    f->busy++;
+    vr->obj = JS_DupValue(ctx, this_val);
+    return ijInitPromise(ctx, &vr->result);
+fail:
+    ijStreamReleaseBufs(ctx, vr->pins, vr->nbufs);
+    js_free(ctx, vr);
+    return JS_EXCEPTION;
+}
+
 static JSValue ijFileClose(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
     IJJSFile* f = ijFileGet(ctx, this_val);
     if (!f)
         return JS_EXCEPTION;
-    IJJSFsReq* fr = js_malloc(ctx, sizeof(*fr));
+    if (f->closing)
+        return ijThrowErrno(ctx, UV_EBUSY);
+    IJJSFsReq* fr = js_mallocz(ctx, sizeof(*fr));
     if (!fr)
         return JS_EXCEPTION;
-    IJS32 r = uv_fs_close(ijGetLoop(ctx), &fr->req, f->fd, uvFsReqCb);
+    if (f->busy > 0) {
+        f->closing = fr;
+        return ijFsReqInit(ctx, fr, this_val);
+    }
+    IJS32 r = ijUringClose(ctx, &fr->req, f->fd, uvFsReqCb);
     if (r != 0) {
         js_free(ctx, fr);
         return ijThrowErrno(ctx, r);
@@ -373,7 +559,22 @@ static JSValue ijFileStat(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSV
     IJJSFsReq* fr = js_malloc(ctx, sizeof(*fr));
     if (!fr)
         return JS_EXCEPTION;
-    IJS32 r = uv_fs_fstat(ijGetLoop(ctx), &fr->req, f->fd, uvFsReqCb);
+    IJS32 r = ijUringFstat(ctx, &fr->req, f->fd, uvFsReqCb);
+    if (r != 0) {
+        js_free(ctx, fr);
+        return ijThrowErrno(ctx, r);
+    }
+    return ijFsReqInit(ctx, fr, this_val);
+}
+
+static JSValue ijFileSync(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv, IJS32 magic) {
+    IJJSFile* f = ijFileGet(ctx, this_val);
+    if (!f)
+        return JS_EXCEPTION;
+    IJJSFsReq* fr = js_malloc(ctx, sizeof(*fr));
+    if (!fr)
+        return JS_EXCEPTION;
+    IJS32 r = ijUringFsync(ctx, &fr->req, f->fd, magic, uvFsReqCb);
     if (r != 0) {
         js_free(ctx, fr);
         return ijThrowErrno(ctx, r);
@@ -388,6 +589,180 @@ static JSValue ijFileFileno(JSContext* ctx, JSValueConst this_val, IJS32 argc, J
     return JS_NewInt32(ctx, f->fd);
 }
 
+typedef struct {
+    uv_fs_t req;
+    uv_write_t flush;
+    uv_poll_t poll;
+    JSContext* ctx;
+    JSValue objs[2];
+    JSValue progress;
+    IJJSFile* f;
+    uv_stream_t* stream;
+    uv_file in_fd;
+    uv_file out_fd;
+    IJS64 offset;
+    IJU64 remaining;
+    IJU64 sent;
+    IJS32 error;
+    IJJSPromise result;
+} IJJSSendFileReq;
+
+#if IJJS_PLATFORM != IJJS_PLATFORM_WIN32
+static IJVoid uvSendFilePollCloseCb(uv_handle_t* handle) {
+    IJJSSendFileReq* sr = handle->data;
+    JSContext* ctx = sr->ctx;
+    close(sr->out_fd);
+    ijStreamReleaseWriter(sr->stream);
+    ijFileUnbusy(sr->f);
+    JSValue arg;
+    IJBool is_reject = sr->error != 0;
+    if (is_reject)
+        arg = ijNewError(ctx, sr->error);
+    else
+        arg = JS_NewInt64(ctx, sr->sent);
+    ijSettlePromise(ctx, &sr->result, is_reject, 1, (JSValueConst*)&arg);
+    JS_FreeValue(ctx, sr->objs[0]);
+    JS_FreeValue(ctx, sr->objs[1]);
+    JS_FreeValue(ctx, sr->progress);
+    js_free(ctx, sr);
+}
+
+static IJVoid ijSendFileProgress(IJJSSendFileReq* sr) {
+    if (JS_IsUndefined(sr->progress))
+        return;
+    JSContext* ctx = sr->ctx;
+    JSValue arg = JS_NewInt64(ctx, sr->sent);
+    JSValue ret = JS_Call(ctx, sr->progress, JS_UNDEFINED, 1, (JSValueConst*)&arg);
+    if (JS_IsException(ret))
+        ijDumpError(ctx);
+    JS_FreeValue(ctx, ret);
+}
+
+static IJVoid ijSendFileFinish(IJJSSendFileReq* sr, IJS32 error) {
+    sr->error = error;
+    uv_close((uv_handle_t*)&sr->poll, uvSendFilePollCloseCb);
+}
+
+static IJVoid uvSendFileCb(uv_fs_t* req);
+
+static IJVoid ijSendFileNext(IJJSSendFileReq* sr) {
+    if (sr->remaining == 0) {
+        ijSendFileFinish(sr, 0);
+        return;
+    }
+    size_t len = sr->remaining < IJJS_DEFAULT_HIGH_WATER_MARK ? sr->remaining : IJJS_DEFAULT_HIGH_WATER_MARK;
+    IJS32 r = uv_fs_sendfile(ijGetLoop(sr->ctx), &sr->req, sr->out_fd, sr->in_fd, sr->offset, len, uvSendFileCb);
+    if (r != 0)
+        ijSendFileFinish(sr, r);
+}
+
+static IJVoid uvSendFilePollCb(uv_poll_t* handle, IJS32 status, IJS32 events) {
+    IJJSSendFileReq* sr = handle->data;
+    uv_poll_stop(handle);
+    if (status < 0)
+        ijSendFileFinish(sr, status);
+    else
+        ijSendFileNext(sr);
+}
+
+static IJVoid uvSendFileCb(uv_fs_t* req) {
+    IJJSSendFileReq* sr = req->data;
+    ssize_t r = req->result;
+    uv_fs_req_cleanup(req);
+    if (r == UV_EAGAIN) {
+        uv_poll_start(&sr->poll, UV_WRITABLE, uvSendFilePollCb);
+    } else if (r < 0) {
+        ijSendFileFinish(sr, r);
+    } else if (r == 0) {
+        ijSendFileFinish(sr, 0);
+    } else {
+        sr->sent += r;
+        sr->offset += r;
+        sr->remaining -= r;
+        ijSendFileProgress(sr);
+        ijSendFileNext(sr);
+    }
+}
+
+static IJVoid uvSendFileFlushCb(uv_write_t* req, IJS32 status) {
+    IJJSSendFileReq* sr = req->data;
+    if (status < 0)
+        ijSendFileFinish(sr, status);
+    else
+        ijSendFileNext(sr);
+}
+#endif
+
+static JSValue ijFileSendTo(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJJSFile* f = ijFileGet(ctx, this_val);
+    if (!f)
+        return JS_EXCEPTION;
+    IJS64 offset = 0;
+    if (!JS_IsUndefined(argv[1]) && JS_ToInt64(ctx, &offset, argv[1]))
+        return JS_EXCEPTION;
+    IJU64 length = UINT64_MAX;
+    if (!JS_IsUndefined(argv[2]) && JS_ToIndex(ctx, &length, argv[2]))
+        return JS_EXCEPTION;
+    if (offset < 0)
+        return ijThrowErrno(ctx, UV_EINVAL);
+    if (!JS_IsUndefined(argv[3]) && !JS_IsFunction(ctx, argv[3]))
+        return JS_ThrowTypeError(ctx, "onProgress must be a function");
+#if IJJS_PLATFORM == IJJS_PLATFORM_WIN32
+    return ijThrowErrno(ctx, UV_ENOTSUP);
+#else
+    if (f->fd == -1 || f->closing)
+        return ijThrowErrno(ctx, UV_EBADF);
+    // The file stays open and direct writes to the stream fail with EBUSY
+    // until the transfer is done, so nothing interleaves with it.
+    uv_stream_t* stream = ijStreamAcquireWriter(ctx, argv[0]);
+    if (!stream)
+        return JS_EXCEPTION;
+    uv_os_fd_t fd;
+    IJS32 r = uv_fileno((uv_handle_t*)stream, &fd);
+    if (r != 0) {
+        ijStreamReleaseWriter(stream);
+        return ijThrowErrno(ctx, r);
+    }
+    IJJSSendFileReq* sr = js_mallocz(ctx, sizeof(*sr));
+    if (!sr) {
+        ijStreamReleaseWriter(stream);
+        return JS_EXCEPTION;
+    }
+    sr->out_fd = fcntl(fd, F_DUPFD_CLOEXEC, 0);
+    if (sr->out_fd < 0) {
+        ijStreamReleaseWriter(stream);
+        js_free(ctx, sr);
+        return ijThrowErrno(ctx, uv_translate_sys_error(errno));
+    }
+    r = uv_poll_init(ijGetLoop(ctx), &sr->poll, sr->out_fd);
+    if (r != 0) {
+        ijStreamReleaseWriter(stream);
+        close(sr->out_fd);
+        js_free(ctx, sr);
+        return ijThrowErrno(ctx, r);
+    }
+    f->busy++;
+    sr->ctx = ctx;
+    sr->f = f;
+    sr->stream = stream;
+    sr->progress = JS_DupValue(ctx, argv[3]);
+    sr->in_fd = f->fd;
+    sr->offset = offset;
+    sr->remaining = length;
+    sr->req.data = sr;
+    sr->flush.data = sr;
+    sr->poll.data = sr;
+    sr->objs[0] = JS_DupValue(ctx, this_val);
+    sr->objs[1] = JS_DupValue(ctx, argv[0]);
+    JSValue ret = ijInitPromise(ctx, &sr->result);
+    uv_buf_t b = uv_buf_init(NULL, 0);
+    r = uv_write(&sr->flush, stream, &b, 1, uvSendFileFlushCb);
+    if (r != 0)
+        ijSendFileFinish(sr, r);
+    return ret;
+#endif
+}
+
 static JSValue ijFilePathGet(JSContext* ctx, JSValueConst this_val) {
     IJJSFile* f = ijFileGet(ctx, this_val);
     if (!f)
@@ -399,6 +774,8 @@ static JSValue ijDirClose(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSV
     IJJSDir* d = ijDirGet(ctx, this_val);
     if (!d)
         return JS_EXCEPTION;
+    if (d->busy)
+        return ijThrowErrno(ctx, UV_EBUSY);
     IJJSFsReq* fr = js_malloc(ctx, sizeof(*fr));
     if (!fr)
         return JS_EXCEPTION;
@@ -417,139 +794,685 @@ static JSValue ijDirPathGet(JSContext* ctx, JSValueConst this_val) {
     return JS_DupValue(ctx, d->path);
 }
 
-static JSValue ijDirNext(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
-    IJJSDir* d = ijDirGet(ctx, this_val);
-    if (!d)
-        return JS_EXCEPTION;
-    if (d->done)
-        return JS_UNDEFINED;
-    IJJSFsReq* fr = js_malloc(ctx, sizeof(*fr));
-    if (!fr)
-        return JS_EXCEPTION;
-    d->dir->dirents = &d->dirent;
-    d->dir->nentries = 1;
-    IJS32 r = uv_fs_readdir(ijGetLoop(ctx), &fr->req, d->dir, uvFsReqCb);
-    if (r != 0) {
-        js_free(ctx, fr);
-        return ijThrowErrno(ctx, r);
+static IJVoid ijDirReadWorkCb(IJJSWork* req) {
+    IJJSDirReadReq* rr = req->data;
+    IJJSDir* d = rr->d;
+    d->dir->dirents = d->dirents;
+    d->dir->nentries = d->batch;
+    rr->r = uv_fs_readdir(NULL, &rr->fs, d->dir, NULL);
+    if (rr->r <= 0 || !d->stats)
+        return;
+    IJAnsi path[4096];
+    for (IJS32 i = 0; i < rr->r; i++) {
+        IJJSDirStat* ds = &d->stats[i];
+        if (snprintf(path, sizeof(path), "%s/%s", d->cpath, d->dirents[i].name) >= (IJS32)sizeof(path)) {
+            ds->r = UV_ENAMETOOLONG;
+            continue;
+        }
+        uv_fs_t sreq;
+        ds->r = uv_fs_lstat(NULL, &sreq, path, NULL);
+        if (ds->r == 0)
+            ds->st = sreq.statbuf;
+        uv_fs_req_cleanup(&sreq);
     }
-    return ijFsReqInit(ctx, fr, this_val);
 }
 
-static JSValue ijDirIterator(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
-    return JS_DupValue(ctx, this_val);
+static JSValue ijDirEntry(JSContext* ctx, IJJSDir* d, IJS32 i) {
+    JSValue item = JS_NewObjectProto(ctx, JS_NULL);
+    JS_DefinePropertyValueStr(ctx, item, "name", JS_NewString(ctx, d->dirents[i].name), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, item, "type", JS_NewInt32(ctx, d->dirents[i].type), JS_PROP_C_W_E);
+    if (d->stats) {
+        JSValue st = d->stats[i].r == 0 ? ijStat2Obj(ctx, &d->stats[i].st) : JS_NULL;
+        JS_DefinePropertyValueStr(ctx, item, "stat", st, JS_PROP_C_W_E);
+    }
+    return item;
 }
 
-static IJS32 ijUvOpenFlags(const IJAnsi* strflags, size_t len) {
-    IJS32 flags = 0, read = 0, write = 0;
-    for (IJS32 i = 0; i < len; i++) {
-        switch (strflags[i]) {
-            case 'r':
-                read = 1;
-                break;
-            case 'w':
-                write = 1;
-                flags |= O_TRUNC | O_CREAT;
-                break;
-            case 'a':
-                write = 1;
-                flags |= O_APPEND | O_CREAT;
-                break;
-            case '+':
-                read = 1;
-                write = 1;
-                break;
-            case 'x':
-                flags |= O_EXCL;
-                break;
-            default:
-                break;
+static JSValue ijDirIterResult(JSContext* ctx, JSValue value) {
+    JSValue obj = JS_NewObjectProto(ctx, JS_NULL);
+    JS_DefinePropertyValueStr(ctx, obj, "done", JS_NewBool(ctx, JS_IsUndefined(value)), JS_PROP_C_W_E);
+    if (!JS_IsUndefined(value))
+        JS_DefinePropertyValueStr(ctx, obj, "value", value, JS_PROP_C_W_E);
+    return obj;
+}
+
+static JSValue ijDirTakePending(JSContext* ctx, IJJSDir* d, IJBool all) {
+    JSValue ret;
+    if (all && d->pending_pos == 0) {
+        ret = d->pending;
+    } else if (all) {
+        ret = JS_NewArray(ctx);
+        for (IJU32 i = d->pending_pos; i < d->pending_len; i++)
+            JS_DefinePropertyValueUint32(ctx, ret, i - d->pending_pos, JS_GetPropertyUint32(ctx, d->pending, i), JS_PROP_C_W_E);
+        JS_FreeValue(ctx, d->pending);
+    } else {
+        ret = JS_GetPropertyUint32(ctx, d->pending, d->pending_pos++);
+        if (d->pending_pos < d->pending_len)
+            return ret;
+        JS_FreeValue(ctx, d->pending);
+    }
+    d->pending = JS_UNDEFINED;
+    return ret;
+}
+
+static IJVoid uvDirReadAfterWorkCb(IJJSWork* req, IJS32 status) {
+    IJJSDirReadReq* rr = req->data;
+    JSContext* ctx = rr->ctx;
+    IJJSDir* d = rr->d;
+    IJS32 r = status < 0 ? status : rr->r;
+    IJBool is_reject = false;
+    JSValue arg;
+    d->busy = false;
+    if (r < 0) {
+        arg = ijNewError(ctx, r);
+        is_reject = true;
+    } else if (r == 0) {
+        d->done = true;
+        arg = rr->flatten ? ijDirIterResult(ctx, JS_UNDEFINED) : JS_UNDEFINED;
+    } else {
+        JSValue items = JS_NewArray(ctx);
+        for (IJS32 i = 0; i < r; i++)
+            JS_DefinePropertyValueUint32(ctx, items, i, ijDirEntry(ctx, d, i), JS_PROP_C_W_E);
+        if (rr->flatten) {
+            d->pending = items;
+            d->pending_pos = 0;
+            d->pending_len = r;
+            arg = ijDirIterResult(ctx, ijDirTakePending(ctx, d, false));
+        } else {
+            arg = items;
         }
     }
-    flags |= read ? (write ? O_RDWR : O_RDONLY) : (write ? O_WRONLY : 0);
-    return flags;
+    uv_fs_req_cleanup(&rr->fs);
+    ijSettlePromise(ctx, &rr->result, is_reject, 1, (JSValueConst*)&arg);
+    JS_FreeValue(ctx, rr->obj);
+    js_free(ctx, rr);
 }
 
-static JSValue ijFsOpen(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
-    const IJAnsi* path;
-    const IJAnsi* strflags;
-    size_t len;
-    IJS32 flags;
-    IJS32 mode;
-    path = JS_ToCString(ctx, argv[0]);
-    if (!path)
-        return JS_EXCEPTION;
-    strflags = JS_ToCStringLen(ctx, &len, argv[1]);
-    if (!strflags) {
-        JS_FreeCString(ctx, path);
+static JSValue ijDirRead(JSContext* ctx, JSValueConst this_val, IJBool flatten) {
+    IJJSDir* d = ijDirGet(ctx, this_val);
+    if (!d)
         return JS_EXCEPTION;
+    if (d->busy)
+        return ijThrowErrno(ctx, UV_EBUSY);
+    if (!JS_IsUndefined(d->pending)) {
+        JSValue arg = ijDirTakePending(ctx, d, !flatten);
+        if (flatten)
+            arg = ijDirIterResult(ctx, arg);
+        return ijNewResolvedPromise(ctx, 1, (JSValueConst*)&arg);
     }
-    flags = ijUvOpenFlags(strflags, len);
-    JS_FreeCString(ctx, strflags);
-    mode = 0;
-    if (!JS_IsUndefined(argv[2]) && JS_ToInt32(ctx, &mode, argv[2])) {
-        JS_FreeCString(ctx, path);
-        return JS_EXCEPTION;
+    if (d->done || !d->dir) {
+        JSValue arg = flatten ? ijDirIterResult(ctx, JS_UNDEFINED) : JS_UNDEFINED;
+        return ijNewResolvedPromise(ctx, 1, (JSValueConst*)&arg);
     }
-    IJJSFsReq* fr = js_malloc(ctx, sizeof(*fr));
-    if (!fr) {
-        JS_FreeCString(ctx, path);
+    IJJSDirReadReq* rr = js_mallocz(ctx, sizeof(*rr));
+    if (!rr)
         return JS_EXCEPTION;
-    }
-    IJS32 r = uv_fs_open(ijGetLoop(ctx), &fr->req, path, flags, mode, uvFsReqCb);
-    JS_FreeCString(ctx, path);
+    rr->req.data = rr;
+    rr->ctx = ctx;
+    rr->d = d;
+    rr->flatten = flatten;
+    IJS32 r = ijQueueWork(ctx, IJJS_LANE_FS, &rr->req, ijDirReadWorkCb, uvDirReadAfterWorkCb);
     if (r != 0) {
-        js_free(ctx, fr);
+        js_free(ctx, rr);
         return ijThrowErrno(ctx, r);
     }
-    return ijFsReqInit(ctx, fr, JS_UNDEFINED);
+    d->busy = true;
+    rr->obj = JS_DupValue(ctx, this_val);
+    return ijInitPromise(ctx, &rr->result);
 }
 
-static JSValue ijFsStat(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv, IJS32 magic) {
-    const IJAnsi* path = JS_ToCString(ctx, argv[0]);
-    if (!path)
-        return JS_EXCEPTION;
-    IJJSFsReq* fr = js_malloc(ctx, sizeof(*fr));
-    if (!fr) {
-        JS_FreeCString(ctx, path);
-        return JS_EXCEPTION;
-    }
-    IJS32 r;
-    if (magic)
-        r = uv_fs_lstat(ijGetLoop(ctx), &fr->req, path, uvFsReqCb);
-    else
-        r = uv_fs_stat(ijGetLoop(ctx), &fr->req, path, uvFsReqCb);
-    JS_FreeCString(ctx, path);
-    if (r != 0) {
-        js_free(ctx, fr);
-        return ijThrowErrno(ctx, r);
-    }
-    return ijFsReqInit(ctx, fr, JS_UNDEFINED);
+static JSValue ijDirNext(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    return ijDirRead(ctx, this_val, true);
 }
 
-static JSValue ijFsRealPath(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
-    const IJAnsi* path = JS_ToCString(ctx, argv[0]);
-    if (!path)
-        return JS_EXCEPTION;
-    IJJSFsReq* fr = js_malloc(ctx, sizeof(*fr));
-    if (!fr) {
-        JS_FreeCString(ctx, path);
-        return JS_EXCEPTION;
-    }
-    IJS32 r = uv_fs_realpath(ijGetLoop(ctx), &fr->req, path, uvFsReqCb);
-    JS_FreeCString(ctx, path);
-    if (r != 0) {
-        js_free(ctx, fr);
-        return ijThrowErrno(ctx, r);
-    }
-    return ijFsReqInit(ctx, fr, JS_UNDEFINED);
+static JSValue ijDirReadBatch(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    return ijDirRead(ctx, this_val, false);
 }
 
-static JSValue ijFsUnlink(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
-    const IJAnsi* path = JS_ToCString(ctx, argv[0]);
-    if (!path)
-        return JS_EXCEPTION;
-    IJJSFsReq* fr = js_malloc(ctx, sizeof(*fr));
+static JSValue ijDirIterator(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    return JS_DupValue(ctx, this_val);
+}
+
+#define IJJS_FILE_READ_AHEAD 4
+#define IJJS_FILE_MAX_READ_AHEAD 64
+
+enum {
+    FILE_SLOT_IDLE = 0,
+    FILE_SLOT_BUSY,
+    FILE_SLOT_DONE,
+};
+
+typedef struct IJJSFileReader IJJSFileReader;
+
+typedef struct {
+    uv_fs_t req;
+    IJJSFileReader* reader;
+    IJU8* data;
+    IJS32 state;
+} IJJSFileReadSlot;
+
+struct IJJSFileReader {
+    JSContext* ctx;
+    JSValue obj;
+    JSValue file;
+    IJJSFile* f;
+    size_t chunk;
+    IJS64 offset;
+    IJU32 depth;
+    IJU32 head;
+    IJU32 tail;
+    IJU32 inflight;
+    IJBool done;
+    IJJSPromise result;
+    IJJSFileReadSlot slots[];
+};
+
+typedef struct IJJSFileWriter IJJSFileWriter;
+
+typedef struct {
+    uv_fs_t req;
+    IJJSFileWriter* writer;
+    IJJSWriteBuf pin;
+    uv_buf_t buf;
+    IJS64 offset;
+} IJJSFileWriteReq;
+
+struct IJJSFileWriter {
+    JSContext* ctx;
+    JSValue obj;
+    JSValue file;
+    IJJSFile* f;
+    IJS64 offset;
+    size_t highwater;
+    size_t queued;
+    IJU32 inflight;
+    IJU64 written;
+    IJS32 error;
+    IJBool ended;
+    IJJSPromise drain;
+    IJJSPromise flush;
+};
+
+static JSClassID ijjs_file_reader_class_id;
+static JSClassID ijjs_file_writer_class_id;
+
+static IJVoid ijFileStreamPin(JSContext* ctx, JSValue* pin, IJU32* inflight, JSValueConst obj) {
+    if ((*inflight)++ == 0 && JS_IsUndefined(*pin))
+        *pin = JS_DupValue(ctx, obj);
+}
+
+static IJVoid ijFileStreamUnpin(JSContext* ctx, JSValue* pin, IJU32 inflight) {
+    if (inflight == 0 && !JS_IsUndefined(*pin)) {
+        JSValue obj = *pin;
+        *pin = JS_UNDEFINED;
+        JS_FreeValue(ctx, obj);
+    }
+}
+
+static IJVoid ijFileReaderDiscard(IJJSFileReader* r) {
+    for (IJU32 i = 0; i < r->depth; i++) {
+        IJJSFileReadSlot* slot = &r->slots[i];
+        if (slot->state == FILE_SLOT_DONE) {
+            ijReadBufFree(r->ctx, slot->data, r->chunk);
+            uv_fs_req_cleanup(&slot->req);
+            slot->state = FILE_SLOT_IDLE;
+        }
+    }
+}
+
+static IJVoid uvFileReaderReadCb(uv_fs_t* req);
+
+static IJVoid ijFileReaderIssue(IJJSFileReader* r, JSValueConst obj) {
+    JSContext* ctx = r->ctx;
+    while (!r->done && r->slots[r->tail].state == FILE_SLOT_IDLE) {
+        IJJSFileReadSlot* slot = &r->slots[r->tail];
+        r->tail = (r->tail + 1) % r->depth;
+        slot->state = FILE_SLOT_DONE;
+        IJBool closed = r->f->fd == -1 || r->f->closing;
+        slot->data = closed ? NULL : ijReadBufAlloc(ctx, r->chunk);
+        IJS32 ret = closed ? UV_EBADF : UV_ENOMEM;
+        if (slot->data) {
+            uv_buf_t b = uv_buf_init((IJAnsi*)slot->data, r->chunk);
+            ret = ijUringRead(ctx, &slot->req, r->f->fd, &b, 1, r->offset, uvFileReaderReadCb);
+        }
+        if (ret != 0) {
+            ijReadBufFree(ctx, slot->data, r->chunk);
+            slot->data = NULL;
+            slot->req.result = ret;
+            break;
+        }
+        slot->state = FILE_SLOT_BUSY;
+        r->offset += r->chunk;
+        r->f->busy++;
+        ijFileStreamPin(ctx, &r->obj, &r->inflight, obj);
+    }
+}
+
+static IJVoid ijFileReaderPump(IJJSFileReader* r) {
+    JSContext* ctx = r->ctx;
+    if (!ijIsPromisePending(ctx, &r->result))
+        return;
+    JSValue arg;
+    IJBool is_reject = false;
+    IJJSFileReadSlot* slot = &r->slots[r->head];
+    if (r->done) {
+        arg = ijDirIterResult(ctx, JS_UNDEFINED);
+    } else if (slot->state == FILE_SLOT_DONE) {
+        ssize_t nread = slot->req.result;
+        if (slot->data)
+            uv_fs_req_cleanup(&slot->req);
+        slot->state = FILE_SLOT_IDLE;
+        r->head = (r->head + 1) % r->depth;
+        if (nread > 0) {
+            arg = ijDirIterResult(ctx, ijNewReadBuffer(ctx, slot->data, r->chunk, nread));
+        } else {
+            ijReadBufFree(ctx, slot->data, r->chunk);
+            arg = nread < 0 ? ijNewError(ctx, nread) : ijDirIterResult(ctx, JS_UNDEFINED);
+            is_reject = nread < 0;
+        }
+        if (nread <= 0 || (size_t)nread < r->chunk) {
+            r->done = true;
+            ijFileReaderDiscard(r);
+        }
+    } else {
+        return;
+    }
+    /* next() pumps too: an error already read must not be reported before the caller awaits it */
+    if (is_reject)
+        ijSettlePromiseLater(ctx, &r->result, true, 1, (JSValueConst*)&arg);
+    else
+        ijSettlePromise(ctx, &r->result, false, 1, (JSValueConst*)&arg);
+    ijClearPromise(ctx, &r->result);
+}
+
+static IJVoid uvFileReaderReadCb(uv_fs_t* req) {
+    IJJSFileReadSlot* slot = req->data;
+    IJJSFileReader* r = slot->reader;
+    JSContext* ctx = r->ctx;
+    slot->state = FILE_SLOT_DONE;
+    r->inflight--;
+    ijFileUnbusy(r->f);
+    if (r->done) {
+        ijFileReaderDiscard(r);
+    } else {
+        ijFileReaderPump(r);
+        ijFileReaderIssue(r, r->obj);
+    }
+    ijFileStreamUnpin(ctx, &r->obj, r->inflight);
+}
+
+static IJVoid ijFileReaderFinalizer(JSRuntime* rt, JSValue val) {
+    IJJSFileReader* r = JS_GetOpaque(val, ijjs_file_reader_class_id);
+    if (r) {
+        for (IJU32 i = 0; i < r->depth; i++) {
+            if (r->slots[i].state == FILE_SLOT_DONE && r->slots[i].data) {
+                js_free_rt(rt, r->slots[i].data);
+                uv_fs_req_cleanup(&r->slots[i].req);
+            }
+        }
+        JS_FreeValueRT(rt, r->file);
+        ijFreePromiseRT(rt, &r->result);
+        js_free_rt(rt, r);
+    }
+}
+
+static IJVoid ijFileReaderMark(JSRuntime* rt, JSValueConst val, JS_MarkFunc* mark_func) {
+    IJJSFileReader* r = JS_GetOpaque(val, ijjs_file_reader_class_id);
+    if (r) {
+        JS_MarkValue(rt, r->file, mark_func);
+        ijMarkPromise(rt, &r->result, mark_func);
+    }
+}
+
+static JSClassDef ijjs_file_reader_class = { "FileReadable", .finalizer = ijFileReaderFinalizer, .gc_mark = ijFileReaderMark };
+
+static JSValue ijFileReaderNext(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJJSFileReader* r = JS_GetOpaque2(ctx, this_val, ijjs_file_reader_class_id);
+    if (!r)
+        return JS_EXCEPTION;
+    if (ijIsPromisePending(ctx, &r->result))
+        return ijThrowErrno(ctx, UV_EBUSY);
+    JSValue ret = ijInitPromise(ctx, &r->result);
+    ijFileReaderPump(r);
+    ijFileReaderIssue(r, this_val);
+    /* a read that fails to start completes its slot at once */
+    ijFileReaderPump(r);
+    return ret;
+}
+
+static JSValue ijFileReaderReturn(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJJSFileReader* r = JS_GetOpaque2(ctx, this_val, ijjs_file_reader_class_id);
+    if (!r)
+        return JS_EXCEPTION;
+    if (!r->done) {
+        r->done = true;
+        ijFileReaderDiscard(r);
+        ijFileReaderPump(r);
+    }
+    JSValue arg = ijDirIterResult(ctx, JS_UNDEFINED);
+    return ijNewResolvedPromise(ctx, 1, (JSValueConst*)&arg);
+}
+
+static JSValue ijFileReadable(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJJSFile* f = ijFileGet(ctx, this_val);
+    if (!f)
+        return JS_EXCEPTION;
+    IJU64 chunk = IJJS_DEFAULt_READ_SIZE;
+    IJU64 depth = IJJS_FILE_READ_AHEAD;
+    IJS64 position = 0;
+    if (JS_IsObject(argv[0])) {
+        JSValue v = JS_GetPropertyStr(ctx, argv[0], "chunkSize");
+        IJS32 ret = !JS_IsUndefined(v) && JS_ToIndex(ctx, &chunk, v);
+        JS_FreeValue(ctx, v);
+        if (ret)
+            return JS_EXCEPTION;
+        v = JS_GetPropertyStr(ctx, argv[0], "readAhead");
+        ret = !JS_IsUndefined(v) && JS_ToIndex(ctx, &depth, v);
+        JS_FreeValue(ctx, v);
+        if (ret)
+            return JS_EXCEPTION;
+        v = JS_GetPropertyStr(ctx, argv[0], "position");
+        ret = !JS_IsUndefined(v) && JS_ToInt64(ctx, &position, v);
+        JS_FreeValue(ctx, v);
+        if (ret)
+            return JS_EXCEPTION;
+    }
+    if (chunk == 0 || chunk > INT32_MAX || depth == 0 || depth > IJJS_FILE_MAX_READ_AHEAD || position < 0)
+        return ijThrowErrno(ctx, UV_EINVAL);
+    JSValue obj = JS_NewObjectClass(ctx, ijjs_file_reader_class_id);
+    if (JS_IsException(obj))
+        return obj;
+    IJJSFileReader* r = js_mallocz(ctx, sizeof(*r) + depth * sizeof(IJJSFileReadSlot));
+    if (!r) {
+        JS_FreeValue(ctx, obj);
+        return JS_EXCEPTION;
+    }
+    r->ctx = ctx;
+    r->obj = JS_UNDEFINED;
+    r->file = JS_DupValue(ctx, this_val);
+    r->f = f;
+    r->chunk = chunk;
+    r->depth = depth;
+    r->offset = position;
+    ijClearPromise(ctx, &r->result);
+    for (IJU32 i = 0; i < r->depth; i++) {
+        r->slots[i].reader = r;
+        r->slots[i].req.data = &r->slots[i];
+    }
+    JS_SetOpaque(obj, r);
+    ijFileReaderIssue(r, obj);
+    return obj;
+}
+
+static IJVoid uvFileWriterWriteCb(uv_fs_t* req) {
+    IJJSFileWriteReq* wr = req->data;
+    IJJSFileWriter* w = wr->writer;
+    JSContext* ctx = w->ctx;
+    ssize_t result = req->result;
+    uv_fs_req_cleanup(req);
+    if (result == 0 && wr->buf.len > 0)
+        result = UV_EIO;
+    if (result > 0 && (size_t)result < wr->buf.len && w->error == 0) {
+        w->written += result;
+        w->queued -= result;
+        wr->buf = uv_buf_init(wr->buf.base + result, wr->buf.len - result);
+        wr->offset += result;
+        result = ijUringWrite(ctx, &wr->req, w->f->fd, &wr->buf, 1, wr->offset, uvFileWriterWriteCb);
+        if (result == 0)
+            return;
+    }
+    w->inflight--;
+    ijFileUnbusy(w->f);
+    w->queued -= wr->buf.len;
+    if (result < 0 && w->error == 0)
+        w->error = result;
+    else if (result > 0)
+        w->written += result;
+    ijStreamReleaseBufs(ctx, &wr->pin, 1);
+    js_free(ctx, wr);
+    if (ijIsPromisePending(ctx, &w->drain) && (w->error != 0 || w->queued <= w->highwater)) {
+        JSValue arg = w->error != 0 ? ijNewError(ctx, w->error) : JS_UNDEFINED;
+        ijSettlePromise(ctx, &w->drain, w->error != 0, 1, (JSValueConst*)&arg);
+        ijClearPromise(ctx, &w->drain);
+    }
+    if (w->inflight == 0 && ijIsPromisePending(ctx, &w->flush)) {
+        JSValue arg = w->error != 0 ? ijNewError(ctx, w->error) : JS_NewInt64(ctx, w->written);
+        ijSettlePromise(ctx, &w->flush, w->error != 0, 1, (JSValueConst*)&arg);
+        ijClearPromise(ctx, &w->flush);
+    }
+    ijFileStreamUnpin(ctx, &w->obj, w->inflight);
+}
+
+static IJVoid ijFileWriterFinalizer(JSRuntime* rt, JSValue val) {
+    IJJSFileWriter* w = JS_GetOpaque(val, ijjs_file_writer_class_id);
+    if (w) {
+        JS_FreeValueRT(rt, w->file);
+        ijFreePromiseRT(rt, &w->drain);
+        ijFreePromiseRT(rt, &w->flush);
+        js_free_rt(rt, w);
+    }
+}
+
+static IJVoid ijFileWriterMark(JSRuntime* rt, JSValueConst val, JS_MarkFunc* mark_func) {
+    IJJSFileWriter* w = JS_GetOpaque(val, ijjs_file_writer_class_id);
+    if (w) {
+        JS_MarkValue(rt, w->file, mark_func);
+        ijMarkPromise(rt, &w->drain, mark_func);
+        ijMarkPromise(rt, &w->flush, mark_func);
+    }
+}
+
+static JSClassDef ijjs_file_writer_class = { "FileWritable", .finalizer = ijFileWriterFinalizer, .gc_mark = ijFileWriterMark };
+
+static JSValue ijFileWriterWrite(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJJSFileWriter* w = JS_GetOpaque2(ctx, this_val, ijjs_file_writer_class_id);
+    if (!w)
+        return JS_EXCEPTION;
+    if (w->ended)
+        return ijThrowErrno(ctx, UV_EPIPE);
+    if (w->error != 0) {
+        JSValue arg = ijNewError(ctx, w->error);
+        return ijNewRejectedPromise(ctx, 1, (JSValueConst*)&arg);
+    }
+    if (w->f->fd == -1 || w->f->closing)
+        return ijThrowErrno(ctx, UV_EBADF);
+    IJJSFileWriteReq* wr = js_malloc(ctx, sizeof(*wr));
+    if (!wr)
+        return JS_EXCEPTION;
+    if (ijStreamGetData(ctx, argv[0], &wr->buf, &wr->pin)) {
+        js_free(ctx, wr);
+        return JS_EXCEPTION;
+    }
+    wr->writer = w;
+    wr->offset = w->offset;
+    wr->req.data = wr;
+    IJS32 r = ijUringWrite(ctx, &wr->req, w->f->fd, &wr->buf, 1, wr->offset, uvFileWriterWriteCb);
+    if (r != 0) {
+        ijStreamReleaseBufs(ctx, &wr->pin, 1);
+        js_free(ctx, wr);
+        return ijThrowErrno(ctx, r);
+    }
+    w->offset += wr->buf.len;
+    w->queued += wr->buf.len;
+    w->f->busy++;
+    ijFileStreamPin(ctx, &w->obj, &w->inflight, this_val);
+    if (w->queued <= w->highwater)
+        return ijNewResolvedPromise(ctx, 0, NULL);
+    if (ijIsPromisePending(ctx, &w->drain))
+        return JS_DupValue(ctx, w->drain.p);
+    return ijInitPromise(ctx, &w->drain);
+}
+
+static JSValue ijFileWriterEnd(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJJSFileWriter* w = JS_GetOpaque2(ctx, this_val, ijjs_file_writer_class_id);
+    if (!w)
+        return JS_EXCEPTION;
+    w->ended = true;
+    if (ijIsPromisePending(ctx, &w->flush))
+        return JS_DupValue(ctx, w->flush.p);
+    if (w->inflight > 0)
+        return ijInitPromise(ctx, &w->flush);
+    JSValue arg = w->error != 0 ? ijNewError(ctx, w->error) : JS_NewInt64(ctx, w->written);
+    return w->error != 0 ? ijNewRejectedPromise(ctx, 1, (JSValueConst*)&arg) : ijNewResolvedPromise(ctx, 1, (JSValueConst*)&arg);
+}
+
+static JSValue ijFileWriterQueueSizeGet(JSContext* ctx, JSValueConst this_val) {
+    IJJSFileWriter* w = JS_GetOpaque2(ctx, this_val, ijjs_file_writer_class_id);
+    if (!w)
+        return JS_EXCEPTION;
+    return JS_NewInt64(ctx, w->queued);
+}
+
+static JSValue ijFileWritable(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJJSFile* f = ijFileGet(ctx, this_val);
+    if (!f)
+        return JS_EXCEPTION;
+    IJU64 highwater = IJJS_DEFAULT_HIGH_WATER_MARK;
+    IJS64 position = 0;
+    if (JS_IsObject(argv[0])) {
+        JSValue v = JS_GetPropertyStr(ctx, argv[0], "highWaterMark");
+        IJS32 ret = !JS_IsUndefined(v) && JS_ToIndex(ctx, &highwater, v);
+        JS_FreeValue(ctx, v);
+        if (ret)
+            return JS_EXCEPTION;
+        v = JS_GetPropertyStr(ctx, argv[0], "position");
+        ret = !JS_IsUndefined(v) && JS_ToInt64(ctx, &position, v);
+        JS_FreeValue(ctx, v);
+        if (ret)
+            return JS_EXCEPTION;
+    }
+    if (position < 0)
+        return ijThrowErrno(ctx, UV_EINVAL);
+    JSValue obj = JS_NewObjectClass(ctx, ijjs_file_writer_class_id);
+    if (JS_IsException(obj))
+        return obj;
+    IJJSFileWriter* w = js_mallocz(ctx, sizeof(*w));
+    if (!w) {
+        JS_FreeValue(ctx, obj);
+        return JS_EXCEPTION;
+    }
+    w->ctx = ctx;
+    w->obj = JS_UNDEFINED;
+    w->file = JS_DupValue(ctx, this_val);
+    w->f = f;
+    w->highwater = highwater;
+    w->offset = position;
+    ijClearPromise(ctx, &w->drain);
+    ijClearPromise(ctx, &w->flush);
+    JS_SetOpaque(obj, w);
+    return obj;
+}
+
+static IJS32 ijUvOpenFlags(const IJAnsi* strflags, size_t len) {
+    IJS32 flags = 0, read = 0, write = 0;
+    for (IJS32 i = 0; i < len; i++) {
+        switch (strflags[i]) {
+            case 'r':
+                read = 1;
+                break;
+            case 'w':
+                write = 1;
+                flags |= O_TRUNC | O_CREAT;
+                break;
+            case 'a':
+                write = 1;
+                flags |= O_APPEND | O_CREAT;
+                break;
+            case '+':
+                read = 1;
+                write = 1;
+                break;
+            case 'x':
+                flags |= O_EXCL;
+                break;
+            default:
+                break;
+        }
+    }
+    flags |= read ? (write ? O_RDWR : O_RDONLY) : (write ? O_WRONLY : 0);
+    return flags;
+}
+
+static JSValue ijFsOpen(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    const IJAnsi* path;
+    const IJAnsi* strflags;
+    size_t len;
+    IJS32 flags;
+    IJS32 mode;
+    path = JS_ToCString(ctx, argv[0]);
+    if (!path)
+        return JS_EXCEPTION;
+    strflags = JS_ToCStringLen(ctx, &len, argv[1]);
+    if (!strflags) {
+        JS_FreeCString(ctx, path);
+        return JS_EXCEPTION;
+    }
+    flags = ijUvOpenFlags(strflags, len);
+    JS_FreeCString(ctx, strflags);
+    mode = 0;
+    if (!JS_IsUndefined(argv[2]) && JS_ToInt32(ctx, &mode, argv[2])) {
+        JS_FreeCString(ctx, path);
+        return JS_EXCEPTION;
+    }
+    IJJSFsReq* fr = js_malloc(ctx, sizeof(*fr));
+    if (!fr) {
+        JS_FreeCString(ctx, path);
+        return JS_EXCEPTION;
+    }
+    IJS32 r = ijUringOpen(ctx, &fr->req, path, flags, mode, uvFsReqCb);
+    JS_FreeCString(ctx, path);
+    if (r != 0) {
+        js_free(ctx, fr);
+        return ijThrowErrno(ctx, r);
+    }
+    return ijFsReqInit(ctx, fr, JS_UNDEFINED);
+}
+
+static JSValue ijFsStat(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv, IJS32 magic) {
+    const IJAnsi* path = JS_ToCString(ctx, argv[0]);
+    if (!path)
+        return JS_EXCEPTION;
+    IJJSFsReq* fr = js_malloc(ctx, sizeof(*fr));
+    if (!fr) {
+        JS_FreeCString(ctx, path);
+        return JS_EXCEPTION;
+    }
+    IJS32 r;
+    if (magic)
+        r = ijUringLstat(ctx, &fr->req, path, uvFsReqCb);
+    else
+        r = ijUringStat(ctx, &fr->req, path, uvFsReqCb);
+    JS_FreeCString(ctx, path);
+    if (r != 0) {
+        js_free(ctx, fr);
+        return ijThrowErrno(ctx, r);
+    }
+    return ijFsReqInit(ctx, fr, JS_UNDEFINED);
+}
+
+static JSValue ijFsRealPath(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    const IJAnsi* path = JS_ToCString(ctx, argv[0]);
+    if (!path)
+        return JS_EXCEPTION;
+    IJJSFsReq* fr = js_malloc(ctx, sizeof(*fr));
+    if (!fr) {
+        JS_FreeCString(ctx, path);
+        return JS_EXCEPTION;
+    }
+    IJS32 r = uv_fs_realpath(ijGetLoop(ctx), &fr->req, path, uvFsReqCb);
+    JS_FreeCString(ctx, path);
+    if (r != 0) {
+        js_free(ctx, fr);
+        return ijThrowErrno(ctx, r);
+    }
+    return ijFsReqInit(ctx, fr, JS_UNDEFINED);
+}
+
+static JSValue ijFsUnlink(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    const IJAnsi* path = JS_ToCString(ctx, argv[0]);
+    if (!path)
+        return JS_EXCEPTION;
+    IJJSFsReq* fr = js_malloc(ctx, sizeof(*fr));
     if (!fr) {
         JS_FreeCString(ctx, path);
         return JS_EXCEPTION;
@@ -674,38 +1597,126 @@ static JSValue ijFsCopyFile(JSContext* ctx, JSValueConst this_val, IJS32 argc, J
 }
 
 static JSValue ijFsReadDir(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJU32 batch = IJJS_DIR_DEFAULT_BATCH;
+    IJBool with_stats = false;
+    if (JS_IsObject(argv[1])) {
+        JSValue v = JS_GetPropertyStr(ctx, argv[1], "batch");
+        IJS32 err = !JS_IsUndefined(v) && JS_ToUint32(ctx, &batch, v);
+        JS_FreeValue(ctx, v);
+        if (err)
+            return JS_EXCEPTION;
+        if (batch < 1 || batch > IJJS_DIR_MAX_BATCH)
+            return JS_ThrowRangeError(ctx, "batch must be between 1 and %d", IJJS_DIR_MAX_BATCH);
+        v = JS_GetPropertyStr(ctx, argv[1], "withStats");
+        with_stats = JS_ToBool(ctx, v);
+        JS_FreeValue(ctx, v);
+    }
     const IJAnsi* path = JS_ToCString(ctx, argv[0]);
     if (!path)
         return JS_EXCEPTION;
-    IJJSFsReq* fr = js_malloc(ctx, sizeof(*fr));
-    if (!fr) {
+    IJJSFsOpenDirReq* dr = js_malloc(ctx, sizeof(*dr));
+    if (!dr) {
         JS_FreeCString(ctx, path);
         return JS_EXCEPTION;
     }
+    dr->batch = batch;
+    dr->with_stats = with_stats;
+    IJJSFsReq* fr = &dr->base;
     IJS32 r = uv_fs_opendir(ijGetLoop(ctx), &fr->req, path, uvFsReqCb);
     JS_FreeCString(ctx, path);
     if (r != 0) {
-        js_free(ctx, fr);
+        js_free(ctx, dr);
         return ijThrowErrno(ctx, r);
     }
     return ijFsReqInit(ctx, fr, JS_UNDEFINED);
 }
 
-static IJVoid ijReadFileFree(JSRuntime* rt, IJVoid* opaque, IJVoid* ptr) {
-    IJJSReadFileReq* fr = opaque;
-    CHECK_NOT_NULL(fr);
-    dbuf_free(&fr->dbuf);
-    js_free_rt(rt, fr->filename);
-    js_free_rt(rt, fr);
+static size_t ijMapGranularity() {
+#if IJJS_PLATFORM == IJJS_PLATFORM_WIN32
+    SYSTEM_INFO si;
+    GetSystemInfo(&si);
+    return si.dwAllocationGranularity;
+#else
+    return (size_t)sysconf(_SC_PAGESIZE);
+#endif
 }
 
-static IJVoid ijReadFileWorkCb(uv_work_t* req) {
+static IJS32 ijMapRegion(uv_file fd, IJU64 offset, IJU64 length, IJBool shared, IJVoid** base, size_t* base_len) {
+    IJU64 start = offset - offset % ijMapGranularity();
+    IJU64 len = length + (offset - start);
+    *base = NULL;
+    *base_len = 0;
+    if (len > SIZE_MAX)
+        return UV_ENOMEM;
+#if IJJS_PLATFORM == IJJS_PLATFORM_WIN32
+    HANDLE mapping = CreateFileMappingW((HANDLE)uv_get_osfhandle(fd), NULL, shared ? PAGE_READWRITE : PAGE_WRITECOPY, 0, 0, NULL);
+    if (!mapping)
+        return uv_translate_sys_error(GetLastError());
+    IJVoid* p = MapViewOfFile(mapping, shared ? FILE_MAP_WRITE : FILE_MAP_COPY, (DWORD)(start >> 32), (DWORD)start, (size_t)len);
+    IJS32 r = p ? 0 : uv_translate_sys_error(GetLastError());
+    CloseHandle(mapping);
+    if (r != 0)
+        return r;
+#else
+    IJVoid* p = mmap(NULL, (size_t)len, PROT_READ | PROT_WRITE, shared ? MAP_SHARED : MAP_PRIVATE, fd, (off_t)start);
+    if (p == MAP_FAILED)
+        return uv_translate_sys_error(errno);
+#endif
+    *base = p;
+    *base_len = (size_t)len;
+    return 0;
+}
+
+static IJVoid ijUnmapRegion(IJVoid* base, size_t len) {
+#if IJJS_PLATFORM == IJJS_PLATFORM_WIN32
+    UnmapViewOfFile(base);
+#else
+    munmap(base, len);
+#endif
+}
+
+static IJS32 ijMapFile(const IJAnsi* filename, IJVoid** map, size_t* len) {
+    uv_fs_t req;
+    IJS32 r = uv_fs_open(NULL, &req, filename, O_RDONLY, 0, NULL);
+    uv_fs_req_cleanup(&req);
+    if (r < 0)
+        return r;
+    uv_file fd = r;
+    r = uv_fs_fstat(NULL, &req, fd, NULL);
+    IJU64 size = req.statbuf.st_size;
+    IJBool regular = (req.statbuf.st_mode & S_IFMT) == S_IFREG;
+    uv_fs_req_cleanup(&req);
+    *map = NULL;
+    *len = 0;
+    if (r == 0 && regular && size > 0)
+        r = ijMapRegion(fd, 0, size, false, map, len);
+    uv_fs_close(NULL, &req, fd, NULL);
+    uv_fs_req_cleanup(&req);
+    return r;
+}
+
+static IJVoid ijReadFileFree(JSRuntime* rt, IJVoid* opaque, IJVoid* ptr) {
+    IJJSReadFileReq* fr = opaque;
+    CHECK_NOT_NULL(fr);
+    if (fr->map)
+        ijUnmapRegion(fr->map, fr->map_len);
+    dbuf_free(&fr->dbuf);
+    js_free_rt(rt, fr->filename);
+    js_free_rt(rt, fr);
+}
+
+static IJVoid ijReadFileWorkCb(IJJSWork* req) {
     IJJSReadFileReq* fr = req->data;
     CHECK_NOT_NULL(fr);
+    if (fr->use_mmap) {
+        fr->r = ijMapFile(fr->filename, &fr->map, &fr->map_len);
+        if (fr->r < 0 || fr->map)
+            return;
+    }
     fr->r = ijLoadFile(fr->ctx, &fr->dbuf, fr->filename);
 }
 
-static IJVoid ijReadFileAfterWorkCb(uv_work_t* req, IJS32 status) {
+static IJVoid ijReadFileAfterWorkCb(IJJSWork* req, IJS32 status) {
     IJJSReadFileReq* fr = req->data;
     CHECK_NOT_NULL(fr);
     JSContext* ctx = fr->ctx;
@@ -717,6 +1728,8 @@ static IJVoid ijReadFileAfterWorkCb(uv_work_t* req, IJS32 status) {
     } else if (fr->r < 0) {
         arg = ijNewError(ctx, fr->r);
         is_reject = true;
+    } else if (fr->map) {
+        arg = JS_NewArrayBuffer(ctx, fr->map, fr->map_len, ijReadFileFree, (IJVoid *) fr, false);
     } else {
         arg = JS_NewArrayBuffer(ctx, fr->dbuf.buf, fr->dbuf.size, ijReadFileFree, (IJVoid *) fr, false);
     }
@@ -726,10 +1739,16 @@ static IJVoid ijReadFileAfterWorkCb(uv_work_t* req, IJS32 status) {
 }
 
 static JSValue ijFsReadFile(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJBool use_mmap = false;
+    if (JS_IsObject(argv[1])) {
+        JSValue v = JS_GetPropertyStr(ctx, argv[1], "mmap");
+        use_mmap = JS_ToBool(ctx, v);
+        JS_FreeValue(ctx, v);
+    }
     const IJAnsi* path = JS_ToCString(ctx, argv[0]);
     if (!path)
         return JS_EXCEPTION;
-    IJJSReadFileReq* fr = js_malloc(ctx, sizeof(*fr));
+    IJJSReadFileReq* fr = js_mallocz(ctx, sizeof(*fr));
     if (!fr) {
         JS_FreeCString(ctx, path);
         return JS_EXCEPTION;
@@ -738,9 +1757,10 @@ static JSValue ijFsReadFile(JSContext* ctx, JSValueConst this_val, IJS32 argc, J
     dbuf_init(&fr->dbuf);
     fr->r = -1;
     fr->filename = js_strdup(ctx, path);
+    fr->use_mmap = use_mmap;
     fr->req.data = fr;
     JS_FreeCString(ctx, path);
-    IJS32 r = uv_queue_work(ijGetLoop(ctx), &fr->req, ijReadFileWorkCb, ijReadFileAfterWorkCb);
+    IJS32 r = ijQueueWork(ctx, IJJS_LANE_FS, &fr->req, ijReadFileWorkCb, ijReadFileAfterWorkCb);
     if (r != 0) {
         js_free(ctx, fr->filename);
         js_free(ctx, fr);
@@ -749,24 +1769,1258 @@ static JSValue ijFsReadFile(JSContext* ctx, JSValueConst this_val, IJS32 argc, J
     return ijInitPromise(ctx, &fr->result);
 }
 
+enum {
+    BATCH_OPEN = 0,
+    BATCH_WRITE,
+    BATCH_FSYNC,
+    BATCH_FDATASYNC,
+    BATCH_CLOSE,
+    BATCH_RENAME,
+    BATCH_UNLINK,
+};
+
+typedef struct {
+    IJS32 type;
+    IJAnsi* path;
+    IJAnsi* new_path;
+    IJS32 flags;
+    IJS32 mode;
+    JSValue file;
+    IJJSFile* f;
+    IJJSWriteBuf pin;
+    uv_buf_t buf;
+    IJS64 pos;
+    IJS64 result;
+} IJJSBatchOp;
+
+typedef struct {
+    IJJSWork req;
+    JSContext* ctx;
+    IJU32 nops;
+    IJS32 error;
+    IJU32 failed;
+    IJJSPromise result;
+    IJJSBatchOp ops[];
+} IJJSBatchReq;
+
+static IJS64 ijBatchWrite(uv_file fd, IJJSBatchOp* op) {
+    uv_fs_t fs;
+    uv_buf_t b = op->buf;
+    IJS64 pos = op->pos;
+    IJS64 total = 0;
+    do {
+        IJS32 r = uv_fs_write(NULL, &fs, fd, &b, 1, pos, NULL);
+        uv_fs_req_cleanup(&fs);
+        if (r < 0)
+            return r;
+        if (r == 0 && b.len > 0)
+            return UV_EIO;
+        total += r;
+        b = uv_buf_init(b.base + r, b.len - r);
+        if (pos >= 0)
+            pos += r;
+    } while (b.len > 0);
+    return total;
+}
+
+static IJVoid ijBatchWorkCb(IJJSWork* req) {
+    IJJSBatchReq* br = req->data;
+    uv_fs_t fs;
+    uv_file fd = -1;
+    for (IJU32 i = 0; i < br->nops; i++) {
+        IJJSBatchOp* op = &br->ops[i];
+        uv_file target = op->f ? op->f->fd : fd;
+        IJS64 r;
+        switch (op->type) {
+            case BATCH_OPEN:
+                if (fd != -1) {
+                    uv_fs_close(NULL, &fs, fd, NULL);
+                    uv_fs_req_cleanup(&fs);
+                }
+                r = fd = uv_fs_open(NULL, &fs, op->path, op->flags, op->mode, NULL);
+                if (fd < 0)
+                    fd = -1;
+                break;
+            case BATCH_WRITE:
+                r = target == -1 ? UV_EBADF : ijBatchWrite(target, op);
+                break;
+            case BATCH_FSYNC:
+                r = target == -1 ? UV_EBADF : uv_fs_fsync(NULL, &fs, target, NULL);
+                break;
+            case BATCH_FDATASYNC:
+                r = target == -1 ? UV_EBADF : uv_fs_fdatasync(NULL, &fs, target, NULL);
+                break;
+            case BATCH_CLOSE:
+                r = fd == -1 ? UV_EBADF : uv_fs_close(NULL, &fs, fd, NULL);
+                fd = -1;
+                break;
+            case BATCH_RENAME:
+                r = uv_fs_rename(NULL, &fs, op->path, op->new_path, NULL);
+                break;
+            case BATCH_UNLINK:
+                r = uv_fs_unlink(NULL, &fs, op->path, NULL);
+                break;
+            default:
+                abort();
+        }
+        if (op->type != BATCH_WRITE)
+            uv_fs_req_cleanup(&fs);
+        if (r < 0) {
+            br->error = (IJS32)r;
+            br->failed = i;
+            break;
+        }
+        op->result = r;
+    }
+    if (fd != -1) {
+        uv_fs_close(NULL, &fs, fd, NULL);
+        uv_fs_req_cleanup(&fs);
+    }
+}
+
+static IJVoid ijBatchFree(JSContext* ctx, IJJSBatchReq* br) {
+    for (IJU32 i = 0; i < br->nops; i++) {
+        IJJSBatchOp* op = &br->ops[i];
+        js_free(ctx, op->path);
+        js_free(ctx, op->new_path);
+        ijStreamReleaseBufs(ctx, &op->pin, 1);
+        if (op->f)
+            ijFileUnbusy(op->f);
+        JS_FreeValue(ctx, op->file);
+    }
+    js_free(ctx, br);
+}
+
+static IJVoid ijBatchAfterWorkCb(IJJSWork* req, IJS32 status) {
+    IJJSBatchReq* br = req->data;
+    JSContext* ctx = br->ctx;
+    JSValue arg;
+    IJBool is_reject = status != 0 || br->error != 0;
+    if (is_reject) {
+        arg = ijNewError(ctx, status != 0 ? status : br->error);
+        JS_DefinePropertyValueStr(ctx, arg, "index", JS_NewUint32(ctx, br->failed), JS_PROP_C_W_E);
+    } else {
+        arg = JS_NewArray(ctx);
+        for (IJU32 i = 0; i < br->nops; i++) {
+            JSValue v = br->ops[i].type == BATCH_WRITE ? JS_NewInt64(ctx, br->ops[i].result) : JS_UNDEFINED;
+            JS_DefinePropertyValueUint32(ctx, arg, i, v, JS_PROP_C_W_E);
+        }
+    }
+    ijSettlePromise(ctx, &br->result, is_reject, 1, (JSValueConst*)&arg);
+    ijClearPromise(ctx, &br->result);
+    ijBatchFree(ctx, br);
+}
+
+static IJAnsi* ijBatchGetPath(JSContext* ctx, JSValueConst obj, const IJAnsi* name) {
+    JSValue v = JS_GetPropertyStr(ctx, obj, name);
+    if (JS_IsUndefined(v)) {
+        JS_ThrowTypeError(ctx, "batch op needs '%s'", name);
+        return NULL;
+    }
+    const IJAnsi* str = JS_ToCString(ctx, v);
+    JS_FreeValue(ctx, v);
+    if (!str)
+        return NULL;
+    IJAnsi* ret = js_strdup(ctx, str);
+    JS_FreeCString(ctx, str);
+    return ret;
+}
+
+static IJS32 ijBatchParse(JSContext* ctx, JSValueConst obj, IJJSBatchOp* op) {
+    static const IJAnsi* names[] = { "open", "write", "fsync", "fdatasync", "close", "rename", "unlink" };
+    JSValue v = JS_GetPropertyStr(ctx, obj, "op");
+    const IJAnsi* name = JS_ToCString(ctx, v);
+    JS_FreeValue(ctx, v);
+    if (!name)
+        return -1;
+    op->type = -1;
+    for (IJS32 i = 0; i < countof(names); i++) {
+        if (!strcmp(name, names[i]))
+            op->type = i;
+    }
+    if (op->type < 0)
+        JS_ThrowTypeError(ctx, "unknown batch op '%s'", name);
+    JS_FreeCString(ctx, name);
+    if (op->type < 0)
+        return -1;
+    op->pos = -1;
+    switch (op->type) {
+        case BATCH_OPEN: {
+            if (!(op->path = ijBatchGetPath(ctx, obj, "path")))
+                return -1;
+            v = JS_GetPropertyStr(ctx, obj, "flags");
+            size_t len;
+            const IJAnsi* flags = JS_IsUndefined(v) ? NULL : JS_ToCStringLen(ctx, &len, v);
+            JS_FreeValue(ctx, v);
+            op->flags = flags ? ijUvOpenFlags(flags, len) : O_RDONLY;
+            JS_FreeCString(ctx, flags);
+            op->mode = 0666;
+            v = JS_GetPropertyStr(ctx, obj, "mode");
+            IJS32 r = !JS_IsUndefined(v) && JS_ToInt32(ctx, &op->mode, v);
+            JS_FreeValue(ctx, v);
+            return r ? -1 : 0;
+        }
+        case BATCH_RENAME:
+            op->path = ijBatchGetPath(ctx, obj, "from");
+            op->new_path = op->path ? ijBatchGetPath(ctx, obj, "to") : NULL;
+            return op->new_path ? 0 : -1;
+        case BATCH_UNLINK:
+            return (op->path = ijBatchGetPath(ctx, obj, "path")) ? 0 : -1;
+        case BATCH_WRITE: {
+            v = JS_GetPropertyStr(ctx, obj, "position");
+            IJS32 r = !JS_IsUndefined(v) && JS_ToInt64(ctx, &op->pos, v);
+            JS_FreeValue(ctx, v);
+            if (r)
+                return -1;
+            v = JS_GetPropertyStr(ctx, obj, "data");
+            r = ijStreamGetData(ctx, v, &op->buf, &op->pin);
+            JS_FreeValue(ctx, v);
+            if (r)
+                return -1;
+        }
+        /* fall through */
+        case BATCH_FSYNC:
+        case BATCH_FDATASYNC:
+            v = JS_GetPropertyStr(ctx, obj, "file");
+            if (!JS_IsUndefined(v)) {
+                op->f = ijFileGet(ctx, v);
+                if (!op->f) {
+                    JS_FreeValue(ctx, v);
+                    return -1;
+                }
+                if (op->f->fd == -1 || op->f->closing) {
+                    op->f = NULL;
+                    JS_FreeValue(ctx, v);
+                    ijThrowErrno(ctx, UV_EBADF);
+                    return -1;
+                }
+                op->f->busy++;
+                op->file = v;
+            }
+            return 0;
+        default:
+            return 0;
+    }
+}
+
+static JSValue ijFsBatch(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJU32 n;
+    JSValue v = JS_GetPropertyStr(ctx, argv[0], "length");
+    IJS32 r = JS_ToUint32(ctx, &n, v);
+    JS_FreeValue(ctx, v);
+    if (r)
+        return JS_EXCEPTION;
+    if (n > INT32_MAX / sizeof(IJJSBatchOp))
+        return ijThrowErrno(ctx, UV_EINVAL);
+    IJJSBatchReq* br = js_mallocz(ctx, sizeof(*br) + n * sizeof(IJJSBatchOp));
+    if (!br)
+        return JS_EXCEPTION;
+    br->ctx = ctx;
+    br->req.data = br;
+    for (IJU32 i = 0; i < n; i++) {
+        IJJSBatchOp* op = &br->ops[br->nops++];
+        op->file = JS_UNDEFINED;
+        op->pin.value = JS_UNDEFINED;
+        v = JS_GetPropertyUint32(ctx, argv[0], i);
+        r = JS_IsObject(v) ? ijBatchParse(ctx, v, op) : (JS_ThrowTypeError(ctx, "batch op must be an object"), -1);
+        JS_FreeValue(ctx, v);
+        if (r) {
+            ijBatchFree(ctx, br);
+            return JS_EXCEPTION;
+        }
+    }
+    r = ijQueueWork(ctx, IJJS_LANE_FS, &br->req, ijBatchWorkCb, ijBatchAfterWorkCb);
+    if (r != 0) {
+        ijBatchFree(ctx, br);
+        return ijThrowErrno(ctx, r);
+    }
+    return ijInitPromise(ctx, &br->result);
+}
+
+enum {
+    IJJS_MADV_NORMAL = 0,
+    IJJS_MADV_RANDOM,
+    IJJS_MADV_SEQUENTIAL,
+    IJJS_MADV_WILLNEED,
+    IJJS_MADV_DONTNEED,
+};
+
+typedef struct IJJSMapping {
+    struct IJJSMapping* next;
+    IJVoid* base;
+    size_t base_len;
+    IJBool shared;
+} IJJSMapping;
+
+typedef struct {
+    IJJSWork req;
+    JSContext* ctx;
+    IJAnsi* path;
+    JSValue obj;
+    IJJSFile* f;
+    uv_file fd;
+    IJU64 offset;
+    IJU64 length;
+    IJBool shared;
+    IJS32 r;
+    IJVoid* base;
+    size_t base_len;
+    IJJSPromise result;
+} IJJSMmapReq;
+
+typedef struct {
+    IJJSWork req;
+    JSContext* ctx;
+    JSValue buf;
+    IJVoid* addr;
+    size_t len;
+    IJS32 r;
+    IJJSPromise result;
+} IJJSMsyncReq;
+
+static IJVoid ijMappingFree(JSRuntime* rt, IJVoid* opaque, IJVoid* ptr) {
+    IJJSMapping* m = opaque;
+    if (!ptr)
+        return;
+    CHECK_NOT_NULL(m);
+    IJJSRuntime* qrt = JS_GetRuntimeOpaque(rt);
+    CHECK_NOT_NULL(qrt);
+    IJJSMapping** pp = &qrt->maps;
+    while (*pp && *pp != m)
+        pp = &(*pp)->next;
+    if (*pp)
+        *pp = m->next;
+    ijUnmapRegion(m->base, m->base_len);
+    js_free_rt(rt, m);
+}
+
+static IJJSMapping* ijMappingGet(JSContext* ctx, JSValueConst buf, IJU8** data, size_t* size) {
+    *data = JS_GetArrayBuffer(ctx, size, buf);
+    if (!*data)
+        return NULL;
+    for (IJJSMapping* m = ijGetRuntime(ctx)->maps; m; m = m->next) {
+        if (*data >= (IJU8*)m->base && *data + *size <= (IJU8*)m->base + m->base_len)
+            return m;
+    }
+    JS_ThrowTypeError(ctx, "not a mapped ArrayBuffer");
+    return NULL;
+}
+
+static IJS32 ijMappingRange(JSContext* ctx, JSValueConst buf, IJS32 argc, JSValueConst* argv, IJJSMapping** mp, IJU8** addr, size_t* len) {
+    IJU8* data;
+    size_t size;
+    IJJSMapping* m = ijMappingGet(ctx, buf, &data, &size);
+    if (!m)
+        return -1;
+    IJU64 offset = 0;
+    IJU64 length = UINT64_MAX;
+    if (argc > 0 && !JS_IsUndefined(argv[0]) && JS_ToIndex(ctx, &offset, argv[0]))
+        return -1;
+    if (argc > 1 && !JS_IsUndefined(argv[1]) && JS_ToIndex(ctx, &length, argv[1]))
+        return -1;
+    if (offset > size) {
+        JS_ThrowRangeError(ctx, "offset is out of bounds");
+        return -1;
+    }
+    if (length > size - offset)
+        length = size - offset;
+    IJU8* start = data + offset;
+    IJU8* page = start - (size_t)(start - (IJU8*)m->base) % ijMapGranularity();
+    *mp = m;
+    *addr = page;
+    *len = (size_t)length + (start - page);
+    return 0;
+}
+
+static IJVoid ijMmapWorkCb(IJJSWork* req) {
+    IJJSMmapReq* mr = req->data;
+    CHECK_NOT_NULL(mr);
+    uv_fs_t fs;
+    uv_file fd = mr->fd;
+    IJS32 r = 0;
+    if (mr->path) {
+        r = uv_fs_open(NULL, &fs, mr->path, mr->shared ? O_RDWR : O_RDONLY, 0, NULL);
+        uv_fs_req_cleanup(&fs);
+        if (r < 0) {
+            mr->r = r;
+            return;
+        }
+        fd = r;
+    }
+    r = uv_fs_fstat(NULL, &fs, fd, NULL);
+    IJU64 size = fs.statbuf.st_size;
+    uv_fs_req_cleanup(&fs);
+    if (r == 0) {
+        if (mr->offset > size)
+            r = UV_EINVAL;
+        else if (mr->length == UINT64_MAX)
+            mr->length = size - mr->offset;
+        else if (mr->length > size - mr->offset)
+            r = UV_EINVAL; /* pages past EOF raise SIGBUS when touched */
+        if (r == 0 && mr->length == 0)
+            r = UV_EINVAL;
+    }
+    if (r == 0)
+        r = ijMapRegion(fd, mr->offset, mr->length, mr->shared, &mr->base, &mr->base_len);
+    if (mr->path) {
+        uv_fs_close(NULL, &fs, fd, NULL);
+        uv_fs_req_cleanup(&fs);
+    }
+    mr->r = r;
+}
+
+static IJVoid ijMmapAfterWorkCb(IJJSWork* req, IJS32 status) {
+    IJJSMmapReq* mr = req->data;
+    CHECK_NOT_NULL(mr);
+    JSContext* ctx = mr->ctx;
+    JSValue arg;
+    IJBool is_reject = false;
+    IJJSMapping* m = NULL;
+    if (status != 0 || mr->r < 0) {
+        arg = ijNewError(ctx, status != 0 ? status : mr->r);
+        is_reject = true;
+    } else if (!(m = js_malloc(ctx, sizeof(*m)))) {
+        ijUnmapRegion(mr->base, mr->base_len);
+        arg = JS_GetException(ctx);
+        is_reject = true;
+    } else {
+        IJJSRuntime* qrt = ijGetRuntime(ctx);
+        m->base = mr->base;
+        m->base_len = mr->base_len;
+        m->shared = mr->shared;
+        m->next = qrt->maps;
+        qrt->maps = m;
+        IJU8* data = (IJU8*)mr->base + (mr->base_len - mr->length);
+        arg = JS_NewArrayBuffer(ctx, data, (size_t)mr->length, ijMappingFree, m, false);
+    }
+    if (mr->f)
+        ijFileUnbusy(mr->f);
+    ijSettlePromise(ctx, &mr->result, is_reject, 1, (JSValueConst*)&arg);
+    ijClearPromise(ctx, &mr->result);
+    JS_FreeValue(ctx, mr->obj);
+    js_free(ctx, mr->path);
+    js_free(ctx, mr);
+}
+
+static JSValue ijFsMmap(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJU64 offset = 0;
+    IJU64 length = UINT64_MAX;
+    IJBool writable = false;
+    IJBool shared = false;
+    if (JS_IsObject(argv[1])) {
+        JSValue v = JS_GetPropertyStr(ctx, argv[1], "offset");
+        IJS32 r = !JS_IsUndefined(v) && JS_ToIndex(ctx, &offset, v);
+        JS_FreeValue(ctx, v);
+        if (r)
+            return JS_EXCEPTION;
+        v = JS_GetPropertyStr(ctx, argv[1], "length");
+        r = !JS_IsUndefined(v) && JS_ToIndex(ctx, &length, v);
+        JS_FreeValue(ctx, v);
+        if (r)
+            return JS_EXCEPTION;
+        v = JS_GetPropertyStr(ctx, argv[1], "writable");
+        writable = JS_ToBool(ctx, v);
+        JS_FreeValue(ctx, v);
+        v = JS_GetPropertyStr(ctx, argv[1], "shared");
+        shared = JS_IsUndefined(v) ? writable : JS_ToBool(ctx, v);
+        JS_FreeValue(ctx, v);
+    }
+    if (shared && !writable)
+        return JS_ThrowTypeError(ctx, "a shared mapping must be writable");
+    if (length == 0)
+        return ijThrowErrno(ctx, UV_EINVAL);
+    IJJSFile* f = JS_GetOpaque(argv[0], ijjs_file_class_id);
+    if (f && (f->closing || f->fd == -1))
+        return ijThrowErrno(ctx, UV_EBADF);
+    IJJSMmapReq* mr = js_mallocz(ctx, sizeof(*mr));
+    if (!mr)
+        return JS_EXCEPTION;
+    mr->obj = JS_UNDEFINED;
+    mr->fd = f ? f->fd : -1;
+    if (!f) {
+        const IJAnsi* path = JS_ToCString(ctx, argv[0]);
+        if (!path) {
+            js_free(ctx, mr);
+            return JS_EXCEPTION;
+        }
+        mr->path = js_strdup(ctx, path);
+        JS_FreeCString(ctx, path);
+        if (!mr->path) {
+            js_free(ctx, mr);
+            return JS_EXCEPTION;
+        }
+    }
+    mr->ctx = ctx;
+    mr->offset = offset;
+    mr->length = length;
+    mr->shared = shared;
+    mr->req.data = mr;
+    IJS32 r = ijQueueWork(ctx, IJJS_LANE_FS, &mr->req, ijMmapWorkCb, ijMmapAfterWorkCb);
+    if (r != 0) {
+        js_free(ctx, mr->path);
+        js_free(ctx, mr);
+        return ijThrowErrno(ctx, r);
+    }
+    if (f) {
+        /* the fd is used on the threadpool; a concurrent close() must wait for it */
+        f->busy++;
+        mr->f = f;
+        mr->obj = JS_DupValue(ctx, argv[0]);
+    }
+    return ijInitPromise(ctx, &mr->result);
+}
+
+static IJVoid ijMsyncWorkCb(IJJSWork* req) {
+    IJJSMsyncReq* sr = req->data;
+    CHECK_NOT_NULL(sr);
+#if IJJS_PLATFORM == IJJS_PLATFORM_WIN32
+    sr->r = FlushViewOfFile(sr->addr, sr->len) ? 0 : uv_translate_sys_error(GetLastError());
+#else
+    sr->r = msync(sr->addr, sr->len, MS_SYNC) == 0 ? 0 : uv_translate_sys_error(errno);
+#endif
+}
+
+static IJVoid ijMsyncAfterWorkCb(IJJSWork* req, IJS32 status) {
+    IJJSMsyncReq* sr = req->data;
+    CHECK_NOT_NULL(sr);
+    JSContext* ctx = sr->ctx;
+    IJS32 r = status != 0 ? status : sr->r;
+    JSValue arg = r < 0 ? ijNewError(ctx, r) : JS_UNDEFINED;
+    ijSettlePromise(ctx, &sr->result, r < 0, 1, (JSValueConst*)&arg);
+    ijClearPromise(ctx, &sr->result);
+    JS_UnpinArrayBuffer(ctx, sr->buf);
+    JS_FreeValue(ctx, sr->buf);
+    js_free(ctx, sr);
+}
+
+static JSValue ijFsMsync(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJJSMapping* m;
+    IJU8* addr;
+    size_t len;
+    if (ijMappingRange(ctx, argv[0], argc - 1, argv + 1, &m, &addr, &len))
+        return JS_EXCEPTION;
+    if (!m->shared || len == 0)
+        return ijNewResolvedPromise(ctx, 0, NULL);
+    IJJSMsyncReq* sr = js_mallocz(ctx, sizeof(*sr));
+    if (!sr)
+        return JS_EXCEPTION;
+    sr->ctx = ctx;
+    sr->buf = JS_DupValue(ctx, argv[0]);
+    sr->addr = addr;
+    sr->len = len;
+    sr->req.data = sr;
+    IJS32 r = ijQueueWork(ctx, IJJS_LANE_FS, &sr->req, ijMsyncWorkCb, ijMsyncAfterWorkCb);
+    if (r != 0) {
+        JS_FreeValue(ctx, sr->buf);
+        js_free(ctx, sr);
+        return ijThrowErrno(ctx, r);
+    }
+    // the worker flushes the pages, unmap() must wait for it
+    JS_PinArrayBuffer(ctx, sr->buf);
+    return ijInitPromise(ctx, &sr->result);
+}
+
+static JSValue ijFsMadvise(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJS32 advice;
+    if (JS_ToInt32(ctx, &advice, argv[1]))
+        return JS_EXCEPTION;
+    IJJSMapping* m;
+    IJU8* addr;
+    size_t len;
+    if (ijMappingRange(ctx, argv[0], argc - 2, argv + 2, &m, &addr, &len))
+        return JS_EXCEPTION;
+#if IJJS_PLATFORM == IJJS_PLATFORM_WIN32
+    if (advice < IJJS_MADV_NORMAL || advice > IJJS_MADV_DONTNEED)
+        return ijThrowErrno(ctx, UV_EINVAL);
+#else
+    IJS32 native;
+    switch (advice) {
+        case IJJS_MADV_NORMAL:
+            native = MADV_NORMAL;
+            break;
+        case IJJS_MADV_RANDOM:
+            native = MADV_RANDOM;
+            break;
+        case IJJS_MADV_SEQUENTIAL:
+            native = MADV_SEQUENTIAL;
+            break;
+        case IJJS_MADV_WILLNEED:
+            native = MADV_WILLNEED;
+            break;
+        case IJJS_MADV_DONTNEED:
+            native = MADV_DONTNEED;
+            break;
+        default:
+            return ijThrowErrno(ctx, UV_EINVAL);
+    }
+    if (len > 0 && madvise(addr, len, native) != 0)
+        return ijThrowErrno(ctx, uv_translate_sys_error(errno));
+#endif
+    return JS_UNDEFINED;
+}
+
+static JSValue ijFsUnmap(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJU8* data;
+    size_t size;
+    if (!ijMappingGet(ctx, argv[0], &data, &size))
+        return JS_EXCEPTION;
+    // a pending write still reads from the mapping
+    if (JS_IsArrayBufferPinned(argv[0]))
+        return ijThrowErrno(ctx, UV_EBUSY);
+    if (JS_DetachArrayBuffer(ctx, argv[0]))
+        return JS_EXCEPTION;
+    return JS_UNDEFINED;
+}
+
+static JSValue ijFsUringSupported(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    return JS_NewBool(ctx, ijUringSupported());
+}
+
+#define IJJS_WALK_DEFAULT_BATCH 256
+#define IJJS_WALK_READDIR_SIZE 64
+
+typedef struct {
+    IJAnsi* path;
+    IJS32 type;
+    IJS32 depth;
+    IJS32 stat_r;
+    IJS32 error;
+    uv_stat_t st;
+} IJJSWalkEntry;
+
+typedef struct {
+    uv_dir_t* dir;
+    uv_fs_t req;
+    uv_dirent_t dirents[IJJS_WALK_READDIR_SIZE];
+    IJS32 count;
+    IJS32 pos;
+    IJAnsi* path;
+    IJS32 depth;
+    IJU64 dev;
+    IJU64 ino;
+} IJJSWalkDir;
+
+typedef struct {
+    JSContext* ctx;
+    IJJSWork req;
+    JSValue obj;
+    IJAnsi* root;
+    size_t root_len;
+    IJAnsi** include;
+    IJU32 ninclude;
+    IJAnsi** exclude;
+    IJU32 nexclude;
+    IJS32 max_depth;
+    IJU32 batch;
+    IJBool follow;
+    IJBool with_stats;
+    IJJSWalkDir** stack;
+    IJU32 nstack;
+    IJJSWalkEntry* out;
+    IJU32 nout;
+    IJS32 out_error;
+    IJBool out_done;
+    IJJSWalkEntry* ready;
+    IJU32 nready;
+    IJS32 error;
+    IJBool started;
+    IJBool done;
+    IJBool busy;
+    IJBool has_ready;
+    IJBool closed;
+    JSValue pending;
+    IJU32 pending_pos;
+    IJU32 pending_len;
+    IJBool flatten;
+    IJJSPromise result;
+} IJJSWalker;
+
+static JSClassID ijjs_walker_class_id;
+
+static IJBool ijGlobMatch(const IJAnsi* p, const IJAnsi* s) {
+    while (*p) {
+        if (p[0] == '*' && p[1] == '*') {
+            p += 2;
+            if (*p == '/') {
+                p++;
+                for (;;) {
+                    if (ijGlobMatch(p, s))
+                        return true;
+                    s = strchr(s, '/');
+                    if (!s)
+                        return false;
+                    s++;
+                }
+            }
+            for (;; s++) {
+                if (ijGlobMatch(p, s))
+                    return true;
+                if (!*s)
+                    return false;
+            }
+        }
+        if (*p == '*') {
+            p++;
+            for (;; s++) {
+                if (ijGlobMatch(p, s))
+                    return true;
+                if (!*s || *s == '/')
+                    return false;
+            }
+        }
+        if (!*s)
+            return false;
+        if (*p == '?') {
+            if (*s == '/')
+                return false;
+        } else if (*p == '[' && strchr(p + 1, ']')) {
+            const IJAnsi* q = p + 1;
+            IJBool neg = *q == '!' || *q == '^';
+            IJBool hit = false;
+            if (neg)
+                q++;
+            do {
+                if (q[1] == '-' && q[2] && q[2] != ']') {
+                    hit |= *s >= q[0] && *s <= q[2];
+                    q += 3;
+                } else {
+                    hit |= *s == *q;
+                    q++;
+                }
+            } while (*q && *q != ']');
+            if (hit == neg || *s == '/')
+                return false;
+            p = q;
+        } else if (*p != *s) {
+            return false;
+        }
+        p++;
+        s++;
+    }
+    return !*s;
+}
+
+static IJBool ijWalkMatchAny(IJAnsi** patterns, IJU32 n, const IJAnsi* rel) {
+    const IJAnsi* base = strrchr(rel, '/');
+    base = base ? base + 1 : rel;
+    for (IJU32 i = 0; i < n; i++) {
+        if (ijGlobMatch(patterns[i], strchr(patterns[i], '/') ? rel : base))
+            return true;
+    }
+    return false;
+}
+
+static IJAnsi* ijWalkJoin(const IJAnsi* dir, const IJAnsi* name) {
+    size_t dlen = strlen(dir);
+    size_t nlen = strlen(name);
+    IJAnsi* path = je_malloc(dlen + nlen + 2);
+    if (!path)
+        return NULL;
+    memcpy(path, dir, dlen);
+    path[dlen] = '/';
+    memcpy(path + dlen + 1, name, nlen + 1);
+    return path;
+}
+
+static IJS32 ijWalkModeType(IJU64 mode) {
+    switch (mode & S_IFMT) {
+        case S_IFDIR:
+            return UV_DIRENT_DIR;
+        case S_IFREG:
+            return UV_DIRENT_FILE;
+        case S_IFLNK:
+            return UV_DIRENT_LINK;
+        default:
+            return UV_DIRENT_UNKNOWN;
+    }
+}
+
+static IJS32 ijWalkPush(IJJSWalker* w, IJAnsi* path, IJS32 depth, uv_stat_t* st) {
+    uv_fs_t req;
+    IJS32 r = uv_fs_opendir(NULL, &req, path, NULL);
+    if (r != 0) {
+        uv_fs_req_cleanup(&req);
+        je_free(path);
+        return r;
+    }
+    IJJSWalkDir* d = je_calloc(1, sizeof(*d));
+    IJJSWalkDir** stack = d ? je_realloc(w->stack, (w->nstack + 1) * sizeof(*stack)) : NULL;
+    if (!stack) {
+        je_free(d);
+        uv_fs_closedir(NULL, &req, req.ptr, NULL);
+        je_free(path);
+        return UV_ENOMEM;
+    }
+    d->dir = req.ptr;
+    uv_fs_req_cleanup(&req);
+    d->path = path;
+    d->depth = depth;
+    if (st) {
+        d->dev = st->st_dev;
+        d->ino = st->st_ino;
+    }
+    w->stack = stack;
+    w->stack[w->nstack++] = d;
+    return 0;
+}
+
+static IJVoid ijWalkPop(IJJSWalker* w) {
+    IJJSWalkDir* d = w->stack[--w->nstack];
+    uv_fs_t req;
+    uv_fs_req_cleanup(&d->req);
+    uv_fs_closedir(NULL, &req, d->dir, NULL);
+    uv_fs_req_cleanup(&req);
+    je_free(d->path);
+    je_free(d);
+}
+
+static IJBool ijWalkIsLoop(IJJSWalker* w, uv_stat_t* st) {
+    for (IJU32 i = 0; i < w->nstack; i++) {
+        if (w->stack[i]->dev == st->st_dev && w->stack[i]->ino == st->st_ino)
+            return true;
+    }
+    return false;
+}
+
+static IJVoid ijWalkFreeEntries(IJJSWalkEntry* entries, IJU32 n) {
+    for (IJU32 i = 0; i < n; i++)
+        je_free(entries[i].path);
+    je_free(entries);
+}
+
+static IJVoid ijWalkWorkCb(IJJSWork* req) {
+    IJJSWalker* w = req->data;
+    w->out = je_malloc(w->batch * sizeof(*w->out));
+    w->nout = 0;
+    if (!w->out) {
+        w->out_error = UV_ENOMEM;
+        return;
+    }
+    if (!w->started) {
+        w->started = true;
+        uv_fs_t sreq;
+        uv_stat_t st;
+        IJS32 r = uv_fs_stat(NULL, &sreq, w->root, NULL);
+        st = sreq.statbuf;
+        uv_fs_req_cleanup(&sreq);
+        IJAnsi* root = r == 0 ? je_malloc(w->root_len + 1) : NULL;
+        if (root)
+            memcpy(root, w->root, w->root_len + 1);
+        else if (r == 0)
+            r = UV_ENOMEM;
+        if (r == 0)
+            r = ijWalkPush(w, root, 0, &st);
+        if (r != 0) {
+            w->out_error = r;
+            return;
+        }
+    }
+    while (w->nout < w->batch && w->nstack > 0) {
+        IJJSWalkDir* d = w->stack[w->nstack - 1];
+        if (d->pos == d->count) {
+            uv_fs_req_cleanup(&d->req);
+            d->dir->dirents = d->dirents;
+            d->dir->nentries = IJJS_WALK_READDIR_SIZE;
+            d->count = uv_fs_readdir(NULL, &d->req, d->dir, NULL);
+            d->pos = 0;
+            if (d->count <= 0) {
+                ijWalkPop(w);
+                continue;
+            }
+        }
+        uv_dirent_t* de = &d->dirents[d->pos++];
+        IJAnsi* path = ijWalkJoin(d->path, de->name);
+        if (!path)
+            continue;
+        const IJAnsi* rel = path + w->root_len + 1;
+        if (w->nexclude && ijWalkMatchAny(w->exclude, w->nexclude, rel)) {
+            je_free(path);
+            continue;
+        }
+        IJJSWalkEntry e = { .path = path, .type = de->type, .depth = d->depth + 1, .stat_r = UV_ENOENT };
+        IJBool link = e.type == UV_DIRENT_LINK;
+        if (w->with_stats || e.type == UV_DIRENT_UNKNOWN || (w->follow && (link || e.type == UV_DIRENT_DIR))) {
+            uv_fs_t sreq;
+            e.stat_r = w->follow ? uv_fs_stat(NULL, &sreq, path, NULL) : uv_fs_lstat(NULL, &sreq, path, NULL);
+            if (e.stat_r != 0 && w->follow) {
+                uv_fs_req_cleanup(&sreq);
+                e.stat_r = uv_fs_lstat(NULL, &sreq, path, NULL);
+            }
+            if (e.stat_r == 0) {
+                e.st = sreq.statbuf;
+                e.type = ijWalkModeType(e.st.st_mode);
+            }
+            uv_fs_req_cleanup(&sreq);
+        }
+        IJBool descend = e.type == UV_DIRENT_DIR && (w->max_depth < 0 || e.depth < w->max_depth) &&
+                         !(link && e.stat_r == 0 && ijWalkIsLoop(w, &e.st));
+        if (descend) {
+            IJAnsi* copy = ijWalkJoin(d->path, de->name);
+            e.error = copy ? ijWalkPush(w, copy, e.depth, e.stat_r == 0 ? &e.st : NULL) : UV_ENOMEM;
+        }
+        // A directory we could not enter is reported even when filtered
+        // out, its subtree is missing from the walk.
+        if (!e.error && w->ninclude && !ijWalkMatchAny(w->include, w->ninclude, rel)) {
+            je_free(path);
+            continue;
+        }
+        w->out[w->nout++] = e;
+    }
+    w->out_done = w->nstack == 0;
+}
+
+static JSValue ijWalkEntryObj(JSContext* ctx, IJJSWalker* w, IJJSWalkEntry* e) {
+    JSValue item = JS_NewObjectProto(ctx, JS_NULL);
+    JS_DefinePropertyValueStr(ctx, item, "path", JS_NewString(ctx, e->path), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, item, "type", JS_NewInt32(ctx, e->type), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, item, "depth", JS_NewInt32(ctx, e->depth), JS_PROP_C_W_E);
+    if (w->with_stats)
+        JS_DefinePropertyValueStr(ctx, item, "stat", e->stat_r == 0 ? ijStat2Obj(ctx, &e->st) : JS_NULL, JS_PROP_C_W_E);
+    if (e->error)
+        JS_DefinePropertyValueStr(ctx, item, "error", ijNewError(ctx, e->error), JS_PROP_C_W_E);
+    return item;
+}
+
+static IJVoid ijWalkAfterWorkCb(IJJSWork* req, IJS32 status);
+
+static IJS32 ijWalkStart(IJJSWalker* w, JSValueConst obj) {
+    IJS32 r = ijQueueWork(w->ctx, IJJS_LANE_FS, &w->req, ijWalkWorkCb, ijWalkAfterWorkCb);
+    if (r != 0)
+        return r;
+    w->busy = true;
+    w->obj = JS_DupValue(w->ctx, obj);
+    return 0;
+}
+
+static JSValue ijWalkTake(JSContext* ctx, IJJSWalker* w, IJBool all) {
+    JSValue ret;
+    if (all && w->pending_pos == 0) {
+        ret = w->pending;
+    } else if (all) {
+        ret = JS_NewArray(ctx);
+        for (IJU32 i = w->pending_pos; i < w->pending_len; i++)
+            JS_DefinePropertyValueUint32(ctx, ret, i - w->pending_pos, JS_GetPropertyUint32(ctx, w->pending, i), JS_PROP_C_W_E);
+        JS_FreeValue(ctx, w->pending);
+    } else {
+        ret = JS_GetPropertyUint32(ctx, w->pending, w->pending_pos++);
+        if (w->pending_pos < w->pending_len)
+            return ret;
+        JS_FreeValue(ctx, w->pending);
+    }
+    w->pending = JS_UNDEFINED;
+    return ret;
+}
+
+static IJVoid ijWalkClear(IJJSWalker* w) {
+    while (w->nstack > 0)
+        ijWalkPop(w);
+    je_free(w->stack);
+    w->stack = NULL;
+    ijWalkFreeEntries(w->ready, w->nready);
+    w->ready = NULL;
+    w->nready = 0;
+    w->has_ready = false;
+    w->done = true;
+}
+
+static IJBool ijWalkDeliver(JSContext* ctx, IJJSWalker* w, JSValueConst obj, IJBool flatten, JSValue* arg) {
+    if (w->error) {
+        *arg = ijNewError(ctx, w->error);
+        w->error = 0;
+        ijWalkClear(w);
+        return true;
+    }
+    IJU32 n = w->nready;
+    JSValue items = JS_UNDEFINED;
+    if (n > 0) {
+        items = JS_NewArray(ctx);
+        for (IJU32 i = 0; i < n; i++)
+            JS_DefinePropertyValueUint32(ctx, items, i, ijWalkEntryObj(ctx, w, &w->ready[i]), JS_PROP_C_W_E);
+    }
+    ijWalkFreeEntries(w->ready, n);
+    w->ready = NULL;
+    w->nready = 0;
+    w->has_ready = false;
+    if (!w->done)
+        ijWalkStart(w, obj);
+    if (!flatten) {
+        *arg = items;
+    } else if (n > 0) {
+        w->pending = items;
+        w->pending_pos = 0;
+        w->pending_len = n;
+        *arg = ijDirIterResult(ctx, ijWalkTake(ctx, w, false));
+    } else {
+        *arg = ijDirIterResult(ctx, JS_UNDEFINED);
+    }
+    return false;
+}
+
+static IJVoid ijWalkAfterWorkCb(IJJSWork* req, IJS32 status) {
+    IJJSWalker* w = req->data;
+    JSContext* ctx = w->ctx;
+    JSValue obj = w->obj;
+    w->obj = JS_UNDEFINED;
+    w->busy = false;
+    w->error = status < 0 ? status : w->out_error;
+    w->done = w->out_done;
+    w->ready = w->out;
+    w->nready = w->out ? w->nout : 0;
+    w->out = NULL;
+    w->has_ready = true;
+    if (w->closed) {
+        ijWalkClear(w);
+    } else if (ijIsPromisePending(ctx, &w->result)) {
+        JSValue arg;
+        IJBool is_reject = ijWalkDeliver(ctx, w, obj, w->flatten, &arg);
+        ijSettlePromise(ctx, &w->result, is_reject, 1, (JSValueConst*)&arg);
+        ijClearPromise(ctx, &w->result);
+    }
+    JS_FreeValue(ctx, obj);
+}
+
+static IJVoid ijWalkerFinalizer(JSRuntime* rt, JSValue val) {
+    IJJSWalker* w = JS_GetOpaque(val, ijjs_walker_class_id);
+    if (w) {
+        ijWalkClear(w);
+        for (IJU32 i = 0; i < w->ninclude; i++)
+            je_free(w->include[i]);
+        for (IJU32 i = 0; i < w->nexclude; i++)
+            je_free(w->exclude[i]);
+        je_free(w->include);
+        je_free(w->exclude);
+        je_free(w->root);
+        JS_FreeValueRT(rt, w->pending);
+        ijFreePromiseRT(rt, &w->result);
+        je_free(w);
+    }
+}
+
+static IJVoid ijWalkerMark(JSRuntime* rt, JSValueConst val, JS_MarkFunc* mark_func) {
+    IJJSWalker* w = JS_GetOpaque(val, ijjs_walker_class_id);
+    if (w) {
+        JS_MarkValue(rt, w->pending, mark_func);
+        ijMarkPromise(rt, &w->result, mark_func);
+    }
+}
+
+static JSClassDef ijjs_walker_class = { "Walker", .finalizer = ijWalkerFinalizer, .gc_mark = ijWalkerMark };
+
+static JSValue ijWalkerRead(JSContext* ctx, JSValueConst this_val, IJBool flatten) {
+    IJJSWalker* w = JS_GetOpaque2(ctx, this_val, ijjs_walker_class_id);
+    if (!w)
+        return JS_EXCEPTION;
+    if (ijIsPromisePending(ctx, &w->result))
+        return ijThrowErrno(ctx, UV_EBUSY);
+    JSValue arg;
+    if (!JS_IsUndefined(w->pending)) {
+        arg = ijWalkTake(ctx, w, !flatten);
+        if (flatten)
+            arg = ijDirIterResult(ctx, arg);
+        return ijNewResolvedPromise(ctx, 1, (JSValueConst*)&arg);
+    }
+    if (w->has_ready) {
+        if (ijWalkDeliver(ctx, w, this_val, flatten, &arg))
+            return ijNewRejectedPromise(ctx, 1, (JSValueConst*)&arg);
+        return ijNewResolvedPromise(ctx, 1, (JSValueConst*)&arg);
+    }
+    if (w->done || w->closed) {
+        arg = flatten ? ijDirIterResult(ctx, JS_UNDEFINED) : JS_UNDEFINED;
+        return ijNewResolvedPromise(ctx, 1, (JSValueConst*)&arg);
+    }
+    if (!w->busy) {
+        IJS32 r = ijWalkStart(w, this_val);
+        if (r != 0)
+            return ijThrowErrno(ctx, r);
+    }
+    w->flatten = flatten;
+    return ijInitPromise(ctx, &w->result);
+}
+
+static JSValue ijWalkerNext(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    return ijWalkerRead(ctx, this_val, true);
+}
+
+static JSValue ijWalkerReadBatch(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    return ijWalkerRead(ctx, this_val, false);
+}
+
+static JSValue ijWalkerClose(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJJSWalker* w = JS_GetOpaque2(ctx, this_val, ijjs_walker_class_id);
+    if (!w)
+        return JS_EXCEPTION;
+    w->closed = true;
+    if (!w->busy)
+        ijWalkClear(w);
+    JS_FreeValue(ctx, w->pending);
+    w->pending = JS_UNDEFINED;
+    if (ijIsPromisePending(ctx, &w->result)) {
+        JSValue arg = w->flatten ? ijDirIterResult(ctx, JS_UNDEFINED) : JS_UNDEFINED;
+        ijSettlePromise(ctx, &w->result, false, 1, (JSValueConst*)&arg);
+        ijClearPromise(ctx, &w->result);
+    }
+    return JS_UNDEFINED;
+}
+
+static IJS32 ijWalkGetPatterns(JSContext* ctx, JSValueConst opts, const IJAnsi* name, IJAnsi*** out, IJU32* n) {
+    JSValue v = JS_GetPropertyStr(ctx, opts, name);
+    if (JS_IsException(v))
+        return -1;
+    if (JS_IsUndefined(v))
+        return 0;
+    if (JS_IsString(v)) {
+        JSValue arr = JS_NewArray(ctx);
+        JS_SetPropertyUint32(ctx, arr, 0, v);
+        v = arr;
+    }
+    IJS32 r = -1;
+    IJU32 len = 0;
+    JSValue jslen = JS_GetPropertyStr(ctx, v, "length");
+    if (!JS_IsArray(ctx, v) || JS_ToUint32(ctx, &len, jslen)) {
+        JS_ThrowTypeError(ctx, "%s must be a string or an array of strings", name);
+        goto done;
+    }
+    *out = je_calloc(len ? len : 1, sizeof(**out));
+    if (!*out) {
+        JS_ThrowOutOfMemory(ctx);
+        goto done;
+    }
+    for (; *n < len; (*n)++) {
+        JSValue item = JS_GetPropertyUint32(ctx, v, *n);
+        const IJAnsi* s = JS_ToCString(ctx, item);
+        JS_FreeValue(ctx, item);
+        if (!s)
+            goto done;
+        size_t slen = strlen(s);
+        (*out)[*n] = je_malloc(slen + 1);
+        if ((*out)[*n])
+            memcpy((*out)[*n], s, slen + 1);
+        JS_FreeCString(ctx, s);
+        if (!(*out)[*n]) {
+            JS_ThrowOutOfMemory(ctx);
+            goto done;
+        }
+    }
+    r = 0;
+done:
+    JS_FreeValue(ctx, jslen);
+    JS_FreeValue(ctx, v);
+    return r;
+}
+
+static JSValue ijFsWalk(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    size_t len;
+    const IJAnsi* root = JS_ToCStringLen(ctx, &len, argv[0]);
+    if (!root)
+        return JS_EXCEPTION;
+    JSValue obj = JS_NewObjectClass(ctx, ijjs_walker_class_id);
+    IJJSWalker* w = JS_IsException(obj) ? NULL : je_calloc(1, sizeof(*w));
+    if (!w) {
+        JS_FreeCString(ctx, root);
+        JS_FreeValue(ctx, obj);
+        return JS_IsException(obj) ? obj : JS_ThrowOutOfMemory(ctx);
+    }
+    w->ctx = ctx;
+    w->req.data = w;
+    w->obj = JS_UNDEFINED;
+    w->pending = JS_UNDEFINED;
+    w->max_depth = -1;
+    w->batch = IJJS_WALK_DEFAULT_BATCH;
+    ijClearPromise(ctx, &w->result);
+    JS_SetOpaque(obj, w);
+    while (len > 1 && (root[len - 1] == '/' || root[len - 1] == '\\'))
+        len--;
+    w->root = je_malloc(len + 1);
+    if (w->root) {
+        memcpy(w->root, root, len);
+        w->root[len] = '\0';
+        w->root_len = len;
+    }
+    JS_FreeCString(ctx, root);
+    if (!w->root) {
+        JS_FreeValue(ctx, obj);
+        return JS_ThrowOutOfMemory(ctx);
+    }
+    JSValueConst opts = argv[1];
+    if (JS_IsObject(opts)) {
+        JSValue v = JS_GetPropertyStr(ctx, opts, "maxDepth");
+        IJS32 err = !JS_IsUndefined(v) && JS_ToInt32(ctx, &w->max_depth, v);
+        JS_FreeValue(ctx, v);
+        v = JS_GetPropertyStr(ctx, opts, "batch");
+        err = err || (!JS_IsUndefined(v) && JS_ToUint32(ctx, &w->batch, v));
+        JS_FreeValue(ctx, v);
+        if (!err && (w->batch < 1 || w->batch > IJJS_DIR_MAX_BATCH)) {
+            JS_ThrowRangeError(ctx, "batch must be between 1 and %d", IJJS_DIR_MAX_BATCH);
+            err = 1;
+        }
+        v = JS_GetPropertyStr(ctx, opts, "followSymlinks");
+        w->follow = JS_ToBool(ctx, v);
+        JS_FreeValue(ctx, v);
+        v = JS_GetPropertyStr(ctx, opts, "withStats");
+        w->with_stats = JS_ToBool(ctx, v);
+        JS_FreeValue(ctx, v);
+        if (err || ijWalkGetPatterns(ctx, opts, "include", &w->include, &w->ninclude) ||
+            ijWalkGetPatterns(ctx, opts, "exclude", &w->exclude, &w->nexclude)) {
+            JS_FreeValue(ctx, obj);
+            return JS_EXCEPTION;
+        }
+    }
+    IJS32 r = ijWalkStart(w, obj);
+    if (r != 0) {
+        JS_FreeValue(ctx, obj);
+        return ijThrowErrno(ctx, r);
+    }
+    return obj;
+}
+
 static const JSCFunctionListEntry ijjs_file_proto_funcs[] = {
     JS_CFUNC_DEF("read", 2, ijFileRead),
     JS_CFUNC_DEF("write", 2, ijFileWrite),
+    JS_CFUNC_MAGIC_DEF("readv", 2, ijFileVec, 1),
+    JS_CFUNC_MAGIC_DEF("writev", 2, ijFileVec, 0),
     JS_CFUNC_DEF("close", 0, ijFileClose),
     JS_CFUNC_DEF("fileno", 0, ijFileFileno),
     JS_CFUNC_DEF("stat", 0, ijFileStat),
+    JS_CFUNC_MAGIC_DEF("fsync", 0, ijFileSync, 0),
+    JS_CFUNC_MAGIC_DEF("fdatasync", 0, ijFileSync, 1),
+    JS_CFUNC_DEF("sendTo", 4, ijFileSendTo),
+    JS_CFUNC_DEF("readable", 1, ijFileReadable),
+    JS_CFUNC_DEF("writable", 1, ijFileWritable),
     JS_CGETSET_DEF("path", ijFilePathGet, NULL),
     JS_PROP_STRING_DEF("[Symbol.toStringTag]", "File", JS_PROP_CONFIGURABLE),
 };
 
+static const JSCFunctionListEntry ijjs_file_reader_proto_funcs[] = {
+    JS_CFUNC_DEF("next", 0, ijFileReaderNext),
+    JS_CFUNC_DEF("return", 0, ijFileReaderReturn),
+    JS_PROP_STRING_DEF("[Symbol.toStringTag]", "FileReadable", JS_PROP_CONFIGURABLE),
+    JS_CFUNC_DEF("[Symbol.asyncIterator]", 0, ijDirIterator),
+};
+
+static const JSCFunctionListEntry ijjs_file_writer_proto_funcs[] = {
+    JS_CFUNC_DEF("write", 1, ijFileWriterWrite),
+    JS_CFUNC_DEF("end", 0, ijFileWriterEnd),
+    JS_CGETSET_DEF("writeQueueSize", ijFileWriterQueueSizeGet, NULL),
+    JS_PROP_STRING_DEF("[Symbol.toStringTag]", "FileWritable", JS_PROP_CONFIGURABLE),
+};
+
 static const JSCFunctionListEntry ijjs_dir_proto_funcs[] = {
     JS_CFUNC_DEF("close", 0, ijDirClose),
     JS_CGETSET_DEF("path", ijDirPathGet, NULL),
     JS_CFUNC_DEF("next", 0, ijDirNext),
+    JS_CFUNC_DEF("read", 0, ijDirReadBatch),
     JS_PROP_STRING_DEF("[Symbol.toStringTag]", "Dir", JS_PROP_CONFIGURABLE),
     JS_CFUNC_DEF("[Symbol.asyncIterator]", 0, ijDirIterator),
 };
 
+static const JSCFunctionListEntry ijjs_walker_proto_funcs[] = {
+    JS_CFUNC_DEF("close", 0, ijWalkerClose),
+    JS_CFUNC_DEF("next", 0, ijWalkerNext),
+    JS_CFUNC_DEF("read", 0, ijWalkerReadBatch),
+    JS_PROP_STRING_DEF("[Symbol.toStringTag]", "Walker", JS_PROP_CONFIGURABLE),
+    JS_CFUNC_DEF("[Symbol.asyncIterator]", 0, ijDirIterator),
+};
+
 static const JSCFunctionListEntry ijjs_fs_funcs[] = {
     IJJS_CONST(UV_DIRENT_UNKNOWN),
     IJJS_CONST(UV_DIRENT_FILE),
@@ -795,6 +3049,11 @@ static const JSCFunctionListEntry ijjs_fs_funcs[] = {
 #ifdef S_ISUID
     IJJS_CONST(S_ISUID),
 #endif
+    JS_PROP_INT32_DEF("MADV_NORMAL", IJJS_MADV_NORMAL, JS_PROP_CONFIGURABLE),
+    JS_PROP_INT32_DEF("MADV_RANDOM", IJJS_MADV_RANDOM, JS_PROP_CONFIGURABLE),
+    JS_PROP_INT32_DEF("MADV_SEQUENTIAL", IJJS_MADV_SEQUENTIAL, JS_PROP_CONFIGURABLE),
+    JS_PROP_INT32_DEF("MADV_WILLNEED", IJJS_MADV_WILLNEED, JS_PROP_CONFIGURABLE),
+    JS_PROP_INT32_DEF("MADV_DONTNEED", IJJS_MADV_DONTNEED, JS_PROP_CONFIGURABLE),
     JS_CFUNC_DEF("open", 3, ijFsOpen),
     JS_CFUNC_MAGIC_DEF("stat", 1, ijFsStat, 0),
     JS_CFUNC_MAGIC_DEF("lstat", 1, ijFsStat, 1),
@@ -805,8 +3064,15 @@ static const JSCFunctionListEntry ijjs_fs_funcs[] = {
     JS_CFUNC_DEF("mkstemp", 1, ijFsMksTemp),
     JS_CFUNC_DEF("rmdir", 1, ijFsRmdir),
     JS_CFUNC_DEF("copyfile", 3, ijFsCopyFile),
-    JS_CFUNC_DEF("readdir", 1, ijFsReadDir),
-    JS_CFUNC_DEF("readFile", 1, ijFsReadFile),
+    JS_CFUNC_DEF("readdir", 2, ijFsReadDir),
+    JS_CFUNC_DEF("walk", 2, ijFsWalk),
+    JS_CFUNC_DEF("readFile", 2, ijFsReadFile),
+    JS_CFUNC_DEF("batch", 1, ijFsBatch),
+    JS_CFUNC_DEF("uringSupported", 0, ijFsUringSupported),
+    JS_CFUNC_DEF("mmap", 2, ijFsMmap),
+    JS_CFUNC_DEF("msync", 3, ijFsMsync),
+    JS_CFUNC_DEF("madvise", 4, ijFsMadvise),
+    JS_CFUNC_DEF("unmap", 1, ijFsUnmap),
 };
 
 IJVoid ijModFSInit(JSContext* ctx, JSModuleDef* m) {
@@ -816,13 +3082,29 @@ IJVoid ijModFSInit(JSContext* ctx, JSModuleDef* m) {
     proto = JS_NewObject(ctx);
     JS_SetPropertyFunctionList(ctx, proto, ijjs_file_proto_funcs, countof(ijjs_file_proto_funcs));
     JS_SetClassProto(ctx, ijjs_file_class_id, proto);
+    JS_NewClassID(&ijjs_file_reader_class_id);
+    JS_NewClass(JS_GetRuntime(ctx), ijjs_file_reader_class_id, &ijjs_file_reader_class);
+    proto = JS_NewObject(ctx);
+    JS_SetPropertyFunctionList(ctx, proto, ijjs_file_reader_proto_funcs, countof(ijjs_file_reader_proto_funcs));
+    JS_SetClassProto(ctx, ijjs_file_reader_class_id, proto);
+    JS_NewClassID(&ijjs_file_writer_class_id);
+    JS_NewClass(JS_GetRuntime(ctx), ijjs_file_writer_class_id, &ijjs_file_writer_class);
+    proto = JS_NewObject(ctx);
+    JS_SetPropertyFunctionList(ctx, proto, ijjs_file_writer_proto_funcs, countof(ijjs_file_writer_proto_funcs));
+    JS_SetClassProto(ctx, ijjs_file_writer_class_id, proto);
     JS_NewClassID(&ijjs_dir_class_id);
     JS_NewClass(JS_GetRuntime(ctx), ijjs_dir_class_id, &ijjs_dir_class);
     proto = JS_NewObject(ctx);
     JS_SetPropertyFunctionList(ctx, proto, ijjs_dir_proto_funcs, countof(ijjs_dir_proto_funcs));
     JS_SetClassProto(ctx, ijjs_dir_class_id, proto);
+    JS_NewClassID(&ijjs_walker_class_id);
+    JS_NewClass(JS_GetRuntime(ctx), ijjs_walker_class_id, &ijjs_walker_class);
+    proto = JS_NewObject(ctx);
+    JS_SetPropertyFunctionList(ctx, proto, ijjs_walker_proto_funcs, countof(ijjs_walker_proto_funcs));
+    JS_SetClassProto(ctx, ijjs_walker_class_id, proto);
     obj = JS_NewObject(ctx);
     JS_SetPropertyFunctionList(ctx, obj, ijjs_fs_funcs, countof(ijjs_fs_funcs));
+    JS_DefinePropertyValueStr(ctx, obj, "engine", JS_NewString(ctx, ijUringEngine(ctx)), JS_PROP_CONFIGURABLE);
     JS_SetModuleExport(ctx, m, "fs", obj);
 }
 
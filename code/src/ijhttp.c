@@ -0,0 +1,1109 @@
+/*
+ ijjs javascript runtime engine
+ Copyright (C) 2010-2017 Trix
+
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include "ijjs.h"
+#if IJJS_PLATFORM == IJJS_PLATFORM_WIN32
+#define strncasecmp _strnicmp
+#endif
+
+#define IJJS_HTTP_MAX_HEAD_SIZE (64 * 1024)
+#define IJJS_HTTP_MAX_HEADERS 100
+#define IJJS_HTTP_MAX_BODY_SIZE (1024 * 1024)
+
+enum {
+    HTTP_BODY_NONE = 0,
+    HTTP_BODY_LENGTH,
+    HTTP_BODY_CHUNK_SIZE,
+    HTTP_BODY_CHUNK_DATA,
+    HTTP_BODY_CHUNK_END,
+    HTTP_BODY_TRAILER,
+};
+
+typedef struct IJJSHttpServer IJJSHttpServer;
+
+typedef struct {
+    struct list_head link;
+    JSContext* ctx;
+    IJJSHttpServer* server;
+    uv_tcp_t tcp;
+    IJS32 refs;
+    IJS32 writes;
+    IJBool reading;
+    IJBool dispatching;
+    IJBool busy;
+    IJBool done;
+    IJBool eof;
+    IJBool closing;
+    DynBuf in;
+    size_t start;
+    size_t scan;
+    JSValue req;
+    IJS32 body_mode;
+    IJU64 body_left;
+    IJU64 max_body;
+    DynBuf body;
+} IJJSHttpConn;
+
+struct IJJSHttpServer {
+    JSContext* ctx;
+    IJS32 closed;
+    IJS32 finalized;
+    uv_tcp_t tcp;
+    JSValue self;
+    JSValue onrequest;
+    struct list_head conns;
+    IJU64 max_body;
+    IJU64 active;
+    IJU64 accepted;
+    IJU64 requests;
+};
+
+typedef struct {
+    IJJSHttpConn* conn;
+    IJBool responded;
+    IJBool keepalive;
+    IJBool head;
+    IJBool http10;
+} IJJSHttpReq;
+
+typedef struct {
+    uv_write_t req;
+    IJJSHttpConn* conn;
+    DynBuf head;
+    IJS32 nbufs;
+    IJJSWriteBuf bufs[];
+} IJJSHttpWriteReq;
+
+static JSClassID ijjs_http_server_class_id;
+static JSClassID ijjs_http_request_class_id;
+
+static IJVoid ijHttpConnProcess(IJJSHttpConn* c);
+
+static const IJAnsi* ijHttpStatusText(IJS32 status) {
+    switch (status) {
+    case 100: return "Continue";
+    case 101: return "Switching Protocols";
+    case 200: return "OK";
+    case 201: return "Created";
+    case 202: return "Accepted";
+    case 204: return "No Content";
+    case 206: return "Partial Content";
+    case 301: return "Moved Permanently";
+    case 302: return "Found";
+    case 303: return "See Other";
+    case 304: return "Not Modified";
+    case 307: return "Temporary Redirect";
+    case 308: return "Permanent Redirect";
+    case 400: return "Bad Request";
+    case 401: return "Unauthorized";
+    case 403: return "Forbidden";
+    case 404: return "Not Found";
+    case 405: return "Method Not Allowed";
+    case 408: return "Request Timeout";
+    case 409: return "Conflict";
+    case 411: return "Length Required";
+    case 413: return "Payload Too Large";
+    case 414: return "URI Too Long";
+    case 415: return "Unsupported Media Type";
+    case 429: return "Too Many Requests";
+    case 431: return "Request Header Fields Too Large";
+    case 500: return "Internal Server Error";
+    case 501: return "Not Implemented";
+    case 502: return "Bad Gateway";
+    case 503: return "Service Unavailable";
+    case 504: return "Gateway Timeout";
+    default: return "Unknown";
+    }
+}
+
+static IJVoid ijHttpConnUnref(IJJSHttpConn* c) {
+    if (--c->refs > 0)
+        return;
+    dbuf_free(&c->in);
+    dbuf_free(&c->body);
+    JS_FreeValue(c->ctx, c->req);
+    js_free(c->ctx, c);
+}
+
+static IJVoid uvHttpConnCloseCb(uv_handle_t* handle) {
+    ijHttpConnUnref(handle->data);
+}
+
+static IJVoid ijHttpConnDropReq(IJJSHttpConn* c) {
+    /* a request that is still being parsed holds a connection ref; nobody will answer it */
+    JSValue req = c->req;
+    if (JS_IsUndefined(req))
+        return;
+    c->req = JS_UNDEFINED;
+    IJJSHttpReq* r = JS_GetOpaque(req, ijjs_http_request_class_id);
+    if (r)
+        r->responded = true;
+    JS_FreeValue(c->ctx, req);
+}
+
+static IJVoid ijHttpConnClose(IJJSHttpConn* c) {
+    if (c->closing)
+        return;
+    c->closing = true;
+    c->reading = false;
+    ijHttpConnDropReq(c);
+    list_del(&c->link);
+    if (c->server)
+        c->server->active--;
+    uv_close((uv_handle_t*)&c->tcp, uvHttpConnCloseCb);
+}
+
+static IJVoid ijHttpConnMaybeClose(IJJSHttpConn* c) {
+    if (!c->closing && c->writes == 0 && (c->done || (c->eof && !c->busy)))
+        ijHttpConnClose(c);
+}
+
+static IJVoid uvHttpWriteCb(uv_write_t* req, IJS32 status) {
+    IJJSHttpWriteReq* wr = req->data;
+    IJJSHttpConn* c = wr->conn;
+    ijStreamReleaseBufs(c->ctx, wr->bufs, wr->nbufs);
+    dbuf_free(&wr->head);
+    js_free(c->ctx, wr);
+    c->writes--;
+    if (status < 0)
+        ijHttpConnClose(c);
+    if (!c->closing)
+        ijHttpConnProcess(c);
+    ijHttpConnUnref(c);
+}
+
+static IJS32 ijHttpWrite(IJJSHttpConn* c, IJJSHttpWriteReq* wr, uv_buf_t* bufs, IJS32 nbufs) {
+    wr->req.data = wr;
+    wr->conn = c;
+    IJS32 r = uv_write(&wr->req, (uv_stream_t*)&c->tcp, bufs, nbufs, uvHttpWriteCb);
+    if (r != 0) {
+        ijStreamReleaseBufs(c->ctx, wr->bufs, wr->nbufs);
+        dbuf_free(&wr->head);
+        js_free(c->ctx, wr);
+        ijHttpConnClose(c);
+        return r;
+    }
+    c->refs++;
+    c->writes++;
+    return 0;
+}
+
+static IJVoid ijHttpWriteStatus(IJJSHttpConn* c, IJS32 status, const IJAnsi* extra) {
+    IJJSHttpWriteReq* wr = js_mallocz(c->ctx, sizeof(*wr));
+    if (!wr) {
+        ijHttpConnClose(c);
+        return;
+    }
+    dbuf_init2(&wr->head, JS_GetRuntime(c->ctx), (DynBufReallocFunc*)js_realloc_rt);
+    dbuf_printf(&wr->head, "HTTP/1.1 %d %s\r\n%s\r\n", status, ijHttpStatusText(status), extra);
+    uv_buf_t b = uv_buf_init((IJAnsi*)wr->head.buf, wr->head.size);
+    ijHttpWrite(c, wr, &b, 1);
+}
+
+static IJVoid ijHttpSendError(IJJSHttpConn* c, IJS32 status) {
+    c->done = true;
+    ijHttpWriteStatus(c, status, "Content-Length: 0\r\nConnection: close\r\n");
+}
+
+static IJBool ijHttpIsToken(IJAnsi ch) {
+    if (ch <= 32 || ch >= 127)
+        return false;
+    return strchr("()<>@,;:\\\"/[]?={}", ch) == NULL;
+}
+
+static IJBool ijHttpHasToken(const IJAnsi* value, size_t len, const IJAnsi* token) {
+    size_t tlen = strlen(token);
+    size_t i = 0;
+    while (i < len) {
+        while (i < len && (value[i] == ' ' || value[i] == '\t' || value[i] == ','))
+            i++;
+        size_t j = i;
+        while (j < len && value[j] != ',')
+            j++;
+        size_t k = j;
+        while (k > i && (value[k - 1] == ' ' || value[k - 1] == '\t'))
+            k--;
+        if (k - i == tlen && strncasecmp(value + i, token, tlen) == 0)
+            return true;
+        i = j;
+    }
+    return false;
+}
+
+static IJBool ijHttpIsOnlyToken(const IJAnsi* value, size_t len, const IJAnsi* token) {
+    size_t tlen = strlen(token);
+    size_t i = 0;
+    while (i < len) {
+        while (i < len && (value[i] == ' ' || value[i] == '\t' || value[i] == ','))
+            i++;
+        size_t j = i;
+        while (j < len && value[j] != ',')
+            j++;
+        size_t k = j;
+        while (k > i && (value[k - 1] == ' ' || value[k - 1] == '\t'))
+            k--;
+        if (k > i && (k - i != tlen || strncasecmp(value + i, token, tlen) != 0))
+            return false;
+        i = j;
+    }
+    return true;
+}
+
+static IJBool ijHttpIsLastToken(const IJAnsi* value, size_t len, const IJAnsi* token) {
+    size_t tlen = strlen(token);
+    while (len > 0 && (value[len - 1] == ' ' || value[len - 1] == '\t' || value[len - 1] == ','))
+        len--;
+    size_t i = len;
+    while (i > 0 && value[i - 1] != ',')
+        i--;
+    while (i < len && (value[i] == ' ' || value[i] == '\t'))
+        i++;
+    return len - i == tlen && strncasecmp(value + i, token, tlen) == 0;
+}
+
+static IJS32 ijHttpFindHeadEnd(IJJSHttpConn* c) {
+    const IJAnsi* buf = (const IJAnsi*)c->in.buf;
+    size_t i = c->scan > c->start + 3 ? c->scan - 3 : c->start;
+    for (; i + 3 < c->in.size; i++) {
+        if (buf[i] == '\r' && buf[i + 1] == '\n' && buf[i + 2] == '\r' && buf[i + 3] == '\n')
+            return (IJS32)(i + 4 - c->start);
+    }
+    c->scan = c->in.size;
+    return -1;
+}
+
+static JSValue ijHttpNewRequest(IJJSHttpConn* c, IJJSHttpReq** preq) {
+    JSContext* ctx = c->ctx;
+    JSValue obj = JS_NewObjectClass(ctx, ijjs_http_request_class_id);
+    if (JS_IsException(obj))
+        return obj;
+    IJJSHttpReq* r = js_mallocz(ctx, sizeof(*r));
+    if (!r) {
+        JS_FreeValue(ctx, obj);
+        return JS_EXCEPTION;
+    }
+    r->conn = c;
+    c->refs++;
+    JS_SetOpaque(obj, r);
+    *preq = r;
+    return obj;
+}
+
+static IJS32 ijHttpParseHead(IJJSHttpConn* c, IJS32 head_len, IJS32* status) {
+    JSContext* ctx = c->ctx;
+    const IJAnsi* p = (const IJAnsi*)c->in.buf + c->start;
+    const IJAnsi* end = p + head_len - 2;
+    while (p < end && (*p == '\r' || *p == '\n'))
+        p++;
+    const IJAnsi* method = p;
+    while (p < end && ijHttpIsToken(*p))
+        p++;
+    size_t method_len = p - method;
+    if (method_len == 0 || p >= end || *p != ' ')
+        return -1;
+    const IJAnsi* url = ++p;
+    while (p < end && *p != ' ' && *p != '\r')
+        p++;
+    size_t url_len = p - url;
+    if (url_len == 0 || p + 10 > end || *p != ' ')
+        return -1;
+    p++;
+    if (memcmp(p, "HTTP/1.", 7) != 0 || (p[7] != '0' && p[7] != '1') || p[8] != '\r' || p[9] != '\n')
+        return -1;
+    IJBool http10 = p[7] == '0';
+    p += 10;
+
+    JSValue headers = JS_NewObjectProto(ctx, JS_NULL);
+    IJS32 nheaders = 0;
+    IJBool has_length = false;
+    IJBool chunked = false;
+    IJBool has_chunked = false;
+    IJBool has_coding = false;
+    IJBool has_te = false;
+    IJBool conn_close = false;
+    IJBool conn_keepalive = false;
+    IJBool expect_continue = false;
+    IJU64 length = 0;
+    IJAnsi name[256];
+    while (p < end) {
+        const IJAnsi* line_end = p;
+        while (line_end < end && *line_end != '\r')
+            line_end++;
+        const IJAnsi* colon = p;
+        while (colon < line_end && ijHttpIsToken(*colon))
+            colon++;
+        size_t name_len = colon - p;
+        if (name_len == 0 || name_len >= sizeof(name) || colon >= line_end || *colon != ':' || ++nheaders > IJJS_HTTP_MAX_HEADERS) {
+            JS_FreeValue(ctx, headers);
+            if (nheaders > IJJS_HTTP_MAX_HEADERS)
+                *status = 431;
+            return -1;
+        }
+        for (size_t i = 0; i < name_len; i++)
+            name[i] = (p[i] >= 'A' && p[i] <= 'Z') ? p[i] + 32 : p[i];
+        name[name_len] = '\0';
+        const IJAnsi* value = colon + 1;
+        while (value < line_end && (*value == ' ' || *value == '\t'))
+            value++;
+        const IJAnsi* value_end = line_end;
+        while (value_end > value && (value_end[-1] == ' ' || value_end[-1] == '\t'))
+            value_end--;
+        size_t value_len = value_end - value;
+        if (strcmp(name, "content-length") == 0) {
+            IJU64 n = 0;
+            if (value_len == 0 || value_len > 15) {
+                JS_FreeValue(ctx, headers);
+                return -1;
+            }
+            for (size_t i = 0; i < value_len; i++) {
+                if (value[i] < '0' || value[i] > '9') {
+                    JS_FreeValue(ctx, headers);
+                    return -1;
+                }
+                n = n * 10 + (value[i] - '0');
+            }
+            if (has_length && n != length) {
+                JS_FreeValue(ctx, headers);
+                return -1;
+            }
+            has_length = true;
+            length = n;
+        } else if (strcmp(name, "transfer-encoding") == 0) {
+            // Repeated headers form one list, only its final coding counts.
+            has_te = true;
+            has_chunked |= ijHttpHasToken(value, value_len, "chunked");
+            chunked = ijHttpIsLastToken(value, value_len, "chunked");
+            has_coding |= !chunked || !ijHttpIsOnlyToken(value, value_len, "chunked");
+        } else if (strcmp(name, "connection") == 0) {
+            conn_close |= ijHttpHasToken(value, value_len, "close");
+            conn_keepalive |= ijHttpHasToken(value, value_len, "keep-alive");
+        } else if (strcmp(name, "expect") == 0) {
+            expect_continue = value_len == 12 && strncasecmp(value, "100-continue", 12) == 0;
+        }
+        JSAtom atom = JS_NewAtom(ctx, name);
+        JSValue prev = JS_GetProperty(ctx, headers, atom);
+        JSValue val;
+        if (JS_IsString(prev)) {
+            size_t prev_len;
+            const IJAnsi* prev_str = JS_ToCStringLen(ctx, &prev_len, prev);
+            DynBuf d;
+            dbuf_init2(&d, JS_GetRuntime(ctx), (DynBufReallocFunc*)js_realloc_rt);
+            dbuf_put(&d, (const IJU8*)prev_str, prev_len);
+            dbuf_put(&d, (const IJU8*)", ", 2);
+            dbuf_put(&d, (const IJU8*)value, value_len);
+            val = JS_NewStringLen(ctx, (const IJAnsi*)d.buf, d.size);
+            dbuf_free(&d);
+            JS_FreeCString(ctx, prev_str);
+        } else {
+            val = JS_NewStringLen(ctx, value, value_len);
+        }
+        JS_FreeValue(ctx, prev);
+        JS_DefinePropertyValue(ctx, headers, atom, val, JS_PROP_C_W_E);
+        JS_FreeAtom(ctx, atom);
+        p = line_end + 2;
+    }
+    // A body framed both ways is a smuggling attempt, and a body whose
+    // final coding is not chunked has no length we can trust. Any other
+    // coding is valid but one we cannot decode.
+    if (has_te && (has_length || (has_chunked && !chunked))) {
+        JS_FreeValue(ctx, headers);
+        return -1;
+    }
+    if (has_te && has_coding) {
+        JS_FreeValue(ctx, headers);
+        *status = 501;
+        return -1;
+    }
+    if (has_length && length > c->max_body) {
+        JS_FreeValue(ctx, headers);
+        *status = 413;
+        return -1;
+    }
+
+    IJJSHttpReq* r;
+    JSValue req = ijHttpNewRequest(c, &r);
+    if (JS_IsException(req)) {
+        JS_FreeValue(ctx, headers);
+        *status = 500;
+        return -1;
+    }
+    r->http10 = http10;
+    r->keepalive = http10 ? conn_keepalive && !conn_close : !conn_close;
+    r->head = method_len == 4 && memcmp(method, "HEAD", 4) == 0;
+    JS_DefinePropertyValueStr(ctx, req, "method", JS_NewStringLen(ctx, method, method_len), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, req, "url", JS_NewStringLen(ctx, url, url_len), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, req, "version", JS_NewString(ctx, http10 ? "1.0" : "1.1"), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, req, "headers", headers, JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, req, "keepAlive", JS_NewBool(ctx, r->keepalive), JS_PROP_C_W_E);
+    c->req = req;
+    c->start += head_len;
+    c->scan = c->start;
+    if (chunked) {
+        c->body_mode = HTTP_BODY_CHUNK_SIZE;
+    } else if (has_length && length > 0) {
+        c->body_mode = HTTP_BODY_LENGTH;
+        c->body_left = length;
+        if (dbuf_realloc(&c->body, length < IJJS_DEFAULT_HIGH_WATER_MARK ? length : IJJS_DEFAULT_HIGH_WATER_MARK)) {
+            *status = 413;
+            return -1;
+        }
+    } else {
+        c->body_mode = HTTP_BODY_NONE;
+    }
+    if (expect_continue && !http10 && c->body_mode != HTTP_BODY_NONE)
+        ijHttpWriteStatus(c, 100, "");
+    return 0;
+}
+
+static IJS32 ijHttpFindLine(IJJSHttpConn* c, size_t* len) {
+    const IJAnsi* buf = (const IJAnsi*)c->in.buf;
+    for (size_t i = c->start; i + 1 < c->in.size; i++) {
+        if (buf[i] == '\r' && buf[i + 1] == '\n') {
+            *len = i - c->start;
+            return 0;
+        }
+    }
+    return -1;
+}
+
+static IJS32 ijHttpParseBody(IJJSHttpConn* c, IJS32* status) {
+    for (;;) {
+        size_t avail = c->in.size - c->start;
+        const IJAnsi* p = (const IJAnsi*)c->in.buf + c->start;
+        size_t len;
+        switch (c->body_mode) {
+        case HTTP_BODY_NONE:
+            return 1;
+        case HTTP_BODY_LENGTH:
+        case HTTP_BODY_CHUNK_DATA: {
+            size_t n = avail < c->body_left ? avail : (size_t)c->body_left;
+            if (n > 0 && dbuf_put(&c->body, (const IJU8*)p, n))
+                return -1;
+            c->start += n;
+            c->body_left -= n;
+            if (c->body_left > 0)
+                return 0;
+            c->body_mode = c->body_mode == HTTP_BODY_LENGTH ? HTTP_BODY_NONE : HTTP_BODY_CHUNK_END;
+            break;
+        }
+        case HTTP_BODY_CHUNK_END:
+            if (avail < 2)
+                return 0;
+            if (p[0] != '\r' || p[1] != '\n')
+                return -1;
+            c->start += 2;
+            c->body_mode = HTTP_BODY_CHUNK_SIZE;
+            break;
+        case HTTP_BODY_CHUNK_SIZE: {
+            if (ijHttpFindLine(c, &len))
+                return avail > 1024 ? -1 : 0;
+            IJU64 size = 0;
+            size_t i = 0;
+            for (; i < len && i < 15; i++) {
+                IJAnsi ch = p[i];
+                IJS32 digit;
+                if (ch >= '0' && ch <= '9')
+                    digit = ch - '0';
+                else if (ch >= 'a' && ch <= 'f')
+                    digit = ch - 'a' + 10;
+                else if (ch >= 'A' && ch <= 'F')
+                    digit = ch - 'A' + 10;
+                else
+                    break;
+                size = size * 16 + digit;
+            }
+            if (i == 0 || (i < len && p[i] != ';' && p[i] != ' ' && p[i] != '\t'))
+                return -1;
+            if (size > c->max_body - c->body.size) {
+                *status = 413;
+                return -1;
+            }
+            c->start += len + 2;
+            c->body_left = size;
+            c->body_mode = size == 0 ? HTTP_BODY_TRAILER : HTTP_BODY_CHUNK_DATA;
+            break;
+        }
+        case HTTP_BODY_TRAILER:
+            if (ijHttpFindLine(c, &len))
+                return avail > IJJS_HTTP_MAX_HEAD_SIZE ? -1 : 0;
+            c->start += len + 2;
+            if (len == 0)
+                c->body_mode = HTTP_BODY_NONE;
+            break;
+        }
+    }
+}
+
+static IJS32 ijHttpParse(IJJSHttpConn* c, IJS32* status) {
+    *status = 400;
+    if (JS_IsUndefined(c->req)) {
+        IJS32 head_len = ijHttpFindHeadEnd(c);
+        if (head_len < 0) {
+            if (c->in.size - c->start > IJJS_HTTP_MAX_HEAD_SIZE) {
+                *status = 431;
+                return -1;
+            }
+            return 0;
+        }
+        if (head_len > IJJS_HTTP_MAX_HEAD_SIZE) {
+            *status = 431;
+            return -1;
+        }
+        if (ijHttpParseHead(c, head_len, status))
+            return -1;
+    }
+    return ijHttpParseBody(c, status);
+}
+
+static IJVoid ijHttpDispatch(IJJSHttpConn* c) {
+    JSContext* ctx = c->ctx;
+    JSValue req = c->req;
+    c->req = JS_UNDEFINED;
+    if (c->body.size > 0) {
+        JS_DefinePropertyValueStr(ctx, req, "body", ijNewUint8Array(ctx, c->body.buf, c->body.size), JS_PROP_C_W_E);
+        dbuf_init2(&c->body, JS_GetRuntime(ctx), (DynBufReallocFunc*)js_realloc_rt);
+    } else {
+        JS_DefinePropertyValueStr(ctx, req, "body", JS_UNDEFINED, JS_PROP_C_W_E);
+    }
+    IJJSHttpReq* r = JS_GetOpaque(req, ijjs_http_request_class_id);
+    c->busy = true;
+    IJJSHttpServer* server = c->server;
+    server->requests++;
+    if (!JS_IsFunction(ctx, server->onrequest)) {
+        JS_FreeValue(ctx, req);
+        c->busy = false;
+        ijHttpSendError(c, 500);
+        return;
+    }
+    JSValue func = JS_DupValue(ctx, server->onrequest);
+    JSValue ret = JS_Call(ctx, func, JS_UNDEFINED, 1, (JSValueConst*)&req);
+    JS_FreeValue(ctx, func);
+    if (JS_IsException(ret)) {
+        ijDumpError(ctx);
+        if (!r->responded) {
+            r->responded = true;
+            c->busy = false;
+            ijHttpSendError(c, 500);
+        }
+    }
+    JS_FreeValue(ctx, ret);
+    JS_FreeValue(ctx, req);
+}
+
+static IJVoid ijHttpConnCompact(IJJSHttpConn* c) {
+    if (c->start == 0)
+        return;
+    if (c->start == c->in.size) {
+        c->in.size = 0;
+    } else if (c->start >= c->in.size / 2) {
+        memmove(c->in.buf, c->in.buf + c->start, c->in.size - c->start);
+        c->in.size -= c->start;
+    } else {
+        return;
+    }
+    c->scan = c->scan > c->start ? c->scan - c->start : 0;
+    c->start = 0;
+}
+
+static IJVoid uvHttpAllocCb(uv_handle_t* handle, size_t suggested_size, uv_buf_t* buf) {
+    IJJSHttpConn* c = handle->data;
+    ijHttpConnCompact(c);
+    if (c->in.allocated_size - c->in.size < IJJS_DEFAULt_READ_SIZE / 4 &&
+        dbuf_realloc(&c->in, c->in.size + IJJS_DEFAULt_READ_SIZE)) {
+        buf->base = NULL;
+        buf->len = 0;
+        return;
+    }
+    buf->base = (IJAnsi*)c->in.buf + c->in.size;
+    buf->len = c->in.allocated_size - c->in.size;
+}
+
+static IJVoid uvHttpReadCb(uv_stream_t* handle, ssize_t nread, const uv_buf_t* buf) {
+    IJJSHttpConn* c = handle->data;
+    if (nread < 0) {
+        c->eof = true;
+        if (nread != UV_EOF)
+            c->done = true;
+    } else {
+        c->in.size += nread;
+    }
+    ijHttpConnProcess(c);
+}
+
+static IJVoid ijHttpConnUpdateReading(IJJSHttpConn* c) {
+    IJBool want = !c->closing && !c->done && !c->eof &&
+                  c->in.size - c->start < IJJS_DEFAULT_HIGH_WATER_MARK &&
+                  c->tcp.write_queue_size < IJJS_DEFAULT_HIGH_WATER_MARK;
+    if (want && !c->reading) {
+        if (uv_read_start((uv_stream_t*)&c->tcp, uvHttpAllocCb, uvHttpReadCb) == 0)
+            c->reading = true;
+    } else if (!want && c->reading) {
+        uv_read_stop((uv_stream_t*)&c->tcp);
+        c->reading = false;
+    }
+}
+
+static IJVoid ijHttpConnProcess(IJJSHttpConn* c) {
+    if (c->dispatching)
+        return;
+    c->dispatching = true;
+    c->refs++;
+    while (!c->closing && !c->done && !c->busy) {
+        IJS32 status;
+        IJS32 r = ijHttpParse(c, &status);
+        if (r == 0)
+            break;
+        if (r < 0) {
+            ijHttpConnDropReq(c);
+            ijHttpSendError(c, status);
+            break;
+        }
+        ijHttpDispatch(c);
+    }
+    c->dispatching = false;
+    ijHttpConnMaybeClose(c);
+    ijHttpConnUpdateReading(c);
+    ijHttpConnUnref(c);
+}
+
+static IJBool ijHttpValidName(const IJAnsi* name, size_t len) {
+    if (len == 0)
+        return false;
+    for (size_t i = 0; i < len; i++) {
+        if (!ijHttpIsToken(name[i]))
+            return false;
+    }
+    return true;
+}
+
+static IJBool ijHttpValidValue(const IJAnsi* value, size_t len) {
+    return !memchr(value, '\r', len) && !memchr(value, '\n', len) && !memchr(value, '\0', len);
+}
+
+static IJVoid ijHttpPutHeader(DynBuf* d, const IJAnsi* name, size_t name_len, const IJAnsi* value, size_t value_len) {
+    dbuf_put(d, (const IJU8*)name, name_len);
+    dbuf_put(d, (const IJU8*)": ", 2);
+    dbuf_put(d, (const IJU8*)value, value_len);
+    dbuf_put(d, (const IJU8*)"\r\n", 2);
+}
+
+static JSValue ijHttpRequestRespond(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJJSHttpReq* r = JS_GetOpaque2(ctx, this_val, ijjs_http_request_class_id);
+    if (!r)
+        return JS_EXCEPTION;
+    if (r->responded)
+        return ijThrowErrno(ctx, UV_EALREADY);
+    IJS32 status = 200;
+    if (!JS_IsUndefined(argv[0]) && JS_ToInt32(ctx, &status, argv[0]))
+        return JS_EXCEPTION;
+    if (status < 100 || status > 999)
+        return JS_ThrowRangeError(ctx, "invalid status code");
+    JSValueConst headers = argv[1];
+    JSValueConst body = argv[2];
+    IJS32 nbufs = 0;
+    IJBool is_array = JS_IsArray(ctx, body);
+    IJU32 count = 0;
+    if (is_array) {
+        JSValue v = JS_GetPropertyStr(ctx, body, "length");
+        IJS32 ret = JS_ToUint32(ctx, &count, v);
+        JS_FreeValue(ctx, v);
+        if (ret)
+            return JS_EXCEPTION;
+    } else if (!JS_IsUndefined(body) && !JS_IsNull(body)) {
+        count = 1;
+    }
+    IJBool no_body = status < 200 || status == 204 || status == 304;
+    IJJSHttpWriteReq* wr = js_mallocz(ctx, sizeof(*wr) + sizeof(IJJSWriteBuf) * count);
+    uv_buf_t* bufs = js_malloc(ctx, sizeof(uv_buf_t) * (count + 1));
+    if (!wr || !bufs) {
+        js_free(ctx, wr);
+        js_free(ctx, bufs);
+        return JS_EXCEPTION;
+    }
+    size_t body_size = 0;
+    for (IJU32 i = 0; i < count; i++) {
+        JSValue item = is_array ? JS_GetPropertyUint32(ctx, body, i) : JS_DupValue(ctx, body);
+        IJS32 ret = ijStreamGetData(ctx, item, &bufs[i + 1], &wr->bufs[i]);
+        JS_FreeValue(ctx, item);
+        if (ret) {
+            ijStreamReleaseBufs(ctx, wr->bufs, nbufs);
+            js_free(ctx, wr);
+            js_free(ctx, bufs);
+            return JS_EXCEPTION;
+        }
+        nbufs++;
+        body_size += bufs[i + 1].len;
+    }
+    wr->nbufs = nbufs;
+
+    IJJSHttpConn* c = r->conn;
+    IJBool keepalive = r->keepalive;
+    IJBool has_length = false;
+    DynBuf* d = &wr->head;
+    dbuf_init2(d, JS_GetRuntime(ctx), (DynBufReallocFunc*)js_realloc_rt);
+    dbuf_printf(d, "HTTP/1.%d %d %s\r\n", r->http10 ? 0 : 1, status, ijHttpStatusText(status));
+    if (JS_IsObject(headers)) {
+        JSPropertyEnum* tab;
+        IJU32 len;
+        if (JS_GetOwnPropertyNames(ctx, &tab, &len, headers, JS_GPN_STRING_MASK | JS_GPN_ENUM_ONLY)) {
+            ijStreamReleaseBufs(ctx, wr->bufs, nbufs);
+            dbuf_free(d);
+            js_free(ctx, wr);
+            js_free(ctx, bufs);
+            return JS_EXCEPTION;
+        }
+        IJBool failed = false;
+        for (IJU32 i = 0; i < len && !failed; i++) {
+            size_t name_len;
+            const IJAnsi* name = JS_AtomToCString(ctx, tab[i].atom);
+            if (!name)
+                continue;
+            name_len = strlen(name);
+            if (!ijHttpValidName(name, name_len)) {
+                JS_ThrowTypeError(ctx, "invalid header name '%s'", name);
+                JS_FreeCString(ctx, name);
+                failed = true;
+                break;
+            }
+            JSValue v = JS_GetProperty(ctx, headers, tab[i].atom);
+            if (name_len == 14 && strncasecmp(name, "content-length", 14) == 0)
+                has_length = true;
+            else if (name_len == 17 && strncasecmp(name, "transfer-encoding", 17) == 0)
+                has_length = true;
+            IJBool multi = JS_IsArray(ctx, v);
+            IJU32 nvalues = 1;
+            if (multi) {
+                JSValue l = JS_GetPropertyStr(ctx, v, "length");
+                JS_ToUint32(ctx, &nvalues, l);
+                JS_FreeValue(ctx, l);
+            }
+            for (IJU32 j = 0; j < nvalues && !failed; j++) {
+                JSValue item = multi ? JS_GetPropertyUint32(ctx, v, j) : JS_DupValue(ctx, v);
+                size_t value_len;
+                const IJAnsi* value = JS_ToCStringLen(ctx, &value_len, item);
+                if (value && !ijHttpValidValue(value, value_len)) {
+                    JS_ThrowTypeError(ctx, "invalid value for header '%s'", name);
+                    failed = true;
+                } else if (value) {
+                    if (name_len == 10 && strncasecmp(name, "connection", 10) == 0 && ijHttpHasToken(value, value_len, "close"))
+                        keepalive = false;
+                    ijHttpPutHeader(d, name, name_len, value, value_len);
+                } else {
+                    JS_FreeValue(ctx, JS_GetException(ctx));
+                }
+                JS_FreeCString(ctx, value);
+                JS_FreeValue(ctx, item);
+            }
+            JS_FreeValue(ctx, v);
+            JS_FreeCString(ctx, name);
+        }
+        ijFreePropEnum(ctx, tab, len);
+        if (failed) {
+            ijStreamReleaseBufs(ctx, wr->bufs, nbufs);
+            dbuf_free(d);
+            js_free(ctx, wr);
+            js_free(ctx, bufs);
+            return JS_EXCEPTION;
+        }
+    }
+    if (!has_length && !no_body)
+        dbuf_printf(d, "Content-Length: %zu\r\n", body_size);
+    if (!keepalive)
+        dbuf_putstr(d, "Connection: close\r\n");
+    else if (r->http10)
+        dbuf_putstr(d, "Connection: keep-alive\r\n");
+    dbuf_put(d, (const IJU8*)"\r\n", 2);
+    if (d->error) {
+        ijStreamReleaseBufs(ctx, wr->bufs, nbufs);
+        dbuf_free(d);
+        js_free(ctx, wr);
+        js_free(ctx, bufs);
+        return JS_ThrowOutOfMemory(ctx);
+    }
+
+    r->responded = true;
+    if (c->closing || c->done) {
+        ijStreamReleaseBufs(ctx, wr->bufs, nbufs);
+        dbuf_free(d);
+        js_free(ctx, wr);
+        js_free(ctx, bufs);
+        return JS_UNDEFINED;
+    }
+    bufs[0] = uv_buf_init((IJAnsi*)d->buf, d->size);
+    IJS32 total = (r->head || no_body) ? 1 : nbufs + 1;
+    c->busy = false;
+    if (!keepalive)
+        c->done = true;
+    ijHttpWrite(c, wr, bufs, total);
+    js_free(ctx, bufs);
+    ijHttpConnProcess(c);
+    return JS_UNDEFINED;
+}
+
+static IJVoid ijHttpRequestFinalizer(JSRuntime* rt, JSValue val) {
+    IJJSHttpReq* r = JS_GetOpaque(val, ijjs_http_request_class_id);
+    if (r) {
+        IJJSHttpConn* c = r->conn;
+        if (!r->responded && !c->closing) {
+            /* no writes from a finalizer: a request dropped without an answer ends its connection */
+            c->busy = false;
+            c->done = true;
+            ijHttpConnMaybeClose(c);
+        }
+        ijHttpConnUnref(c);
+        js_free_rt(rt, r);
+    }
+}
+
+static JSClassDef ijjs_http_request_class = { "HttpRequest", .finalizer = ijHttpRequestFinalizer };
+
+static IJVoid uvHttpServerCloseCb(uv_handle_t* handle) {
+    IJJSHttpServer* s = handle->data;
+    CHECK_NOT_NULL(s);
+    s->closed = 1;
+    if (s->finalized)
+        je_free(s);
+}
+
+static IJVoid ijHttpServerCloseInternal(IJJSHttpServer* s) {
+    while (!list_empty(&s->conns)) {
+        IJJSHttpConn* c = list_entry(s->conns.next, IJJSHttpConn, link);
+        c->server = NULL;
+        ijHttpConnClose(c);
+    }
+    s->active = 0;
+    if (!uv_is_closing((uv_handle_t*)&s->tcp))
+        uv_close((uv_handle_t*)&s->tcp, uvHttpServerCloseCb);
+}
+
+static IJVoid ijHttpServerFinalizer(JSRuntime* rt, JSValue val) {
+    IJJSHttpServer* s = JS_GetOpaque(val, ijjs_http_server_class_id);
+    if (s) {
+        JS_FreeValueRT(rt, s->onrequest);
+        s->finalized = 1;
+        if (s->closed)
+            je_free(s);
+        else
+            ijHttpServerCloseInternal(s);
+    }
+}
+
+static IJVoid ijHttpServerMark(JSRuntime* rt, JSValueConst val, JS_MarkFunc* mark_func) {
+    IJJSHttpServer* s = JS_GetOpaque(val, ijjs_http_server_class_id);
+    if (s)
+        JS_MarkValue(rt, s->onrequest, mark_func);
+}
+
+static JSClassDef ijjs_http_server_class = { "HttpServer", .finalizer = ijHttpServerFinalizer, .gc_mark = ijHttpServerMark };
+
+static IJJSHttpServer* ijHttpServerGet(JSContext* ctx, JSValueConst obj) {
+    return JS_GetOpaque2(ctx, obj, ijjs_http_server_class_id);
+}
+
+static IJVoid uvHttpConnectionCb(uv_stream_t* handle, IJS32 status) {
+    IJJSHttpServer* s = handle->data;
+    CHECK_NOT_NULL(s);
+    if (status < 0)
+        return;
+    JSContext* ctx = s->ctx;
+    IJJSHttpConn* c = js_mallocz(ctx, sizeof(*c));
+    if (!c)
+        return;
+    uv_tcp_init(ijGetLoop(ctx), &c->tcp);
+    c->tcp.data = c;
+    c->ctx = ctx;
+    c->refs = 1;
+    c->req = JS_UNDEFINED;
+    dbuf_init2(&c->in, JS_GetRuntime(ctx), (DynBufReallocFunc*)js_realloc_rt);
+    dbuf_init2(&c->body, JS_GetRuntime(ctx), (DynBufReallocFunc*)js_realloc_rt);
+    if (uv_accept(handle, (uv_stream_t*)&c->tcp) != 0) {
+        c->closing = true;
+        uv_close((uv_handle_t*)&c->tcp, uvHttpConnCloseCb);
+        return;
+    }
+    c->server = s;
+    c->max_body = s->max_body;
+    list_add_tail(&c->link, &s->conns);
+    s->active++;
+    s->accepted++;
+    uv_tcp_nodelay(&c->tcp, 1);
+    ijHttpConnUpdateReading(c);
+}
+
+static JSValue ijHttpServerConstructor(JSContext* ctx, JSValueConst new_target, IJS32 argc, JSValueConst* argv) {
+    IJS32 af = AF_UNSPEC;
+    if (!JS_IsUndefined(argv[0]) && JS_ToInt32(ctx, &af, argv[0]))
+        return JS_EXCEPTION;
+    IJU64 max_body = IJJS_HTTP_MAX_BODY_SIZE;
+    if (JS_IsObject(argv[1])) {
+        JSValue val = JS_GetPropertyStr(ctx, argv[1], "maxBodySize");
+        IJS32 r = !JS_IsUndefined(val) && JS_ToIndex(ctx, &max_body, val);
+        JS_FreeValue(ctx, val);
+        if (r)
+            return JS_EXCEPTION;
+    }
+    JSValue obj = JS_NewObjectClass(ctx, ijjs_http_server_class_id);
+    if (JS_IsException(obj))
+        return obj;
+    IJJSHttpServer* s = je_calloc(1, sizeof(*s));
+    if (!s) {
+        JS_FreeValue(ctx, obj);
+        return JS_EXCEPTION;
+    }
+    if (uv_tcp_init_ex(ijGetLoop(ctx), &s->tcp, af) != 0) {
+        JS_FreeValue(ctx, obj);
+        je_free(s);
+        return JS_ThrowInternalError(ctx, "couldn't initialize TCP handle");
+    }
+    s->ctx = ctx;
+    s->tcp.data = s;
+    s->self = JS_UNDEFINED;
+    s->onrequest = JS_UNDEFINED;
+    s->max_body = max_body;
+    init_list_head(&s->conns);
+    JS_SetOpaque(obj, s);
+    return obj;
+}
+
+static JSValue ijHttpServerBind(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJJSHttpServer* s = ijHttpServerGet(ctx, this_val);
+    if (!s)
+        return JS_EXCEPTION;
+    struct sockaddr_storage ss;
+    IJS32 r = ijObj2Addr(ctx, argv[0], &ss);
+    if (r != 0)
+        return JS_EXCEPTION;
+    IJS32 flags = 0;
+    if (!JS_IsUndefined(argv[1]) && JS_ToInt32(ctx, &flags, argv[1]))
+        return JS_EXCEPTION;
+    if (flags & IJJS_TCP_REUSEPORT) {
+        r = ijTcpSetReusePort(&s->tcp, ss.ss_family);
+        if (r != 0)
+            return ijThrowErrno(ctx, r);
+        flags &= ~IJJS_TCP_REUSEPORT;
+    }
+    r = uv_tcp_bind(&s->tcp, (struct sockaddr*)&ss, flags);
+    if (r != 0)
+        return ijThrowErrno(ctx, r);
+    return JS_UNDEFINED;
+}
+
+static JSValue ijHttpServerListen(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJJSHttpServer* s = ijHttpServerGet(ctx, this_val);
+    if (!s)
+        return JS_EXCEPTION;
+    IJU32 backlog = 511;
+    if (!JS_IsUndefined(argv[0]) && JS_ToUint32(ctx, &backlog, argv[0]))
+        return JS_EXCEPTION;
+    IJS32 r = uv_listen((uv_stream_t*)&s->tcp, (IJS32)backlog, uvHttpConnectionCb);
+    if (r != 0)
+        return ijThrowErrno(ctx, r);
+    if (JS_IsUndefined(s->self))
+        s->self = JS_DupValue(ctx, this_val);
+    return JS_UNDEFINED;
+}
+
+static JSValue ijHttpServerClose(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJJSHttpServer* s = ijHttpServerGet(ctx, this_val);
+    if (!s)
+        return JS_EXCEPTION;
+    ijHttpServerCloseInternal(s);
+    JSValue self = s->self;
+    s->self = JS_UNDEFINED;
+    JS_FreeValue(ctx, self);
+    return JS_UNDEFINED;
+}
+
+static JSValue ijHttpServerGetSockName(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJJSHttpServer* s = ijHttpServerGet(ctx, this_val);
+    if (!s)
+        return JS_EXCEPTION;
+    struct sockaddr_storage addr;
+    IJS32 namelen = sizeof(addr);
+    IJS32 r = uv_tcp_getsockname(&s->tcp, (struct sockaddr*)&addr, &namelen);
+    if (r != 0)
+        return ijThrowErrno(ctx, r);
+    return ijAddr2Obj(ctx, (struct sockaddr*)&addr);
+}
+
+static JSValue ijHttpServerStats(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJJSHttpServer* s = ijHttpServerGet(ctx, this_val);
+    if (!s)
+        return JS_EXCEPTION;
+    JSValue obj = JS_NewObjectProto(ctx, JS_NULL);
+    JS_DefinePropertyValueStr(ctx, obj, "connections", JS_NewInt64(ctx, s->active), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "accepted", JS_NewInt64(ctx, s->accepted), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "requests", JS_NewInt64(ctx, s->requests), JS_PROP_C_W_E);
+    return obj;
+}
+
+static JSValue ijHttpServerOnRequestGet(JSContext* ctx, JSValueConst this_val) {
+    IJJSHttpServer* s = ijHttpServerGet(ctx, this_val);
+    if (!s)
+        return JS_EXCEPTION;
+    return JS_DupValue(ctx, s->onrequest);
+}
+
+static JSValue ijHttpServerOnRequestSet(JSContext* ctx, JSValueConst this_val, JSValueConst value) {
+    IJJSHttpServer* s = ijHttpServerGet(ctx, this_val);
+    if (!s)
+        return JS_EXCEPTION;
+    if (JS_IsFunction(ctx, value) || JS_IsUndefined(value) || JS_IsNull(value)) {
+        JS_FreeValue(ctx, s->onrequest);
+        s->onrequest = JS_DupValue(ctx, value);
+    }
+    return JS_UNDEFINED;
+}
+
+static const JSCFunctionListEntry ijjs_http_server_proto_funcs[] = {
+    JS_CFUNC_DEF("bind", 2, ijHttpServerBind),
+    JS_CFUNC_DEF("listen", 1, ijHttpServerListen),
+    JS_CFUNC_DEF("close", 0, ijHttpServerClose),
+    JS_CFUNC_DEF("getsockname", 0, ijHttpServerGetSockName),
+    JS_CFUNC_DEF("stats", 0, ijHttpServerStats),
+    JS_CGETSET_DEF("onrequest", ijHttpServerOnRequestGet, ijHttpServerOnRequestSet),
+    JS_PROP_STRING_DEF("[Symbol.toStringTag]", "HttpServer", JS_PROP_CONFIGURABLE),
+};
+
+static const JSCFunctionListEntry ijjs_http_request_proto_funcs[] = {
+    JS_CFUNC_DEF("respond", 3, ijHttpRequestRespond),
+    JS_PROP_STRING_DEF("[Symbol.toStringTag]", "HttpRequest", JS_PROP_CONFIGURABLE),
+};
+
+IJVoid ijModHttpInit(JSContext* ctx, JSModuleDef* m) {
+    JSValue proto, obj;
+    JS_NewClassID(&ijjs_http_request_class_id);
+    JS_NewClass(JS_GetRuntime(ctx), ijjs_http_request_class_id, &ijjs_http_request_class);
+    proto = JS_NewObject(ctx);
+    JS_SetPropertyFunctionList(ctx, proto, ijjs_http_request_proto_funcs, countof(ijjs_http_request_proto_funcs));
+    JS_SetClassProto(ctx, ijjs_http_request_class_id, proto);
+    JS_NewClassID(&ijjs_http_server_class_id);
+    JS_NewClass(JS_GetRuntime(ctx), ijjs_http_server_class_id, &ijjs_http_server_class);
+    proto = JS_NewObject(ctx);
+    JS_SetPropertyFunctionList(ctx, proto, ijjs_http_server_proto_funcs, countof(ijjs_http_server_proto_funcs));
+    JS_SetClassProto(ctx, ijjs_http_server_class_id, proto);
+    obj = JS_NewCFunction2(ctx, ijHttpServerConstructor, "HttpServer", 2, JS_CFUNC_constructor, 0);
+    JS_SetModuleExport(ctx, m, "HttpServer", obj);
+}
+
+IJVoid ijModHttpExport(JSContext* ctx, JSModuleDef* m) {
+    JS_AddModuleExport(ctx, m, "HttpServer");
+}
@@ -202,10 +202,10 @@ const uint8_t abort_controller[1556] = {
  0x44, 0x26, 0xb2, 0x08,
 };
 
-const uint32_t bootstrap_size = 990;
+const uint32_t bootstrap_size = 1014;
 
-const uint8_t bootstrap[990] = {
- 0x02, 0x1a, 0x1e, 0x40, 0x69, 0x6a, 0x6a, 0x73,
+const uint8_t bootstrap[1014] = {
+ 0x02, 0x1b, 0x1e, 0x40, 0x69, 0x6a, 0x6a, 0x73,
  0x2f, 0x62, 0x6f, 0x6f, 0x74, 0x73, 0x74, 0x72,
  0x61, 0x70, 0x14, 0x40, 0x69, 0x6a, 0x6a, 0x73,
  0x2f, 0x63, 0x6f, 0x72, 0x65, 0x06, 0x6b, 0x65,
@@ -223,93 +223,96 @@ const uint8_t bootstrap[990] = {
  0x0c, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x1c,
  0x58, 0x4d, 0x4c, 0x48, 0x74, 0x74, 0x70, 0x52,
  0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x0c, 0x57,
- 0x6f, 0x72, 0x6b, 0x65, 0x72, 0x0c, 0x73, 0x69,
- 0x67, 0x6e, 0x61, 0x6c, 0x0c, 0x72, 0x61, 0x6e,
- 0x64, 0x6f, 0x6d, 0x08, 0x61, 0x72, 0x67, 0x73,
- 0x10, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e,
- 0x73, 0x08, 0x77, 0x61, 0x73, 0x6d, 0x0e, 0x65,
- 0x6e, 0x74, 0x72, 0x69, 0x65, 0x73, 0x0e, 0x69,
- 0x6e, 0x64, 0x65, 0x78, 0x4f, 0x66, 0x14, 0x73,
- 0x74, 0x61, 0x72, 0x74, 0x73, 0x57, 0x69, 0x74,
- 0x68, 0x06, 0x53, 0x49, 0x47, 0x0c, 0x66, 0x72,
- 0x65, 0x65, 0x7a, 0x65, 0x0f, 0xc0, 0x03, 0x01,
- 0xc2, 0x03, 0x00, 0x00, 0x01, 0x00, 0xf8, 0x01,
- 0x00, 0x0e, 0x00, 0x06, 0x01, 0xa0, 0x01, 0x00,
- 0x02, 0x00, 0x0c, 0x03, 0x06, 0x9d, 0x04, 0x02,
- 0xc4, 0x03, 0x02, 0x00, 0x60, 0x80, 0x01, 0x02,
- 0x01, 0x60, 0xc6, 0x03, 0x00, 0x0d, 0xc8, 0x03,
- 0x00, 0x0d, 0xca, 0x03, 0x01, 0x0d, 0x38, 0x89,
- 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x41, 0xe6,
- 0x00, 0x00, 0x00, 0x43, 0xe6, 0x00, 0x00, 0x00,
+ 0x6f, 0x72, 0x6b, 0x65, 0x72, 0x22, 0x6e, 0x65,
+ 0x77, 0x4d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65,
+ 0x43, 0x68, 0x61, 0x6e, 0x6e, 0x65, 0x6c, 0x0c,
+ 0x73, 0x69, 0x67, 0x6e, 0x61, 0x6c, 0x0c, 0x72,
+ 0x61, 0x6e, 0x64, 0x6f, 0x6d, 0x08, 0x61, 0x72,
+ 0x67, 0x73, 0x10, 0x76, 0x65, 0x72, 0x73, 0x69,
+ 0x6f, 0x6e, 0x73, 0x08, 0x77, 0x61, 0x73, 0x6d,
+ 0x0e, 0x65, 0x6e, 0x74, 0x72, 0x69, 0x65, 0x73,
+ 0x0e, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x4f, 0x66,
+ 0x14, 0x73, 0x74, 0x61, 0x72, 0x74, 0x73, 0x57,
+ 0x69, 0x74, 0x68, 0x06, 0x53, 0x49, 0x47, 0x0c,
+ 0x66, 0x72, 0x65, 0x65, 0x7a, 0x65, 0x0f, 0xc0,
+ 0x03, 0x01, 0xc2, 0x03, 0x00, 0x00, 0x01, 0x00,
+ 0xf8, 0x01, 0x00, 0x0e, 0x00, 0x06, 0x01, 0xa0,
+ 0x01, 0x00, 0x02, 0x00, 0x0d, 0x03, 0x06, 0xa2,
+ 0x04, 0x02, 0xc4, 0x03, 0x02, 0x00, 0x60, 0x80,
+ 0x01, 0x02, 0x01, 0x60, 0xc6, 0x03, 0x00, 0x0d,
+ 0xc8, 0x03, 0x00, 0x0d, 0xca, 0x03, 0x01, 0x0d,
  0x38, 0x89, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00,
- 0x41, 0xe7, 0x00, 0x00, 0x00, 0x43, 0xe7, 0x00,
+ 0x41, 0xe6, 0x00, 0x00, 0x00, 0x43, 0xe6, 0x00,
  0x00, 0x00, 0x38, 0x89, 0x00, 0x00, 0x00, 0x65,
- 0x00, 0x00, 0x41, 0xe8, 0x00, 0x00, 0x00, 0x43,
- 0xe8, 0x00, 0x00, 0x00, 0x38, 0x89, 0x00, 0x00,
- 0x00, 0x65, 0x00, 0x00, 0x41, 0xe9, 0x00, 0x00,
- 0x00, 0x43, 0xe9, 0x00, 0x00, 0x00, 0x38, 0x89,
- 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x41, 0xea,
- 0x00, 0x00, 0x00, 0x43, 0xea, 0x00, 0x00, 0x00,
+ 0x00, 0x00, 0x41, 0xe7, 0x00, 0x00, 0x00, 0x43,
+ 0xe7, 0x00, 0x00, 0x00, 0x38, 0x89, 0x00, 0x00,
+ 0x00, 0x65, 0x00, 0x00, 0x41, 0xe8, 0x00, 0x00,
+ 0x00, 0x43, 0xe8, 0x00, 0x00, 0x00, 0x38, 0x89,
+ 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x41, 0xe9,
+ 0x00, 0x00, 0x00, 0x43, 0xe9, 0x00, 0x00, 0x00,
+ 0x38, 0x89, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00,
+ 0x41, 0xea, 0x00, 0x00, 0x00, 0x43, 0xea, 0x00,
+ 0x00, 0x00, 0x38, 0x94, 0x00, 0x00, 0x00, 0x42,
+ 0x64, 0x00, 0x00, 0x00, 0x38, 0x89, 0x00, 0x00,
+ 0x00, 0x04, 0x6d, 0x00, 0x00, 0x00, 0x0b, 0x0a,
+ 0x4c, 0x3f, 0x00, 0x00, 0x00, 0xc1, 0x00, 0x54,
+ 0x41, 0x00, 0x00, 0x00, 0x04, 0xc1, 0x01, 0x54,
+ 0x42, 0x00, 0x00, 0x00, 0x04, 0x24, 0x03, 0x00,
+ 0x0e, 0x38, 0x94, 0x00, 0x00, 0x00, 0x42, 0x64,
+ 0x00, 0x00, 0x00, 0x38, 0x89, 0x00, 0x00, 0x00,
+ 0x04, 0xeb, 0x00, 0x00, 0x00, 0x0b, 0x0a, 0x4c,
+ 0x3f, 0x00, 0x00, 0x00, 0xc1, 0x02, 0x54, 0x41,
+ 0x00, 0x00, 0x00, 0x04, 0xc1, 0x03, 0x54, 0x42,
+ 0x00, 0x00, 0x00, 0x04, 0x24, 0x03, 0x00, 0x0e,
  0x38, 0x94, 0x00, 0x00, 0x00, 0x42, 0x64, 0x00,
  0x00, 0x00, 0x38, 0x89, 0x00, 0x00, 0x00, 0x04,
- 0x6d, 0x00, 0x00, 0x00, 0x0b, 0x0a, 0x4c, 0x3f,
- 0x00, 0x00, 0x00, 0xc1, 0x00, 0x54, 0x41, 0x00,
- 0x00, 0x00, 0x04, 0xc1, 0x01, 0x54, 0x42, 0x00,
+ 0xec, 0x00, 0x00, 0x00, 0x0b, 0x0a, 0x4c, 0x3f,
+ 0x00, 0x00, 0x00, 0xc1, 0x04, 0x54, 0x41, 0x00,
+ 0x00, 0x00, 0x04, 0xc1, 0x05, 0x54, 0x42, 0x00,
  0x00, 0x00, 0x04, 0x24, 0x03, 0x00, 0x0e, 0x38,
+ 0x94, 0x00, 0x00, 0x00, 0x42, 0xed, 0x00, 0x00,
+ 0x00, 0x07, 0x24, 0x01, 0x00, 0xe3, 0x04, 0xe6,
+ 0x00, 0x00, 0x00, 0x04, 0xe8, 0x00, 0x00, 0x00,
+ 0x04, 0xe7, 0x00, 0x00, 0x00, 0x04, 0xe9, 0x00,
+ 0x00, 0x00, 0x04, 0xea, 0x00, 0x00, 0x00, 0x04,
+ 0xee, 0x00, 0x00, 0x00, 0x04, 0xef, 0x00, 0x00,
+ 0x00, 0x04, 0xf0, 0x00, 0x00, 0x00, 0x04, 0xf1,
+ 0x00, 0x00, 0x00, 0x04, 0xf2, 0x00, 0x00, 0x00,
+ 0x04, 0xf3, 0x00, 0x00, 0x00, 0x04, 0xf4, 0x00,
+ 0x00, 0x00, 0x04, 0xf5, 0x00, 0x00, 0x00, 0x26,
+ 0x0d, 0x00, 0xe4, 0x65, 0x01, 0x00, 0x65, 0x00,
+ 0x00, 0x41, 0xf1, 0x00, 0x00, 0x00, 0x43, 0xf1,
+ 0x00, 0x00, 0x00, 0x61, 0x01, 0x00, 0x61, 0x00,
+ 0x00, 0x38, 0x94, 0x00, 0x00, 0x00, 0x42, 0xf6,
+ 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x24, 0x01,
+ 0x00, 0x7d, 0xed, 0x4c, 0x7d, 0x80, 0x00, 0x0e,
+ 0xca, 0x80, 0x00, 0x0e, 0xcb, 0x83, 0x65, 0x02,
+ 0x00, 0x42, 0xf7, 0x00, 0x00, 0x00, 0x62, 0x00,
+ 0x00, 0x24, 0x01, 0x00, 0xb5, 0xad, 0xec, 0x30,
+ 0x62, 0x00, 0x00, 0x42, 0xf8, 0x00, 0x00, 0x00,
+ 0x04, 0xf9, 0x00, 0x00, 0x00, 0x24, 0x01, 0x00,
+ 0xeb, 0x13, 0x65, 0x01, 0x00, 0x41, 0xf1, 0x00,
+ 0x00, 0x00, 0x62, 0x00, 0x00, 0x71, 0x62, 0x01,
+ 0x00, 0x49, 0xed, 0x0c, 0x65, 0x01, 0x00, 0x62,
+ 0x00, 0x00, 0x71, 0x62, 0x01, 0x00, 0x49, 0x80,
+ 0x00, 0xeb, 0xb2, 0x0e, 0x83, 0x65, 0x01, 0x00,
+ 0x38, 0x94, 0x00, 0x00, 0x00, 0x42, 0xfa, 0x00,
+ 0x00, 0x00, 0x65, 0x00, 0x00, 0x41, 0xf3, 0x00,
+ 0x00, 0x00, 0x24, 0x01, 0x00, 0x43, 0xf3, 0x00,
+ 0x00, 0x00, 0x65, 0x01, 0x00, 0x38, 0x94, 0x00,
+ 0x00, 0x00, 0x42, 0xfa, 0x00, 0x00, 0x00, 0x65,
+ 0x00, 0x00, 0x41, 0xf4, 0x00, 0x00, 0x00, 0x24,
+ 0x01, 0x00, 0x43, 0xf4, 0x00, 0x00, 0x00, 0x38,
  0x94, 0x00, 0x00, 0x00, 0x42, 0x64, 0x00, 0x00,
- 0x00, 0x38, 0x89, 0x00, 0x00, 0x00, 0x04, 0xeb,
+ 0x00, 0x38, 0x89, 0x00, 0x00, 0x00, 0x04, 0xe4,
  0x00, 0x00, 0x00, 0x0b, 0x0a, 0x4c, 0x3f, 0x00,
- 0x00, 0x00, 0xc1, 0x02, 0x54, 0x41, 0x00, 0x00,
- 0x00, 0x04, 0xc1, 0x03, 0x54, 0x42, 0x00, 0x00,
- 0x00, 0x04, 0x24, 0x03, 0x00, 0x0e, 0x38, 0x94,
- 0x00, 0x00, 0x00, 0x42, 0x64, 0x00, 0x00, 0x00,
- 0x38, 0x89, 0x00, 0x00, 0x00, 0x04, 0xec, 0x00,
- 0x00, 0x00, 0x0b, 0x0a, 0x4c, 0x3f, 0x00, 0x00,
- 0x00, 0xc1, 0x04, 0x54, 0x41, 0x00, 0x00, 0x00,
- 0x04, 0xc1, 0x05, 0x54, 0x42, 0x00, 0x00, 0x00,
- 0x04, 0x24, 0x03, 0x00, 0x0e, 0x38, 0x94, 0x00,
- 0x00, 0x00, 0x42, 0xed, 0x00, 0x00, 0x00, 0x07,
- 0x24, 0x01, 0x00, 0xe3, 0x04, 0xe6, 0x00, 0x00,
- 0x00, 0x04, 0xe8, 0x00, 0x00, 0x00, 0x04, 0xe7,
- 0x00, 0x00, 0x00, 0x04, 0xe9, 0x00, 0x00, 0x00,
- 0x04, 0xea, 0x00, 0x00, 0x00, 0x04, 0xee, 0x00,
- 0x00, 0x00, 0x04, 0xef, 0x00, 0x00, 0x00, 0x04,
- 0xf0, 0x00, 0x00, 0x00, 0x04, 0xf1, 0x00, 0x00,
- 0x00, 0x04, 0xf2, 0x00, 0x00, 0x00, 0x04, 0xf3,
- 0x00, 0x00, 0x00, 0x04, 0xf4, 0x00, 0x00, 0x00,
- 0x26, 0x0c, 0x00, 0xe4, 0x65, 0x01, 0x00, 0x65,
- 0x00, 0x00, 0x41, 0xf0, 0x00, 0x00, 0x00, 0x43,
- 0xf0, 0x00, 0x00, 0x00, 0x61, 0x01, 0x00, 0x61,
- 0x00, 0x00, 0x38, 0x94, 0x00, 0x00, 0x00, 0x42,
- 0xf5, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x24,
- 0x01, 0x00, 0x7d, 0xed, 0x4c, 0x7d, 0x80, 0x00,
- 0x0e, 0xca, 0x80, 0x00, 0x0e, 0xcb, 0x83, 0x65,
- 0x02, 0x00, 0x42, 0xf6, 0x00, 0x00, 0x00, 0x62,
- 0x00, 0x00, 0x24, 0x01, 0x00, 0xb5, 0xad, 0xec,
- 0x30, 0x62, 0x00, 0x00, 0x42, 0xf7, 0x00, 0x00,
- 0x00, 0x04, 0xf8, 0x00, 0x00, 0x00, 0x24, 0x01,
- 0x00, 0xeb, 0x13, 0x65, 0x01, 0x00, 0x41, 0xf0,
- 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x71, 0x62,
- 0x01, 0x00, 0x49, 0xed, 0x0c, 0x65, 0x01, 0x00,
- 0x62, 0x00, 0x00, 0x71, 0x62, 0x01, 0x00, 0x49,
- 0x80, 0x00, 0xeb, 0xb2, 0x0e, 0x83, 0x65, 0x01,
- 0x00, 0x38, 0x94, 0x00, 0x00, 0x00, 0x42, 0xf9,
- 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x41, 0xf2,
- 0x00, 0x00, 0x00, 0x24, 0x01, 0x00, 0x43, 0xf2,
- 0x00, 0x00, 0x00, 0x65, 0x01, 0x00, 0x38, 0x94,
- 0x00, 0x00, 0x00, 0x42, 0xf9, 0x00, 0x00, 0x00,
- 0x65, 0x00, 0x00, 0x41, 0xf3, 0x00, 0x00, 0x00,
- 0x24, 0x01, 0x00, 0x43, 0xf3, 0x00, 0x00, 0x00,
- 0x38, 0x94, 0x00, 0x00, 0x00, 0x42, 0x64, 0x00,
- 0x00, 0x00, 0x38, 0x89, 0x00, 0x00, 0x00, 0x04,
- 0xe4, 0x00, 0x00, 0x00, 0x0b, 0x0a, 0x4c, 0x3f,
- 0x00, 0x00, 0x00, 0x09, 0x4c, 0x3d, 0x00, 0x00,
- 0x00, 0x09, 0x4c, 0x3e, 0x00, 0x00, 0x00, 0x65,
- 0x01, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x00, 0x24,
- 0x03, 0x00, 0x29, 0xc0, 0x03, 0x01, 0x34, 0x04,
- 0x5d, 0x5d, 0x5d, 0x5d, 0x5e, 0x6c, 0x21, 0x2b,
- 0x2b, 0x18, 0x6c, 0x21, 0x2b, 0x2b, 0x18, 0x6c,
- 0x21, 0x2b, 0x2b, 0x18, 0x4f, 0x1c, 0x1c, 0x1c,
+ 0x00, 0x00, 0x09, 0x4c, 0x3d, 0x00, 0x00, 0x00,
+ 0x09, 0x4c, 0x3e, 0x00, 0x00, 0x00, 0x65, 0x01,
+ 0x00, 0x4c, 0x40, 0x00, 0x00, 0x00, 0x24, 0x03,
+ 0x00, 0x29, 0xc0, 0x03, 0x01, 0x35, 0x04, 0x5d,
+ 0x5d, 0x5d, 0x5d, 0x5e, 0x6c, 0x21, 0x2b, 0x2b,
+ 0x18, 0x6c, 0x21, 0x2b, 0x2b, 0x18, 0x6c, 0x21,
+ 0x2b, 0x2b, 0x18, 0x4f, 0x1c, 0x1c, 0x1c, 0x1c,
  0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c,
  0x1c, 0x12, 0x09, 0x54, 0xb2, 0x53, 0x0e, 0x5d,
  0x53, 0x0e, 0x3a, 0x22, 0x94, 0x95, 0x6c, 0x21,
@@ -331,10 +334,10 @@ const uint8_t bootstrap[990] = {
  0x00, 0x29, 0xc0, 0x03, 0x18, 0x00,
 };
 
-const uint32_t bootstrap2_size = 5365;
+const uint32_t bootstrap2_size = 7277;
 
-const uint8_t bootstrap2[5365] = {
- 0x02, 0x5b, 0x20, 0x40, 0x69, 0x6a, 0x6a, 0x73,
+const uint8_t bootstrap2[7277] = {
+ 0x02, 0x76, 0x20, 0x40, 0x69, 0x6a, 0x6a, 0x73,
  0x2f, 0x62, 0x6f, 0x6f, 0x74, 0x73, 0x74, 0x72,
  0x61, 0x70, 0x32, 0x2c, 0x40, 0x69, 0x6a, 0x6a,
  0x73, 0x2f, 0x61, 0x62, 0x6f, 0x72, 0x74, 0x2d,
@@ -347,58 +350,80 @@ const uint8_t bootstrap2[5365] = {
  0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x22, 0x40,
  0x69, 0x6a, 0x6a, 0x73, 0x2f, 0x70, 0x65, 0x72,
  0x66, 0x6f, 0x72, 0x6d, 0x61, 0x6e, 0x63, 0x65,
- 0x1e, 0x41, 0x62, 0x6f, 0x72, 0x74, 0x43, 0x6f,
- 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x6c, 0x65, 0x72,
- 0x16, 0x41, 0x62, 0x6f, 0x72, 0x74, 0x53, 0x69,
- 0x67, 0x6e, 0x61, 0x6c, 0x0e, 0x43, 0x6f, 0x6e,
- 0x73, 0x6f, 0x6c, 0x65, 0x1c, 0x58, 0x4d, 0x4c,
- 0x48, 0x74, 0x74, 0x70, 0x52, 0x65, 0x71, 0x75,
- 0x65, 0x73, 0x74, 0x0c, 0x57, 0x6f, 0x72, 0x6b,
- 0x65, 0x72, 0x28, 0x64, 0x65, 0x66, 0x69, 0x6e,
- 0x65, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x41, 0x74,
- 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x16,
- 0x45, 0x76, 0x65, 0x6e, 0x74, 0x54, 0x61, 0x72,
- 0x67, 0x65, 0x74, 0x0a, 0x45, 0x76, 0x65, 0x6e,
- 0x74, 0x16, 0x43, 0x75, 0x73, 0x74, 0x6f, 0x6d,
- 0x45, 0x76, 0x65, 0x6e, 0x74, 0x16, 0x50, 0x65,
- 0x72, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x6e, 0x63,
- 0x65, 0x14, 0x45, 0x72, 0x72, 0x6f, 0x72, 0x45,
- 0x76, 0x65, 0x6e, 0x74, 0x18, 0x4d, 0x65, 0x73,
- 0x73, 0x61, 0x67, 0x65, 0x45, 0x76, 0x65, 0x6e,
- 0x74, 0x2a, 0x50, 0x72, 0x6f, 0x6d, 0x69, 0x73,
- 0x65, 0x52, 0x65, 0x6a, 0x65, 0x63, 0x74, 0x69,
- 0x6f, 0x6e, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x06,
- 0x58, 0x48, 0x52, 0x0e, 0x5f, 0x57, 0x6f, 0x72,
- 0x6b, 0x65, 0x72, 0x1e, 0x6b, 0x45, 0x72, 0x72,
- 0x6f, 0x72, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x44,
- 0x61, 0x74, 0x61, 0x22, 0x6b, 0x4d, 0x65, 0x73,
+ 0x12, 0x77, 0x72, 0x61, 0x70, 0x50, 0x6f, 0x72,
+ 0x74, 0x73, 0x1c, 0x75, 0x6e, 0x77, 0x72, 0x61,
+ 0x70, 0x54, 0x72, 0x61, 0x6e, 0x73, 0x66, 0x65,
+ 0x72, 0x1e, 0x41, 0x62, 0x6f, 0x72, 0x74, 0x43,
+ 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x6c, 0x65,
+ 0x72, 0x16, 0x41, 0x62, 0x6f, 0x72, 0x74, 0x53,
+ 0x69, 0x67, 0x6e, 0x61, 0x6c, 0x0e, 0x43, 0x6f,
+ 0x6e, 0x73, 0x6f, 0x6c, 0x65, 0x1c, 0x58, 0x4d,
+ 0x4c, 0x48, 0x74, 0x74, 0x70, 0x52, 0x65, 0x71,
+ 0x75, 0x65, 0x73, 0x74, 0x0c, 0x57, 0x6f, 0x72,
+ 0x6b, 0x65, 0x72, 0x22, 0x6e, 0x65, 0x77, 0x4d,
+ 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x43, 0x68,
+ 0x61, 0x6e, 0x6e, 0x65, 0x6c, 0x28, 0x64, 0x65,
+ 0x66, 0x69, 0x6e, 0x65, 0x45, 0x76, 0x65, 0x6e,
+ 0x74, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75,
+ 0x74, 0x65, 0x16, 0x45, 0x76, 0x65, 0x6e, 0x74,
+ 0x54, 0x61, 0x72, 0x67, 0x65, 0x74, 0x0a, 0x45,
+ 0x76, 0x65, 0x6e, 0x74, 0x16, 0x43, 0x75, 0x73,
+ 0x74, 0x6f, 0x6d, 0x45, 0x76, 0x65, 0x6e, 0x74,
+ 0x16, 0x50, 0x65, 0x72, 0x66, 0x6f, 0x72, 0x6d,
+ 0x61, 0x6e, 0x63, 0x65, 0x14, 0x45, 0x72, 0x72,
+ 0x6f, 0x72, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x18,
+ 0x4d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x45,
+ 0x76, 0x65, 0x6e, 0x74, 0x2a, 0x50, 0x72, 0x6f,
+ 0x6d, 0x69, 0x73, 0x65, 0x52, 0x65, 0x6a, 0x65,
+ 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x45, 0x76, 0x65,
+ 0x6e, 0x74, 0x16, 0x4d, 0x65, 0x73, 0x73, 0x61,
+ 0x67, 0x65, 0x50, 0x6f, 0x72, 0x74, 0x1c, 0x4d,
+ 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x43, 0x68,
+ 0x61, 0x6e, 0x6e, 0x65, 0x6c, 0x06, 0x58, 0x48,
+ 0x52, 0x0e, 0x5f, 0x57, 0x6f, 0x72, 0x6b, 0x65,
+ 0x72, 0x1e, 0x6b, 0x45, 0x72, 0x72, 0x6f, 0x72,
+ 0x45, 0x76, 0x65, 0x6e, 0x74, 0x44, 0x61, 0x74,
+ 0x61, 0x22, 0x6b, 0x4d, 0x65, 0x73, 0x73, 0x61,
+ 0x67, 0x65, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x44,
+ 0x61, 0x74, 0x61, 0x24, 0x6b, 0x4d, 0x65, 0x73,
  0x73, 0x61, 0x67, 0x65, 0x45, 0x76, 0x65, 0x6e,
- 0x74, 0x44, 0x61, 0x74, 0x61, 0x2e, 0x6b, 0x50,
- 0x72, 0x6f, 0x6d, 0x69, 0x73, 0x65, 0x52, 0x65,
- 0x6a, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x52,
- 0x65, 0x61, 0x73, 0x6f, 0x6e, 0x16, 0x77, 0x69,
- 0x6e, 0x64, 0x6f, 0x77, 0x50, 0x72, 0x6f, 0x74,
- 0x6f, 0x0e, 0x6b, 0x57, 0x6f, 0x72, 0x6b, 0x65,
- 0x72, 0x16, 0x77, 0x6f, 0x72, 0x6b, 0x65, 0x72,
- 0x50, 0x72, 0x6f, 0x74, 0x6f, 0x08, 0x6b, 0x58,
- 0x48, 0x52, 0x10, 0x78, 0x68, 0x72, 0x50, 0x72,
- 0x6f, 0x74, 0x6f, 0x0c, 0x77, 0x69, 0x6e, 0x64,
- 0x6f, 0x77, 0x0e, 0x63, 0x6f, 0x6e, 0x73, 0x6f,
- 0x6c, 0x65, 0x10, 0x66, 0x69, 0x6c, 0x65, 0x6e,
- 0x61, 0x6d, 0x65, 0x0c, 0x6c, 0x69, 0x6e, 0x65,
- 0x6e, 0x6f, 0x0a, 0x63, 0x6f, 0x6c, 0x6e, 0x6f,
- 0x0a, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x08, 0x64,
- 0x61, 0x74, 0x61, 0x0c, 0x5f, 0x5f, 0x69, 0x6e,
+ 0x74, 0x50, 0x6f, 0x72, 0x74, 0x73, 0x2e, 0x6b,
+ 0x50, 0x72, 0x6f, 0x6d, 0x69, 0x73, 0x65, 0x52,
+ 0x65, 0x6a, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e,
+ 0x52, 0x65, 0x61, 0x73, 0x6f, 0x6e, 0x16, 0x77,
+ 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x50, 0x72, 0x6f,
+ 0x74, 0x6f, 0x0a, 0x6b, 0x50, 0x6f, 0x72, 0x74,
+ 0x14, 0x6b, 0x50, 0x6f, 0x72, 0x74, 0x54, 0x6f,
+ 0x6b, 0x65, 0x6e, 0x12, 0x70, 0x6f, 0x72, 0x74,
+ 0x50, 0x72, 0x6f, 0x74, 0x6f, 0x1a, 0x6f, 0x6e,
+ 0x6d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x44,
+ 0x65, 0x73, 0x63, 0x0e, 0x6b, 0x57, 0x6f, 0x72,
+ 0x6b, 0x65, 0x72, 0x16, 0x77, 0x6f, 0x72, 0x6b,
+ 0x65, 0x72, 0x50, 0x72, 0x6f, 0x74, 0x6f, 0x08,
+ 0x6b, 0x58, 0x48, 0x52, 0x10, 0x78, 0x68, 0x72,
+ 0x50, 0x72, 0x6f, 0x74, 0x6f, 0x0c, 0x77, 0x69,
+ 0x6e, 0x64, 0x6f, 0x77, 0x0e, 0x63, 0x6f, 0x6e,
+ 0x73, 0x6f, 0x6c, 0x65, 0x10, 0x66, 0x69, 0x6c,
+ 0x65, 0x6e, 0x61, 0x6d, 0x65, 0x0c, 0x6c, 0x69,
+ 0x6e, 0x65, 0x6e, 0x6f, 0x0a, 0x63, 0x6f, 0x6c,
+ 0x6e, 0x6f, 0x0a, 0x65, 0x72, 0x72, 0x6f, 0x72,
+ 0x08, 0x64, 0x61, 0x74, 0x61, 0x0a, 0x70, 0x6f,
+ 0x72, 0x74, 0x73, 0x0c, 0x5f, 0x5f, 0x69, 0x6e,
  0x69, 0x74, 0x08, 0x63, 0x61, 0x6c, 0x6c, 0x08,
  0x6c, 0x6f, 0x61, 0x64, 0x24, 0x75, 0x6e, 0x68,
  0x61, 0x6e, 0x64, 0x6c, 0x65, 0x64, 0x72, 0x65,
  0x6a, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x16,
  0x70, 0x65, 0x72, 0x66, 0x6f, 0x72, 0x6d, 0x61,
  0x6e, 0x63, 0x65, 0x16, 0x70, 0x6f, 0x73, 0x74,
- 0x4d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x12,
- 0x74, 0x65, 0x72, 0x6d, 0x69, 0x6e, 0x61, 0x74,
- 0x65, 0x18, 0x6d, 0x65, 0x73, 0x73, 0x61, 0x67,
- 0x65, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x14, 0x72,
+ 0x4d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x0a,
+ 0x73, 0x74, 0x61, 0x72, 0x74, 0x0a, 0x63, 0x6c,
+ 0x6f, 0x73, 0x65, 0x18, 0x6d, 0x65, 0x73, 0x73,
+ 0x61, 0x67, 0x65, 0x65, 0x72, 0x72, 0x6f, 0x72,
+ 0x12, 0x6f, 0x6e, 0x6d, 0x65, 0x73, 0x73, 0x61,
+ 0x67, 0x65, 0x14, 0x73, 0x65, 0x6e, 0x64, 0x48,
+ 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x12, 0x74, 0x65,
+ 0x72, 0x6d, 0x69, 0x6e, 0x61, 0x74, 0x65, 0x0c,
+ 0x68, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x14, 0x72,
  0x65, 0x61, 0x64, 0x79, 0x53, 0x74, 0x61, 0x74,
  0x65, 0x10, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e,
  0x73, 0x65, 0x18, 0x72, 0x65, 0x73, 0x70, 0x6f,
@@ -430,27 +455,37 @@ const uint8_t bootstrap2[5365] = {
  0x61, 0x74, 0x65, 0x63, 0x68, 0x61, 0x6e, 0x67,
  0x65, 0x10, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x54,
  0x79, 0x65, 0x14, 0x63, 0x61, 0x6e, 0x63, 0x65,
- 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x08, 0x70, 0x61,
- 0x74, 0x68, 0x0c, 0x77, 0x6f, 0x72, 0x6b, 0x65,
- 0x72, 0x12, 0x6f, 0x6e, 0x6d, 0x65, 0x73, 0x73,
- 0x61, 0x67, 0x65, 0x1c, 0x6f, 0x6e, 0x6d, 0x65,
- 0x73, 0x73, 0x61, 0x67, 0x65, 0x65, 0x72, 0x72,
- 0x6f, 0x72, 0x0e, 0x6f, 0x6e, 0x65, 0x72, 0x72,
- 0x6f, 0x72, 0x06, 0x6d, 0x73, 0x67, 0x1a, 0x64,
- 0x69, 0x73, 0x70, 0x61, 0x74, 0x63, 0x68, 0x45,
- 0x76, 0x65, 0x6e, 0x74, 0x10, 0x6d, 0x73, 0x67,
- 0x65, 0x72, 0x72, 0x6f, 0x72, 0x08, 0x61, 0x72,
- 0x67, 0x73, 0x06, 0x78, 0x68, 0x72, 0x0e, 0x6f,
- 0x6e, 0x61, 0x62, 0x6f, 0x72, 0x74, 0x0c, 0x6f,
- 0x6e, 0x6c, 0x6f, 0x61, 0x64, 0x12, 0x6f, 0x6e,
- 0x6c, 0x6f, 0x61, 0x64, 0x65, 0x6e, 0x64, 0x16,
- 0x6f, 0x6e, 0x6c, 0x6f, 0x61, 0x64, 0x73, 0x74,
- 0x61, 0x72, 0x74, 0x14, 0x6f, 0x6e, 0x70, 0x72,
- 0x6f, 0x67, 0x72, 0x65, 0x73, 0x73, 0x24, 0x6f,
- 0x6e, 0x72, 0x65, 0x61, 0x64, 0x79, 0x73, 0x74,
- 0x61, 0x74, 0x65, 0x63, 0x68, 0x61, 0x6e, 0x67,
- 0x65, 0x12, 0x6f, 0x6e, 0x74, 0x69, 0x6d, 0x65,
- 0x6f, 0x75, 0x74, 0x02, 0x70, 0x10, 0x6d, 0x69,
+ 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x0a, 0x74, 0x6f,
+ 0x6b, 0x65, 0x6e, 0x08, 0x70, 0x6f, 0x72, 0x74,
+ 0x26, 0x49, 0x6c, 0x6c, 0x65, 0x67, 0x61, 0x6c,
+ 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x72, 0x75,
+ 0x63, 0x74, 0x6f, 0x72, 0x1c, 0x6f, 0x6e, 0x6d,
+ 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x65, 0x72,
+ 0x72, 0x6f, 0x72, 0x06, 0x6d, 0x73, 0x67, 0x1a,
+ 0x64, 0x69, 0x73, 0x70, 0x61, 0x74, 0x63, 0x68,
+ 0x45, 0x76, 0x65, 0x6e, 0x74, 0x10, 0x6d, 0x73,
+ 0x67, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x10, 0x74,
+ 0x72, 0x61, 0x6e, 0x73, 0x66, 0x65, 0x72, 0x06,
+ 0x6d, 0x61, 0x70, 0x0c, 0x75, 0x6e, 0x77, 0x72,
+ 0x61, 0x70, 0x0e, 0x69, 0x73, 0x41, 0x72, 0x72,
+ 0x61, 0x79, 0x08, 0x6c, 0x69, 0x73, 0x74, 0x08,
+ 0x69, 0x74, 0x65, 0x6d, 0x0a, 0x70, 0x6f, 0x72,
+ 0x74, 0x31, 0x0a, 0x70, 0x6f, 0x72, 0x74, 0x32,
+ 0x08, 0x70, 0x61, 0x74, 0x68, 0x0c, 0x77, 0x6f,
+ 0x72, 0x6b, 0x65, 0x72, 0x0e, 0x6f, 0x6e, 0x65,
+ 0x72, 0x72, 0x6f, 0x72, 0x10, 0x6f, 0x6e, 0x68,
+ 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x06, 0x78, 0x68,
+ 0x72, 0x0e, 0x6f, 0x6e, 0x61, 0x62, 0x6f, 0x72,
+ 0x74, 0x0c, 0x6f, 0x6e, 0x6c, 0x6f, 0x61, 0x64,
+ 0x12, 0x6f, 0x6e, 0x6c, 0x6f, 0x61, 0x64, 0x65,
+ 0x6e, 0x64, 0x16, 0x6f, 0x6e, 0x6c, 0x6f, 0x61,
+ 0x64, 0x73, 0x74, 0x61, 0x72, 0x74, 0x14, 0x6f,
+ 0x6e, 0x70, 0x72, 0x6f, 0x67, 0x72, 0x65, 0x73,
+ 0x73, 0x24, 0x6f, 0x6e, 0x72, 0x65, 0x61, 0x64,
+ 0x79, 0x73, 0x74, 0x61, 0x74, 0x65, 0x63, 0x68,
+ 0x61, 0x6e, 0x67, 0x65, 0x12, 0x6f, 0x6e, 0x74,
+ 0x69, 0x6d, 0x65, 0x6f, 0x75, 0x74, 0x02, 0x70,
+ 0x08, 0x61, 0x72, 0x67, 0x73, 0x10, 0x6d, 0x69,
  0x6d, 0x65, 0x54, 0x79, 0x70, 0x65, 0x08, 0x62,
  0x6f, 0x64, 0x79, 0x0c, 0x55, 0x4e, 0x53, 0x45,
  0x4e, 0x54, 0x0c, 0x4f, 0x50, 0x45, 0x4e, 0x45,
@@ -459,551 +494,758 @@ const uint8_t bootstrap2[5365] = {
  0x45, 0x44, 0x0e, 0x4c, 0x4f, 0x41, 0x44, 0x49,
  0x4e, 0x47, 0x08, 0x44, 0x4f, 0x4e, 0x45, 0x0f,
  0xc0, 0x03, 0x05, 0xc2, 0x03, 0xc4, 0x03, 0xc6,
- 0x03, 0xc8, 0x03, 0xca, 0x03, 0x00, 0x00, 0x0a,
- 0x00, 0xcc, 0x03, 0x00, 0x01, 0xce, 0x03, 0x00,
- 0x02, 0xd0, 0x03, 0x01, 0x03, 0xd2, 0x03, 0x02,
- 0x04, 0xd4, 0x03, 0x02, 0x05, 0xd6, 0x03, 0x03,
- 0x06, 0xd8, 0x03, 0x03, 0x07, 0xda, 0x03, 0x03,
- 0x08, 0xdc, 0x03, 0x03, 0x09, 0xde, 0x03, 0x04,
- 0x0e, 0x00, 0x06, 0x01, 0xa0, 0x01, 0x00, 0x0a,
- 0x00, 0x07, 0x17, 0x24, 0xe7, 0x09, 0x0a, 0xe0,
- 0x03, 0x02, 0x00, 0x60, 0xea, 0x01, 0x03, 0x01,
- 0xe0, 0xe2, 0x03, 0x04, 0x00, 0x60, 0xea, 0x01,
- 0x05, 0x03, 0xe0, 0xe4, 0x03, 0x06, 0x00, 0x60,
- 0xea, 0x01, 0x07, 0x05, 0xe0, 0xd4, 0x03, 0x08,
- 0x00, 0x60, 0xea, 0x01, 0x09, 0x07, 0xe0, 0xd2,
- 0x03, 0x0a, 0x00, 0x60, 0xea, 0x01, 0x0b, 0x09,
- 0xe0, 0xcc, 0x03, 0x00, 0x0c, 0xce, 0x03, 0x01,
- 0x0c, 0xd0, 0x03, 0x02, 0x0c, 0xe6, 0x03, 0x03,
- 0x0c, 0xe8, 0x03, 0x04, 0x0c, 0xd6, 0x03, 0x05,
- 0x0c, 0xd8, 0x03, 0x06, 0x0c, 0xda, 0x03, 0x07,
- 0x0c, 0xdc, 0x03, 0x08, 0x0c, 0xde, 0x03, 0x09,
- 0x0c, 0xea, 0x03, 0x00, 0x0d, 0xe0, 0x03, 0x01,
- 0x09, 0xec, 0x03, 0x02, 0x0d, 0xe2, 0x03, 0x03,
- 0x09, 0xee, 0x03, 0x04, 0x0d, 0xe4, 0x03, 0x05,
- 0x09, 0xf0, 0x03, 0x06, 0x0d, 0xf2, 0x03, 0x07,
- 0x0d, 0xd4, 0x03, 0x08, 0x09, 0xf4, 0x03, 0x09,
- 0x0d, 0xf6, 0x03, 0x0a, 0x0d, 0xd2, 0x03, 0x0b,
- 0x09, 0xf8, 0x03, 0x0c, 0x0d, 0x38, 0x94, 0x00,
- 0x00, 0x00, 0x42, 0x64, 0x00, 0x00, 0x00, 0x38,
- 0xfd, 0x00, 0x00, 0x00, 0x04, 0xfe, 0x00, 0x00,
- 0x00, 0x0b, 0x0a, 0x4c, 0x3f, 0x00, 0x00, 0x00,
- 0x0a, 0x4c, 0x3d, 0x00, 0x00, 0x00, 0x0a, 0x4c,
- 0x3e, 0x00, 0x00, 0x00, 0x65, 0x02, 0x00, 0x11,
- 0x21, 0x00, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x00,
- 0x24, 0x03, 0x00, 0x0e, 0x38, 0x9a, 0x00, 0x00,
- 0x00, 0x04, 0xf5, 0x00, 0x00, 0x00, 0xf0, 0x5f,
- 0x0a, 0x00, 0x61, 0x00, 0x00, 0x65, 0x07, 0x00,
- 0x61, 0x01, 0x00, 0xc0, 0x00, 0x56, 0xf0, 0x00,
- 0x00, 0x00, 0x01, 0xc1, 0x01, 0x54, 0x33, 0x00,
- 0x00, 0x00, 0x01, 0xc1, 0x02, 0x54, 0xff, 0x00,
- 0x00, 0x00, 0x01, 0xc1, 0x03, 0x54, 0x00, 0x01,
- 0x00, 0x00, 0x01, 0xc1, 0x04, 0x54, 0x01, 0x01,
- 0x00, 0x00, 0x01, 0xc1, 0x05, 0x54, 0x02, 0x01,
- 0x00, 0x00, 0x01, 0x06, 0xcb, 0x0e, 0xce, 0x68,
- 0x01, 0x00, 0x5f, 0x0b, 0x00, 0x38, 0x9a, 0x00,
- 0x00, 0x00, 0x04, 0xf6, 0x00, 0x00, 0x00, 0xf0,
- 0x5f, 0x0c, 0x00, 0x61, 0x02, 0x00, 0x65, 0x07,
- 0x00, 0x61, 0x03, 0x00, 0xc0, 0x06, 0x56, 0xf1,
- 0x00, 0x00, 0x00, 0x01, 0xc1, 0x07, 0x54, 0x03,
+ 0x03, 0xc8, 0x03, 0xca, 0x03, 0x02, 0x00, 0x18,
+ 0xcc, 0x03, 0x00, 0x19, 0xce, 0x03, 0x00, 0x0b,
+ 0x00, 0xd0, 0x03, 0x00, 0x01, 0xd2, 0x03, 0x00,
+ 0x02, 0xd4, 0x03, 0x01, 0x03, 0xd6, 0x03, 0x02,
+ 0x04, 0xd8, 0x03, 0x02, 0x05, 0xda, 0x03, 0x02,
+ 0x06, 0xdc, 0x03, 0x03, 0x07, 0xde, 0x03, 0x03,
+ 0x08, 0xe0, 0x03, 0x03, 0x09, 0xe2, 0x03, 0x03,
+ 0x0a, 0xe4, 0x03, 0x04, 0x0e, 0x00, 0x06, 0x01,
+ 0xa0, 0x01, 0x00, 0x0e, 0x00, 0x07, 0x21, 0x2e,
+ 0xc0, 0x0c, 0x0e, 0xe6, 0x03, 0x02, 0x00, 0x60,
+ 0xea, 0x01, 0x03, 0x01, 0xe0, 0xe8, 0x03, 0x04,
+ 0x00, 0x60, 0xea, 0x01, 0x05, 0x03, 0xe0, 0xea,
+ 0x03, 0x06, 0x00, 0x60, 0xea, 0x01, 0x07, 0x05,
+ 0xe0, 0xec, 0x03, 0x08, 0x00, 0x60, 0xea, 0x01,
+ 0x09, 0x07, 0xe0, 0xee, 0x03, 0x0a, 0x00, 0x60,
+ 0xea, 0x01, 0x0b, 0x09, 0xe0, 0xd8, 0x03, 0x0c,
+ 0x00, 0x60, 0xea, 0x01, 0x0d, 0x0b, 0xe0, 0xd6,
+ 0x03, 0x0e, 0x00, 0x60, 0xea, 0x01, 0x0f, 0x0d,
+ 0xe0, 0xd0, 0x03, 0x00, 0x0c, 0xd2, 0x03, 0x01,
+ 0x0c, 0xd4, 0x03, 0x02, 0x0c, 0xf0, 0x03, 0x03,
+ 0x0c, 0xf2, 0x03, 0x04, 0x0c, 0xda, 0x03, 0x05,
+ 0x0c, 0xdc, 0x03, 0x06, 0x0c, 0xde, 0x03, 0x07,
+ 0x0c, 0xe0, 0x03, 0x08, 0x0c, 0xe2, 0x03, 0x09,
+ 0x0c, 0xe4, 0x03, 0x0a, 0x0c, 0xf4, 0x03, 0x00,
+ 0x0d, 0xe6, 0x03, 0x01, 0x09, 0xf6, 0x03, 0x02,
+ 0x0d, 0xf8, 0x03, 0x03, 0x0d, 0xe8, 0x03, 0x04,
+ 0x09, 0xfa, 0x03, 0x05, 0x0d, 0xea, 0x03, 0x06,
+ 0x09, 0xfc, 0x03, 0x07, 0x0d, 0xfe, 0x03, 0x08,
+ 0x0d, 0x80, 0x04, 0x09, 0x0d, 0xec, 0x03, 0x0a,
+ 0x09, 0x82, 0x04, 0x0b, 0x0d, 0x84, 0x04, 0x0c,
+ 0x0d, 0xcc, 0x03, 0x0d, 0x01, 0xce, 0x03, 0x0e,
+ 0x01, 0xee, 0x03, 0x0f, 0x09, 0x86, 0x04, 0x10,
+ 0x0d, 0xd8, 0x03, 0x11, 0x09, 0x88, 0x04, 0x12,
+ 0x0d, 0x8a, 0x04, 0x13, 0x0d, 0xd6, 0x03, 0x14,
+ 0x09, 0x8c, 0x04, 0x15, 0x0d, 0xc1, 0x10, 0x5f,
+ 0x18, 0x00, 0xc1, 0x11, 0x5f, 0x19, 0x00, 0x38,
+ 0x94, 0x00, 0x00, 0x00, 0x42, 0x64, 0x00, 0x00,
+ 0x00, 0x38, 0x07, 0x01, 0x00, 0x00, 0x04, 0x08,
+ 0x01, 0x00, 0x00, 0x0b, 0x0a, 0x4c, 0x3f, 0x00,
+ 0x00, 0x00, 0x0a, 0x4c, 0x3d, 0x00, 0x00, 0x00,
+ 0x0a, 0x4c, 0x3e, 0x00, 0x00, 0x00, 0x65, 0x02,
+ 0x00, 0x11, 0x21, 0x00, 0x00, 0x4c, 0x40, 0x00,
+ 0x00, 0x00, 0x24, 0x03, 0x00, 0x0e, 0x38, 0x9a,
+ 0x00, 0x00, 0x00, 0x04, 0xfa, 0x00, 0x00, 0x00,
+ 0xf0, 0x5f, 0x0b, 0x00, 0x61, 0x00, 0x00, 0x65,
+ 0x08, 0x00, 0x61, 0x01, 0x00, 0xc0, 0x00, 0x56,
+ 0xf3, 0x00, 0x00, 0x00, 0x01, 0xc1, 0x01, 0x54,
+ 0x33, 0x00, 0x00, 0x00, 0x01, 0xc1, 0x02, 0x54,
+ 0x09, 0x01, 0x00, 0x00, 0x01, 0xc1, 0x03, 0x54,
+ 0x0a, 0x01, 0x00, 0x00, 0x01, 0xc1, 0x04, 0x54,
+ 0x0b, 0x01, 0x00, 0x00, 0x01, 0xc1, 0x05, 0x54,
+ 0x0c, 0x01, 0x00, 0x00, 0x01, 0x06, 0xcb, 0x0e,
+ 0xce, 0x68, 0x01, 0x00, 0x5f, 0x0c, 0x00, 0x38,
+ 0x9a, 0x00, 0x00, 0x00, 0x04, 0xfb, 0x00, 0x00,
+ 0x00, 0xf0, 0x5f, 0x0d, 0x00, 0x38, 0x9a, 0x00,
+ 0x00, 0x00, 0x04, 0xfc, 0x00, 0x00, 0x00, 0xf0,
+ 0x5f, 0x0e, 0x00, 0x61, 0x02, 0x00, 0x65, 0x08,
+ 0x00, 0x61, 0x03, 0x00, 0xc0, 0x06, 0x56, 0xf4,
+ 0x00, 0x00, 0x00, 0x01, 0xc1, 0x07, 0x54, 0x0d,
+ 0x01, 0x00, 0x00, 0x01, 0xc1, 0x08, 0x54, 0x0e,
  0x01, 0x00, 0x00, 0x01, 0x06, 0xcd, 0x0e, 0xd0,
- 0x68, 0x03, 0x00, 0x5f, 0x0d, 0x00, 0x38, 0x9a,
- 0x00, 0x00, 0x00, 0x04, 0xf7, 0x00, 0x00, 0x00,
- 0xf0, 0x5f, 0x0e, 0x00, 0x61, 0x04, 0x00, 0x65,
- 0x07, 0x00, 0x61, 0x05, 0x00, 0xc0, 0x08, 0x56,
- 0xf2, 0x00, 0x00, 0x00, 0x01, 0xc1, 0x09, 0x54,
+ 0x68, 0x03, 0x00, 0x5f, 0x0f, 0x00, 0x38, 0x9a,
+ 0x00, 0x00, 0x00, 0x04, 0xfd, 0x00, 0x00, 0x00,
+ 0xf0, 0x5f, 0x10, 0x00, 0x61, 0x04, 0x00, 0x65,
+ 0x08, 0x00, 0x61, 0x05, 0x00, 0xc0, 0x09, 0x56,
+ 0xf5, 0x00, 0x00, 0x00, 0x01, 0xc1, 0x0a, 0x54,
  0x88, 0x00, 0x00, 0x00, 0x01, 0x06, 0xc4, 0x05,
- 0x0e, 0xc5, 0x04, 0x68, 0x05, 0x00, 0x5f, 0x0f,
+ 0x0e, 0xc5, 0x04, 0x68, 0x05, 0x00, 0x5f, 0x11,
  0x00, 0x38, 0x94, 0x00, 0x00, 0x00, 0x42, 0x58,
- 0x00, 0x00, 0x00, 0x38, 0xfd, 0x00, 0x00, 0x00,
+ 0x00, 0x00, 0x00, 0x38, 0x07, 0x01, 0x00, 0x00,
  0x0b, 0x0b, 0x0a, 0x4c, 0x3f, 0x00, 0x00, 0x00,
  0x0a, 0x4c, 0x3d, 0x00, 0x00, 0x00, 0x0a, 0x4c,
- 0x3e, 0x00, 0x00, 0x00, 0x65, 0x06, 0x00, 0x4c,
- 0x40, 0x00, 0x00, 0x00, 0x4c, 0xec, 0x00, 0x00,
- 0x00, 0x0b, 0x0a, 0x4c, 0x3f, 0x00, 0x00, 0x00,
- 0x0a, 0x4c, 0x3d, 0x00, 0x00, 0x00, 0x0a, 0x4c,
  0x3e, 0x00, 0x00, 0x00, 0x65, 0x07, 0x00, 0x4c,
- 0x40, 0x00, 0x00, 0x00, 0x4c, 0xed, 0x00, 0x00,
+ 0x40, 0x00, 0x00, 0x00, 0x4c, 0xef, 0x00, 0x00,
  0x00, 0x0b, 0x0a, 0x4c, 0x3f, 0x00, 0x00, 0x00,
  0x0a, 0x4c, 0x3d, 0x00, 0x00, 0x00, 0x0a, 0x4c,
- 0x3e, 0x00, 0x00, 0x00, 0x65, 0x0b, 0x00, 0x4c,
+ 0x3e, 0x00, 0x00, 0x00, 0x65, 0x08, 0x00, 0x4c,
  0x40, 0x00, 0x00, 0x00, 0x4c, 0xf0, 0x00, 0x00,
  0x00, 0x0b, 0x0a, 0x4c, 0x3f, 0x00, 0x00, 0x00,
  0x0a, 0x4c, 0x3d, 0x00, 0x00, 0x00, 0x0a, 0x4c,
- 0x3e, 0x00, 0x00, 0x00, 0x65, 0x0d, 0x00, 0x4c,
- 0x40, 0x00, 0x00, 0x00, 0x4c, 0xf1, 0x00, 0x00,
+ 0x3e, 0x00, 0x00, 0x00, 0x65, 0x0c, 0x00, 0x4c,
+ 0x40, 0x00, 0x00, 0x00, 0x4c, 0xf3, 0x00, 0x00,
  0x00, 0x0b, 0x0a, 0x4c, 0x3f, 0x00, 0x00, 0x00,
  0x0a, 0x4c, 0x3d, 0x00, 0x00, 0x00, 0x0a, 0x4c,
  0x3e, 0x00, 0x00, 0x00, 0x65, 0x0f, 0x00, 0x4c,
- 0x40, 0x00, 0x00, 0x00, 0x4c, 0xf2, 0x00, 0x00,
+ 0x40, 0x00, 0x00, 0x00, 0x4c, 0xf4, 0x00, 0x00,
  0x00, 0x0b, 0x0a, 0x4c, 0x3f, 0x00, 0x00, 0x00,
  0x0a, 0x4c, 0x3d, 0x00, 0x00, 0x00, 0x0a, 0x4c,
- 0x3e, 0x00, 0x00, 0x00, 0x65, 0x08, 0x00, 0x4c,
- 0x40, 0x00, 0x00, 0x00, 0x4c, 0xee, 0x00, 0x00,
+ 0x3e, 0x00, 0x00, 0x00, 0x65, 0x11, 0x00, 0x4c,
+ 0x40, 0x00, 0x00, 0x00, 0x4c, 0xf5, 0x00, 0x00,
+ 0x00, 0x0b, 0x0a, 0x4c, 0x3f, 0x00, 0x00, 0x00,
+ 0x0a, 0x4c, 0x3d, 0x00, 0x00, 0x00, 0x0a, 0x4c,
+ 0x3e, 0x00, 0x00, 0x00, 0x65, 0x09, 0x00, 0x4c,
+ 0x40, 0x00, 0x00, 0x00, 0x4c, 0xf1, 0x00, 0x00,
  0x00, 0x24, 0x02, 0x00, 0x0e, 0x38, 0x94, 0x00,
  0x00, 0x00, 0x42, 0x5f, 0x00, 0x00, 0x00, 0x38,
- 0xfd, 0x00, 0x00, 0x00, 0x65, 0x06, 0x00, 0x41,
+ 0x07, 0x01, 0x00, 0x00, 0x65, 0x07, 0x00, 0x41,
  0x3b, 0x00, 0x00, 0x00, 0x24, 0x02, 0x00, 0x0e,
- 0x65, 0x06, 0x00, 0x41, 0x3b, 0x00, 0x00, 0x00,
- 0x41, 0x04, 0x01, 0x00, 0x00, 0x42, 0x05, 0x01,
- 0x00, 0x00, 0x38, 0xfd, 0x00, 0x00, 0x00, 0x24,
+ 0x65, 0x07, 0x00, 0x41, 0x3b, 0x00, 0x00, 0x00,
+ 0x41, 0x0f, 0x01, 0x00, 0x00, 0x42, 0x10, 0x01,
+ 0x00, 0x00, 0x38, 0x07, 0x01, 0x00, 0x00, 0x24,
  0x01, 0x00, 0x0e, 0x38, 0x94, 0x00, 0x00, 0x00,
- 0x42, 0x5e, 0x00, 0x00, 0x00, 0x38, 0xfd, 0x00,
- 0x00, 0x00, 0x24, 0x01, 0x00, 0x5f, 0x10, 0x00,
- 0x65, 0x05, 0x00, 0x65, 0x10, 0x00, 0x04, 0x06,
- 0x01, 0x00, 0x00, 0xf1, 0x0e, 0x65, 0x05, 0x00,
- 0x65, 0x10, 0x00, 0x04, 0x07, 0x01, 0x00, 0x00,
+ 0x42, 0x5e, 0x00, 0x00, 0x00, 0x38, 0x07, 0x01,
+ 0x00, 0x00, 0x24, 0x01, 0x00, 0x5f, 0x12, 0x00,
+ 0x65, 0x06, 0x00, 0x65, 0x12, 0x00, 0x04, 0x11,
+ 0x01, 0x00, 0x00, 0xf1, 0x0e, 0x65, 0x06, 0x00,
+ 0x65, 0x12, 0x00, 0x04, 0x12, 0x01, 0x00, 0x00,
  0xf1, 0x0e, 0x38, 0x94, 0x00, 0x00, 0x00, 0x42,
- 0x64, 0x00, 0x00, 0x00, 0x38, 0xfd, 0x00, 0x00,
- 0x00, 0x04, 0x08, 0x01, 0x00, 0x00, 0x0b, 0x0a,
+ 0x64, 0x00, 0x00, 0x00, 0x38, 0x07, 0x01, 0x00,
+ 0x00, 0x04, 0x13, 0x01, 0x00, 0x00, 0x0b, 0x0a,
  0x4c, 0x3f, 0x00, 0x00, 0x00, 0x0a, 0x4c, 0x3d,
  0x00, 0x00, 0x00, 0x0a, 0x4c, 0x3e, 0x00, 0x00,
- 0x00, 0x65, 0x09, 0x00, 0x11, 0x21, 0x00, 0x00,
+ 0x00, 0x65, 0x0a, 0x00, 0x11, 0x21, 0x00, 0x00,
  0x4c, 0x40, 0x00, 0x00, 0x00, 0x24, 0x03, 0x00,
  0x0e, 0x38, 0x94, 0x00, 0x00, 0x00, 0x42, 0x64,
- 0x00, 0x00, 0x00, 0x38, 0xfd, 0x00, 0x00, 0x00,
- 0x04, 0xe6, 0x00, 0x00, 0x00, 0x0b, 0x0a, 0x4c,
+ 0x00, 0x00, 0x00, 0x38, 0x07, 0x01, 0x00, 0x00,
+ 0x04, 0xe8, 0x00, 0x00, 0x00, 0x0b, 0x0a, 0x4c,
  0x3f, 0x00, 0x00, 0x00, 0x0a, 0x4c, 0x3d, 0x00,
  0x00, 0x00, 0x0a, 0x4c, 0x3e, 0x00, 0x00, 0x00,
  0x65, 0x00, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x00,
  0x24, 0x03, 0x00, 0x0e, 0x38, 0x94, 0x00, 0x00,
- 0x00, 0x42, 0x64, 0x00, 0x00, 0x00, 0x38, 0xfd,
- 0x00, 0x00, 0x00, 0x04, 0xe7, 0x00, 0x00, 0x00,
+ 0x00, 0x42, 0x64, 0x00, 0x00, 0x00, 0x38, 0x07,
+ 0x01, 0x00, 0x00, 0x04, 0xe9, 0x00, 0x00, 0x00,
  0x0b, 0x0a, 0x4c, 0x3f, 0x00, 0x00, 0x00, 0x0a,
  0x4c, 0x3d, 0x00, 0x00, 0x00, 0x0a, 0x4c, 0x3e,
  0x00, 0x00, 0x00, 0x65, 0x01, 0x00, 0x4c, 0x40,
  0x00, 0x00, 0x00, 0x24, 0x03, 0x00, 0x0e, 0x38,
- 0x9a, 0x00, 0x00, 0x00, 0x04, 0xf9, 0x00, 0x00,
- 0x00, 0xf0, 0x5f, 0x11, 0x00, 0x61, 0x06, 0x00,
- 0x65, 0x06, 0x00, 0x61, 0x07, 0x00, 0xc0, 0x0a,
- 0x56, 0xea, 0x00, 0x00, 0x00, 0x01, 0xc1, 0x0b,
- 0x54, 0x09, 0x01, 0x00, 0x00, 0x00, 0xc1, 0x0c,
- 0x54, 0x0a, 0x01, 0x00, 0x00, 0x00, 0x06, 0xc4,
- 0x07, 0x0e, 0xc5, 0x06, 0x68, 0x07, 0x00, 0x5f,
- 0x12, 0x00, 0x65, 0x12, 0x00, 0x41, 0x3b, 0x00,
- 0x00, 0x00, 0x5f, 0x13, 0x00, 0x65, 0x05, 0x00,
- 0x65, 0x13, 0x00, 0x04, 0x33, 0x00, 0x00, 0x00,
- 0xf1, 0x0e, 0x65, 0x05, 0x00, 0x65, 0x13, 0x00,
- 0x04, 0x0b, 0x01, 0x00, 0x00, 0xf1, 0x0e, 0x65,
- 0x05, 0x00, 0x65, 0x13, 0x00, 0x04, 0x02, 0x01,
- 0x00, 0x00, 0xf1, 0x0e, 0x38, 0x94, 0x00, 0x00,
- 0x00, 0x42, 0x64, 0x00, 0x00, 0x00, 0x38, 0xfd,
- 0x00, 0x00, 0x00, 0x04, 0xea, 0x00, 0x00, 0x00,
- 0x0b, 0x0a, 0x4c, 0x3f, 0x00, 0x00, 0x00, 0x0a,
- 0x4c, 0x3d, 0x00, 0x00, 0x00, 0x0a, 0x4c, 0x3e,
- 0x00, 0x00, 0x00, 0x65, 0x12, 0x00, 0x4c, 0x40,
- 0x00, 0x00, 0x00, 0x24, 0x03, 0x00, 0x0e, 0x38,
- 0x9a, 0x00, 0x00, 0x00, 0x04, 0xfb, 0x00, 0x00,
- 0x00, 0xf0, 0x5f, 0x14, 0x00, 0x61, 0x08, 0x00,
- 0x65, 0x06, 0x00, 0x61, 0x09, 0x00, 0xc0, 0x0d,
- 0x56, 0xe9, 0x00, 0x00, 0x00, 0x01, 0x1b, 0x1b,
+ 0x9a, 0x00, 0x00, 0x00, 0x04, 0xff, 0x00, 0x00,
+ 0x00, 0xf0, 0x5f, 0x13, 0x00, 0x38, 0x9a, 0x00,
+ 0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0xf0,
+ 0x5f, 0x14, 0x00, 0x61, 0x06, 0x00, 0x65, 0x07,
+ 0x00, 0x61, 0x07, 0x00, 0xc0, 0x0b, 0x56, 0xf6,
+ 0x00, 0x00, 0x00, 0x01, 0xc1, 0x0c, 0x54, 0x14,
+ 0x01, 0x00, 0x00, 0x00, 0xc1, 0x0d, 0x54, 0x15,
+ 0x01, 0x00, 0x00, 0x00, 0xc1, 0x0e, 0x54, 0x16,
+ 0x01, 0x00, 0x00, 0x00, 0x06, 0xc4, 0x07, 0x0e,
+ 0xc5, 0x06, 0x68, 0x07, 0x00, 0x5f, 0x15, 0x00,
+ 0x65, 0x15, 0x00, 0x41, 0x3b, 0x00, 0x00, 0x00,
+ 0x5f, 0x16, 0x00, 0x65, 0x06, 0x00, 0x65, 0x16,
+ 0x00, 0x04, 0x33, 0x00, 0x00, 0x00, 0xf1, 0x0e,
+ 0x65, 0x06, 0x00, 0x65, 0x16, 0x00, 0x04, 0x17,
+ 0x01, 0x00, 0x00, 0xf1, 0x0e, 0x38, 0x94, 0x00,
+ 0x00, 0x00, 0x42, 0x65, 0x00, 0x00, 0x00, 0x65,
+ 0x16, 0x00, 0x04, 0x18, 0x01, 0x00, 0x00, 0x24,
+ 0x02, 0x00, 0x5f, 0x17, 0x00, 0x38, 0x94, 0x00,
+ 0x00, 0x00, 0x42, 0x64, 0x00, 0x00, 0x00, 0x65,
+ 0x16, 0x00, 0x04, 0x18, 0x01, 0x00, 0x00, 0x0b,
+ 0x65, 0x17, 0x00, 0x07, 0x53, 0x06, 0x0e, 0x0e,
+ 0xc1, 0x0f, 0x54, 0x42, 0x00, 0x00, 0x00, 0x04,
+ 0x24, 0x03, 0x00, 0x0e, 0x61, 0x08, 0x00, 0x06,
+ 0x61, 0x09, 0x00, 0xc0, 0x12, 0x56, 0xf7, 0x00,
+ 0x00, 0x00, 0x00, 0x06, 0xc4, 0x09, 0x0e, 0xc5,
+ 0x08, 0x68, 0x09, 0x00, 0x5f, 0x1a, 0x00, 0x38,
+ 0x94, 0x00, 0x00, 0x00, 0x42, 0x58, 0x00, 0x00,
+ 0x00, 0x38, 0x07, 0x01, 0x00, 0x00, 0x0b, 0x0b,
+ 0x0a, 0x4c, 0x3f, 0x00, 0x00, 0x00, 0x0a, 0x4c,
+ 0x3d, 0x00, 0x00, 0x00, 0x0a, 0x4c, 0x3e, 0x00,
+ 0x00, 0x00, 0x65, 0x1a, 0x00, 0x4c, 0x40, 0x00,
+ 0x00, 0x00, 0x4c, 0xf7, 0x00, 0x00, 0x00, 0x0b,
+ 0x0a, 0x4c, 0x3f, 0x00, 0x00, 0x00, 0x0a, 0x4c,
+ 0x3d, 0x00, 0x00, 0x00, 0x0a, 0x4c, 0x3e, 0x00,
+ 0x00, 0x00, 0x65, 0x15, 0x00, 0x4c, 0x40, 0x00,
+ 0x00, 0x00, 0x4c, 0xf6, 0x00, 0x00, 0x00, 0x24,
+ 0x02, 0x00, 0x0e, 0x38, 0x9a, 0x00, 0x00, 0x00,
+ 0x04, 0x03, 0x01, 0x00, 0x00, 0xf0, 0x5f, 0x1b,
+ 0x00, 0x61, 0x0a, 0x00, 0x65, 0x07, 0x00, 0x61,
+ 0x0b, 0x00, 0xc0, 0x13, 0x56, 0xec, 0x00, 0x00,
+ 0x00, 0x01, 0xc1, 0x14, 0x54, 0x14, 0x01, 0x00,
+ 0x00, 0x00, 0xc1, 0x15, 0x54, 0x19, 0x01, 0x00,
+ 0x00, 0x00, 0xc1, 0x16, 0x54, 0x1a, 0x01, 0x00,
+ 0x00, 0x00, 0x06, 0xc4, 0x0b, 0x0e, 0xc5, 0x0a,
+ 0x68, 0x0b, 0x00, 0x5f, 0x1c, 0x00, 0x65, 0x1c,
+ 0x00, 0x41, 0x3b, 0x00, 0x00, 0x00, 0x5f, 0x1d,
+ 0x00, 0x65, 0x06, 0x00, 0x65, 0x1d, 0x00, 0x04,
+ 0x33, 0x00, 0x00, 0x00, 0xf1, 0x0e, 0x65, 0x06,
+ 0x00, 0x65, 0x1d, 0x00, 0x04, 0x17, 0x01, 0x00,
+ 0x00, 0xf1, 0x0e, 0x65, 0x06, 0x00, 0x65, 0x1d,
+ 0x00, 0x04, 0x0c, 0x01, 0x00, 0x00, 0xf1, 0x0e,
+ 0x65, 0x06, 0x00, 0x65, 0x1d, 0x00, 0x04, 0x1b,
+ 0x01, 0x00, 0x00, 0xf1, 0x0e, 0x38, 0x94, 0x00,
+ 0x00, 0x00, 0x42, 0x64, 0x00, 0x00, 0x00, 0x38,
+ 0x07, 0x01, 0x00, 0x00, 0x04, 0xec, 0x00, 0x00,
+ 0x00, 0x0b, 0x0a, 0x4c, 0x3f, 0x00, 0x00, 0x00,
+ 0x0a, 0x4c, 0x3d, 0x00, 0x00, 0x00, 0x0a, 0x4c,
+ 0x3e, 0x00, 0x00, 0x00, 0x65, 0x1c, 0x00, 0x4c,
+ 0x40, 0x00, 0x00, 0x00, 0x24, 0x03, 0x00, 0x0e,
+ 0x38, 0x9a, 0x00, 0x00, 0x00, 0x04, 0x05, 0x01,
+ 0x00, 0x00, 0xf0, 0x5f, 0x1e, 0x00, 0x61, 0x0c,
+ 0x00, 0x65, 0x07, 0x00, 0x61, 0x0d, 0x00, 0xc0,
+ 0x17, 0x56, 0xeb, 0x00, 0x00, 0x00, 0x01, 0x1b,
  0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
- 0xc1, 0x0e, 0x54, 0x0c, 0x01, 0x00, 0x00, 0x01,
- 0xc1, 0x0f, 0x54, 0x0d, 0x01, 0x00, 0x00, 0x01,
- 0xc1, 0x10, 0x54, 0x0e, 0x01, 0x00, 0x00, 0x01,
- 0xc1, 0x11, 0x54, 0x0f, 0x01, 0x00, 0x00, 0x02,
- 0xc1, 0x12, 0x54, 0x0f, 0x01, 0x00, 0x00, 0x01,
- 0xc1, 0x13, 0x54, 0x10, 0x01, 0x00, 0x00, 0x01,
- 0xc1, 0x14, 0x54, 0x87, 0x00, 0x00, 0x00, 0x01,
- 0xc1, 0x15, 0x54, 0x11, 0x01, 0x00, 0x00, 0x01,
- 0xc1, 0x16, 0x54, 0x12, 0x01, 0x00, 0x00, 0x02,
- 0xc1, 0x17, 0x54, 0x12, 0x01, 0x00, 0x00, 0x01,
- 0xc1, 0x18, 0x54, 0x13, 0x01, 0x00, 0x00, 0x01,
- 0xc1, 0x19, 0x54, 0x14, 0x01, 0x00, 0x00, 0x02,
- 0xc1, 0x1a, 0x54, 0x14, 0x01, 0x00, 0x00, 0x01,
- 0xc1, 0x1b, 0x54, 0x15, 0x01, 0x00, 0x00, 0x00,
- 0xc1, 0x1c, 0x54, 0x16, 0x01, 0x00, 0x00, 0x00,
- 0xc1, 0x1d, 0x54, 0x17, 0x01, 0x00, 0x00, 0x00,
- 0xc1, 0x1e, 0x54, 0x18, 0x01, 0x00, 0x00, 0x00,
- 0xc1, 0x1f, 0x54, 0x19, 0x01, 0x00, 0x00, 0x00,
- 0xc1, 0x20, 0x54, 0x1a, 0x01, 0x00, 0x00, 0x00,
- 0xc1, 0x21, 0x54, 0x1b, 0x01, 0x00, 0x00, 0x00,
- 0xc1, 0x22, 0x50, 0xc4, 0x09, 0x0e, 0x11, 0xc1,
- 0x23, 0x50, 0x24, 0x00, 0x00, 0x0e, 0xc5, 0x08,
- 0x68, 0x09, 0x00, 0x5f, 0x15, 0x00, 0x65, 0x15,
- 0x00, 0x41, 0x3b, 0x00, 0x00, 0x00, 0x5f, 0x16,
- 0x00, 0x65, 0x05, 0x00, 0x65, 0x16, 0x00, 0x04,
- 0x15, 0x01, 0x00, 0x00, 0xf1, 0x0e, 0x65, 0x05,
- 0x00, 0x65, 0x16, 0x00, 0x04, 0x02, 0x01, 0x00,
- 0x00, 0xf1, 0x0e, 0x65, 0x05, 0x00, 0x65, 0x16,
- 0x00, 0x04, 0x06, 0x01, 0x00, 0x00, 0xf1, 0x0e,
- 0x65, 0x05, 0x00, 0x65, 0x16, 0x00, 0x04, 0x1c,
- 0x01, 0x00, 0x00, 0xf1, 0x0e, 0x65, 0x05, 0x00,
- 0x65, 0x16, 0x00, 0x04, 0x1d, 0x01, 0x00, 0x00,
- 0xf1, 0x0e, 0x65, 0x05, 0x00, 0x65, 0x16, 0x00,
- 0x04, 0x1e, 0x01, 0x00, 0x00, 0xf1, 0x0e, 0x65,
- 0x05, 0x00, 0x65, 0x16, 0x00, 0x04, 0x1f, 0x01,
- 0x00, 0x00, 0xf1, 0x0e, 0x65, 0x05, 0x00, 0x65,
- 0x16, 0x00, 0x04, 0x12, 0x01, 0x00, 0x00, 0xf1,
- 0x0e, 0x38, 0x94, 0x00, 0x00, 0x00, 0x42, 0x64,
- 0x00, 0x00, 0x00, 0x38, 0xfd, 0x00, 0x00, 0x00,
- 0x04, 0xe9, 0x00, 0x00, 0x00, 0x0b, 0x0a, 0x4c,
- 0x3f, 0x00, 0x00, 0x00, 0x0a, 0x4c, 0x3d, 0x00,
- 0x00, 0x00, 0x0a, 0x4c, 0x3e, 0x00, 0x00, 0x00,
- 0x65, 0x15, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x00,
- 0x24, 0x03, 0x00, 0x29, 0xc0, 0x03, 0x01, 0xc9,
- 0x01, 0x00, 0x00, 0x0c, 0x6c, 0x21, 0x21, 0x21,
- 0x3f, 0x18, 0x4a, 0x00, 0x11, 0x12, 0x00, 0x08,
- 0x08, 0x00, 0x08, 0x08, 0x00, 0x08, 0x08, 0x00,
- 0x08, 0x08, 0x2b, 0x36, 0x4a, 0x00, 0x11, 0x12,
- 0x2b, 0x36, 0x4a, 0x00, 0x11, 0x12, 0x2b, 0x40,
- 0x53, 0x08, 0x21, 0x21, 0x21, 0x2b, 0x1c, 0x08,
+ 0x1b, 0xc1, 0x18, 0x54, 0x1c, 0x01, 0x00, 0x00,
+ 0x01, 0xc1, 0x19, 0x54, 0x1d, 0x01, 0x00, 0x00,
+ 0x01, 0xc1, 0x1a, 0x54, 0x1e, 0x01, 0x00, 0x00,
+ 0x01, 0xc1, 0x1b, 0x54, 0x1f, 0x01, 0x00, 0x00,
+ 0x02, 0xc1, 0x1c, 0x54, 0x1f, 0x01, 0x00, 0x00,
+ 0x01, 0xc1, 0x1d, 0x54, 0x20, 0x01, 0x00, 0x00,
+ 0x01, 0xc1, 0x1e, 0x54, 0x87, 0x00, 0x00, 0x00,
+ 0x01, 0xc1, 0x1f, 0x54, 0x21, 0x01, 0x00, 0x00,
+ 0x01, 0xc1, 0x20, 0x54, 0x22, 0x01, 0x00, 0x00,
+ 0x02, 0xc1, 0x21, 0x54, 0x22, 0x01, 0x00, 0x00,
+ 0x01, 0xc1, 0x22, 0x54, 0x23, 0x01, 0x00, 0x00,
+ 0x01, 0xc1, 0x23, 0x54, 0x24, 0x01, 0x00, 0x00,
+ 0x02, 0xc1, 0x24, 0x54, 0x24, 0x01, 0x00, 0x00,
+ 0x01, 0xc1, 0x25, 0x54, 0x25, 0x01, 0x00, 0x00,
+ 0x00, 0xc1, 0x26, 0x54, 0x26, 0x01, 0x00, 0x00,
+ 0x00, 0xc1, 0x27, 0x54, 0x27, 0x01, 0x00, 0x00,
+ 0x00, 0xc1, 0x28, 0x54, 0x28, 0x01, 0x00, 0x00,
+ 0x00, 0xc1, 0x29, 0x54, 0x29, 0x01, 0x00, 0x00,
+ 0x00, 0xc1, 0x2a, 0x54, 0x2a, 0x01, 0x00, 0x00,
+ 0x00, 0xc1, 0x2b, 0x54, 0x2b, 0x01, 0x00, 0x00,
+ 0x00, 0xc1, 0x2c, 0x50, 0xc4, 0x0d, 0x0e, 0x11,
+ 0xc1, 0x2d, 0x50, 0x24, 0x00, 0x00, 0x0e, 0xc5,
+ 0x0c, 0x68, 0x0d, 0x00, 0x5f, 0x1f, 0x00, 0x65,
+ 0x1f, 0x00, 0x41, 0x3b, 0x00, 0x00, 0x00, 0x5f,
+ 0x20, 0x00, 0x65, 0x06, 0x00, 0x65, 0x20, 0x00,
+ 0x04, 0x25, 0x01, 0x00, 0x00, 0xf1, 0x0e, 0x65,
+ 0x06, 0x00, 0x65, 0x20, 0x00, 0x04, 0x0c, 0x01,
+ 0x00, 0x00, 0xf1, 0x0e, 0x65, 0x06, 0x00, 0x65,
+ 0x20, 0x00, 0x04, 0x11, 0x01, 0x00, 0x00, 0xf1,
+ 0x0e, 0x65, 0x06, 0x00, 0x65, 0x20, 0x00, 0x04,
+ 0x2c, 0x01, 0x00, 0x00, 0xf1, 0x0e, 0x65, 0x06,
+ 0x00, 0x65, 0x20, 0x00, 0x04, 0x2d, 0x01, 0x00,
+ 0x00, 0xf1, 0x0e, 0x65, 0x06, 0x00, 0x65, 0x20,
+ 0x00, 0x04, 0x2e, 0x01, 0x00, 0x00, 0xf1, 0x0e,
+ 0x65, 0x06, 0x00, 0x65, 0x20, 0x00, 0x04, 0x2f,
+ 0x01, 0x00, 0x00, 0xf1, 0x0e, 0x65, 0x06, 0x00,
+ 0x65, 0x20, 0x00, 0x04, 0x22, 0x01, 0x00, 0x00,
+ 0xf1, 0x0e, 0x38, 0x94, 0x00, 0x00, 0x00, 0x42,
+ 0x64, 0x00, 0x00, 0x00, 0x38, 0x07, 0x01, 0x00,
+ 0x00, 0x04, 0xeb, 0x00, 0x00, 0x00, 0x0b, 0x0a,
+ 0x4c, 0x3f, 0x00, 0x00, 0x00, 0x0a, 0x4c, 0x3d,
+ 0x00, 0x00, 0x00, 0x0a, 0x4c, 0x3e, 0x00, 0x00,
+ 0x00, 0x65, 0x1f, 0x00, 0x4c, 0x40, 0x00, 0x00,
+ 0x00, 0x24, 0x03, 0x00, 0x29, 0xc0, 0x03, 0x01,
+ 0xfe, 0x01, 0x01, 0x00, 0x0a, 0x0e, 0x6c, 0x21,
+ 0x21, 0x21, 0x3f, 0x18, 0x4a, 0x00, 0x11, 0x12,
+ 0x00, 0x08, 0x08, 0x00, 0x08, 0x08, 0x00, 0x08,
+ 0x08, 0x00, 0x08, 0x08, 0x2b, 0x36, 0x49, 0x4a,
+ 0x00, 0x11, 0x14, 0x00, 0x08, 0x08, 0x2b, 0x36,
+ 0x4a, 0x00, 0x11, 0x12, 0x2b, 0x40, 0x53, 0x08,
  0x21, 0x21, 0x21, 0x2b, 0x1c, 0x08, 0x21, 0x21,
  0x21, 0x2b, 0x1c, 0x08, 0x21, 0x21, 0x21, 0x2b,
  0x1c, 0x08, 0x21, 0x21, 0x21, 0x2b, 0x1c, 0x08,
- 0x21, 0x21, 0x21, 0x2b, 0x1c, 0x18, 0x8a, 0x8a,
- 0x6c, 0x44, 0x45, 0x6c, 0x21, 0x21, 0x21, 0x3f,
- 0x18, 0x6c, 0x21, 0x21, 0x21, 0x2b, 0x18, 0x6c,
- 0x21, 0x21, 0x21, 0x2b, 0x17, 0x4a, 0x00, 0x11,
- 0x28, 0x00, 0x08, 0x08, 0x2b, 0x40, 0x3a, 0x44,
- 0x44, 0x45, 0x6c, 0x21, 0x21, 0x21, 0x2b, 0x18,
- 0x4a, 0x58, 0x0d, 0x0d, 0x0d, 0x0d, 0x00, 0x02,
- 0x50, 0x00, 0x08, 0x08, 0x00, 0x08, 0x08, 0x00,
+ 0x21, 0x21, 0x21, 0x2b, 0x1c, 0x08, 0x21, 0x21,
+ 0x21, 0x2b, 0x1c, 0x18, 0x8a, 0x8a, 0x6c, 0x44,
+ 0x45, 0x6c, 0x21, 0x21, 0x21, 0x3f, 0x18, 0x6c,
+ 0x21, 0x21, 0x21, 0x2b, 0x18, 0x6c, 0x21, 0x21,
+ 0x21, 0x2b, 0x17, 0x49, 0x4a, 0x00, 0x11, 0x28,
+ 0x00, 0x08, 0x08, 0x00, 0x08, 0x08, 0x2b, 0x40,
+ 0x3a, 0x44, 0x46, 0x7b, 0x62, 0x00, 0x08, 0x08,
+ 0x2b, 0x00, 0x04, 0x30, 0x00, 0x0f, 0x0e, 0x40,
+ 0x53, 0x08, 0x21, 0x21, 0x21, 0x2b, 0x1c, 0x08,
+ 0x21, 0x21, 0x21, 0x2b, 0x1c, 0x18, 0x4a, 0x00,
+ 0x11, 0x2e, 0x00, 0x08, 0x08, 0x00, 0x08, 0x08,
+ 0x2b, 0x40, 0x3a, 0x44, 0x44, 0x44, 0x45, 0x6c,
+ 0x21, 0x21, 0x21, 0x2b, 0x18, 0x4a, 0x58, 0x0d,
+ 0x0d, 0x0d, 0x0d, 0x00, 0x02, 0x50, 0x00, 0x08,
+ 0x08, 0x00, 0x08, 0x08, 0x00, 0x08, 0x08, 0x00,
  0x08, 0x08, 0x00, 0x08, 0x08, 0x00, 0x08, 0x08,
  0x00, 0x08, 0x08, 0x00, 0x08, 0x08, 0x00, 0x08,
  0x08, 0x00, 0x08, 0x08, 0x00, 0x08, 0x08, 0x00,
  0x08, 0x08, 0x00, 0x08, 0x08, 0x00, 0x08, 0x08,
  0x00, 0x08, 0x08, 0x00, 0x08, 0x08, 0x00, 0x08,
- 0x08, 0x00, 0x08, 0x08, 0x00, 0x08, 0x08, 0x00,
- 0x08, 0x08, 0x2b, 0x72, 0x3a, 0x44, 0x44, 0x44,
- 0x44, 0x44, 0x44, 0x44, 0x45, 0x6c, 0x21, 0x21,
- 0x21, 0x2b, 0x0e, 0xc6, 0x07, 0x01, 0x00, 0x01,
- 0x03, 0x01, 0x03, 0x02, 0x00, 0x34, 0x04, 0x84,
- 0x04, 0x00, 0x01, 0x00, 0xe2, 0x01, 0x00, 0x01,
- 0x00, 0xe0, 0x01, 0x00, 0x01, 0x00, 0x10, 0x00,
- 0x01, 0x40, 0xea, 0x01, 0x01, 0x0d, 0xea, 0x03,
- 0x0a, 0x0c, 0x0c, 0x02, 0xca, 0x0c, 0x03, 0xcb,
- 0x61, 0x02, 0x00, 0x2b, 0xc6, 0x34, 0xc7, 0x04,
- 0x02, 0x01, 0x00, 0x00, 0x21, 0x01, 0x00, 0x11,
- 0x64, 0x02, 0x00, 0x65, 0x00, 0x00, 0x11, 0xeb,
- 0x08, 0x62, 0x02, 0x00, 0x1b, 0x24, 0x00, 0x00,
- 0x0e, 0x0e, 0x62, 0x02, 0x00, 0x65, 0x01, 0x00,
- 0xd2, 0x49, 0x62, 0x02, 0x00, 0x28, 0xc0, 0x03,
- 0x11, 0x03, 0x35, 0x9a, 0x2b, 0x0e, 0x42, 0x07,
- 0x01, 0x00, 0x00, 0x01, 0x00, 0x03, 0x01, 0x00,
- 0x0f, 0x01, 0x10, 0x00, 0x01, 0x00, 0xea, 0x03,
- 0x0a, 0x0c, 0x08, 0xca, 0x38, 0x98, 0x00, 0x00,
- 0x00, 0xc6, 0x65, 0x00, 0x00, 0x47, 0x23, 0x01,
- 0x00, 0xc0, 0x03, 0x17, 0x01, 0x0d, 0x0e, 0x42,
- 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
- 0x00, 0x06, 0x00, 0x38, 0x45, 0x00, 0x00, 0x00,
- 0x28, 0xc0, 0x03, 0x1b, 0x01, 0x03, 0x0e, 0x42,
- 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
- 0x00, 0x06, 0x00, 0x38, 0x45, 0x00, 0x00, 0x00,
- 0x28, 0xc0, 0x03, 0x1f, 0x01, 0x03, 0x0e, 0x42,
- 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
- 0x00, 0x06, 0x00, 0x38, 0x45, 0x00, 0x00, 0x00,
- 0x28, 0xc0, 0x03, 0x23, 0x01, 0x03, 0x0e, 0x42,
+ 0x08, 0x00, 0x08, 0x08, 0x00, 0x08, 0x08, 0x2b,
+ 0x72, 0x3a, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+ 0x44, 0x45, 0x6c, 0x21, 0x21, 0x21, 0x2b, 0x13,
+ 0x0e, 0xc6, 0x07, 0x01, 0x00, 0x01, 0x03, 0x01,
+ 0x03, 0x02, 0x00, 0x34, 0x04, 0x98, 0x04, 0x00,
+ 0x01, 0x00, 0xe2, 0x01, 0x00, 0x01, 0x00, 0xe0,
+ 0x01, 0x00, 0x01, 0x00, 0x10, 0x00, 0x01, 0x40,
+ 0xea, 0x01, 0x01, 0x0d, 0xf4, 0x03, 0x0b, 0x0c,
+ 0x0c, 0x02, 0xca, 0x0c, 0x03, 0xcb, 0x61, 0x02,
+ 0x00, 0x2b, 0xc6, 0x34, 0xc7, 0x04, 0x0c, 0x01,
+ 0x00, 0x00, 0x21, 0x01, 0x00, 0x11, 0x64, 0x02,
+ 0x00, 0x65, 0x00, 0x00, 0x11, 0xeb, 0x08, 0x62,
+ 0x02, 0x00, 0x1b, 0x24, 0x00, 0x00, 0x0e, 0x0e,
+ 0x62, 0x02, 0x00, 0x65, 0x01, 0x00, 0xd2, 0x49,
+ 0x62, 0x02, 0x00, 0x28, 0xc0, 0x03, 0x11, 0x03,
+ 0x35, 0x9a, 0x2b, 0x0e, 0x42, 0x07, 0x01, 0x00,
+ 0x00, 0x01, 0x00, 0x03, 0x01, 0x00, 0x0f, 0x01,
+ 0x10, 0x00, 0x01, 0x00, 0xf4, 0x03, 0x0b, 0x0c,
+ 0x08, 0xca, 0x38, 0x98, 0x00, 0x00, 0x00, 0xc6,
+ 0x65, 0x00, 0x00, 0x47, 0x23, 0x01, 0x00, 0xc0,
+ 0x03, 0x17, 0x01, 0x0d, 0x0e, 0x42, 0x07, 0x01,
+ 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x06,
+ 0x00, 0x38, 0x45, 0x00, 0x00, 0x00, 0x28, 0xc0,
+ 0x03, 0x1b, 0x01, 0x03, 0x0e, 0x42, 0x07, 0x01,
+ 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x06,
+ 0x00, 0x38, 0x45, 0x00, 0x00, 0x00, 0x28, 0xc0,
+ 0x03, 0x1f, 0x01, 0x03, 0x0e, 0x42, 0x07, 0x01,
+ 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x06,
+ 0x00, 0x38, 0x45, 0x00, 0x00, 0x00, 0x28, 0xc0,
+ 0x03, 0x23, 0x01, 0x03, 0x0e, 0x42, 0x07, 0x01,
+ 0x00, 0x00, 0x01, 0x00, 0x02, 0x01, 0x00, 0x08,
+ 0x01, 0x10, 0x00, 0x01, 0x00, 0xf4, 0x03, 0x0b,
+ 0x0c, 0x08, 0xca, 0xc6, 0x65, 0x00, 0x00, 0x47,
+ 0x28, 0xc0, 0x03, 0x27, 0x01, 0x0d, 0x0e, 0xc4,
+ 0x07, 0x01, 0x00, 0x03, 0x03, 0x02, 0x03, 0x03,
+ 0x00, 0x40, 0x06, 0xe0, 0x04, 0x00, 0x01, 0x00,
+ 0x9a, 0x04, 0x00, 0x01, 0x00, 0x9c, 0x04, 0x00,
+ 0x01, 0x00, 0xe2, 0x01, 0x00, 0x01, 0x00, 0xe0,
+ 0x01, 0x00, 0x01, 0x00, 0x10, 0x00, 0x01, 0x40,
+ 0xea, 0x01, 0x03, 0x0d, 0xf6, 0x03, 0x0d, 0x0c,
+ 0xf8, 0x03, 0x0e, 0x0c, 0x0c, 0x02, 0xca, 0x0c,
+ 0x03, 0xcb, 0x61, 0x02, 0x00, 0x2b, 0xd4, 0xf3,
+ 0xeb, 0x05, 0x26, 0x00, 0x00, 0xd8, 0xc6, 0x34,
+ 0xc7, 0xd2, 0x21, 0x01, 0x00, 0x11, 0x64, 0x02,
+ 0x00, 0x65, 0x00, 0x00, 0x11, 0xeb, 0x08, 0x62,
+ 0x02, 0x00, 0x1b, 0x24, 0x00, 0x00, 0x0e, 0x0e,
+ 0x62, 0x02, 0x00, 0x65, 0x01, 0x00, 0xd3, 0x49,
+ 0x62, 0x02, 0x00, 0x65, 0x02, 0x00, 0xd4, 0x49,
+ 0x62, 0x02, 0x00, 0x28, 0xc0, 0x03, 0x30, 0x04,
+ 0x5d, 0x86, 0x2b, 0x2b, 0x0e, 0x42, 0x07, 0x01,
+ 0x00, 0x00, 0x01, 0x00, 0x02, 0x01, 0x00, 0x08,
+ 0x01, 0x10, 0x00, 0x01, 0x00, 0xf6, 0x03, 0x0d,
+ 0x0c, 0x08, 0xca, 0xc6, 0x65, 0x00, 0x00, 0x47,
+ 0x28, 0xc0, 0x03, 0x37, 0x01, 0x0d, 0x0e, 0x42,
  0x07, 0x01, 0x00, 0x00, 0x01, 0x00, 0x02, 0x01,
- 0x00, 0x08, 0x01, 0x10, 0x00, 0x01, 0x00, 0xea,
- 0x03, 0x0a, 0x0c, 0x08, 0xca, 0xc6, 0x65, 0x00,
- 0x00, 0x47, 0x28, 0xc0, 0x03, 0x27, 0x01, 0x0d,
+ 0x00, 0x08, 0x01, 0x10, 0x00, 0x01, 0x00, 0xf8,
+ 0x03, 0x0e, 0x0c, 0x08, 0xca, 0xc6, 0x65, 0x00,
+ 0x00, 0x47, 0x28, 0xc0, 0x03, 0x3b, 0x01, 0x0d,
  0x0e, 0xc6, 0x07, 0x01, 0x00, 0x02, 0x03, 0x02,
- 0x03, 0x02, 0x00, 0x30, 0x05, 0xc0, 0x04, 0x00,
- 0x01, 0x00, 0x86, 0x04, 0x00, 0x01, 0x00, 0xe2,
+ 0x05, 0x02, 0x00, 0x37, 0x05, 0xe0, 0x04, 0x00,
+ 0x01, 0x00, 0x90, 0x02, 0x00, 0x01, 0x00, 0xe2,
  0x01, 0x00, 0x01, 0x00, 0xe0, 0x01, 0x00, 0x01,
- 0x00, 0x10, 0x00, 0x01, 0x40, 0xea, 0x01, 0x03,
- 0x0d, 0xec, 0x03, 0x0c, 0x0c, 0x0c, 0x02, 0xca,
+ 0x00, 0x10, 0x00, 0x01, 0x40, 0xea, 0x01, 0x05,
+ 0x0d, 0xfa, 0x03, 0x10, 0x0c, 0x0c, 0x02, 0xca,
  0x0c, 0x03, 0xcb, 0x61, 0x02, 0x00, 0x2b, 0xc6,
- 0x34, 0xc7, 0xd2, 0x21, 0x01, 0x00, 0x11, 0x64,
- 0x02, 0x00, 0x65, 0x00, 0x00, 0x11, 0xeb, 0x08,
- 0x62, 0x02, 0x00, 0x1b, 0x24, 0x00, 0x00, 0x0e,
- 0x0e, 0x62, 0x02, 0x00, 0x65, 0x01, 0x00, 0xd3,
- 0x49, 0x62, 0x02, 0x00, 0x28, 0xc0, 0x03, 0x2f,
- 0x03, 0x35, 0x86, 0x2b, 0x0e, 0x42, 0x07, 0x01,
- 0x00, 0x00, 0x01, 0x00, 0x02, 0x01, 0x00, 0x08,
- 0x01, 0x10, 0x00, 0x01, 0x00, 0xec, 0x03, 0x0c,
- 0x0c, 0x08, 0xca, 0xc6, 0x65, 0x00, 0x00, 0x47,
- 0x28, 0xc0, 0x03, 0x35, 0x01, 0x0d, 0x0e, 0xc6,
- 0x07, 0x01, 0x00, 0x02, 0x03, 0x02, 0x05, 0x02,
- 0x00, 0x37, 0x05, 0xc0, 0x04, 0x00, 0x01, 0x00,
- 0x90, 0x02, 0x00, 0x01, 0x00, 0xe2, 0x01, 0x00,
- 0x01, 0x00, 0xe0, 0x01, 0x00, 0x01, 0x00, 0x10,
- 0x00, 0x01, 0x40, 0xea, 0x01, 0x05, 0x0d, 0xee,
- 0x03, 0x0e, 0x0c, 0x0c, 0x02, 0xca, 0x0c, 0x03,
- 0xcb, 0x61, 0x02, 0x00, 0x2b, 0xc6, 0x34, 0xc7,
- 0xd2, 0x0b, 0x0a, 0x4c, 0x21, 0x01, 0x00, 0x00,
- 0x21, 0x02, 0x00, 0x11, 0x64, 0x02, 0x00, 0x65,
- 0x00, 0x00, 0x11, 0xeb, 0x08, 0x62, 0x02, 0x00,
- 0x1b, 0x24, 0x00, 0x00, 0x0e, 0x0e, 0x62, 0x02,
- 0x00, 0x65, 0x01, 0x00, 0xd3, 0x49, 0x62, 0x02,
- 0x00, 0x28, 0xc0, 0x03, 0x3d, 0x03, 0x35, 0xa9,
- 0x2b, 0x0e, 0x42, 0x07, 0x01, 0x00, 0x00, 0x01,
- 0x00, 0x02, 0x01, 0x00, 0x08, 0x01, 0x10, 0x00,
- 0x01, 0x00, 0xee, 0x03, 0x0e, 0x0c, 0x08, 0xca,
- 0xc6, 0x65, 0x00, 0x00, 0x47, 0x28, 0xc0, 0x03,
- 0x43, 0x01, 0x0d, 0x0e, 0xc6, 0x07, 0x01, 0x00,
- 0x01, 0x04, 0x01, 0x03, 0x05, 0x03, 0x5c, 0x05,
- 0xc4, 0x04, 0x00, 0x01, 0x00, 0xc6, 0x04, 0x01,
- 0x00, 0x60, 0x10, 0x00, 0x01, 0xc0, 0xe2, 0x01,
- 0x00, 0x01, 0x00, 0xe0, 0x01, 0x00, 0x01, 0x00,
- 0xe2, 0x03, 0x0d, 0x08, 0xe0, 0x03, 0x0b, 0x08,
- 0xea, 0x01, 0x07, 0x0d, 0xe8, 0x03, 0x04, 0x0c,
- 0xf2, 0x03, 0x11, 0x0c, 0x0c, 0x02, 0xcc, 0x0c,
- 0x03, 0xcd, 0x61, 0x01, 0x00, 0x2b, 0x61, 0x00,
- 0x00, 0xc8, 0x34, 0xc9, 0x21, 0x00, 0x00, 0x11,
- 0x64, 0x01, 0x00, 0x65, 0x02, 0x00, 0x11, 0xeb,
- 0x08, 0x62, 0x01, 0x00, 0x1b, 0x24, 0x00, 0x00,
- 0x0e, 0x0e, 0x65, 0x03, 0x00, 0x11, 0xd2, 0x21,
- 0x01, 0x00, 0xca, 0x62, 0x00, 0x00, 0xc1, 0x00,
- 0x43, 0x24, 0x01, 0x00, 0x00, 0x62, 0x00, 0x00,
- 0xc1, 0x01, 0x43, 0x25, 0x01, 0x00, 0x00, 0x62,
- 0x00, 0x00, 0xc1, 0x02, 0x43, 0x26, 0x01, 0x00,
- 0x00, 0x62, 0x01, 0x00, 0x65, 0x04, 0x00, 0x71,
- 0x62, 0x00, 0x00, 0x49, 0x62, 0x01, 0x00, 0x28,
- 0xc0, 0x03, 0x8c, 0x01, 0x0a, 0x44, 0x81, 0x30,
- 0x13, 0x26, 0x13, 0x26, 0x13, 0x27, 0x3a, 0x0e,
+ 0x34, 0xc7, 0xd2, 0x0b, 0x0a, 0x4c, 0x31, 0x01,
+ 0x00, 0x00, 0x21, 0x02, 0x00, 0x11, 0x64, 0x02,
+ 0x00, 0x65, 0x00, 0x00, 0x11, 0xeb, 0x08, 0x62,
+ 0x02, 0x00, 0x1b, 0x24, 0x00, 0x00, 0x0e, 0x0e,
+ 0x62, 0x02, 0x00, 0x65, 0x01, 0x00, 0xd3, 0x49,
+ 0x62, 0x02, 0x00, 0x28, 0xc0, 0x03, 0x43, 0x03,
+ 0x35, 0xa9, 0x2b, 0x0e, 0x42, 0x07, 0x01, 0x00,
+ 0x00, 0x01, 0x00, 0x02, 0x01, 0x00, 0x08, 0x01,
+ 0x10, 0x00, 0x01, 0x00, 0xfa, 0x03, 0x10, 0x0c,
+ 0x08, 0xca, 0xc6, 0x65, 0x00, 0x00, 0x47, 0x28,
+ 0xc0, 0x03, 0x49, 0x01, 0x0d, 0x0e, 0xc6, 0x07,
+ 0x01, 0x00, 0x02, 0x03, 0x02, 0x03, 0x05, 0x02,
+ 0x55, 0x05, 0xe4, 0x04, 0x00, 0x01, 0x00, 0xe6,
+ 0x04, 0x00, 0x01, 0x00, 0x10, 0x00, 0x01, 0xc0,
+ 0xe2, 0x01, 0x00, 0x01, 0x00, 0xe0, 0x01, 0x00,
+ 0x01, 0x00, 0xe8, 0x03, 0x0f, 0x08, 0xcc, 0x03,
+ 0x18, 0x00, 0x80, 0x04, 0x14, 0x0c, 0xea, 0x01,
+ 0x07, 0x0d, 0xfe, 0x03, 0x13, 0x0c, 0x0c, 0x02,
+ 0xcb, 0x0c, 0x03, 0xcc, 0x61, 0x00, 0x00, 0x2b,
+ 0xd2, 0x65, 0x02, 0x00, 0xad, 0xeb, 0x10, 0x38,
+ 0xce, 0x00, 0x00, 0x00, 0x11, 0x04, 0x34, 0x01,
+ 0x00, 0x00, 0x21, 0x01, 0x00, 0x2f, 0xc7, 0x34,
+ 0xc8, 0x21, 0x00, 0x00, 0x11, 0x64, 0x00, 0x00,
+ 0x65, 0x03, 0x00, 0x11, 0xeb, 0x08, 0x62, 0x00,
+ 0x00, 0x1b, 0x24, 0x00, 0x00, 0x0e, 0x0e, 0xd3,
+ 0xc1, 0x00, 0x43, 0x18, 0x01, 0x00, 0x00, 0xd3,
+ 0xc1, 0x01, 0x43, 0x35, 0x01, 0x00, 0x00, 0x62,
+ 0x00, 0x00, 0x65, 0x04, 0x00, 0xd3, 0x49, 0x62,
+ 0x00, 0x00, 0x28, 0xc0, 0x03, 0x93, 0x01, 0x0a,
+ 0x35, 0x26, 0x49, 0x09, 0x81, 0x09, 0x26, 0x09,
+ 0x27, 0x2b, 0x0e, 0xc2, 0x07, 0x01, 0x00, 0x02,
+ 0x00, 0x02, 0x08, 0x03, 0x00, 0x1c, 0x02, 0xec,
+ 0x04, 0x00, 0x01, 0x00, 0x9c, 0x04, 0x00, 0x01,
+ 0x00, 0x10, 0x00, 0x09, 0xe8, 0x03, 0x00, 0x08,
+ 0xcc, 0x03, 0x01, 0x00, 0x65, 0x00, 0x00, 0x42,
+ 0x37, 0x01, 0x00, 0x00, 0x65, 0x01, 0x00, 0x11,
+ 0x04, 0x33, 0x00, 0x00, 0x00, 0xd2, 0xe0, 0xd3,
+ 0xf0, 0x21, 0x03, 0x00, 0x24, 0x01, 0x00, 0x29,
+ 0xc0, 0x03, 0x9a, 0x01, 0x02, 0x03, 0x8a, 0x0e,
  0xc2, 0x07, 0x01, 0x00, 0x01, 0x00, 0x01, 0x06,
- 0x02, 0x00, 0x19, 0x01, 0xce, 0x04, 0x00, 0x01,
- 0x00, 0x10, 0x01, 0x09, 0xe2, 0x03, 0x00, 0x08,
- 0x65, 0x00, 0x00, 0x42, 0x28, 0x01, 0x00, 0x00,
- 0x65, 0x01, 0x00, 0x11, 0x04, 0x33, 0x00, 0x00,
+ 0x02, 0x00, 0x19, 0x01, 0xf0, 0x04, 0x00, 0x01,
+ 0x00, 0x10, 0x00, 0x09, 0xe8, 0x03, 0x00, 0x08,
+ 0x65, 0x00, 0x00, 0x42, 0x37, 0x01, 0x00, 0x00,
+ 0x65, 0x01, 0x00, 0x11, 0x04, 0x17, 0x01, 0x00,
  0x00, 0xd2, 0x21, 0x02, 0x00, 0x24, 0x01, 0x00,
- 0x29, 0xc0, 0x03, 0x90, 0x01, 0x02, 0x03, 0x7b,
- 0x0e, 0xc2, 0x07, 0x01, 0x00, 0x01, 0x00, 0x01,
- 0x06, 0x02, 0x00, 0x19, 0x01, 0xd2, 0x04, 0x00,
- 0x01, 0x00, 0x10, 0x01, 0x09, 0xe2, 0x03, 0x00,
- 0x08, 0x65, 0x00, 0x00, 0x42, 0x28, 0x01, 0x00,
- 0x00, 0x65, 0x01, 0x00, 0x11, 0x04, 0x0b, 0x01,
- 0x00, 0x00, 0xd2, 0x21, 0x02, 0x00, 0x24, 0x01,
- 0x00, 0x29, 0xc0, 0x03, 0x93, 0x01, 0x02, 0x03,
- 0x7b, 0x0e, 0xc2, 0x07, 0x01, 0x00, 0x01, 0x00,
- 0x01, 0x05, 0x02, 0x00, 0x14, 0x01, 0x84, 0x04,
- 0x00, 0x01, 0x00, 0x10, 0x01, 0x09, 0xe0, 0x03,
- 0x01, 0x08, 0x65, 0x00, 0x00, 0x42, 0x28, 0x01,
- 0x00, 0x00, 0x65, 0x01, 0x00, 0x11, 0xd2, 0x21,
- 0x01, 0x00, 0x24, 0x01, 0x00, 0x29, 0xc0, 0x03,
- 0x96, 0x01, 0x02, 0x03, 0x62, 0x0e, 0x40, 0x07,
- 0x01, 0x00, 0x01, 0x01, 0x00, 0x03, 0x01, 0x00,
- 0x15, 0x02, 0xd4, 0x04, 0x00, 0x01, 0x00, 0x10,
- 0x00, 0x01, 0x00, 0xf2, 0x03, 0x11, 0x0c, 0x08,
- 0xca, 0x0d, 0x00, 0x00, 0xd6, 0xc6, 0x65, 0x00,
- 0x00, 0x47, 0x42, 0x09, 0x01, 0x00, 0x00, 0xd2,
- 0x24, 0x01, 0x00, 0x29, 0xc0, 0x03, 0x9d, 0x01,
- 0x02, 0x21, 0x49, 0x0e, 0x42, 0x07, 0x01, 0x00,
+ 0x29, 0xc0, 0x03, 0x9d, 0x01, 0x02, 0x03, 0x7b,
+ 0x0e, 0x42, 0x07, 0x01, 0x00, 0x02, 0x01, 0x02,
+ 0x05, 0x02, 0x00, 0x14, 0x03, 0x66, 0x00, 0x01,
+ 0x00, 0xf2, 0x04, 0x00, 0x01, 0x00, 0x10, 0x00,
+ 0x01, 0x00, 0xfe, 0x03, 0x13, 0x0c, 0xce, 0x03,
+ 0x19, 0x00, 0x08, 0xca, 0xc6, 0x65, 0x00, 0x00,
+ 0x47, 0x42, 0x14, 0x01, 0x00, 0x00, 0xd2, 0xdf,
+ 0xd3, 0xf0, 0x24, 0x02, 0x00, 0x29, 0xc0, 0x03,
+ 0xa4, 0x01, 0x02, 0x0d, 0x58, 0x0e, 0x42, 0x07,
+ 0x01, 0x00, 0x00, 0x01, 0x00, 0x02, 0x01, 0x00,
+ 0x10, 0x01, 0x10, 0x00, 0x01, 0x00, 0xfe, 0x03,
+ 0x13, 0x0c, 0x08, 0xca, 0xc6, 0x65, 0x00, 0x00,
+ 0x47, 0x42, 0x15, 0x01, 0x00, 0x00, 0x24, 0x00,
+ 0x00, 0x29, 0xc0, 0x03, 0xa8, 0x01, 0x02, 0x0d,
+ 0x44, 0x0e, 0x42, 0x07, 0x01, 0x00, 0x00, 0x01,
+ 0x00, 0x02, 0x01, 0x00, 0x10, 0x01, 0x10, 0x00,
+ 0x01, 0x00, 0xfe, 0x03, 0x13, 0x0c, 0x08, 0xca,
+ 0xc6, 0x65, 0x00, 0x00, 0x47, 0x42, 0x16, 0x01,
+ 0x00, 0x00, 0x24, 0x00, 0x00, 0x29, 0xc0, 0x03,
+ 0xac, 0x01, 0x02, 0x0d, 0x44, 0x0e, 0x42, 0x07,
+ 0x01, 0x00, 0x01, 0x01, 0x01, 0x04, 0x01, 0x00,
+ 0x1f, 0x02, 0x80, 0x01, 0x00, 0x01, 0x00, 0x10,
+ 0x00, 0x01, 0x00, 0x84, 0x04, 0x17, 0x0c, 0x08,
+ 0xca, 0x65, 0x00, 0x00, 0x41, 0x42, 0x00, 0x00,
+ 0x00, 0x42, 0x10, 0x01, 0x00, 0x00, 0xc6, 0xd2,
+ 0x24, 0x02, 0x00, 0x0e, 0xc6, 0x42, 0x15, 0x01,
+ 0x00, 0x00, 0x24, 0x00, 0x00, 0x29, 0xc0, 0x03,
+ 0xb9, 0x01, 0x03, 0x0d, 0x62, 0x30, 0x0e, 0x43,
+ 0x06, 0x01, 0xcc, 0x03, 0x01, 0x00, 0x01, 0x03,
+ 0x02, 0x01, 0x13, 0x01, 0x9c, 0x04, 0x00, 0x01,
+ 0x00, 0xec, 0x03, 0x15, 0x08, 0x80, 0x04, 0x14,
+ 0x0c, 0xd2, 0x97, 0xeb, 0x05, 0x26, 0x00, 0x00,
+ 0x28, 0xd2, 0x42, 0x3a, 0x01, 0x00, 0x00, 0xc1,
+ 0x00, 0x25, 0x01, 0x00, 0xc0, 0x03, 0xbf, 0x01,
+ 0x04, 0x03, 0x17, 0x12, 0x09, 0x0e, 0x42, 0x06,
+ 0x01, 0x00, 0x01, 0x00, 0x01, 0x04, 0x02, 0x00,
+ 0x0c, 0x01, 0xe6, 0x04, 0x00, 0x01, 0x00, 0xec,
+ 0x03, 0x00, 0x08, 0x80, 0x04, 0x01, 0x0c, 0x65,
+ 0x00, 0x00, 0x11, 0x65, 0x01, 0x00, 0xd2, 0x21,
+ 0x02, 0x00, 0x28, 0xc0, 0x03, 0xc4, 0x01, 0x00,
+ 0x0e, 0x43, 0x06, 0x01, 0xce, 0x03, 0x01, 0x01,
+ 0x01, 0x03, 0x02, 0x01, 0x4d, 0x02, 0xf2, 0x04,
+ 0x00, 0x01, 0x00, 0xf6, 0x04, 0x01, 0x00, 0x60,
+ 0xec, 0x03, 0x15, 0x08, 0xfe, 0x03, 0x13, 0x0c,
+ 0x61, 0x00, 0x00, 0xc1, 0x00, 0x4d, 0x3b, 0x01,
+ 0x00, 0x00, 0xca, 0x38, 0x95, 0x00, 0x00, 0x00,
+ 0x42, 0x3c, 0x01, 0x00, 0x00, 0xd2, 0x24, 0x01,
+ 0x00, 0xeb, 0x08, 0x62, 0x00, 0x00, 0xd2, 0x23,
+ 0x01, 0x00, 0xd2, 0xeb, 0x27, 0x38, 0x95, 0x00,
+ 0x00, 0x00, 0x42, 0x3c, 0x01, 0x00, 0x00, 0xd2,
+ 0x41, 0x39, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00,
+ 0xeb, 0x12, 0x0b, 0x62, 0x00, 0x00, 0xd2, 0x41,
+ 0x39, 0x01, 0x00, 0x00, 0xf0, 0x4c, 0x39, 0x01,
+ 0x00, 0x00, 0x28, 0xd2, 0x28, 0xc0, 0x03, 0xc7,
+ 0x01, 0x07, 0x12, 0x2c, 0x53, 0x28, 0x7b, 0x53,
+ 0x09, 0x0e, 0x42, 0x06, 0x01, 0x00, 0x01, 0x00,
+ 0x01, 0x03, 0x02, 0x01, 0x0b, 0x01, 0xfa, 0x04,
+ 0x00, 0x01, 0x00, 0xec, 0x03, 0x00, 0x08, 0xfe,
+ 0x03, 0x01, 0x0c, 0xd2, 0x42, 0x3a, 0x01, 0x00,
+ 0x00, 0xc1, 0x00, 0x25, 0x01, 0x00, 0xc0, 0x03,
+ 0xc8, 0x01, 0x00, 0x0e, 0x42, 0x06, 0x01, 0x00,
+ 0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x0f, 0x01,
+ 0xfc, 0x04, 0x00, 0x01, 0x00, 0xec, 0x03, 0x00,
+ 0x08, 0xfe, 0x03, 0x01, 0x0c, 0xd2, 0x65, 0x00,
+ 0x00, 0xa8, 0xeb, 0x07, 0xd2, 0x65, 0x01, 0x00,
+ 0x47, 0x28, 0xd2, 0x28, 0xc0, 0x03, 0xc8, 0x01,
+ 0x00, 0x0e, 0x42, 0x07, 0x01, 0x00, 0x00, 0x03,
+ 0x00, 0x05, 0x04, 0x00, 0x54, 0x03, 0xfe, 0x04,
+ 0x01, 0x00, 0x60, 0x80, 0x05, 0x01, 0x01, 0x60,
+ 0x10, 0x00, 0x01, 0x00, 0xea, 0x01, 0x09, 0x0d,
+ 0xda, 0x03, 0x05, 0x0c, 0xec, 0x03, 0x15, 0x08,
+ 0x80, 0x04, 0x14, 0x0c, 0x08, 0xcc, 0x2b, 0x65,
+ 0x00, 0x00, 0x11, 0xeb, 0x06, 0xc8, 0x1b, 0x24,
+ 0x00, 0x00, 0x0e, 0x61, 0x01, 0x00, 0x61, 0x00,
+ 0x00, 0x06, 0x11, 0xf3, 0xec, 0x0d, 0x7d, 0x80,
+ 0x00, 0x0e, 0xca, 0x80, 0x00, 0x0e, 0xcb, 0x83,
+ 0xed, 0x08, 0x0e, 0x65, 0x01, 0x00, 0xef, 0xed,
+ 0xee, 0xc8, 0x65, 0x02, 0x00, 0x11, 0x65, 0x03,
+ 0x00, 0x62, 0x00, 0x00, 0x21, 0x02, 0x00, 0x43,
+ 0x3f, 0x01, 0x00, 0x00, 0xc8, 0x65, 0x02, 0x00,
+ 0x11, 0x65, 0x03, 0x00, 0x62, 0x01, 0x00, 0x21,
+ 0x02, 0x00, 0x43, 0x40, 0x01, 0x00, 0x00, 0x29,
+ 0xc0, 0x03, 0xd6, 0x01, 0x04, 0x6c, 0x7c, 0x62,
+ 0x62, 0x0e, 0xc6, 0x07, 0x01, 0x00, 0x01, 0x04,
+ 0x01, 0x03, 0x06, 0x04, 0x66, 0x05, 0x82, 0x05,
+ 0x00, 0x01, 0x00, 0x84, 0x05, 0x01, 0x00, 0x60,
+ 0x10, 0x00, 0x01, 0xc0, 0xe2, 0x01, 0x00, 0x01,
+ 0x00, 0xe0, 0x01, 0x00, 0x01, 0x00, 0xe8, 0x03,
+ 0x0f, 0x08, 0xcc, 0x03, 0x18, 0x00, 0xe6, 0x03,
+ 0x0c, 0x08, 0xea, 0x01, 0x0b, 0x0d, 0xf2, 0x03,
+ 0x04, 0x0c, 0x86, 0x04, 0x1b, 0x0c, 0x0c, 0x02,
+ 0xcc, 0x0c, 0x03, 0xcd, 0x61, 0x01, 0x00, 0x2b,
+ 0x61, 0x00, 0x00, 0xc8, 0x34, 0xc9, 0x21, 0x00,
+ 0x00, 0x11, 0x64, 0x01, 0x00, 0x65, 0x03, 0x00,
+ 0x11, 0xeb, 0x08, 0x62, 0x01, 0x00, 0x1b, 0x24,
+ 0x00, 0x00, 0x0e, 0x0e, 0x65, 0x04, 0x00, 0x11,
+ 0xd2, 0x21, 0x01, 0x00, 0xca, 0x62, 0x00, 0x00,
+ 0xc1, 0x00, 0x43, 0x18, 0x01, 0x00, 0x00, 0x62,
+ 0x00, 0x00, 0xc1, 0x01, 0x43, 0x35, 0x01, 0x00,
+ 0x00, 0x62, 0x00, 0x00, 0xc1, 0x02, 0x43, 0x43,
+ 0x01, 0x00, 0x00, 0x62, 0x00, 0x00, 0xc1, 0x03,
+ 0x43, 0x44, 0x01, 0x00, 0x00, 0x62, 0x01, 0x00,
+ 0x65, 0x05, 0x00, 0x71, 0x62, 0x00, 0x00, 0x49,
+ 0x62, 0x01, 0x00, 0x28, 0xc0, 0x03, 0xf0, 0x01,
+ 0x0c, 0x44, 0x81, 0x30, 0x13, 0x26, 0x13, 0x26,
+ 0x13, 0x26, 0x13, 0x27, 0x3a, 0x0e, 0xc2, 0x07,
+ 0x01, 0x00, 0x02, 0x00, 0x02, 0x08, 0x03, 0x00,
+ 0x1c, 0x02, 0xec, 0x04, 0x00, 0x01, 0x00, 0x9c,
+ 0x04, 0x00, 0x01, 0x00, 0x10, 0x01, 0x09, 0xe8,
+ 0x03, 0x00, 0x08, 0xcc, 0x03, 0x01, 0x00, 0x65,
+ 0x00, 0x00, 0x42, 0x37, 0x01, 0x00, 0x00, 0x65,
+ 0x01, 0x00, 0x11, 0x04, 0x33, 0x00, 0x00, 0x00,
+ 0xd2, 0xe0, 0xd3, 0xf0, 0x21, 0x03, 0x00, 0x24,
+ 0x01, 0x00, 0x29, 0xc0, 0x03, 0xf4, 0x01, 0x02,
+ 0x03, 0x8a, 0x0e, 0xc2, 0x07, 0x01, 0x00, 0x01,
+ 0x00, 0x01, 0x06, 0x02, 0x00, 0x19, 0x01, 0xf0,
+ 0x04, 0x00, 0x01, 0x00, 0x10, 0x01, 0x09, 0xe8,
+ 0x03, 0x00, 0x08, 0x65, 0x00, 0x00, 0x42, 0x37,
+ 0x01, 0x00, 0x00, 0x65, 0x01, 0x00, 0x11, 0x04,
+ 0x17, 0x01, 0x00, 0x00, 0xd2, 0x21, 0x02, 0x00,
+ 0x24, 0x01, 0x00, 0x29, 0xc0, 0x03, 0xf7, 0x01,
+ 0x02, 0x03, 0x7b, 0x0e, 0xc2, 0x07, 0x01, 0x00,
+ 0x01, 0x00, 0x01, 0x05, 0x02, 0x00, 0x14, 0x01,
+ 0x98, 0x04, 0x00, 0x01, 0x00, 0x10, 0x01, 0x09,
+ 0xe6, 0x03, 0x02, 0x08, 0x65, 0x00, 0x00, 0x42,
+ 0x37, 0x01, 0x00, 0x00, 0x65, 0x01, 0x00, 0x11,
+ 0xd2, 0x21, 0x01, 0x00, 0x24, 0x01, 0x00, 0x29,
+ 0xc0, 0x03, 0xfa, 0x01, 0x02, 0x03, 0x62, 0x0e,
+ 0xc2, 0x07, 0x01, 0x00, 0x01, 0x00, 0x01, 0x06,
+ 0x02, 0x00, 0x19, 0x01, 0xec, 0x04, 0x00, 0x01,
+ 0x00, 0x10, 0x01, 0x09, 0xe8, 0x03, 0x00, 0x08,
+ 0x65, 0x00, 0x00, 0x42, 0x37, 0x01, 0x00, 0x00,
+ 0x65, 0x01, 0x00, 0x11, 0x04, 0x1b, 0x01, 0x00,
+ 0x00, 0xd2, 0x21, 0x02, 0x00, 0x24, 0x01, 0x00,
+ 0x29, 0xc0, 0x03, 0xfd, 0x01, 0x02, 0x03, 0x7b,
+ 0x0e, 0x42, 0x07, 0x01, 0x00, 0x02, 0x01, 0x02,
+ 0x05, 0x02, 0x00, 0x14, 0x03, 0x66, 0x00, 0x01,
+ 0x00, 0xf2, 0x04, 0x00, 0x01, 0x00, 0x10, 0x00,
+ 0x01, 0x00, 0x86, 0x04, 0x1b, 0x0c, 0xce, 0x03,
+ 0x19, 0x00, 0x08, 0xca, 0xc6, 0x65, 0x00, 0x00,
+ 0x47, 0x42, 0x14, 0x01, 0x00, 0x00, 0xd2, 0xdf,
+ 0xd3, 0xf0, 0x24, 0x02, 0x00, 0x29, 0xc0, 0x03,
+ 0x84, 0x02, 0x02, 0x0d, 0x58, 0x0e, 0x42, 0x07,
+ 0x01, 0x00, 0x02, 0x01, 0x02, 0x04, 0x01, 0x01,
+ 0x1b, 0x03, 0xb6, 0x04, 0x00, 0x01, 0x80, 0x66,
+ 0x00, 0x01, 0x00, 0x10, 0x00, 0x01, 0x00, 0x86,
+ 0x04, 0x1b, 0x0c, 0x08, 0xca, 0xc6, 0x65, 0x00,
+ 0x00, 0x47, 0x42, 0x19, 0x01, 0x00, 0x00, 0xd2,
+ 0xd3, 0x24, 0x02, 0x00, 0x42, 0x7e, 0x00, 0x00,
+ 0x00, 0xc1, 0x00, 0x25, 0x01, 0x00, 0xc0, 0x03,
+ 0x88, 0x02, 0x01, 0x0d, 0x0e, 0x42, 0x07, 0x01,
+ 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x09,
+ 0x00, 0xb6, 0x04, 0x00, 0x03, 0xde, 0x42, 0x16,
+ 0x01, 0x00, 0x00, 0x25, 0x00, 0x00, 0xc0, 0x03,
+ 0x89, 0x02, 0x00, 0x0e, 0x42, 0x07, 0x01, 0x00,
  0x00, 0x01, 0x00, 0x02, 0x01, 0x00, 0x10, 0x01,
- 0x10, 0x00, 0x01, 0x00, 0xf2, 0x03, 0x11, 0x0c,
+ 0x10, 0x00, 0x01, 0x00, 0x86, 0x04, 0x1b, 0x0c,
  0x08, 0xca, 0xc6, 0x65, 0x00, 0x00, 0x47, 0x42,
- 0x0a, 0x01, 0x00, 0x00, 0x24, 0x00, 0x00, 0x29,
- 0xc0, 0x03, 0xa1, 0x01, 0x02, 0x0d, 0x44, 0x0e,
+ 0x1a, 0x01, 0x00, 0x00, 0x24, 0x00, 0x00, 0x29,
+ 0xc0, 0x03, 0x8c, 0x02, 0x02, 0x0d, 0x44, 0x0e,
  0xc6, 0x07, 0x01, 0x00, 0x00, 0x04, 0x00, 0x03,
- 0x04, 0x08, 0x8d, 0x01, 0x04, 0xd6, 0x04, 0x01,
+ 0x04, 0x08, 0x8d, 0x01, 0x04, 0x8a, 0x05, 0x01,
  0x00, 0x60, 0x10, 0x00, 0x01, 0xc0, 0xe2, 0x01,
  0x00, 0x01, 0x00, 0xe0, 0x01, 0x00, 0x01, 0x00,
- 0xda, 0x03, 0x07, 0x0c, 0xea, 0x01, 0x09, 0x0d,
- 0xe6, 0x03, 0x03, 0x0c, 0xf6, 0x03, 0x14, 0x0c,
+ 0xe0, 0x03, 0x08, 0x0c, 0xea, 0x01, 0x0d, 0x0d,
+ 0xf0, 0x03, 0x03, 0x0c, 0x8a, 0x04, 0x1e, 0x0c,
  0x0c, 0x02, 0xcc, 0x0c, 0x03, 0xcd, 0x61, 0x01,
  0x00, 0x2b, 0x61, 0x00, 0x00, 0xc8, 0x34, 0xc9,
  0x21, 0x00, 0x00, 0x11, 0x64, 0x01, 0x00, 0x65,
  0x01, 0x00, 0x11, 0xeb, 0x08, 0x62, 0x01, 0x00,
  0x1b, 0x24, 0x00, 0x00, 0x0e, 0x0e, 0x65, 0x02,
  0x00, 0x11, 0x21, 0x00, 0x00, 0xca, 0x62, 0x00,
- 0x00, 0xc1, 0x00, 0x43, 0x2c, 0x01, 0x00, 0x00,
- 0x62, 0x00, 0x00, 0xc1, 0x01, 0x43, 0x26, 0x01,
+ 0x00, 0xc1, 0x00, 0x43, 0x46, 0x01, 0x00, 0x00,
+ 0x62, 0x00, 0x00, 0xc1, 0x01, 0x43, 0x43, 0x01,
  0x00, 0x00, 0x62, 0x00, 0x00, 0xc1, 0x02, 0x43,
- 0x2d, 0x01, 0x00, 0x00, 0x62, 0x00, 0x00, 0xc1,
- 0x03, 0x43, 0x2e, 0x01, 0x00, 0x00, 0x62, 0x00,
- 0x00, 0xc1, 0x04, 0x43, 0x2f, 0x01, 0x00, 0x00,
- 0x62, 0x00, 0x00, 0xc1, 0x05, 0x43, 0x30, 0x01,
+ 0x47, 0x01, 0x00, 0x00, 0x62, 0x00, 0x00, 0xc1,
+ 0x03, 0x43, 0x48, 0x01, 0x00, 0x00, 0x62, 0x00,
+ 0x00, 0xc1, 0x04, 0x43, 0x49, 0x01, 0x00, 0x00,
+ 0x62, 0x00, 0x00, 0xc1, 0x05, 0x43, 0x4a, 0x01,
  0x00, 0x00, 0x62, 0x00, 0x00, 0xc1, 0x06, 0x43,
- 0x31, 0x01, 0x00, 0x00, 0x62, 0x00, 0x00, 0xc1,
- 0x07, 0x43, 0x32, 0x01, 0x00, 0x00, 0x62, 0x01,
+ 0x4b, 0x01, 0x00, 0x00, 0x62, 0x00, 0x00, 0xc1,
+ 0x07, 0x43, 0x4c, 0x01, 0x00, 0x00, 0x62, 0x01,
  0x00, 0x65, 0x03, 0x00, 0x71, 0x62, 0x00, 0x00,
- 0x49, 0x62, 0x01, 0x00, 0x28, 0xc0, 0x03, 0xbf,
- 0x01, 0x14, 0x44, 0x81, 0x2b, 0x13, 0x26, 0x13,
+ 0x49, 0x62, 0x01, 0x00, 0x28, 0xc0, 0x03, 0xab,
+ 0x02, 0x14, 0x44, 0x81, 0x2b, 0x13, 0x26, 0x13,
  0x26, 0x13, 0x26, 0x13, 0x26, 0x13, 0x26, 0x13,
  0x26, 0x13, 0x26, 0x13, 0x27, 0x3a, 0x0e, 0xc2,
  0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x05, 0x02,
- 0x00, 0x18, 0x00, 0x10, 0x01, 0x09, 0xda, 0x03,
- 0x00, 0x0c, 0x65, 0x00, 0x00, 0x42, 0x28, 0x01,
- 0x00, 0x00, 0x65, 0x01, 0x00, 0x11, 0x04, 0x15,
+ 0x00, 0x18, 0x00, 0x10, 0x01, 0x09, 0xe0, 0x03,
+ 0x00, 0x0c, 0x65, 0x00, 0x00, 0x42, 0x37, 0x01,
+ 0x00, 0x00, 0x65, 0x01, 0x00, 0x11, 0x04, 0x25,
  0x01, 0x00, 0x00, 0x21, 0x01, 0x00, 0x24, 0x01,
- 0x00, 0x29, 0xc0, 0x03, 0xc3, 0x01, 0x02, 0x03,
+ 0x00, 0x29, 0xc0, 0x03, 0xaf, 0x02, 0x02, 0x03,
  0x76, 0x0e, 0xc2, 0x07, 0x01, 0x00, 0x00, 0x00,
  0x00, 0x05, 0x02, 0x00, 0x18, 0x00, 0x10, 0x01,
- 0x09, 0xda, 0x03, 0x00, 0x0c, 0x65, 0x00, 0x00,
- 0x42, 0x28, 0x01, 0x00, 0x00, 0x65, 0x01, 0x00,
- 0x11, 0x04, 0x02, 0x01, 0x00, 0x00, 0x21, 0x01,
- 0x00, 0x24, 0x01, 0x00, 0x29, 0xc0, 0x03, 0xc6,
- 0x01, 0x02, 0x03, 0x76, 0x0e, 0xc2, 0x07, 0x01,
+ 0x09, 0xe0, 0x03, 0x00, 0x0c, 0x65, 0x00, 0x00,
+ 0x42, 0x37, 0x01, 0x00, 0x00, 0x65, 0x01, 0x00,
+ 0x11, 0x04, 0x0c, 0x01, 0x00, 0x00, 0x21, 0x01,
+ 0x00, 0x24, 0x01, 0x00, 0x29, 0xc0, 0x03, 0xb2,
+ 0x02, 0x02, 0x03, 0x76, 0x0e, 0xc2, 0x07, 0x01,
  0x00, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x18,
- 0x00, 0x10, 0x01, 0x09, 0xda, 0x03, 0x00, 0x0c,
- 0x65, 0x00, 0x00, 0x42, 0x28, 0x01, 0x00, 0x00,
- 0x65, 0x01, 0x00, 0x11, 0x04, 0x06, 0x01, 0x00,
+ 0x00, 0x10, 0x01, 0x09, 0xe0, 0x03, 0x00, 0x0c,
+ 0x65, 0x00, 0x00, 0x42, 0x37, 0x01, 0x00, 0x00,
+ 0x65, 0x01, 0x00, 0x11, 0x04, 0x11, 0x01, 0x00,
  0x00, 0x21, 0x01, 0x00, 0x24, 0x01, 0x00, 0x29,
- 0xc0, 0x03, 0xc9, 0x01, 0x02, 0x03, 0x76, 0x0e,
+ 0xc0, 0x03, 0xb5, 0x02, 0x02, 0x03, 0x76, 0x0e,
  0xc2, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x05,
- 0x02, 0x00, 0x18, 0x00, 0x10, 0x01, 0x09, 0xda,
- 0x03, 0x00, 0x0c, 0x65, 0x00, 0x00, 0x42, 0x28,
+ 0x02, 0x00, 0x18, 0x00, 0x10, 0x01, 0x09, 0xe0,
+ 0x03, 0x00, 0x0c, 0x65, 0x00, 0x00, 0x42, 0x37,
  0x01, 0x00, 0x00, 0x65, 0x01, 0x00, 0x11, 0x04,
- 0x1c, 0x01, 0x00, 0x00, 0x21, 0x01, 0x00, 0x24,
- 0x01, 0x00, 0x29, 0xc0, 0x03, 0xcc, 0x01, 0x02,
+ 0x2c, 0x01, 0x00, 0x00, 0x21, 0x01, 0x00, 0x24,
+ 0x01, 0x00, 0x29, 0xc0, 0x03, 0xb8, 0x02, 0x02,
  0x03, 0x76, 0x0e, 0xc2, 0x07, 0x01, 0x00, 0x00,
  0x00, 0x00, 0x05, 0x02, 0x00, 0x18, 0x00, 0x10,
- 0x01, 0x09, 0xda, 0x03, 0x00, 0x0c, 0x65, 0x00,
- 0x00, 0x42, 0x28, 0x01, 0x00, 0x00, 0x65, 0x01,
- 0x00, 0x11, 0x04, 0x1d, 0x01, 0x00, 0x00, 0x21,
+ 0x01, 0x09, 0xe0, 0x03, 0x00, 0x0c, 0x65, 0x00,
+ 0x00, 0x42, 0x37, 0x01, 0x00, 0x00, 0x65, 0x01,
+ 0x00, 0x11, 0x04, 0x2d, 0x01, 0x00, 0x00, 0x21,
  0x01, 0x00, 0x24, 0x01, 0x00, 0x29, 0xc0, 0x03,
- 0xcf, 0x01, 0x02, 0x03, 0x76, 0x0e, 0xc2, 0x07,
+ 0xbb, 0x02, 0x02, 0x03, 0x76, 0x0e, 0xc2, 0x07,
  0x01, 0x00, 0x01, 0x00, 0x01, 0x06, 0x02, 0x00,
- 0x19, 0x01, 0xe6, 0x04, 0x00, 0x01, 0x00, 0x10,
- 0x01, 0x09, 0xda, 0x03, 0x00, 0x0c, 0x65, 0x00,
- 0x00, 0x42, 0x28, 0x01, 0x00, 0x00, 0x65, 0x01,
- 0x00, 0x11, 0x04, 0x1e, 0x01, 0x00, 0x00, 0xd2,
+ 0x19, 0x01, 0x9a, 0x05, 0x00, 0x01, 0x00, 0x10,
+ 0x01, 0x09, 0xe0, 0x03, 0x00, 0x0c, 0x65, 0x00,
+ 0x00, 0x42, 0x37, 0x01, 0x00, 0x00, 0x65, 0x01,
+ 0x00, 0x11, 0x04, 0x2e, 0x01, 0x00, 0x00, 0xd2,
  0x21, 0x02, 0x00, 0x24, 0x01, 0x00, 0x29, 0xc0,
- 0x03, 0xd2, 0x01, 0x02, 0x03, 0x7b, 0x0e, 0xc2,
+ 0x03, 0xbe, 0x02, 0x02, 0x03, 0x7b, 0x0e, 0xc2,
  0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x05, 0x02,
- 0x00, 0x18, 0x00, 0x10, 0x01, 0x09, 0xda, 0x03,
- 0x00, 0x0c, 0x65, 0x00, 0x00, 0x42, 0x28, 0x01,
- 0x00, 0x00, 0x65, 0x01, 0x00, 0x11, 0x04, 0x1f,
+ 0x00, 0x18, 0x00, 0x10, 0x01, 0x09, 0xe0, 0x03,
+ 0x00, 0x0c, 0x65, 0x00, 0x00, 0x42, 0x37, 0x01,
+ 0x00, 0x00, 0x65, 0x01, 0x00, 0x11, 0x04, 0x2f,
  0x01, 0x00, 0x00, 0x21, 0x01, 0x00, 0x24, 0x01,
- 0x00, 0x29, 0xc0, 0x03, 0xd5, 0x01, 0x02, 0x03,
+ 0x00, 0x29, 0xc0, 0x03, 0xc1, 0x02, 0x02, 0x03,
  0x76, 0x0e, 0xc2, 0x07, 0x01, 0x00, 0x00, 0x00,
  0x00, 0x05, 0x02, 0x00, 0x18, 0x00, 0x10, 0x01,
- 0x09, 0xda, 0x03, 0x00, 0x0c, 0x65, 0x00, 0x00,
- 0x42, 0x28, 0x01, 0x00, 0x00, 0x65, 0x01, 0x00,
- 0x11, 0x04, 0x12, 0x01, 0x00, 0x00, 0x21, 0x01,
- 0x00, 0x24, 0x01, 0x00, 0x29, 0xc0, 0x03, 0xd8,
- 0x01, 0x02, 0x03, 0x76, 0x0e, 0x42, 0x07, 0x01,
+ 0x09, 0xe0, 0x03, 0x00, 0x0c, 0x65, 0x00, 0x00,
+ 0x42, 0x37, 0x01, 0x00, 0x00, 0x65, 0x01, 0x00,
+ 0x11, 0x04, 0x22, 0x01, 0x00, 0x00, 0x21, 0x01,
+ 0x00, 0x24, 0x01, 0x00, 0x29, 0xc0, 0x03, 0xc4,
+ 0x02, 0x02, 0x03, 0x76, 0x0e, 0x42, 0x07, 0x01,
  0x00, 0x00, 0x01, 0x00, 0x02, 0x01, 0x00, 0x0d,
- 0x01, 0x10, 0x00, 0x01, 0x00, 0xf6, 0x03, 0x14,
+ 0x01, 0x10, 0x00, 0x01, 0x00, 0x8a, 0x04, 0x1e,
  0x0c, 0x08, 0xca, 0xc6, 0x65, 0x00, 0x00, 0x47,
- 0x41, 0x0c, 0x01, 0x00, 0x00, 0x28, 0xc0, 0x03,
- 0xdf, 0x01, 0x01, 0x0d, 0x0e, 0x42, 0x07, 0x01,
+ 0x41, 0x1c, 0x01, 0x00, 0x00, 0x28, 0xc0, 0x03,
+ 0xcb, 0x02, 0x01, 0x0d, 0x0e, 0x42, 0x07, 0x01,
  0x00, 0x00, 0x01, 0x00, 0x02, 0x01, 0x00, 0x0d,
- 0x01, 0x10, 0x00, 0x01, 0x00, 0xf6, 0x03, 0x14,
+ 0x01, 0x10, 0x00, 0x01, 0x00, 0x8a, 0x04, 0x1e,
  0x0c, 0x08, 0xca, 0xc6, 0x65, 0x00, 0x00, 0x47,
- 0x41, 0x0d, 0x01, 0x00, 0x00, 0x28, 0xc0, 0x03,
- 0xe3, 0x01, 0x01, 0x0d, 0x0e, 0x42, 0x07, 0x01,
+ 0x41, 0x1d, 0x01, 0x00, 0x00, 0x28, 0xc0, 0x03,
+ 0xcf, 0x02, 0x01, 0x0d, 0x0e, 0x42, 0x07, 0x01,
  0x00, 0x00, 0x01, 0x00, 0x02, 0x01, 0x00, 0x0d,
- 0x01, 0x10, 0x00, 0x01, 0x00, 0xf6, 0x03, 0x14,
+ 0x01, 0x10, 0x00, 0x01, 0x00, 0x8a, 0x04, 0x1e,
  0x0c, 0x08, 0xca, 0xc6, 0x65, 0x00, 0x00, 0x47,
- 0x41, 0x0e, 0x01, 0x00, 0x00, 0x28, 0xc0, 0x03,
- 0xe7, 0x01, 0x01, 0x0d, 0x0e, 0x42, 0x07, 0x01,
+ 0x41, 0x1e, 0x01, 0x00, 0x00, 0x28, 0xc0, 0x03,
+ 0xd3, 0x02, 0x01, 0x0d, 0x0e, 0x42, 0x07, 0x01,
  0x00, 0x01, 0x01, 0x01, 0x02, 0x01, 0x00, 0x0e,
  0x02, 0x80, 0x01, 0x00, 0x01, 0x00, 0x10, 0x00,
- 0x01, 0x00, 0xf6, 0x03, 0x14, 0x0c, 0x08, 0xca,
- 0xc6, 0x65, 0x00, 0x00, 0x47, 0xd2, 0x43, 0x0f,
- 0x01, 0x00, 0x00, 0x29, 0xc0, 0x03, 0xeb, 0x01,
+ 0x01, 0x00, 0x8a, 0x04, 0x1e, 0x0c, 0x08, 0xca,
+ 0xc6, 0x65, 0x00, 0x00, 0x47, 0xd2, 0x43, 0x1f,
+ 0x01, 0x00, 0x00, 0x29, 0xc0, 0x03, 0xd7, 0x02,
  0x02, 0x0d, 0x3a, 0x0e, 0x42, 0x07, 0x01, 0x00,
  0x00, 0x01, 0x00, 0x02, 0x01, 0x00, 0x0d, 0x01,
- 0x10, 0x00, 0x01, 0x00, 0xf6, 0x03, 0x14, 0x0c,
+ 0x10, 0x00, 0x01, 0x00, 0x8a, 0x04, 0x1e, 0x0c,
  0x08, 0xca, 0xc6, 0x65, 0x00, 0x00, 0x47, 0x41,
- 0x0f, 0x01, 0x00, 0x00, 0x28, 0xc0, 0x03, 0xef,
- 0x01, 0x01, 0x0d, 0x0e, 0x42, 0x07, 0x01, 0x00,
+ 0x1f, 0x01, 0x00, 0x00, 0x28, 0xc0, 0x03, 0xdb,
+ 0x02, 0x01, 0x0d, 0x0e, 0x42, 0x07, 0x01, 0x00,
  0x00, 0x01, 0x00, 0x02, 0x01, 0x00, 0x0d, 0x01,
- 0x10, 0x00, 0x01, 0x00, 0xf6, 0x03, 0x14, 0x0c,
+ 0x10, 0x00, 0x01, 0x00, 0x8a, 0x04, 0x1e, 0x0c,
  0x08, 0xca, 0xc6, 0x65, 0x00, 0x00, 0x47, 0x41,
- 0x10, 0x01, 0x00, 0x00, 0x28, 0xc0, 0x03, 0xf3,
- 0x01, 0x01, 0x0d, 0x0e, 0x42, 0x07, 0x01, 0x00,
+ 0x20, 0x01, 0x00, 0x00, 0x28, 0xc0, 0x03, 0xdf,
+ 0x02, 0x01, 0x0d, 0x0e, 0x42, 0x07, 0x01, 0x00,
  0x00, 0x01, 0x00, 0x02, 0x01, 0x00, 0x0d, 0x01,
- 0x10, 0x00, 0x01, 0x00, 0xf6, 0x03, 0x14, 0x0c,
+ 0x10, 0x00, 0x01, 0x00, 0x8a, 0x04, 0x1e, 0x0c,
  0x08, 0xca, 0xc6, 0x65, 0x00, 0x00, 0x47, 0x41,
- 0x87, 0x00, 0x00, 0x00, 0x28, 0xc0, 0x03, 0xf7,
- 0x01, 0x01, 0x0d, 0x0e, 0x42, 0x07, 0x01, 0x00,
+ 0x87, 0x00, 0x00, 0x00, 0x28, 0xc0, 0x03, 0xe3,
+ 0x02, 0x01, 0x0d, 0x0e, 0x42, 0x07, 0x01, 0x00,
  0x00, 0x01, 0x00, 0x02, 0x01, 0x00, 0x0d, 0x01,
- 0x10, 0x00, 0x01, 0x00, 0xf6, 0x03, 0x14, 0x0c,
+ 0x10, 0x00, 0x01, 0x00, 0x8a, 0x04, 0x1e, 0x0c,
  0x08, 0xca, 0xc6, 0x65, 0x00, 0x00, 0x47, 0x41,
- 0x11, 0x01, 0x00, 0x00, 0x28, 0xc0, 0x03, 0xfb,
- 0x01, 0x01, 0x0d, 0x0e, 0x42, 0x07, 0x01, 0x00,
+ 0x21, 0x01, 0x00, 0x00, 0x28, 0xc0, 0x03, 0xe7,
+ 0x02, 0x01, 0x0d, 0x0e, 0x42, 0x07, 0x01, 0x00,
  0x01, 0x01, 0x01, 0x02, 0x01, 0x00, 0x0e, 0x02,
  0x80, 0x01, 0x00, 0x01, 0x00, 0x10, 0x00, 0x01,
- 0x00, 0xf6, 0x03, 0x14, 0x0c, 0x08, 0xca, 0xc6,
- 0x65, 0x00, 0x00, 0x47, 0xd2, 0x43, 0x12, 0x01,
- 0x00, 0x00, 0x29, 0xc0, 0x03, 0xff, 0x01, 0x02,
+ 0x00, 0x8a, 0x04, 0x1e, 0x0c, 0x08, 0xca, 0xc6,
+ 0x65, 0x00, 0x00, 0x47, 0xd2, 0x43, 0x22, 0x01,
+ 0x00, 0x00, 0x29, 0xc0, 0x03, 0xeb, 0x02, 0x02,
  0x0d, 0x3a, 0x0e, 0x42, 0x07, 0x01, 0x00, 0x00,
  0x01, 0x00, 0x02, 0x01, 0x00, 0x0d, 0x01, 0x10,
- 0x00, 0x01, 0x00, 0xf6, 0x03, 0x14, 0x0c, 0x08,
- 0xca, 0xc6, 0x65, 0x00, 0x00, 0x47, 0x41, 0x12,
- 0x01, 0x00, 0x00, 0x28, 0xc0, 0x03, 0x83, 0x02,
+ 0x00, 0x01, 0x00, 0x8a, 0x04, 0x1e, 0x0c, 0x08,
+ 0xca, 0xc6, 0x65, 0x00, 0x00, 0x47, 0x41, 0x22,
+ 0x01, 0x00, 0x00, 0x28, 0xc0, 0x03, 0xef, 0x02,
  0x01, 0x0d, 0x0e, 0x42, 0x07, 0x01, 0x00, 0x00,
  0x01, 0x00, 0x02, 0x01, 0x00, 0x0d, 0x01, 0x10,
- 0x00, 0x01, 0x00, 0xf6, 0x03, 0x14, 0x0c, 0x08,
- 0xca, 0xc6, 0x65, 0x00, 0x00, 0x47, 0x41, 0x13,
- 0x01, 0x00, 0x00, 0x28, 0xc0, 0x03, 0x87, 0x02,
+ 0x00, 0x01, 0x00, 0x8a, 0x04, 0x1e, 0x0c, 0x08,
+ 0xca, 0xc6, 0x65, 0x00, 0x00, 0x47, 0x41, 0x23,
+ 0x01, 0x00, 0x00, 0x28, 0xc0, 0x03, 0xf3, 0x02,
  0x01, 0x0d, 0x0e, 0x42, 0x07, 0x01, 0x00, 0x01,
  0x01, 0x01, 0x02, 0x01, 0x00, 0x0e, 0x02, 0x80,
  0x01, 0x00, 0x01, 0x00, 0x10, 0x00, 0x01, 0x00,
- 0xf6, 0x03, 0x14, 0x0c, 0x08, 0xca, 0xc6, 0x65,
- 0x00, 0x00, 0x47, 0xd2, 0x43, 0x14, 0x01, 0x00,
- 0x00, 0x29, 0xc0, 0x03, 0x8b, 0x02, 0x02, 0x0d,
+ 0x8a, 0x04, 0x1e, 0x0c, 0x08, 0xca, 0xc6, 0x65,
+ 0x00, 0x00, 0x47, 0xd2, 0x43, 0x24, 0x01, 0x00,
+ 0x00, 0x29, 0xc0, 0x03, 0xf7, 0x02, 0x02, 0x0d,
  0x3a, 0x0e, 0x42, 0x07, 0x01, 0x00, 0x00, 0x01,
  0x00, 0x02, 0x01, 0x00, 0x0d, 0x01, 0x10, 0x00,
- 0x01, 0x00, 0xf6, 0x03, 0x14, 0x0c, 0x08, 0xca,
- 0xc6, 0x65, 0x00, 0x00, 0x47, 0x41, 0x14, 0x01,
- 0x00, 0x00, 0x28, 0xc0, 0x03, 0x8f, 0x02, 0x01,
+ 0x01, 0x00, 0x8a, 0x04, 0x1e, 0x0c, 0x08, 0xca,
+ 0xc6, 0x65, 0x00, 0x00, 0x47, 0x41, 0x24, 0x01,
+ 0x00, 0x00, 0x28, 0xc0, 0x03, 0xfb, 0x02, 0x01,
  0x0d, 0x0e, 0x42, 0x07, 0x01, 0x00, 0x00, 0x01,
  0x00, 0x02, 0x01, 0x00, 0x0f, 0x01, 0x10, 0x00,
- 0x01, 0x00, 0xf6, 0x03, 0x14, 0x0c, 0x08, 0xca,
- 0xc6, 0x65, 0x00, 0x00, 0x47, 0x42, 0x15, 0x01,
- 0x00, 0x00, 0x25, 0x00, 0x00, 0xc0, 0x03, 0x93,
+ 0x01, 0x00, 0x8a, 0x04, 0x1e, 0x0c, 0x08, 0xca,
+ 0xc6, 0x65, 0x00, 0x00, 0x47, 0x42, 0x25, 0x01,
+ 0x00, 0x00, 0x25, 0x00, 0x00, 0xc0, 0x03, 0xff,
  0x02, 0x01, 0x0d, 0x0e, 0x42, 0x07, 0x01, 0x00,
  0x00, 0x01, 0x00, 0x02, 0x01, 0x00, 0x0f, 0x01,
- 0x10, 0x00, 0x01, 0x00, 0xf6, 0x03, 0x14, 0x0c,
+ 0x10, 0x00, 0x01, 0x00, 0x8a, 0x04, 0x1e, 0x0c,
  0x08, 0xca, 0xc6, 0x65, 0x00, 0x00, 0x47, 0x42,
- 0x16, 0x01, 0x00, 0x00, 0x25, 0x00, 0x00, 0xc0,
- 0x03, 0x97, 0x02, 0x01, 0x0d, 0x0e, 0x42, 0x07,
+ 0x26, 0x01, 0x00, 0x00, 0x25, 0x00, 0x00, 0xc0,
+ 0x03, 0x83, 0x03, 0x01, 0x0d, 0x0e, 0x42, 0x07,
  0x01, 0x00, 0x01, 0x01, 0x01, 0x03, 0x01, 0x00,
  0x10, 0x02, 0x6c, 0x00, 0x01, 0x00, 0x10, 0x00,
- 0x01, 0x00, 0xf6, 0x03, 0x14, 0x0c, 0x08, 0xca,
- 0xc6, 0x65, 0x00, 0x00, 0x47, 0x42, 0x17, 0x01,
+ 0x01, 0x00, 0x8a, 0x04, 0x1e, 0x0c, 0x08, 0xca,
+ 0xc6, 0x65, 0x00, 0x00, 0x47, 0x42, 0x27, 0x01,
  0x00, 0x00, 0xd2, 0x25, 0x01, 0x00, 0xc0, 0x03,
- 0x9b, 0x02, 0x01, 0x0d, 0x0e, 0x40, 0x07, 0x01,
+ 0x87, 0x03, 0x01, 0x0d, 0x0e, 0x40, 0x07, 0x01,
  0x00, 0x01, 0x01, 0x00, 0x05, 0x01, 0x00, 0x1c,
- 0x02, 0xd4, 0x04, 0x00, 0x01, 0x00, 0x10, 0x00,
- 0x01, 0x00, 0xf6, 0x03, 0x14, 0x0c, 0x08, 0xca,
+ 0x02, 0x9c, 0x05, 0x00, 0x01, 0x00, 0x10, 0x00,
+ 0x01, 0x00, 0x8a, 0x04, 0x1e, 0x0c, 0x08, 0xca,
  0x0d, 0x00, 0x00, 0xd6, 0xc6, 0x65, 0x00, 0x00,
- 0x47, 0x42, 0x18, 0x01, 0x00, 0x00, 0x26, 0x00,
+ 0x47, 0x42, 0x28, 0x01, 0x00, 0x00, 0x26, 0x00,
  0x00, 0xb6, 0xd2, 0x52, 0x0e, 0x18, 0x27, 0x00,
- 0x00, 0x28, 0xc0, 0x03, 0x9f, 0x02, 0x01, 0x21,
+ 0x00, 0x28, 0xc0, 0x03, 0x8b, 0x03, 0x01, 0x21,
  0x0e, 0x42, 0x07, 0x01, 0x00, 0x01, 0x01, 0x01,
- 0x03, 0x01, 0x00, 0x10, 0x02, 0xe8, 0x04, 0x00,
- 0x01, 0x00, 0x10, 0x00, 0x01, 0x00, 0xf6, 0x03,
- 0x14, 0x0c, 0x08, 0xca, 0xc6, 0x65, 0x00, 0x00,
- 0x47, 0x42, 0x19, 0x01, 0x00, 0x00, 0xd2, 0x25,
- 0x01, 0x00, 0xc0, 0x03, 0xa3, 0x02, 0x01, 0x0d,
+ 0x03, 0x01, 0x00, 0x10, 0x02, 0x9e, 0x05, 0x00,
+ 0x01, 0x00, 0x10, 0x00, 0x01, 0x00, 0x8a, 0x04,
+ 0x1e, 0x0c, 0x08, 0xca, 0xc6, 0x65, 0x00, 0x00,
+ 0x47, 0x42, 0x29, 0x01, 0x00, 0x00, 0xd2, 0x25,
+ 0x01, 0x00, 0xc0, 0x03, 0x8f, 0x03, 0x01, 0x0d,
  0x0e, 0x42, 0x07, 0x01, 0x00, 0x01, 0x01, 0x01,
- 0x03, 0x01, 0x00, 0x10, 0x02, 0xea, 0x04, 0x00,
- 0x01, 0x00, 0x10, 0x00, 0x01, 0x00, 0xf6, 0x03,
- 0x14, 0x0c, 0x08, 0xca, 0xc6, 0x65, 0x00, 0x00,
- 0x47, 0x42, 0x1a, 0x01, 0x00, 0x00, 0xd2, 0x25,
- 0x01, 0x00, 0xc0, 0x03, 0xa7, 0x02, 0x01, 0x0d,
+ 0x03, 0x01, 0x00, 0x10, 0x02, 0xa0, 0x05, 0x00,
+ 0x01, 0x00, 0x10, 0x00, 0x01, 0x00, 0x8a, 0x04,
+ 0x1e, 0x0c, 0x08, 0xca, 0xc6, 0x65, 0x00, 0x00,
+ 0x47, 0x42, 0x2a, 0x01, 0x00, 0x00, 0xd2, 0x25,
+ 0x01, 0x00, 0xc0, 0x03, 0x93, 0x03, 0x01, 0x0d,
  0x0e, 0x42, 0x07, 0x01, 0x00, 0x02, 0x01, 0x02,
  0x04, 0x01, 0x00, 0x11, 0x03, 0x6c, 0x00, 0x01,
  0x00, 0x80, 0x01, 0x00, 0x01, 0x00, 0x10, 0x00,
- 0x01, 0x00, 0xf6, 0x03, 0x14, 0x0c, 0x08, 0xca,
- 0xc6, 0x65, 0x00, 0x00, 0x47, 0x42, 0x1b, 0x01,
+ 0x01, 0x00, 0x8a, 0x04, 0x1e, 0x0c, 0x08, 0xca,
+ 0xc6, 0x65, 0x00, 0x00, 0x47, 0x42, 0x2b, 0x01,
  0x00, 0x00, 0xd2, 0xd3, 0x25, 0x02, 0x00, 0xc0,
- 0x03, 0xab, 0x02, 0x01, 0x0d, 0x0e, 0x48, 0x05,
+ 0x03, 0x97, 0x03, 0x01, 0x0d, 0x0e, 0x48, 0x05,
  0x01, 0x00, 0x00, 0x02, 0x00, 0x06, 0x01, 0x00,
  0x4e, 0x02, 0x10, 0x00, 0x01, 0x00, 0xe4, 0x01,
- 0x00, 0x01, 0x00, 0xe6, 0x03, 0x03, 0x0c, 0x0c,
+ 0x00, 0x01, 0x00, 0xf0, 0x03, 0x03, 0x0c, 0x0c,
  0x04, 0xcb, 0x08, 0xca, 0xed, 0x01, 0xc6, 0x65,
- 0x00, 0x00, 0x41, 0x36, 0x01, 0x00, 0x00, 0x4c,
- 0x36, 0x01, 0x00, 0x00, 0xc6, 0x65, 0x00, 0x00,
- 0x41, 0x37, 0x01, 0x00, 0x00, 0x4c, 0x37, 0x01,
- 0x00, 0x00, 0xc6, 0x65, 0x00, 0x00, 0x41, 0x38,
- 0x01, 0x00, 0x00, 0x4c, 0x38, 0x01, 0x00, 0x00,
- 0xc6, 0x65, 0x00, 0x00, 0x41, 0x39, 0x01, 0x00,
- 0x00, 0x4c, 0x39, 0x01, 0x00, 0x00, 0xc6, 0x65,
- 0x00, 0x00, 0x41, 0x3a, 0x01, 0x00, 0x00, 0x4c,
- 0x3a, 0x01, 0x00, 0x00, 0x29, 0xc0, 0x03, 0x00,
- 0x0c, 0x00, 0x05, 0xf4, 0x02, 0x53, 0x49, 0x49,
+ 0x00, 0x00, 0x41, 0x51, 0x01, 0x00, 0x00, 0x4c,
+ 0x51, 0x01, 0x00, 0x00, 0xc6, 0x65, 0x00, 0x00,
+ 0x41, 0x52, 0x01, 0x00, 0x00, 0x4c, 0x52, 0x01,
+ 0x00, 0x00, 0xc6, 0x65, 0x00, 0x00, 0x41, 0x53,
+ 0x01, 0x00, 0x00, 0x4c, 0x53, 0x01, 0x00, 0x00,
+ 0xc6, 0x65, 0x00, 0x00, 0x41, 0x54, 0x01, 0x00,
+ 0x00, 0x4c, 0x54, 0x01, 0x00, 0x00, 0xc6, 0x65,
+ 0x00, 0x00, 0x41, 0x55, 0x01, 0x00, 0x00, 0x4c,
+ 0x55, 0x01, 0x00, 0x00, 0x29, 0xc0, 0x03, 0x00,
+ 0x0c, 0x00, 0x05, 0xcc, 0x04, 0x53, 0x49, 0x49,
  0x49, 0x00, 0x0e, 0xe0, 0x01, 0x0e, 0x48, 0x05,
  0x01, 0x00, 0x00, 0x02, 0x00, 0x06, 0x01, 0x00,
  0x4e, 0x02, 0x10, 0x00, 0x01, 0x00, 0xe4, 0x01,
- 0x00, 0x01, 0x00, 0xe6, 0x03, 0x03, 0x0c, 0x0c,
+ 0x00, 0x01, 0x00, 0xf0, 0x03, 0x03, 0x0c, 0x0c,
  0x04, 0xcb, 0x08, 0xca, 0xed, 0x01, 0xc6, 0x65,
- 0x00, 0x00, 0x41, 0x36, 0x01, 0x00, 0x00, 0x4c,
- 0x36, 0x01, 0x00, 0x00, 0xc6, 0x65, 0x00, 0x00,
- 0x41, 0x37, 0x01, 0x00, 0x00, 0x4c, 0x37, 0x01,
- 0x00, 0x00, 0xc6, 0x65, 0x00, 0x00, 0x41, 0x38,
- 0x01, 0x00, 0x00, 0x4c, 0x38, 0x01, 0x00, 0x00,
- 0xc6, 0x65, 0x00, 0x00, 0x41, 0x39, 0x01, 0x00,
- 0x00, 0x4c, 0x39, 0x01, 0x00, 0x00, 0xc6, 0x65,
- 0x00, 0x00, 0x41, 0x3a, 0x01, 0x00, 0x00, 0x4c,
- 0x3a, 0x01, 0x00, 0x00, 0x29, 0xc0, 0x03, 0x00,
- 0x0c, 0x00, 0x05, 0xea, 0x02, 0x53, 0x49, 0x49,
+ 0x00, 0x00, 0x41, 0x51, 0x01, 0x00, 0x00, 0x4c,
+ 0x51, 0x01, 0x00, 0x00, 0xc6, 0x65, 0x00, 0x00,
+ 0x41, 0x52, 0x01, 0x00, 0x00, 0x4c, 0x52, 0x01,
+ 0x00, 0x00, 0xc6, 0x65, 0x00, 0x00, 0x41, 0x53,
+ 0x01, 0x00, 0x00, 0x4c, 0x53, 0x01, 0x00, 0x00,
+ 0xc6, 0x65, 0x00, 0x00, 0x41, 0x54, 0x01, 0x00,
+ 0x00, 0x4c, 0x54, 0x01, 0x00, 0x00, 0xc6, 0x65,
+ 0x00, 0x00, 0x41, 0x55, 0x01, 0x00, 0x00, 0x4c,
+ 0x55, 0x01, 0x00, 0x00, 0x29, 0xc0, 0x03, 0x00,
+ 0x0c, 0x00, 0x05, 0xc2, 0x04, 0x53, 0x49, 0x49,
  0x49, 0x00, 0x0e, 0xea, 0x01,
 };
 
@@ -17248,92 +17490,156 @@ const uint8_t wasm[3363] = {
  0x00, 0x09, 0x20,
 };
 
-const uint32_t worker_bootstrap_size = 666;
+const uint32_t worker_bootstrap_size = 1181;
 
-const uint8_t worker_bootstrap[666] = {
- 0x02, 0x13, 0x2c, 0x40, 0x69, 0x6a, 0x6a, 0x73,
+const uint8_t worker_bootstrap[1181] = {
+ 0x02, 0x21, 0x2c, 0x40, 0x69, 0x6a, 0x6a, 0x73,
  0x2f, 0x77, 0x6f, 0x72, 0x6b, 0x65, 0x72, 0x2d,
  0x62, 0x6f, 0x6f, 0x74, 0x73, 0x74, 0x72, 0x61,
- 0x70, 0x24, 0x40, 0x69, 0x6a, 0x6a, 0x73, 0x2f,
- 0x65, 0x76, 0x65, 0x6e, 0x74, 0x2d, 0x74, 0x61,
- 0x72, 0x67, 0x65, 0x74, 0x28, 0x64, 0x65, 0x66,
- 0x69, 0x6e, 0x65, 0x45, 0x76, 0x65, 0x6e, 0x74,
- 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74,
- 0x65, 0x16, 0x6b, 0x57, 0x6f, 0x72, 0x6b, 0x65,
- 0x72, 0x53, 0x65, 0x6c, 0x66, 0x0c, 0x77, 0x6f,
- 0x72, 0x6b, 0x65, 0x72, 0x14, 0x77, 0x6f, 0x72,
- 0x6b, 0x65, 0x72, 0x54, 0x68, 0x69, 0x73, 0x08,
- 0x73, 0x65, 0x6c, 0x66, 0x12, 0x6f, 0x6e, 0x6d,
- 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x1c, 0x6f,
- 0x6e, 0x6d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65,
- 0x65, 0x72, 0x72, 0x6f, 0x72, 0x0e, 0x6f, 0x6e,
- 0x65, 0x72, 0x72, 0x6f, 0x72, 0x16, 0x70, 0x6f,
- 0x73, 0x74, 0x4d, 0x65, 0x73, 0x73, 0x61, 0x67,
- 0x65, 0x18, 0x6d, 0x65, 0x73, 0x73, 0x61, 0x67,
- 0x65, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x0a, 0x65,
- 0x72, 0x72, 0x6f, 0x72, 0x06, 0x6d, 0x73, 0x67,
- 0x1a, 0x64, 0x69, 0x73, 0x70, 0x61, 0x74, 0x63,
- 0x68, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x18, 0x4d,
- 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x45, 0x76,
- 0x65, 0x6e, 0x74, 0x10, 0x6d, 0x73, 0x67, 0x65,
- 0x72, 0x72, 0x6f, 0x72, 0x14, 0x45, 0x72, 0x72,
- 0x6f, 0x72, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x08,
- 0x61, 0x72, 0x67, 0x73, 0x0f, 0xc0, 0x03, 0x01,
- 0xc2, 0x03, 0x00, 0x00, 0x01, 0x00, 0xc4, 0x03,
- 0x00, 0x0e, 0x00, 0x06, 0x01, 0xa0, 0x01, 0x00,
- 0x00, 0x00, 0x04, 0x03, 0x04, 0xae, 0x01, 0x00,
- 0xc4, 0x03, 0x00, 0x0c, 0xc6, 0x03, 0x00, 0x0d,
- 0xc8, 0x03, 0x01, 0x0d, 0x38, 0x9a, 0x00, 0x00,
- 0x00, 0x04, 0xe3, 0x00, 0x00, 0x00, 0xf0, 0xe3,
- 0x38, 0x89, 0x00, 0x00, 0x00, 0x41, 0xe5, 0x00,
- 0x00, 0x00, 0xe4, 0x38, 0x89, 0x00, 0x00, 0x00,
- 0x04, 0xe5, 0x00, 0x00, 0x00, 0x99, 0x0e, 0x38,
- 0xe6, 0x00, 0x00, 0x00, 0x65, 0x01, 0x00, 0x71,
- 0x65, 0x02, 0x00, 0x49, 0x65, 0x02, 0x00, 0xc1,
- 0x00, 0x43, 0xe7, 0x00, 0x00, 0x00, 0x65, 0x02,
- 0x00, 0xc1, 0x01, 0x43, 0xe8, 0x00, 0x00, 0x00,
- 0x65, 0x02, 0x00, 0xc1, 0x02, 0x43, 0xe9, 0x00,
- 0x00, 0x00, 0x38, 0xe6, 0x00, 0x00, 0x00, 0xc1,
- 0x03, 0x43, 0xea, 0x00, 0x00, 0x00, 0x65, 0x00,
- 0x00, 0x38, 0x94, 0x00, 0x00, 0x00, 0x42, 0x5e,
- 0x00, 0x00, 0x00, 0x38, 0xe6, 0x00, 0x00, 0x00,
- 0x24, 0x01, 0x00, 0x04, 0x33, 0x00, 0x00, 0x00,
- 0xf1, 0x0e, 0x65, 0x00, 0x00, 0x38, 0x94, 0x00,
- 0x00, 0x00, 0x42, 0x5e, 0x00, 0x00, 0x00, 0x38,
- 0xe6, 0x00, 0x00, 0x00, 0x24, 0x01, 0x00, 0x04,
- 0xeb, 0x00, 0x00, 0x00, 0xf1, 0x0e, 0x65, 0x00,
- 0x00, 0x38, 0x94, 0x00, 0x00, 0x00, 0x42, 0x5e,
- 0x00, 0x00, 0x00, 0x38, 0xe6, 0x00, 0x00, 0x00,
- 0x24, 0x01, 0x00, 0x04, 0xec, 0x00, 0x00, 0x00,
- 0xf1, 0x29, 0xc0, 0x03, 0x01, 0x11, 0x00, 0x00,
- 0x0a, 0x40, 0x3a, 0x40, 0x44, 0x13, 0x26, 0x13,
- 0x26, 0x13, 0x26, 0x1d, 0x27, 0x8f, 0x8f, 0x0e,
- 0x02, 0x06, 0x01, 0x00, 0x01, 0x00, 0x01, 0x06,
- 0x00, 0x00, 0x1d, 0x01, 0xda, 0x03, 0x00, 0x01,
- 0x00, 0x38, 0xe6, 0x00, 0x00, 0x00, 0x42, 0xee,
- 0x00, 0x00, 0x00, 0x38, 0xef, 0x00, 0x00, 0x00,
- 0x11, 0x04, 0x33, 0x00, 0x00, 0x00, 0xd2, 0x21,
- 0x02, 0x00, 0x24, 0x01, 0x00, 0x29, 0xc0, 0x03,
- 0x0c, 0x02, 0x03, 0x8f, 0x0e, 0x02, 0x06, 0x01,
- 0x00, 0x01, 0x00, 0x01, 0x06, 0x00, 0x00, 0x1d,
- 0x01, 0xe0, 0x03, 0x00, 0x01, 0x00, 0x38, 0xe6,
- 0x00, 0x00, 0x00, 0x42, 0xee, 0x00, 0x00, 0x00,
- 0x38, 0xef, 0x00, 0x00, 0x00, 0x11, 0x04, 0xeb,
- 0x00, 0x00, 0x00, 0xd2, 0x21, 0x02, 0x00, 0x24,
- 0x01, 0x00, 0x29, 0xc0, 0x03, 0x0f, 0x02, 0x03,
- 0x8f, 0x0e, 0x02, 0x06, 0x01, 0x00, 0x01, 0x00,
- 0x01, 0x05, 0x00, 0x00, 0x18, 0x01, 0xd8, 0x03,
- 0x00, 0x01, 0x00, 0x38, 0xe6, 0x00, 0x00, 0x00,
- 0x42, 0xee, 0x00, 0x00, 0x00, 0x38, 0xf1, 0x00,
- 0x00, 0x00, 0x11, 0xd2, 0x21, 0x01, 0x00, 0x24,
- 0x01, 0x00, 0x29, 0xc0, 0x03, 0x12, 0x02, 0x03,
- 0x76, 0x0e, 0x00, 0x06, 0x01, 0x00, 0x01, 0x00,
- 0x00, 0x05, 0x01, 0x00, 0x1e, 0x01, 0xe4, 0x03,
- 0x00, 0x01, 0x00, 0xc6, 0x03, 0x01, 0x0c, 0x0d,
- 0x00, 0x00, 0xd6, 0x38, 0xe6, 0x00, 0x00, 0x00,
- 0x65, 0x00, 0x00, 0x47, 0x42, 0xea, 0x00, 0x00,
- 0x00, 0x26, 0x00, 0x00, 0xb6, 0xd2, 0x52, 0x0e,
- 0x18, 0x27, 0x00, 0x00, 0x28, 0xc0, 0x03, 0x15,
- 0x01, 0x17,
+ 0x70, 0x20, 0x40, 0x69, 0x6a, 0x6a, 0x73, 0x2f,
+ 0x62, 0x6f, 0x6f, 0x74, 0x73, 0x74, 0x72, 0x61,
+ 0x70, 0x32, 0x24, 0x40, 0x69, 0x6a, 0x6a, 0x73,
+ 0x2f, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x2d, 0x74,
+ 0x61, 0x72, 0x67, 0x65, 0x74, 0x12, 0x77, 0x72,
+ 0x61, 0x70, 0x50, 0x6f, 0x72, 0x74, 0x73, 0x1c,
+ 0x75, 0x6e, 0x77, 0x72, 0x61, 0x70, 0x54, 0x72,
+ 0x61, 0x6e, 0x73, 0x66, 0x65, 0x72, 0x28, 0x64,
+ 0x65, 0x66, 0x69, 0x6e, 0x65, 0x45, 0x76, 0x65,
+ 0x6e, 0x74, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62,
+ 0x75, 0x74, 0x65, 0x16, 0x6b, 0x57, 0x6f, 0x72,
+ 0x6b, 0x65, 0x72, 0x53, 0x65, 0x6c, 0x66, 0x0c,
+ 0x77, 0x6f, 0x72, 0x6b, 0x65, 0x72, 0x16, 0x61,
+ 0x74, 0x6f, 0x6d, 0x69, 0x63, 0x73, 0x57, 0x61,
+ 0x69, 0x74, 0x14, 0x77, 0x6f, 0x72, 0x6b, 0x65,
+ 0x72, 0x54, 0x68, 0x69, 0x73, 0x08, 0x73, 0x65,
+ 0x6c, 0x66, 0x12, 0x6f, 0x6e, 0x6d, 0x65, 0x73,
+ 0x73, 0x61, 0x67, 0x65, 0x1c, 0x6f, 0x6e, 0x6d,
+ 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x65, 0x72,
+ 0x72, 0x6f, 0x72, 0x0e, 0x6f, 0x6e, 0x65, 0x72,
+ 0x72, 0x6f, 0x72, 0x10, 0x6f, 0x6e, 0x68, 0x61,
+ 0x6e, 0x64, 0x6c, 0x65, 0x16, 0x70, 0x6f, 0x73,
+ 0x74, 0x4d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65,
+ 0x14, 0x73, 0x65, 0x6e, 0x64, 0x48, 0x61, 0x6e,
+ 0x64, 0x6c, 0x65, 0x0e, 0x41, 0x74, 0x6f, 0x6d,
+ 0x69, 0x63, 0x73, 0x08, 0x77, 0x61, 0x69, 0x74,
+ 0x18, 0x6d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65,
+ 0x65, 0x72, 0x72, 0x6f, 0x72, 0x0a, 0x65, 0x72,
+ 0x72, 0x6f, 0x72, 0x0c, 0x68, 0x61, 0x6e, 0x64,
+ 0x6c, 0x65, 0x06, 0x6d, 0x73, 0x67, 0x0a, 0x70,
+ 0x6f, 0x72, 0x74, 0x73, 0x1a, 0x64, 0x69, 0x73,
+ 0x70, 0x61, 0x74, 0x63, 0x68, 0x45, 0x76, 0x65,
+ 0x6e, 0x74, 0x18, 0x4d, 0x65, 0x73, 0x73, 0x61,
+ 0x67, 0x65, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x10,
+ 0x6d, 0x73, 0x67, 0x65, 0x72, 0x72, 0x6f, 0x72,
+ 0x14, 0x45, 0x72, 0x72, 0x6f, 0x72, 0x45, 0x76,
+ 0x65, 0x6e, 0x74, 0x10, 0x74, 0x72, 0x61, 0x6e,
+ 0x73, 0x66, 0x65, 0x72, 0x0a, 0x63, 0x6c, 0x6f,
+ 0x73, 0x65, 0x14, 0x74, 0x79, 0x70, 0x65, 0x64,
+ 0x41, 0x72, 0x72, 0x61, 0x79, 0x0e, 0x74, 0x69,
+ 0x6d, 0x65, 0x6f, 0x75, 0x74, 0x0a, 0x66, 0x6c,
+ 0x75, 0x73, 0x68, 0x0f, 0xc0, 0x03, 0x02, 0xc2,
+ 0x03, 0xc4, 0x03, 0x00, 0x00, 0x03, 0x00, 0xc6,
+ 0x03, 0x00, 0x01, 0xc8, 0x03, 0x00, 0x02, 0xca,
+ 0x03, 0x01, 0x0e, 0x00, 0x06, 0x01, 0xa0, 0x01,
+ 0x00, 0x00, 0x00, 0x06, 0x06, 0x07, 0x9b, 0x02,
+ 0x00, 0xc6, 0x03, 0x00, 0x0c, 0xc8, 0x03, 0x01,
+ 0x0c, 0xca, 0x03, 0x02, 0x0c, 0xcc, 0x03, 0x00,
+ 0x0d, 0xce, 0x03, 0x01, 0x0d, 0xd0, 0x03, 0x02,
+ 0x0d, 0x38, 0x9a, 0x00, 0x00, 0x00, 0x04, 0xe6,
+ 0x00, 0x00, 0x00, 0xf0, 0xe5, 0x38, 0x89, 0x00,
+ 0x00, 0x00, 0x41, 0xe9, 0x00, 0x00, 0x00, 0x5f,
+ 0x04, 0x00, 0x38, 0x89, 0x00, 0x00, 0x00, 0x04,
+ 0xe9, 0x00, 0x00, 0x00, 0x99, 0x0e, 0x38, 0xea,
+ 0x00, 0x00, 0x00, 0x65, 0x03, 0x00, 0x71, 0x65,
+ 0x04, 0x00, 0x49, 0x65, 0x04, 0x00, 0xc1, 0x00,
+ 0x43, 0xeb, 0x00, 0x00, 0x00, 0x65, 0x04, 0x00,
+ 0xc1, 0x01, 0x43, 0xec, 0x00, 0x00, 0x00, 0x65,
+ 0x04, 0x00, 0xc1, 0x02, 0x43, 0xed, 0x00, 0x00,
+ 0x00, 0x65, 0x04, 0x00, 0xc1, 0x03, 0x43, 0xee,
+ 0x00, 0x00, 0x00, 0x38, 0xea, 0x00, 0x00, 0x00,
+ 0xc1, 0x04, 0x43, 0xef, 0x00, 0x00, 0x00, 0x38,
+ 0xea, 0x00, 0x00, 0x00, 0xc1, 0x05, 0x43, 0xf0,
+ 0x00, 0x00, 0x00, 0x38, 0xf1, 0x00, 0x00, 0x00,
+ 0x41, 0xf2, 0x00, 0x00, 0x00, 0x5f, 0x05, 0x00,
+ 0x38, 0x94, 0x00, 0x00, 0x00, 0x42, 0x64, 0x00,
+ 0x00, 0x00, 0x38, 0xf1, 0x00, 0x00, 0x00, 0x04,
+ 0xf2, 0x00, 0x00, 0x00, 0x0b, 0xc1, 0x06, 0x4c,
+ 0x40, 0x00, 0x00, 0x00, 0x0a, 0x4c, 0x3e, 0x00,
+ 0x00, 0x00, 0x0a, 0x4c, 0x3d, 0x00, 0x00, 0x00,
+ 0x24, 0x03, 0x00, 0x0e, 0x65, 0x02, 0x00, 0x38,
+ 0x94, 0x00, 0x00, 0x00, 0x42, 0x5e, 0x00, 0x00,
+ 0x00, 0x38, 0xea, 0x00, 0x00, 0x00, 0x24, 0x01,
+ 0x00, 0x04, 0x33, 0x00, 0x00, 0x00, 0xf1, 0x0e,
+ 0x65, 0x02, 0x00, 0x38, 0x94, 0x00, 0x00, 0x00,
+ 0x42, 0x5e, 0x00, 0x00, 0x00, 0x38, 0xea, 0x00,
+ 0x00, 0x00, 0x24, 0x01, 0x00, 0x04, 0xf3, 0x00,
+ 0x00, 0x00, 0xf1, 0x0e, 0x65, 0x02, 0x00, 0x38,
+ 0x94, 0x00, 0x00, 0x00, 0x42, 0x5e, 0x00, 0x00,
+ 0x00, 0x38, 0xea, 0x00, 0x00, 0x00, 0x24, 0x01,
+ 0x00, 0x04, 0xf4, 0x00, 0x00, 0x00, 0xf1, 0x0e,
+ 0x65, 0x02, 0x00, 0x38, 0x94, 0x00, 0x00, 0x00,
+ 0x42, 0x5e, 0x00, 0x00, 0x00, 0x38, 0xea, 0x00,
+ 0x00, 0x00, 0x24, 0x01, 0x00, 0x04, 0xf5, 0x00,
+ 0x00, 0x00, 0xf1, 0x29, 0xc0, 0x03, 0x01, 0x20,
+ 0x00, 0x00, 0x0c, 0x40, 0x44, 0x40, 0x44, 0x13,
+ 0x26, 0x13, 0x26, 0x13, 0x26, 0x13, 0x26, 0x1d,
+ 0x26, 0x1d, 0x00, 0x07, 0x08, 0x44, 0x00, 0x15,
+ 0x08, 0x26, 0x21, 0x21, 0x18, 0x8f, 0x8f, 0x8f,
+ 0x0e, 0x02, 0x06, 0x01, 0x00, 0x02, 0x00, 0x02,
+ 0x08, 0x01, 0x00, 0x22, 0x02, 0xec, 0x03, 0x00,
+ 0x01, 0x00, 0xee, 0x03, 0x00, 0x01, 0x00, 0xc6,
+ 0x03, 0x00, 0x0c, 0x38, 0xea, 0x00, 0x00, 0x00,
+ 0x42, 0xf8, 0x00, 0x00, 0x00, 0x38, 0xf9, 0x00,
+ 0x00, 0x00, 0x11, 0x04, 0x33, 0x00, 0x00, 0x00,
+ 0xd2, 0x65, 0x00, 0x00, 0xd3, 0xf0, 0x21, 0x03,
+ 0x00, 0x24, 0x01, 0x00, 0x29, 0xc0, 0x03, 0x0d,
+ 0x02, 0x03, 0xa8, 0x0e, 0x02, 0x06, 0x01, 0x00,
+ 0x01, 0x00, 0x01, 0x06, 0x00, 0x00, 0x1d, 0x01,
+ 0xf4, 0x03, 0x00, 0x01, 0x00, 0x38, 0xea, 0x00,
+ 0x00, 0x00, 0x42, 0xf8, 0x00, 0x00, 0x00, 0x38,
+ 0xf9, 0x00, 0x00, 0x00, 0x11, 0x04, 0xf3, 0x00,
+ 0x00, 0x00, 0xd2, 0x21, 0x02, 0x00, 0x24, 0x01,
+ 0x00, 0x29, 0xc0, 0x03, 0x10, 0x02, 0x03, 0x8f,
+ 0x0e, 0x02, 0x06, 0x01, 0x00, 0x01, 0x00, 0x01,
+ 0x05, 0x00, 0x00, 0x18, 0x01, 0xe8, 0x03, 0x00,
+ 0x01, 0x00, 0x38, 0xea, 0x00, 0x00, 0x00, 0x42,
+ 0xf8, 0x00, 0x00, 0x00, 0x38, 0xfb, 0x00, 0x00,
+ 0x00, 0x11, 0xd2, 0x21, 0x01, 0x00, 0x24, 0x01,
+ 0x00, 0x29, 0xc0, 0x03, 0x13, 0x02, 0x03, 0x76,
+ 0x0e, 0x02, 0x06, 0x01, 0x00, 0x01, 0x00, 0x01,
+ 0x06, 0x00, 0x00, 0x1d, 0x01, 0xec, 0x03, 0x00,
+ 0x01, 0x00, 0x38, 0xea, 0x00, 0x00, 0x00, 0x42,
+ 0xf8, 0x00, 0x00, 0x00, 0x38, 0xf9, 0x00, 0x00,
+ 0x00, 0x11, 0x04, 0xf5, 0x00, 0x00, 0x00, 0xd2,
+ 0x21, 0x02, 0x00, 0x24, 0x01, 0x00, 0x29, 0xc0,
+ 0x03, 0x16, 0x02, 0x03, 0x8f, 0x0e, 0x02, 0x06,
+ 0x01, 0x00, 0x02, 0x00, 0x02, 0x05, 0x02, 0x00,
+ 0x17, 0x02, 0x66, 0x00, 0x01, 0x00, 0xf8, 0x03,
+ 0x00, 0x01, 0x00, 0xcc, 0x03, 0x03, 0x0c, 0xc8,
+ 0x03, 0x01, 0x0c, 0x38, 0xea, 0x00, 0x00, 0x00,
+ 0x65, 0x00, 0x00, 0x47, 0x42, 0xef, 0x00, 0x00,
+ 0x00, 0xd2, 0x65, 0x01, 0x00, 0xd3, 0xf0, 0x25,
+ 0x02, 0x00, 0xc0, 0x03, 0x19, 0x01, 0x03, 0x0e,
+ 0x02, 0x06, 0x01, 0x00, 0x02, 0x00, 0x02, 0x04,
+ 0x01, 0x01, 0x1d, 0x02, 0xea, 0x03, 0x00, 0x01,
+ 0x80, 0x66, 0x00, 0x01, 0x00, 0xcc, 0x03, 0x03,
+ 0x0c, 0x38, 0xea, 0x00, 0x00, 0x00, 0x65, 0x00,
+ 0x00, 0x47, 0x42, 0xf0, 0x00, 0x00, 0x00, 0xd2,
+ 0xd3, 0x24, 0x02, 0x00, 0x42, 0x7e, 0x00, 0x00,
+ 0x00, 0xc1, 0x00, 0x25, 0x01, 0x00, 0xc0, 0x03,
+ 0x1c, 0x01, 0x03, 0x0e, 0x02, 0x06, 0x01, 0x00,
+ 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x09, 0x00,
+ 0xea, 0x03, 0x00, 0x03, 0xde, 0x42, 0xfd, 0x00,
+ 0x00, 0x00, 0x25, 0x00, 0x00, 0xc0, 0x03, 0x1d,
+ 0x00, 0x0e, 0x43, 0x06, 0x01, 0xe4, 0x03, 0x04,
+ 0x00, 0x04, 0x05, 0x02, 0x00, 0x1c, 0x04, 0xfc,
+ 0x03, 0x00, 0x01, 0x00, 0xac, 0x01, 0x00, 0x01,
+ 0x00, 0x80, 0x01, 0x00, 0x01, 0x00, 0xfe, 0x03,
+ 0x00, 0x01, 0x00, 0xcc, 0x03, 0x03, 0x0c, 0xd0,
+ 0x03, 0x05, 0x0c, 0x38, 0xea, 0x00, 0x00, 0x00,
+ 0x65, 0x00, 0x00, 0x47, 0x42, 0x00, 0x01, 0x00,
+ 0x00, 0x24, 0x00, 0x00, 0x0e, 0x65, 0x01, 0x00,
+ 0xd2, 0xd3, 0xd4, 0xd5, 0x23, 0x04, 0x00, 0xc0,
+ 0x03, 0x24, 0x02, 0x03, 0x5d,
 };
 
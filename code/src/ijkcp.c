@@ -72,7 +72,7 @@ static IJVoid uvKcpRecvCb(uv_udp_t* handle, ssize_t nread, const uv_buf_t* buf,
     IJJSKcp* k = handle->data;
     CHECK_NOT_NULL(k);
     if (nread == 0 && addr == NULL) {
-        js_free(k->ctx, buf->base);
+        ijReadBufFree(k->ctx, (IJU8*)buf->base, buf->len);
         return;
     }
     JSContext* ctx = k->ctx;
@@ -82,7 +82,7 @@ static IJVoid uvKcpRecvCb(uv_udp_t* handle, ssize_t nread, const uv_buf_t* buf,
         uv_udp_recv_stop(handle);
         arg = ijNewError(ctx, nread);
         is_reject = 1;
-        js_free(ctx, buf->base);
+        ijReadBufFree(ctx, (IJU8*)buf->base, buf->len);
     }
     else {
         ikcp_input(k->kcp, buf->base, nread);
@@ -92,12 +92,14 @@ static IJVoid uvKcpRecvCb(uv_udp_t* handle, ssize_t nread, const uv_buf_t* buf,
             uv_udp_recv_stop(handle);
             arg = JS_NewObjectProto(ctx, JS_NULL);
             ikcp_recv(k->kcp, buf->base, len);
-            JS_DefinePropertyValueStr(ctx, arg, "data", ijNewUint8Array(ctx, (IJU8*)buf->base, len), JS_PROP_C_W_E);
+            JS_DefinePropertyValueStr(ctx, arg, "data", ijNewReadBuffer(ctx, (IJU8*)buf->base, buf->len, len), JS_PROP_C_W_E);
             JS_DefinePropertyValueStr(ctx, arg, "flags", JS_NewInt32(ctx, flags), JS_PROP_C_W_E);
             JS_DefinePropertyValueStr(ctx, arg, "addr", ijAddr2Obj(ctx, addr), JS_PROP_C_W_E);
         }
-        else
+        else {
+            ijReadBufFree(ctx, (IJU8*)buf->base, buf->len);
             return;
+        }
     }
     ijSettlePromise(ctx, &k->read.result, is_reject, 1, (JSValueConst*)&arg);
     ijClearPromise(ctx, &k->read.result);
@@ -106,7 +108,7 @@ static IJVoid uvKcpRecvCb(uv_udp_t* handle, ssize_t nread, const uv_buf_t* buf,
 static IJVoid uvKcpAllocCb(uv_handle_t* handle, size_t suggested_size, uv_buf_t* buf) {
     IJJSKcp* k = handle->data;
     CHECK_NOT_NULL(k);
-    buf->base = js_malloc(k->ctx, k->read.size);
+    buf->base = (IJAnsi*)ijReadBufAlloc(k->ctx, k->read.size);
     buf->len = k->read.size;
 }
 
@@ -133,7 +135,6 @@ static IJVoid ijKcpFinalizer(JSRuntime* rt, JSValue val) {
     if (k) {
         uv_idle_stop(&k->idle);
         uv_close((uv_handle_t*)&k->idle, NULL);
-        ikcp_release(k->kcp);
         ijFreePromiseRT(rt, &k->read.result);
         k->finalized = 1;
         if (k->closed)
@@ -255,6 +255,48 @@ static JSValue ijRandom(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSVal
     return JS_UNDEFINED;
 }
 
+static JSValue ijCpuCount(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    uv_cpu_info_t* infos;
+    IJS32 count;
+    IJS32 r = uv_cpu_info(&infos, &count);
+    if (r != 0)
+        return JS_NewInt32(ctx, 1);
+    uv_free_cpu_info(infos, count);
+    return JS_NewInt32(ctx, count > 0 ? count : 1);
+}
+
+static JSValue ijReadPoolStats(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJJSRuntime* qrt = ijGetRuntime(ctx);
+    CHECK_NOT_NULL(qrt);
+    JSValue obj = JS_NewObjectProto(ctx, JS_NULL);
+    JS_DefinePropertyValueStr(ctx, obj, "hits", JS_NewInt64(ctx, qrt->pool.hits), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "misses", JS_NewInt64(ctx, qrt->pool.misses), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "copied", JS_NewInt64(ctx, qrt->pool.copied), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "handed", JS_NewInt64(ctx, qrt->pool.handed), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "pooled", JS_NewInt32(ctx, qrt->pool.count), JS_PROP_C_W_E);
+    return obj;
+}
+
+static JSValue ijExecutorStats(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    JSValue obj = JS_NewObjectProto(ctx, JS_NULL);
+    for (IJS32 i = 0; i < IJJS_LANE_COUNT; i++) {
+        IJJSLaneStats st;
+        ijExecStats(i, &st);
+        JSValue lane = JS_NewObjectProto(ctx, JS_NULL);
+        JS_DefinePropertyValueStr(ctx, lane, "threads", JS_NewUint32(ctx, st.threads), JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, lane, "queued", JS_NewUint32(ctx, st.queued), JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, lane, "maxQueued", JS_NewUint32(ctx, st.max_queued), JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, lane, "busy", JS_NewUint32(ctx, st.busy), JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, lane, "submitted", JS_NewInt64(ctx, st.submitted), JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, lane, "completed", JS_NewInt64(ctx, st.completed), JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, lane, "waitMs", JS_NewFloat64(ctx, st.wait_ns / 1e6), JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, lane, "maxWaitMs", JS_NewFloat64(ctx, st.max_wait_ns / 1e6), JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, lane, "runMs", JS_NewFloat64(ctx, st.run_ns / 1e6), JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, obj, st.name, lane, JS_PROP_C_W_E);
+    }
+    return obj;
+}
+
 static const JSCFunctionListEntry ijjs_misc_funcs[] = {
     IJJS_CONST(AF_INET),
     IJJS_CONST(AF_INET6),
@@ -265,6 +307,7 @@ static const JSCFunctionListEntry ijjs_misc_funcs[] = {
     JS_CFUNC_DEF("hrtime", 0, ijHrTime),
     JS_CFUNC_DEF("gettimeofday", 0, ijGetTimeOfDay),
     JS_CFUNC_DEF("uname", 0, ijUname),
+    JS_CFUNC_DEF("cpucount", 0, ijCpuCount),
     JS_CFUNC_DEF("isatty", 1, ijIsAtty),
     JS_CFUNC_DEF("environ", 0, ijEnviron),
     JS_CFUNC_DEF("getenv", 0, ijGetEnv),
@@ -278,6 +321,8 @@ static const JSCFunctionListEntry ijjs_misc_funcs[] = {
     JS_CFUNC_MAGIC_DEF("printError", 1, ijPrint, 1),
     JS_CFUNC_MAGIC_DEF("alert", 1, ijPrint, 1),
     JS_CFUNC_DEF("random", 3, ijRandom),
+    JS_CFUNC_DEF("readPoolStats", 0, ijReadPoolStats),
+    JS_CFUNC_DEF("executorStats", 0, ijExecutorStats),
 };
 
 IJVoid ijModMiscInit(JSContext* ctx, JSModuleDef* m) {
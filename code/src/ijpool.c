@@ -0,0 +1,794 @@
+/*
+ ijjs javascript runtime engine
+ Copyright (C) 2010-2017 Trix
+
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+ */
+
+
+#include "ijjs.h"
+#include <stdatomic.h>
+
+#define IJJS_POOL_MAX_SIZE 256
+
+typedef struct IJJSPool IJJSPool;
+
+typedef struct {
+    struct list_head link;
+    IJJSChannelMsg* msg;
+    IJS32 status;
+    IJBool failed;
+    IJBool error;
+    IJBool stolen;
+    IJU64 queued_at;
+    IJU64 started_at;
+    IJU64 finished_at;
+    IJJSPromise result;
+} IJJSPoolTask;
+
+typedef struct {
+    IJJSPool* pool;
+    uv_thread_t tid;
+    uv_sem_t* sem;
+    IJJSRuntime* wrt;
+    JSContext* ctx;
+    uv_async_t async;
+    uv_mutex_t lock;
+    struct list_head queue;
+    atomic_uint queued;
+    atomic_bool idle;
+    IJJSPoolTask* current;
+    JSValue ns;
+    JSValue self;
+} IJJSPoolWorker;
+
+struct IJJSPool {
+    JSContext* ctx;
+    JSValue self;
+    IJAnsi* module;
+    uv_async_t* done_async;
+    uv_mutex_t done_lock;
+    struct list_head done;
+    IJU32 pending;
+    IJBool terminated;
+    IJBool joined;
+    atomic_bool stopping;
+    atomic_uint exited;
+    IJU32 next;
+    IJU32 max_queued;
+    IJU64 submitted;
+    IJU64 completed;
+    IJU64 failed;
+    IJU64 stolen;
+    IJU64 wait_ns;
+    IJU64 max_wait_ns;
+    IJU64 run_ns;
+    IJU64 max_run_ns;
+    IJU32 size;
+    IJJSPoolWorker workers[];
+};
+
+static JSClassID ijjs_pool_class_id;
+static JSClassID ijjs_pool_thread_class_id;
+
+static IJU32 ijPoolDefaultSize(IJVoid) {
+    uv_cpu_info_t* infos;
+    IJS32 count;
+    if (uv_cpu_info(&infos, &count) != 0)
+        return 1;
+    uv_free_cpu_info(infos, count);
+    return count > 0 ? count : 1;
+}
+
+static IJJSPoolTask* ijPoolPop(IJJSPoolWorker* pw, IJBool steal) {
+    IJJSPoolTask* t = NULL;
+    uv_mutex_lock(&pw->lock);
+    if (!list_empty(&pw->queue)) {
+        struct list_head* el = steal ? pw->queue.prev : pw->queue.next;
+        list_del(el);
+        atomic_fetch_sub(&pw->queued, 1);
+        t = list_entry(el, IJJSPoolTask, link);
+    }
+    uv_mutex_unlock(&pw->lock);
+    return t;
+}
+
+static IJJSPoolTask* ijPoolTake(IJJSPoolWorker* pw) {
+    IJJSPool* pool = pw->pool;
+    if (atomic_load(&pool->stopping))
+        return NULL;
+    for (;;) {
+        IJJSPoolTask* t = ijPoolPop(pw, false);
+        if (!t) {
+            IJJSPoolWorker* victim = NULL;
+            IJU32 most = 0;
+            for (IJU32 i = 0; i < pool->size; i++) {
+                IJU32 n = atomic_load(&pool->workers[i].queued);
+                if (n > most) {
+                    most = n;
+                    victim = &pool->workers[i];
+                }
+            }
+            if (victim && (t = ijPoolPop(victim, true)))
+                t->stolen = victim != pw;
+        }
+        if (t) {
+            atomic_store(&pw->idle, false);
+            return t;
+        }
+        // Publish idleness before the final scan so a concurrent submit
+        // either sees this worker idle or leaves a task for the rescan.
+        if (atomic_load(&pw->idle))
+            return NULL;
+        atomic_store(&pw->idle, true);
+    }
+}
+
+static JSValue ijPoolErrorData(JSContext* ctx, JSValueConst error, IJBool* is_error) {
+    *is_error = JS_IsError(ctx, error);
+    if (!*is_error)
+        return JS_DupValue(ctx, error);
+    JSValue obj = JS_NewObject(ctx);
+    if (JS_IsException(obj))
+        return obj;
+    JS_SetPropertyStr(ctx, obj, "name", JS_GetPropertyStr(ctx, error, "name"));
+    JS_SetPropertyStr(ctx, obj, "message", JS_GetPropertyStr(ctx, error, "message"));
+    JS_SetPropertyStr(ctx, obj, "stack", JS_GetPropertyStr(ctx, error, "stack"));
+    return obj;
+}
+
+static IJJSChannelMsg* ijPoolPack(JSContext* ctx, JSValueConst value) {
+    if (JS_IsException(value))
+        return NULL;
+    IJJSMessage msg;
+    if (ijMessageWrite(ctx, value, JS_UNDEFINED, NULL, &msg) != 0)
+        return NULL;
+    IJJSChannelMsg* m = ijChannelMsgNew(&msg);
+    ijMessageFree(JS_GetRuntime(ctx), &msg, m != NULL);
+    if (!m)
+        JS_ThrowOutOfMemory(ctx);
+    return m;
+}
+
+static IJVoid ijPoolStore(JSContext* ctx, IJJSPoolTask* t, JSValueConst value, IJBool failed) {
+    JSValue data = failed ? ijPoolErrorData(ctx, value, &t->error) : JS_DupValue(ctx, value);
+    t->msg = ijPoolPack(ctx, data);
+    JS_FreeValue(ctx, data);
+    if (!t->msg) {
+        JSValue exception = JS_GetException(ctx);
+        failed = true;
+        data = ijPoolErrorData(ctx, exception, &t->error);
+        JS_FreeValue(ctx, exception);
+        t->msg = ijPoolPack(ctx, data);
+        JS_FreeValue(ctx, data);
+        if (!t->msg) {
+            JS_FreeValue(ctx, JS_GetException(ctx));
+            t->status = UV_ENOMEM;
+        }
+    }
+    t->failed = failed;
+}
+
+static IJVoid ijPoolFinish(IJJSPoolWorker* pw, JSValueConst value, IJBool failed) {
+    IJJSPool* pool = pw->pool;
+    IJJSPoolTask* t = pw->current;
+    // A task that fails while the pool stops was interrupted by terminate().
+    if (failed && atomic_load(&pool->stopping)) {
+        t->status = UV_ECANCELED;
+    } else {
+        ijPoolStore(pw->ctx, t, value, failed);
+        t->finished_at = uv_hrtime();
+    }
+    pw->current = NULL;
+    uv_mutex_lock(&pool->done_lock);
+    list_add_tail(&t->link, &pool->done);
+    uv_mutex_unlock(&pool->done_lock);
+    uv_async_send(pool->done_async);
+}
+
+static JSValue ijPoolCall(IJJSPoolWorker* pw, JSValueConst req) {
+    JSContext* ctx = pw->ctx;
+    if (!JS_IsObject(pw->ns))
+        return JS_ThrowReferenceError(ctx, "could not load '%s'", pw->pool->module);
+    JSValue name = JS_GetPropertyUint32(ctx, req, 0);
+    JSValue args = JS_GetPropertyUint32(ctx, req, 1);
+    JSValue func = JS_UNDEFINED;
+    JSValue ret = JS_EXCEPTION;
+    JSValue* argv = NULL;
+    IJU32 argc = 0;
+    JSAtom atom = JS_ValueToAtom(ctx, name);
+    if (atom == JS_ATOM_NULL)
+        goto done;
+    func = JS_GetProperty(ctx, pw->ns, atom);
+    if (!JS_IsFunction(ctx, func)) {
+        const IJAnsi* fn = JS_AtomToCString(ctx, atom);
+        JS_ThrowTypeError(ctx, "'%s' is not a function exported by '%s'", fn ? fn : "", pw->pool->module);
+        JS_FreeCString(ctx, fn);
+        goto done;
+    }
+    if (!JS_IsUndefined(args)) {
+        JSValue jslen = JS_GetPropertyStr(ctx, args, "length");
+        IJS32 r = JS_ToUint32(ctx, &argc, jslen);
+        JS_FreeValue(ctx, jslen);
+        if (r != 0)
+            goto done;
+        argv = js_mallocz(ctx, (argc ? argc : 1) * sizeof(*argv));
+        if (!argv)
+            goto done;
+        for (IJU32 i = 0; i < argc; i++)
+            argv[i] = JS_GetPropertyUint32(ctx, args, i);
+    }
+    ret = JS_Call(ctx, func, JS_UNDEFINED, argc, (JSValueConst*)argv);
+done:
+    if (argv) {
+        for (IJU32 i = 0; i < argc; i++)
+            JS_FreeValue(ctx, argv[i]);
+        js_free(ctx, argv);
+    }
+    if (atom != JS_ATOM_NULL)
+        JS_FreeAtom(ctx, atom);
+    JS_FreeValue(ctx, func);
+    JS_FreeValue(ctx, name);
+    JS_FreeValue(ctx, args);
+    return ret;
+}
+
+static IJVoid ijPoolWorkerNext(IJJSPoolWorker* pw);
+
+static JSValue ijPoolSettled(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv, IJS32 magic, JSValue* func_data) {
+    IJJSPoolWorker* pw = JS_GetOpaque(func_data[0], ijjs_pool_thread_class_id);
+    if (pw && pw->current) {
+        ijPoolFinish(pw, argc > 0 ? argv[0] : JS_UNDEFINED, magic);
+        ijPoolWorkerNext(pw);
+    }
+    return JS_UNDEFINED;
+}
+
+static IJVoid ijPoolStart(IJJSPoolWorker* pw, IJJSPoolTask* t) {
+    JSContext* ctx = pw->ctx;
+    pw->current = t;
+    t->started_at = uv_hrtime();
+    JSValue ports;
+    JSValue req = ijChannelMsgRead(ctx, t->msg, &ports);
+    t->msg = NULL;
+    JS_FreeValue(ctx, ports);
+    JSValue ret = JS_IsException(req) ? JS_EXCEPTION : ijPoolCall(pw, req);
+    JS_FreeValue(ctx, req);
+    if (!JS_IsException(ret) && JS_IsObject(ret)) {
+        JSValue then = JS_GetPropertyStr(ctx, ret, "then");
+        if (JS_IsFunction(ctx, then)) {
+            JSValue funcs[2];
+            funcs[0] = JS_NewCFunctionData(ctx, ijPoolSettled, 1, false, 1, &pw->self);
+            funcs[1] = JS_NewCFunctionData(ctx, ijPoolSettled, 1, true, 1, &pw->self);
+            JSValue r = JS_Call(ctx, then, ret, 2, (JSValueConst*)funcs);
+            JS_FreeValue(ctx, funcs[0]);
+            JS_FreeValue(ctx, funcs[1]);
+            JS_FreeValue(ctx, then);
+            JS_FreeValue(ctx, ret);
+            if (!JS_IsException(r)) {
+                JS_FreeValue(ctx, r);
+                return;
+            }
+            ret = JS_EXCEPTION;
+        } else if (JS_IsException(then)) {
+            JS_FreeValue(ctx, ret);
+            ret = JS_EXCEPTION;
+        } else {
+            JS_FreeValue(ctx, then);
+        }
+    }
+    if (JS_IsException(ret)) {
+        JSValue exception = JS_GetException(ctx);
+        ijPoolFinish(pw, exception, true);
+        JS_FreeValue(ctx, exception);
+    } else {
+        ijPoolFinish(pw, ret, false);
+        JS_FreeValue(ctx, ret);
+    }
+}
+
+static IJVoid ijPoolWorkerNext(IJJSPoolWorker* pw) {
+    while (!pw->current) {
+        IJJSPoolTask* t = ijPoolTake(pw);
+        if (!t)
+            return;
+        ijPoolStart(pw, t);
+    }
+}
+
+static IJVoid uvPoolWorkerAsyncCb(uv_async_t* handle) {
+    ijPoolWorkerNext(handle->data);
+}
+
+static JSValue ijPoolLoadModule(JSContext* ctx, const IJAnsi* filename) {
+    DynBuf dbuf;
+    dbuf_init(&dbuf);
+    if (ijLoadFile(ctx, &dbuf, filename) != 0) {
+        dbuf_free(&dbuf);
+        return JS_ThrowReferenceError(ctx, "could not load '%s'", filename);
+    }
+    dbuf_putc(&dbuf, '\0');
+    JSValue func = JS_Eval(ctx, (IJAnsi*)dbuf.buf, dbuf.size, filename, JS_EVAL_TYPE_MODULE | JS_EVAL_FLAG_COMPILE_ONLY);
+    dbuf_free(&dbuf);
+    if (JS_IsException(func))
+        return func;
+    JSModuleDef* m = JS_VALUE_GET_PTR(func);
+    ijModuleSetImportMeta(ctx, func, TRUE, FALSE);
+    JSValue ret = JS_EvalFunction(ctx, func);
+    if (JS_IsException(ret))
+        return ret;
+    JS_FreeValue(ctx, ret);
+    return JS_GetModuleNamespace(ctx, m);
+}
+
+static IJVoid ijPoolCancel(IJJSPool* pool, IJJSPoolTask* t) {
+    if (t->msg)
+        ijChannelMsgDrop(t->msg);
+    t->msg = NULL;
+    t->status = UV_ECANCELED;
+    uv_mutex_lock(&pool->done_lock);
+    list_add_tail(&t->link, &pool->done);
+    uv_mutex_unlock(&pool->done_lock);
+}
+
+static IJS32 ijPoolInterrupt(JSRuntime* rt, IJVoid* opaque) {
+    IJJSPool* pool = opaque;
+    return atomic_load(&pool->stopping);
+}
+
+// Runs on the worker once its loop is stopped: the task it was awaiting and
+// the ones still queued for it are cancelled.
+static IJVoid ijPoolWorkerExit(IJJSPoolWorker* pw) {
+    IJJSPool* pool = pw->pool;
+    IJJSPoolTask* t;
+    if (pw->current) {
+        ijPoolCancel(pool, pw->current);
+        pw->current = NULL;
+    }
+    while ((t = ijPoolPop(pw, false)))
+        ijPoolCancel(pool, t);
+}
+
+static IJVoid ijPoolWorkerEntry(IJVoid* arg) {
+    IJJSPoolWorker* pw = arg;
+    IJJSRuntime* wrt = ijNewRuntimeWorker();
+    CHECK_NOT_NULL(wrt);
+    JS_UpdateStackTop(wrt->rt);
+    JS_SetInterruptHandler(wrt->rt, ijPoolInterrupt, pw->pool);
+    JSContext* ctx = ijGetJSContext(wrt);
+    pw->wrt = wrt;
+    pw->ctx = ctx;
+    CHECK_EQ(uv_async_init(ijGetLoopRT(wrt), &pw->async, uvPoolWorkerAsyncCb), 0);
+    pw->async.data = pw;
+    pw->self = JS_NewObjectClass(ctx, ijjs_pool_thread_class_id);
+    CHECK(!JS_IsException(pw->self));
+    JS_SetOpaque(pw->self, pw);
+    uv_sem_post(pw->sem);
+    pw->ns = ijPoolLoadModule(ctx, pw->pool->module);
+    if (JS_IsException(pw->ns)) {
+        if (atomic_load(&pw->pool->stopping))
+            JS_FreeValue(ctx, JS_GetException(ctx));
+        else
+            ijDumpError(ctx);
+        pw->ns = JS_UNDEFINED;
+    }
+    ijRun(wrt);
+    ijPoolWorkerExit(pw);
+    JS_SetOpaque(pw->self, NULL);
+    JS_FreeValue(ctx, pw->self);
+    JS_FreeValue(ctx, pw->ns);
+    uv_close((uv_handle_t*)&pw->async, NULL);
+    ijFreeRuntime(wrt);
+    // The pool may be freed as soon as the last worker is joined.
+    IJJSPool* pool = pw->pool;
+    atomic_fetch_add(&pool->exited, 1);
+    uv_async_send(pool->done_async);
+}
+
+static IJVoid ijPoolSubmit(IJJSPool* pool, IJJSPoolTask* t) {
+    IJJSPoolWorker* target = NULL;
+    IJU32 best = UINT32_MAX;
+    IJU32 total = 1;
+    for (IJU32 i = 0; i < pool->size; i++) {
+        IJJSPoolWorker* pw = &pool->workers[(pool->next + i) % pool->size];
+        IJU32 queued = atomic_load(&pw->queued);
+        IJU32 load = queued + !atomic_load(&pw->idle);
+        total += queued;
+        if (load < best) {
+            best = load;
+            target = pw;
+        }
+    }
+    pool->next = (pool->next + 1) % pool->size;
+    if (total > pool->max_queued)
+        pool->max_queued = total;
+    t->queued_at = uv_hrtime();
+    uv_mutex_lock(&target->lock);
+    list_add_tail(&t->link, &target->queue);
+    atomic_fetch_add(&target->queued, 1);
+    uv_mutex_unlock(&target->lock);
+    if (atomic_load(&target->idle)) {
+        uv_async_send(&target->async);
+        return;
+    }
+    // The target is busy, wake an idle worker so it steals the task.
+    for (IJU32 i = 0; i < pool->size; i++) {
+        IJJSPoolWorker* pw = &pool->workers[i];
+        if (atomic_load(&pw->idle)) {
+            uv_async_send(&pw->async);
+            return;
+        }
+    }
+}
+
+static JSValue ijPoolNewError(JSContext* ctx, JSValue data) {
+    static const IJAnsi* names[] = { "EvalError", "RangeError", "ReferenceError", "SyntaxError", "TypeError", "URIError" };
+    JSValue name = JS_GetPropertyStr(ctx, data, "name");
+    JSValue message = JS_GetPropertyStr(ctx, data, "message");
+    JSValue stack = JS_GetPropertyStr(ctx, data, "stack");
+    const IJAnsi* str = JS_IsString(name) ? JS_ToCString(ctx, name) : NULL;
+    JSValue error = JS_UNDEFINED;
+    for (IJU32 i = 0; str && i < countof(names); i++) {
+        if (strcmp(str, names[i]) == 0) {
+            JSValue global = JS_GetGlobalObject(ctx);
+            JSValue ctor = JS_GetPropertyStr(ctx, global, names[i]);
+            error = JS_CallConstructor(ctx, ctor, 1, (JSValueConst*)&message);
+            JS_FreeValue(ctx, ctor);
+            JS_FreeValue(ctx, global);
+            break;
+        }
+    }
+    JS_FreeCString(ctx, str);
+    if (JS_IsUndefined(error)) {
+        error = JS_NewError(ctx);
+        if (!JS_IsUndefined(name))
+            JS_DefinePropertyValueStr(ctx, error, "name", JS_DupValue(ctx, name), JS_PROP_WRITABLE | JS_PROP_CONFIGURABLE);
+        JS_DefinePropertyValueStr(ctx, error, "message", JS_DupValue(ctx, message), JS_PROP_WRITABLE | JS_PROP_CONFIGURABLE);
+    }
+    if (!JS_IsException(error) && !JS_IsUndefined(stack))
+        JS_DefinePropertyValueStr(ctx, error, "stack", JS_DupValue(ctx, stack), JS_PROP_WRITABLE | JS_PROP_CONFIGURABLE);
+    if (JS_IsException(error))
+        error = JS_GetException(ctx);
+    JS_FreeValue(ctx, name);
+    JS_FreeValue(ctx, message);
+    JS_FreeValue(ctx, stack);
+    JS_FreeValue(ctx, data);
+    return error;
+}
+
+static IJVoid ijPoolSettle(IJJSPool* pool, IJJSPoolTask* t) {
+    JSContext* ctx = pool->ctx;
+    IJBool failed = t->failed;
+    JSValue arg;
+    if (t->status != 0) {
+        arg = ijNewError(ctx, t->status);
+        failed = true;
+    } else {
+        JSValue ports;
+        arg = ijChannelMsgRead(ctx, t->msg, &ports);
+        JS_FreeValue(ctx, ports);
+        if (JS_IsException(arg)) {
+            arg = JS_GetException(ctx);
+            failed = true;
+        } else if (t->error) {
+            arg = ijPoolNewError(ctx, arg);
+        }
+    }
+    t->msg = NULL;
+    if (failed)
+        pool->failed++;
+    if (--pool->pending == 0)
+        uv_unref((uv_handle_t*)pool->done_async);
+    ijSettlePromise(ctx, &t->result, failed, 1, (JSValueConst*)&arg);
+    je_free(t);
+}
+
+static IJVoid ijPoolDrainDone(IJJSPool* pool) {
+    struct list_head done;
+    struct list_head *el, *el1;
+    init_list_head(&done);
+    uv_mutex_lock(&pool->done_lock);
+    list_for_each_safe(el, el1, &pool->done) {
+        list_del(el);
+        list_add_tail(el, &done);
+    }
+    uv_mutex_unlock(&pool->done_lock);
+    list_for_each_safe(el, el1, &done) {
+        IJJSPoolTask* t = list_entry(el, IJJSPoolTask, link);
+        list_del(el);
+        if (t->finished_at) {
+            IJU64 wait = t->started_at - t->queued_at;
+            IJU64 run = t->finished_at - t->started_at;
+            pool->completed++;
+            pool->stolen += t->stolen;
+            pool->wait_ns += wait;
+            pool->run_ns += run;
+            if (wait > pool->max_wait_ns)
+                pool->max_wait_ns = wait;
+            if (run > pool->max_run_ns)
+                pool->max_run_ns = run;
+        }
+        ijPoolSettle(pool, t);
+    }
+}
+
+// Running JS is interrupted, the workers cancel their tasks and exit.
+static IJVoid ijPoolStop(IJJSPool* pool) {
+    if (pool->terminated)
+        return;
+    pool->terminated = true;
+    atomic_store(&pool->stopping, true);
+    for (IJU32 i = 0; i < pool->size; i++)
+        ijStop(pool->workers[i].wrt);
+}
+
+static IJVoid ijPoolJoin(IJJSPool* pool) {
+    if (pool->joined)
+        return;
+    pool->joined = true;
+    for (IJU32 i = 0; i < pool->size; i++)
+        CHECK_EQ(uv_thread_join(&pool->workers[i].tid), 0);
+}
+
+static IJVoid ijPoolRelease(IJJSPool* pool) {
+    if (pool->pending == 0 && !JS_IsUndefined(pool->self)) {
+        JSValue self = pool->self;
+        pool->self = JS_UNDEFINED;
+        JS_FreeValue(pool->ctx, self);
+    }
+}
+
+static IJVoid uvPoolDoneCb(uv_async_t* handle) {
+    IJJSPool* pool = handle->data;
+    if (!pool)
+        return;
+    // Workers queue their cancelled tasks before they count as exited.
+    IJBool exited = pool->terminated && !pool->joined && atomic_load(&pool->exited) == pool->size;
+    ijPoolDrainDone(pool);
+    if (exited) {
+        ijPoolJoin(pool);
+        if (--pool->pending == 0)
+            uv_unref((uv_handle_t*)pool->done_async);
+    }
+    ijPoolRelease(pool);
+}
+
+static IJVoid uvPoolCloseCb(uv_handle_t* handle) {
+    je_free(handle);
+}
+
+static IJVoid ijPoolFinalizer(JSRuntime* rt, JSValue val) {
+    IJJSPool* pool = JS_GetOpaque(val, ijjs_pool_class_id);
+    if (!pool)
+        return;
+    ijPoolStop(pool);
+    ijPoolJoin(pool);
+    struct list_head *el, *el1;
+    list_for_each_safe(el, el1, &pool->done) {
+        list_del(el);
+        list_add_tail(el, &pool->workers[0].queue);
+    }
+    for (IJU32 i = 0; i < pool->size; i++) {
+        IJJSPoolWorker* pw = &pool->workers[i];
+        list_for_each_safe(el, el1, &pw->queue) {
+            IJJSPoolTask* t = list_entry(el, IJJSPoolTask, link);
+            if (t->msg)
+                ijChannelMsgDrop(t->msg);
+            ijFreePromiseRT(rt, &t->result);
+            je_free(t);
+        }
+        uv_mutex_destroy(&pw->lock);
+    }
+    pool->done_async->data = NULL;
+    uv_close((uv_handle_t*)pool->done_async, uvPoolCloseCb);
+    uv_mutex_destroy(&pool->done_lock);
+    je_free(pool->module);
+    je_free(pool);
+}
+
+static JSClassDef ijjs_pool_class = { "WorkerPool", .finalizer = ijPoolFinalizer };
+static JSClassDef ijjs_pool_thread_class = { .class_name = "WorkerPoolThread" };
+
+static IJJSPool* ijPoolGet(JSContext* ctx, JSValueConst obj) {
+    return JS_GetOpaque2(ctx, obj, ijjs_pool_class_id);
+}
+
+static JSValue ijPoolConstructor(JSContext* ctx, JSValueConst new_target, IJS32 argc, JSValueConst* argv) {
+    JSValueConst options = argc > 0 ? argv[0] : JS_UNDEFINED;
+    if (!JS_IsObject(options))
+        return JS_ThrowTypeError(ctx, "options must be an object");
+    IJU32 size = 0;
+    JSValue jssize = JS_GetPropertyStr(ctx, options, "size");
+    IJS32 r = JS_IsUndefined(jssize) ? 0 : JS_ToUint32(ctx, &size, jssize);
+    JS_FreeValue(ctx, jssize);
+    if (r != 0)
+        return JS_EXCEPTION;
+    if (size == 0)
+        size = ijPoolDefaultSize();
+    if (size > IJJS_POOL_MAX_SIZE)
+        size = IJJS_POOL_MAX_SIZE;
+    JSValue jsmodule = JS_GetPropertyStr(ctx, options, "module");
+    if (!JS_IsString(jsmodule)) {
+        JS_FreeValue(ctx, jsmodule);
+        return JS_ThrowTypeError(ctx, "options.module must be a string");
+    }
+    size_t len;
+    const IJAnsi* module = JS_ToCStringLen(ctx, &len, jsmodule);
+    JS_FreeValue(ctx, jsmodule);
+    if (!module)
+        return JS_EXCEPTION;
+    JSValue obj = JS_NewObjectClass(ctx, ijjs_pool_class_id);
+    IJJSPool* pool = JS_IsException(obj) ? NULL : je_calloc(1, sizeof(*pool) + size * sizeof(IJJSPoolWorker));
+    IJAnsi* path = pool ? je_malloc(len + 1) : NULL;
+    uv_async_t* async = path ? je_malloc(sizeof(*async)) : NULL;
+    if (!async) {
+        je_free(path);
+        je_free(pool);
+        JS_FreeCString(ctx, module);
+        JS_FreeValue(ctx, obj);
+        return JS_IsException(obj) ? obj : JS_ThrowOutOfMemory(ctx);
+    }
+    memcpy(path, module, len + 1);
+    JS_FreeCString(ctx, module);
+    pool->ctx = ctx;
+    pool->self = JS_UNDEFINED;
+    pool->module = path;
+    pool->size = size;
+    pool->done_async = async;
+    CHECK_EQ(uv_async_init(ijGetLoop(ctx), async, uvPoolDoneCb), 0);
+    async->data = pool;
+    uv_unref((uv_handle_t*)async);
+    CHECK_EQ(uv_mutex_init(&pool->done_lock), 0);
+    init_list_head(&pool->done);
+    atomic_init(&pool->stopping, false);
+    atomic_init(&pool->exited, 0);
+    uv_sem_t sem;
+    CHECK_EQ(uv_sem_init(&sem, 0), 0);
+    for (IJU32 i = 0; i < size; i++) {
+        IJJSPoolWorker* pw = &pool->workers[i];
+        pw->pool = pool;
+        pw->sem = &sem;
+        pw->ns = JS_UNDEFINED;
+        pw->self = JS_UNDEFINED;
+        CHECK_EQ(uv_mutex_init(&pw->lock), 0);
+        init_list_head(&pw->queue);
+        atomic_init(&pw->queued, 0);
+        atomic_init(&pw->idle, true);
+        CHECK_EQ(uv_thread_create(&pw->tid, ijPoolWorkerEntry, pw), 0);
+    }
+    for (IJU32 i = 0; i < size; i++)
+        uv_sem_wait(&sem);
+    uv_sem_destroy(&sem);
+    uv_update_time(ijGetLoop(ctx));
+    JS_SetOpaque(obj, pool);
+    return obj;
+}
+
+static JSValue ijPoolRun(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJJSPool* pool = ijPoolGet(ctx, this_val);
+    if (!pool)
+        return JS_EXCEPTION;
+    if (pool->terminated)
+        return JS_ThrowTypeError(ctx, "WorkerPool is terminated");
+    if (!JS_IsString(argv[0]))
+        return JS_ThrowTypeError(ctx, "function name must be a string");
+    JSValueConst args = argc > 1 ? argv[1] : JS_UNDEFINED;
+    if (!JS_IsUndefined(args) && !JS_IsArray(ctx, args))
+        return JS_ThrowTypeError(ctx, "args must be an array");
+    JSValue req = JS_NewArray(ctx);
+    if (JS_IsException(req))
+        return req;
+    JS_DefinePropertyValueUint32(ctx, req, 0, JS_DupValue(ctx, argv[0]), JS_PROP_C_W_E);
+    JS_DefinePropertyValueUint32(ctx, req, 1, JS_DupValue(ctx, args), JS_PROP_C_W_E);
+    IJJSMessage msg;
+    IJS32 r = ijMessageWrite(ctx, req, argc > 2 ? argv[2] : JS_UNDEFINED, NULL, &msg);
+    JS_FreeValue(ctx, req);
+    if (r != 0)
+        return JS_EXCEPTION;
+    IJJSPoolTask* t = je_calloc(1, sizeof(*t));
+    if (t)
+        t->msg = ijChannelMsgNew(&msg);
+    ijMessageFree(JS_GetRuntime(ctx), &msg, t && t->msg);
+    if (!t || !t->msg) {
+        je_free(t);
+        return JS_ThrowOutOfMemory(ctx);
+    }
+    JSValue promise = ijInitPromise(ctx, &t->result);
+    if (JS_IsException(promise)) {
+        ijChannelMsgDrop(t->msg);
+        je_free(t);
+        return promise;
+    }
+    if (pool->pending++ == 0) {
+        uv_ref((uv_handle_t*)pool->done_async);
+        pool->self = JS_DupValue(ctx, this_val);
+    }
+    pool->submitted++;
+    ijPoolSubmit(pool, t);
+    return promise;
+}
+
+static JSValue ijPoolTerminate(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJJSPool* pool = ijPoolGet(ctx, this_val);
+    if (!pool)
+        return JS_EXCEPTION;
+    if (pool->terminated)
+        return JS_UNDEFINED;
+    ijPoolStop(pool);
+    // The workers are joined from the loop once they all exited, until
+    // then the pool stays alive like it does for a pending task.
+    if (pool->pending++ == 0) {
+        uv_ref((uv_handle_t*)pool->done_async);
+        pool->self = JS_DupValue(ctx, this_val);
+    }
+    return JS_UNDEFINED;
+}
+
+static JSValue ijPoolStats(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJJSPool* pool = ijPoolGet(ctx, this_val);
+    if (!pool)
+        return JS_EXCEPTION;
+    JSValue obj = JS_NewObjectProto(ctx, JS_NULL);
+    JSValue queues = JS_NewArray(ctx);
+    IJU32 queued = 0;
+    IJU32 busy = 0;
+    for (IJU32 i = 0; i < pool->size; i++) {
+        IJJSPoolWorker* pw = &pool->workers[i];
+        IJU32 n = pool->terminated ? 0 : atomic_load(&pw->queued);
+        queued += n;
+        busy += !pool->terminated && !atomic_load(&pw->idle);
+        JS_DefinePropertyValueUint32(ctx, queues, i, JS_NewUint32(ctx, n), JS_PROP_C_W_E);
+    }
+    JS_DefinePropertyValueStr(ctx, obj, "size", JS_NewUint32(ctx, pool->size), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "queued", JS_NewUint32(ctx, queued), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "maxQueued", JS_NewUint32(ctx, pool->max_queued), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "queues", queues, JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "busy", JS_NewUint32(ctx, busy), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "submitted", JS_NewInt64(ctx, pool->submitted), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "completed", JS_NewInt64(ctx, pool->completed), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "failed", JS_NewInt64(ctx, pool->failed), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "stolen", JS_NewInt64(ctx, pool->stolen), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "waitMs", JS_NewFloat64(ctx, pool->wait_ns / 1e6), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "maxWaitMs", JS_NewFloat64(ctx, pool->max_wait_ns / 1e6), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "runMs", JS_NewFloat64(ctx, pool->run_ns / 1e6), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "maxRunMs", JS_NewFloat64(ctx, pool->max_run_ns / 1e6), JS_PROP_C_W_E);
+    return obj;
+}
+
+static const JSCFunctionListEntry ijjs_pool_proto_funcs[] = {
+    JS_CFUNC_DEF("run", 3, ijPoolRun),
+    JS_CFUNC_DEF("stats", 0, ijPoolStats),
+    JS_CFUNC_DEF("terminate", 0, ijPoolTerminate),
+    JS_PROP_STRING_DEF("[Symbol.toStringTag]", "WorkerPool", JS_PROP_CONFIGURABLE),
+};
+
+IJVoid ijModPoolInit(JSContext* ctx, JSModuleDef* m) {
+    JSValue proto, obj;
+    JS_NewClassID(&ijjs_pool_class_id);
+    JS_NewClass(JS_GetRuntime(ctx), ijjs_pool_class_id, &ijjs_pool_class);
+    proto = JS_NewObject(ctx);
+    JS_SetPropertyFunctionList(ctx, proto, ijjs_pool_proto_funcs, countof(ijjs_pool_proto_funcs));
+    JS_SetClassProto(ctx, ijjs_pool_class_id, proto);
+    JS_NewClassID(&ijjs_pool_thread_class_id);
+    JS_NewClass(JS_GetRuntime(ctx), ijjs_pool_thread_class_id, &ijjs_pool_thread_class);
+    obj = JS_NewCFunction2(ctx, ijPoolConstructor, "WorkerPool", 1, JS_CFUNC_constructor_or_func, 0);
+    JS_SetModuleExport(ctx, m, "WorkerPool", obj);
+}
+
+IJVoid ijModPoolExport(JSContext* ctx, JSModuleDef* m) {
+    JS_AddModuleExport(ctx, m, "WorkerPool");
+}
@@ -20,13 +20,24 @@
  */
 
 #include "ijjs.h"
+#if IJJS_PLATFORM != IJJS_PLATFORM_WIN32
+#include <netinet/tcp.h>
+#endif
+#if IJJS_PLATFORM == IJJS_PLATFORM_LINUX
+#include <fcntl.h>
+#include <pthread.h>
+#include <signal.h>
+#endif
 
-static JSValue ijNewTcp(JSContext *ctx, IJS32 af);
+typedef struct IJJSPump IJJSPump;
 
 typedef struct {
     JSContext* ctx;
     IJS32 closed;
     IJS32 finalized;
+    IJJSPump* pump;
+    IJJSStreamOwner* owner;
+    IJBool writer;
     union {
         uv_handle_t handle;
         uv_stream_t stream;
@@ -39,10 +50,45 @@ typedef struct {
         IJJSPromise result;
     } read;
     struct {
+        IJBool active;
+        IJBool reading;
+        size_t highwater;
+        size_t queued;
+        IJS32 status;
+        struct list_head chunks;
+        IJJSPromise result;
+    } flow;
+    struct {
+        IJS32 level;
+        DynBuf dbuf;
         IJJSPromise result;
+    } cork;
+    struct {
+        IJJSPromise result;
+        IJS32 mode;
+        IJU32 max;
+        JSValue* queue;
+        IJU32 head;
+        IJU32 count;
+        IJBool paused;
+        IJU64 accepted;
+        IJU32 peak;
     } accept;
 } IJJSStream;
 
+enum {
+    ACCEPT_ONE = 0,
+    ACCEPT_MANY,
+    ACCEPT_ITER,
+};
+
+typedef struct {
+    struct list_head link;
+    IJU8* data;
+    size_t size;
+    size_t cap;
+} IJJSReadChunk;
+
 typedef struct {
     uv_connect_t req;
     IJJSPromise result;
@@ -56,12 +102,14 @@ typedef struct {
 typedef struct {
     uv_write_t req;
     IJJSPromise result;
-    size_t size;
-    IJAnsi data[];
+    IJU8* data;
+    IJS32 nbufs;
+    IJJSWriteBuf bufs[];
 } IJJSWriteReq;
 
 static IJJSStream* ijTcpGet(JSContext* ctx, JSValueConst obj);
 static IJJSStream* ijPipeGet(JSContext* ctx, JSValueConst obj);
+static IJJSStream* ijStreamGet(JSContext* ctx, JSValueConst obj);
 
 static IJVoid uvStreamCloseCb(uv_handle_t* handle) {
     IJJSStream* s = handle->data;
@@ -76,9 +124,48 @@ static IJVoid uvMaybeClose(IJJSStream* s) {
         uv_close(&s->h.handle, uvStreamCloseCb);
 }
 
+static IJVoid ijStreamFlowPump(IJJSStream* s);
+static IJVoid ijPumpAbort(IJJSPump* p, IJS32 err);
+static IJBool ijPumpWritesTo(IJJSPump* p, IJJSStream* s);
+
+static IJBool ijStreamWriteBusy(IJJSStream* s) {
+    return s->owner || s->writer || ijPumpWritesTo(s->pump, s);
+}
+
 static JSValue ijStreamClose(JSContext* ctx, IJJSStream* s, IJS32 argc, JSValueConst* argv) {
     if (!s)
         return JS_EXCEPTION;
+    if (s->pump)
+        ijPumpAbort(s->pump, UV_ECANCELED);
+    if (s->owner) {
+        IJJSStreamOwner* owner = s->owner;
+        s->owner = NULL;
+        owner->closed(owner);
+    }
+    if (s->flow.active && s->flow.status == 0)
+        s->flow.status = UV_EOF;
+    ijStreamFlowPump(s);
+    if (ijIsPromisePending(ctx, &s->accept.result) && s->accept.mode == ACCEPT_ITER) {
+        JSValue arg = JS_NewObjectProto(ctx, JS_NULL);
+        JS_DefinePropertyValueStr(ctx, arg, "done", JS_TRUE, JS_PROP_C_W_E);
+        ijSettlePromise(ctx, &s->accept.result, false, 1, (JSValueConst*)&arg);
+        ijClearPromise(ctx, &s->accept.result);
+    }
+    // Connections nobody took yet would otherwise stay open until the
+    // listener is collected.
+    while (s->accept.count > 0) {
+        JSValue obj = s->accept.queue[s->accept.head];
+        s->accept.head = (s->accept.head + 1) % IJJS_ACCEPT_QUEUE_SIZE;
+        s->accept.count--;
+        ijStreamClose(ctx, ijStreamGet(ctx, obj), 0, NULL);
+        JS_FreeValue(ctx, obj);
+    }
+    s->accept.paused = false;
+    if (ijIsPromisePending(ctx, &s->cork.result)) {
+        JSValue arg = ijNewError(ctx, UV_ECANCELED);
+        ijSettlePromise(ctx, &s->cork.result, true, 1, (JSValueConst*)&arg);
+        ijClearPromise(ctx, &s->cork.result);
+    }
     uvMaybeClose(s);
     return JS_UNDEFINED;
 }
@@ -86,7 +173,7 @@ static JSValue ijStreamClose(JSContext* ctx, IJJSStream* s, IJS32 argc, JSValueC
 static IJVoid uvStreamAllocCb(uv_handle_t* handle, size_t suggested_size, uv_buf_t* buf) {
     IJJSStream* s = handle->data;
     CHECK_NOT_NULL(s);
-    buf->base = js_malloc(s->ctx, s->read.size);
+    buf->base = (IJAnsi*)ijReadBufAlloc(s->ctx, s->read.size);
     buf->len = s->read.size;
 }
 
@@ -104,9 +191,9 @@ static IJVoid uvStreamReadCb(uv_stream_t* handle, ssize_t nread, const uv_buf_t*
             arg = ijNewError(ctx, nread);
             is_reject = 1;
         }
-        js_free(ctx, buf->base);
+        ijReadBufFree(ctx, (IJU8*)buf->base, buf->len);
     } else {
-        arg = ijNewUint8Array(ctx, (IJU8*)buf->base, nread);
+        arg = ijNewReadBuffer(ctx, (IJU8*)buf->base, buf->len, nread);
     }
     ijSettlePromise(ctx, &s->read.result, is_reject, 1, (JSValueConst*)&arg);
     ijClearPromise(ctx, &s->read.result);
@@ -115,7 +202,7 @@ static IJVoid uvStreamReadCb(uv_stream_t* handle, ssize_t nread, const uv_buf_t*
 static JSValue ijStreamRead(JSContext* ctx, IJJSStream* s, IJS32 argc, JSValueConst* argv) {
     if (!s)
         return JS_EXCEPTION;
-    if (!JS_IsUndefined(s->read.result.p))
+    if (!JS_IsUndefined(s->read.result.p) || s->flow.active || s->pump || s->owner)
         return ijThrowErrno(ctx, UV_EBUSY);
     IJU64 size = IJJS_DEFAULt_READ_SIZE;
     if (!JS_IsUndefined(argv[0]) && JS_ToIndex(ctx, &size, argv[0]))
@@ -127,6 +214,176 @@ static JSValue ijStreamRead(JSContext* ctx, IJJSStream* s, IJS32 argc, JSValueCo
     return ijInitPromise(ctx, &s->read.result);
 }
 
+static IJVoid ijStreamFlowClear(JSRuntime* rt, IJJSStream* s) {
+    struct list_head* el;
+    struct list_head* el1;
+    list_for_each_safe(el, el1, &s->flow.chunks) {
+        IJJSReadChunk* c = list_entry(el, IJJSReadChunk, link);
+        list_del(&c->link);
+        js_free_rt(rt, c->data);
+        js_free_rt(rt, c);
+    }
+    s->flow.queued = 0;
+}
+
+static IJVoid uvStreamFlowReadCb(uv_stream_t* handle, ssize_t nread, const uv_buf_t* buf) {
+    IJJSStream* s = handle->data;
+    CHECK_NOT_NULL(s);
+    JSContext* ctx = s->ctx;
+    if (nread == 0) {
+        ijReadBufFree(ctx, (IJU8*)buf->base, buf->len);
+        return;
+    }
+    if (nread < 0) {
+        ijReadBufFree(ctx, (IJU8*)buf->base, buf->len);
+        uv_read_stop(handle);
+        s->flow.reading = false;
+        s->flow.status = nread;
+    } else {
+        IJJSReadChunk* c = js_malloc(ctx, sizeof(*c));
+        if (!c) {
+            ijReadBufFree(ctx, (IJU8*)buf->base, buf->len);
+            return;
+        }
+        c->data = ijReadBufShrink(ctx, (IJU8*)buf->base, buf->len, nread);
+        c->size = nread;
+        c->cap = c->data == (IJU8*)buf->base ? buf->len : nread;
+        list_add_tail(&c->link, &s->flow.chunks);
+        s->flow.queued += nread;
+        if (s->flow.queued >= s->flow.highwater) {
+            uv_read_stop(handle);
+            s->flow.reading = false;
+        }
+    }
+    ijStreamFlowPump(s);
+}
+
+static IJVoid ijStreamFlowPump(IJJSStream* s) {
+    JSContext* ctx = s->ctx;
+    if (!ijIsPromisePending(ctx, &s->flow.result))
+        return;
+    JSValue arg;
+    IJBool is_reject = false;
+    if (!list_empty(&s->flow.chunks)) {
+        IJJSReadChunk* c = list_entry(s->flow.chunks.next, IJJSReadChunk, link);
+        list_del(&c->link);
+        s->flow.queued -= c->size;
+        arg = JS_NewObjectProto(ctx, JS_NULL);
+        JS_DefinePropertyValueStr(ctx, arg, "done", JS_FALSE, JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, arg, "value", ijNewReadBuffer(ctx, c->data, c->cap, c->size), JS_PROP_C_W_E);
+        js_free(ctx, c);
+        if (!s->flow.reading && s->flow.status == 0 && s->flow.queued <= s->flow.highwater / 2) {
+            if (uv_read_start(&s->h.stream, uvStreamAllocCb, uvStreamFlowReadCb) == 0)
+                s->flow.reading = true;
+        }
+    } else if (s->flow.status == UV_EOF) {
+        arg = JS_NewObjectProto(ctx, JS_NULL);
+        JS_DefinePropertyValueStr(ctx, arg, "done", JS_TRUE, JS_PROP_C_W_E);
+    } else if (s->flow.status < 0) {
+        arg = ijNewError(ctx, s->flow.status);
+        is_reject = true;
+    } else {
+        return;
+    }
+    ijSettlePromise(ctx, &s->flow.result, is_reject, 1, (JSValueConst*)&arg);
+    ijClearPromise(ctx, &s->flow.result);
+}
+
+static JSValue ijStreamFlowNext(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv, IJS32 magic, JSValue* func_data) {
+    IJJSStream* s = ijStreamGet(ctx, func_data[0]);
+    if (!s)
+        return JS_EXCEPTION;
+    if (ijIsPromisePending(ctx, &s->flow.result))
+        return ijThrowErrno(ctx, UV_EBUSY);
+    if (!s->flow.active) {
+        JSValue arg = JS_NewObjectProto(ctx, JS_NULL);
+        JS_DefinePropertyValueStr(ctx, arg, "done", JS_TRUE, JS_PROP_C_W_E);
+        return ijNewResolvedPromise(ctx, 1, (JSValueConst*)&arg);
+    }
+    if (list_empty(&s->flow.chunks) && s->flow.status < 0 && s->flow.status != UV_EOF) {
+        JSValue arg = ijNewError(ctx, s->flow.status);
+        return ijNewRejectedPromise(ctx, 1, (JSValueConst*)&arg);
+    }
+    JSValue ret = ijInitPromise(ctx, &s->flow.result);
+    ijStreamFlowPump(s);
+    return ret;
+}
+
+static JSValue ijStreamFlowReturn(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv, IJS32 magic, JSValue* func_data) {
+    IJJSStream* s = ijStreamGet(ctx, func_data[0]);
+    if (!s)
+        return JS_EXCEPTION;
+    if (s->flow.active) {
+        if (s->flow.reading)
+            uv_read_stop(&s->h.stream);
+        if (s->flow.status == 0)
+            s->flow.status = UV_EOF;
+        ijStreamFlowPump(s);
+        ijStreamFlowClear(JS_GetRuntime(ctx), s);
+        s->flow.active = false;
+        s->flow.reading = false;
+        s->flow.status = 0;
+    }
+    JSValue arg = JS_NewObjectProto(ctx, JS_NULL);
+    JS_DefinePropertyValueStr(ctx, arg, "done", JS_TRUE, JS_PROP_C_W_E);
+    return ijNewResolvedPromise(ctx, 1, (JSValueConst*)&arg);
+}
+
+static JSValue ijStreamFlowIterator(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    return JS_DupValue(ctx, this_val);
+}
+
+static const JSCFunctionListEntry ijjs_stream_iterator_funcs[] = {
+    JS_CFUNC_DEF("[Symbol.asyncIterator]", 0, ijStreamFlowIterator),
+};
+
+static JSValue ijStreamReadable(JSContext* ctx, IJJSStream* s, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    if (!s)
+        return JS_EXCEPTION;
+    if (!JS_IsUndefined(s->read.result.p) || s->flow.active || s->pump || s->owner)
+        return ijThrowErrno(ctx, UV_EBUSY);
+    IJU64 size = IJJS_DEFAULt_READ_SIZE;
+    IJU64 highwater = IJJS_DEFAULT_HIGH_WATER_MARK;
+    if (JS_IsObject(argv[0])) {
+        JSValue val = JS_GetPropertyStr(ctx, argv[0], "size");
+        IJS32 r = !JS_IsUndefined(val) && JS_ToIndex(ctx, &size, val);
+        JS_FreeValue(ctx, val);
+        if (r)
+            return JS_EXCEPTION;
+        val = JS_GetPropertyStr(ctx, argv[0], "highWaterMark");
+        r = !JS_IsUndefined(val) && JS_ToIndex(ctx, &highwater, val);
+        JS_FreeValue(ctx, val);
+        if (r)
+            return JS_EXCEPTION;
+    }
+    if (size == 0 || highwater == 0)
+        return ijThrowErrno(ctx, UV_EINVAL);
+    s->read.size = size;
+    s->flow.highwater = highwater;
+    s->flow.status = 0;
+    IJS32 r = uv_read_start(&s->h.stream, uvStreamAllocCb, uvStreamFlowReadCb);
+    if (r != 0)
+        return ijThrowErrno(ctx, r);
+    s->flow.active = true;
+    s->flow.reading = true;
+    JSValue iter = JS_NewObject(ctx);
+    if (JS_IsException(iter))
+        return iter;
+    JS_SetPropertyFunctionList(ctx, iter, ijjs_stream_iterator_funcs, countof(ijjs_stream_iterator_funcs));
+    JS_DefinePropertyValueStr(ctx, iter, "next", JS_NewCFunctionData(ctx, ijStreamFlowNext, 0, 0, 1, &this_val), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, iter, "return", JS_NewCFunctionData(ctx, ijStreamFlowReturn, 0, 0, 1, &this_val), JS_PROP_C_W_E);
+    return iter;
+}
+
+IJVoid ijStreamReleaseBufs(JSContext* ctx, IJJSWriteBuf* bufs, IJS32 nbufs) {
+    for (IJS32 i = 0; i < nbufs; i++) {
+        if (bufs[i].cstr)
+            JS_FreeCString(ctx, bufs[i].cstr);
+        JS_UnpinArrayBuffer(ctx, bufs[i].value);
+        JS_FreeValue(ctx, bufs[i].value);
+    }
+}
+
 static IJVoid uvStreamWriteCb(uv_write_t* req, IJS32 status) {
     IJJSStream* s = req->handle->data;
     CHECK_NOT_NULL(s);
@@ -141,62 +398,178 @@ static IJVoid uvStreamWriteCb(uv_write_t* req, IJS32 status) {
         arg = JS_UNDEFINED;
     }
     ijSettlePromise(ctx, &wr->result, is_reject, 1, (JSValueConst*)&arg);
+    ijStreamReleaseBufs(ctx, wr->bufs, wr->nbufs);
+    js_free(ctx, wr->data);
     js_free(ctx, wr);
 }
 
-static JSValue ijStreamWrite(JSContext* ctx, IJJSStream* s, IJS32 argc, JSValueConst* argv) {
-    if (!s)
-        return JS_EXCEPTION;
-    JSValue jsData = argv[0];
-    IJBool is_string = false;
+IJS32 ijStreamGetData(JSContext* ctx, JSValueConst val, uv_buf_t* b, IJJSWriteBuf* pin) {
     size_t size;
     IJAnsi* buf;
-    if (JS_IsString(jsData)) {
-        is_string = true;
-        buf = (IJAnsi*) JS_ToCStringLen(ctx, &size, jsData);
+    pin->value = JS_UNDEFINED;
+    pin->cstr = NULL;
+    if (JS_IsString(val)) {
+        buf = (IJAnsi*) JS_ToCStringLen(ctx, &size, val);
         if (!buf)
-            return JS_EXCEPTION;
+            return -1;
+        pin->cstr = buf;
     } else {
         size_t aoffset, asize;
-        JSValue abuf = JS_GetTypedArrayBuffer(ctx, jsData, &aoffset, &asize, NULL);
+        JSValue abuf = JS_GetTypedArrayBuffer(ctx, val, &aoffset, &asize, NULL);
         if (JS_IsException(abuf))
-            return abuf;
+            return -1;
         buf = (IJAnsi*) JS_GetArrayBuffer(ctx, &size, abuf);
-        JS_FreeValue(ctx, abuf);
-        if (!buf)
-            return JS_EXCEPTION;
+        if (!buf) {
+            JS_FreeValue(ctx, abuf);
+            return -1;
+        }
         buf += aoffset;
         size = asize;
+        /* the buffer cannot be detached or transferred while it is in use */
+        JS_PinArrayBuffer(ctx, abuf);
+        pin->value = abuf;
     }
-    IJS32 r;
-    uv_buf_t b;
-    b = uv_buf_init(buf, size);
-    r = uv_try_write(&s->h.stream, &b, 1);
+    *b = uv_buf_init(buf, size);
+    return 0;
+}
+
+static JSValue ijStreamWriteBufs(JSContext* ctx, IJJSStream* s, uv_buf_t* bufs, IJJSWriteBuf* pins, IJS32 nbufs, IJU8* data) {
+    size_t size = 0;
+    for (IJS32 i = 0; i < nbufs; i++)
+        size += bufs[i].len;
+    if (s->cork.level > 0) {
+        IJS32 r = 0;
+        for (IJS32 i = 0; i < nbufs && r == 0; i++)
+            r = dbuf_put(&s->cork.dbuf, (const IJU8*)bufs[i].base, bufs[i].len);
+        ijStreamReleaseBufs(ctx, pins, nbufs);
+        js_free(ctx, data);
+        if (r)
+            return JS_ThrowOutOfMemory(ctx);
+        if (ijIsPromisePending(ctx, &s->cork.result))
+            return JS_DupValue(ctx, s->cork.result.p);
+        return ijInitPromise(ctx, &s->cork.result);
+    }
+    IJS32 r = uv_try_write(&s->h.stream, bufs, nbufs);
     if (r == size) {
-        if (is_string)
-            JS_FreeCString(ctx, buf);
+        ijStreamReleaseBufs(ctx, pins, nbufs);
+        js_free(ctx, data);
         return ijNewResolvedPromise(ctx, 0, NULL);
     }
-    if (r >= 0) {
-        buf += r;
-        size -= r;
-    }
-    IJJSWriteReq* wr = js_malloc(ctx, sizeof(*wr) + size);
-    if (!wr)
+    IJJSWriteReq* wr = js_malloc(ctx, sizeof(*wr) + nbufs * sizeof(IJJSWriteBuf));
+    if (!wr) {
+        ijStreamReleaseBufs(ctx, pins, nbufs);
+        js_free(ctx, data);
         return JS_EXCEPTION;
+    }
     wr->req.data = wr;
-    memcpy(wr->data, buf, size);
-    if (is_string)
-        JS_FreeCString(ctx, buf);
-    b = uv_buf_init(wr->data, size);
-    r = uv_write(&wr->req, &s->h.stream, &b, 1, uvStreamWriteCb);
+    wr->data = data;
+    wr->nbufs = nbufs;
+    memcpy(wr->bufs, pins, nbufs * sizeof(IJJSWriteBuf));
+    size_t skip = r > 0 ? r : 0;
+    IJS32 first = 0;
+    while (skip > 0 && skip >= bufs[first].len)
+        skip -= bufs[first++].len;
+    bufs[first].base += skip;
+    bufs[first].len -= skip;
+    r = uv_write(&wr->req, &s->h.stream, bufs + first, nbufs - first, uvStreamWriteCb);
     if (r != 0) {
+        ijStreamReleaseBufs(ctx, wr->bufs, wr->nbufs);
+        js_free(ctx, wr->data);
         js_free(ctx, wr);
         return ijThrowErrno(ctx, r);
     }
     return ijInitPromise(ctx, &wr->result);
 }
 
+static JSValue ijStreamWrite(JSContext* ctx, IJJSStream* s, IJS32 argc, JSValueConst* argv) {
+    if (!s)
+        return JS_EXCEPTION;
+    if (ijStreamWriteBusy(s))
+        return ijThrowErrno(ctx, UV_EBUSY);
+    uv_buf_t b;
+    IJJSWriteBuf pin;
+    if (ijStreamGetData(ctx, argv[0], &b, &pin))
+        return JS_EXCEPTION;
+    return ijStreamWriteBufs(ctx, s, &b, &pin, 1, NULL);
+}
+
+static JSValue ijStreamWritev(JSContext* ctx, IJJSStream* s, IJS32 argc, JSValueConst* argv) {
+    if (!s)
+        return JS_EXCEPTION;
+    if (ijStreamWriteBusy(s))
+        return ijThrowErrno(ctx, UV_EBUSY);
+    if (!JS_IsArray(ctx, argv[0]))
+        return JS_ThrowTypeError(ctx, "expected an array");
+    IJU32 n;
+    JSValue len = JS_GetPropertyStr(ctx, argv[0], "length");
+    IJS32 r = JS_ToUint32(ctx, &n, len);
+    JS_FreeValue(ctx, len);
+    if (r)
+        return JS_EXCEPTION;
+    if (n == 0)
+        return ijNewResolvedPromise(ctx, 0, NULL);
+    if (n > IJJS_MAX_WRITEV_BUFS)
+        return ijThrowErrno(ctx, UV_EINVAL);
+    uv_buf_t* bufs = js_malloc(ctx, n * (sizeof(uv_buf_t) + sizeof(IJJSWriteBuf)));
+    if (!bufs)
+        return JS_EXCEPTION;
+    IJJSWriteBuf* pins = (IJJSWriteBuf*)(bufs + n);
+    JSValue ret = JS_EXCEPTION;
+    IJU32 i;
+    for (i = 0; i < n; i++) {
+        JSValue val = JS_GetPropertyUint32(ctx, argv[0], i);
+        if (JS_IsException(val))
+            break;
+        r = ijStreamGetData(ctx, val, &bufs[i], &pins[i]);
+        JS_FreeValue(ctx, val);
+        if (r)
+            break;
+    }
+    if (i == n)
+        ret = ijStreamWriteBufs(ctx, s, bufs, pins, n, NULL);
+    else
+        ijStreamReleaseBufs(ctx, pins, i);
+    js_free(ctx, bufs);
+    return ret;
+}
+
+static JSValue ijStreamCork(JSContext* ctx, IJJSStream* s, IJS32 argc, JSValueConst* argv) {
+    if (!s)
+        return JS_EXCEPTION;
+    s->cork.level++;
+    return JS_UNDEFINED;
+}
+
+static JSValue ijStreamUncork(JSContext* ctx, IJJSStream* s, IJS32 argc, JSValueConst* argv) {
+    if (!s)
+        return JS_EXCEPTION;
+    if (s->cork.level == 0 || --s->cork.level > 0)
+        return JS_UNDEFINED;
+    if (!ijIsPromisePending(ctx, &s->cork.result))
+        return JS_UNDEFINED;
+    uv_buf_t b = uv_buf_init((IJAnsi*)s->cork.dbuf.buf, s->cork.dbuf.size);
+    IJJSWriteBuf pin = { JS_UNDEFINED, NULL };
+    JSValue p = ijStreamWriteBufs(ctx, s, &b, &pin, 1, s->cork.dbuf.buf);
+    dbuf_init2(&s->cork.dbuf, JS_GetRuntime(ctx), (DynBufReallocFunc*)js_realloc_rt);
+    JSValue arg;
+    IJBool is_reject = false;
+    if (JS_IsException(p)) {
+        arg = JS_GetException(ctx);
+        is_reject = true;
+    } else {
+        arg = p;
+    }
+    ijSettlePromise(ctx, &s->cork.result, is_reject, 1, (JSValueConst*)&arg);
+    ijClearPromise(ctx, &s->cork.result);
+    return JS_UNDEFINED;
+}
+
+static JSValue ijStreamWriteQueueSizeGet(JSContext* ctx, IJJSStream* s) {
+    if (!s)
+        return JS_EXCEPTION;
+    return JS_NewInt64(ctx, uv_stream_get_write_queue_size(&s->h.stream) + s->cork.dbuf.size);
+}
+
 static IJVoid uvStreamShutdownCb(uv_shutdown_t* req, IJS32 status) {
     IJJSStream* s = req->handle->data;
     CHECK_NOT_NULL(s);
@@ -217,6 +590,8 @@ static IJVoid uvStreamShutdownCb(uv_shutdown_t* req, IJS32 status) {
 static JSValue ijStreamShutdown(JSContext* ctx, IJJSStream* s, IJS32 argc, JSValueConst* argv) {
     if (!s)
         return JS_EXCEPTION;
+    if (s->writer || ijPumpWritesTo(s->pump, s))
+        return ijThrowErrno(ctx, UV_EBUSY);
     IJJSShutdownReq* sr = js_malloc(ctx, sizeof(*sr));
     if (!sr)
         return JS_EXCEPTION;
@@ -262,38 +637,91 @@ static IJVoid uvStreamConnectCb(uv_connect_t* req, IJS32 status) {
     js_free(ctx, cr);
 }
 
+static IJS32 ijStreamAcceptOne(IJJSStream* s) {
+    JSContext* ctx = s->ctx;
+    if (s->accept.count == IJJS_ACCEPT_QUEUE_SIZE) {
+        s->accept.paused = true;
+        return 0;
+    }
+    JSValue obj;
+    IJJSStream* t2;
+    switch (s->h.handle.type) {
+        case UV_TCP:
+            obj = ijNewTcp(ctx, AF_UNSPEC);
+            t2 = JS_IsException(obj) ? NULL : ijTcpGet(ctx, obj);
+            break;
+        case UV_NAMED_PIPE:
+            obj = ijNewPipe(ctx);
+            t2 = JS_IsException(obj) ? NULL : ijPipeGet(ctx, obj);
+            break;
+        default:
+            abort();
+    }
+    if (!t2) {
+        // libuv holds the connection until uv_accept() is called, so retry
+        // on the next accept() instead of stalling the listener.
+        JS_FreeValue(ctx, JS_GetException(ctx));
+        s->accept.paused = true;
+        return UV_ENOMEM;
+    }
+    IJS32 r = uv_accept(&s->h.stream, &t2->h.stream);
+    if (r != 0) {
+        JS_FreeValue(ctx, obj);
+        if (r == UV_EAGAIN)
+            s->accept.paused = false;
+        return r;
+    }
+    s->accept.paused = false;
+    s->accept.queue[(s->accept.head + s->accept.count) % IJJS_ACCEPT_QUEUE_SIZE] = obj;
+    s->accept.count++;
+    s->accept.accepted++;
+    if (s->accept.count > s->accept.peak)
+        s->accept.peak = s->accept.count;
+    return 0;
+}
+
+static JSValue ijStreamAcceptShift(IJJSStream* s) {
+    JSValue obj = s->accept.queue[s->accept.head];
+    s->accept.head = (s->accept.head + 1) % IJJS_ACCEPT_QUEUE_SIZE;
+    s->accept.count--;
+    if (s->accept.paused)
+        ijStreamAcceptOne(s);
+    return obj;
+}
+
+static JSValue ijStreamAcceptTake(IJJSStream* s, IJS32 mode, IJU32 max) {
+    JSContext* ctx = s->ctx;
+    if (mode == ACCEPT_ONE)
+        return ijStreamAcceptShift(s);
+    if (mode == ACCEPT_ITER) {
+        JSValue ret = JS_NewObjectProto(ctx, JS_NULL);
+        JS_DefinePropertyValueStr(ctx, ret, "done", JS_FALSE, JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, ret, "value", ijStreamAcceptShift(s), JS_PROP_C_W_E);
+        return ret;
+    }
+    JSValue arr = JS_NewArray(ctx);
+    for (IJU32 i = 0; i < max && s->accept.count > 0; i++)
+        JS_SetPropertyUint32(ctx, arr, i, ijStreamAcceptShift(s));
+    return arr;
+}
+
 static IJVoid uvStreamConnectionCb(uv_stream_t* handle, IJS32 status) {
     IJJSStream* s = handle->data;
     CHECK_NOT_NULL(s);
-    if (JS_IsUndefined(s->accept.result.p)) {
-        return;
-    }
     JSContext* ctx = s->ctx;
+    if (status == 0)
+        status = ijStreamAcceptOne(s);
+    if (!ijIsPromisePending(ctx, &s->accept.result))
+        return;
     JSValue arg;
     IJS32 is_reject = 0;
-    if (status == 0) {
-        IJJSStream* t2;
-        switch (handle->type) {
-            case UV_TCP:
-                arg = ijNewTcp(ctx, AF_UNSPEC);
-                t2 = ijTcpGet(ctx, arg);
-                break;
-            case UV_NAMED_PIPE:
-                arg = ijNewPipe(ctx);
-                t2 = ijPipeGet(ctx, arg);
-                break;
-            default:
-                abort();
-        }
-        IJS32 r = uv_accept(handle, &t2->h.stream);
-        if (r != 0) {
-            JS_FreeValue(ctx, arg);
-            arg = ijNewError(ctx, r);
-            is_reject = 1;
-        }
-    } else {
+    if (s->accept.count > 0) {
+        arg = ijStreamAcceptTake(s, s->accept.mode, s->accept.max);
+    } else if (status < 0) {
         arg = ijNewError(ctx, status);
         is_reject = 1;
+    } else {
+        return;
     }
     ijSettlePromise(ctx, &s->accept.result, is_reject, 1, (JSValueConst*)&arg);
     ijClearPromise(ctx, &s->accept.result);
@@ -307,6 +735,11 @@ static JSValue ijStreamListen(JSContext* ctx, IJJSStream* s, IJS32 argc, JSValue
         if (JS_ToUint32(ctx, &backlog, argv[0]))
             return JS_EXCEPTION;
     }
+    if (!s->accept.queue) {
+        s->accept.queue = js_malloc(ctx, IJJS_ACCEPT_QUEUE_SIZE * sizeof(JSValue));
+        if (!s->accept.queue)
+            return JS_EXCEPTION;
+    }
     IJS32 r = uv_listen(&s->h.stream, (IJS32) backlog, uvStreamConnectionCb);
     if (r != 0) {
         return ijThrowErrno(ctx, r);
@@ -314,14 +747,74 @@ static JSValue ijStreamListen(JSContext* ctx, IJJSStream* s, IJS32 argc, JSValue
     return JS_UNDEFINED;
 }
 
-static JSValue ijStreamAccept(JSContext* ctx, IJJSStream* s, IJS32 argc, JSValueConst* argv) {
-    if (!s)
-        return JS_EXCEPTION;
+static JSValue ijStreamAcceptInternal(JSContext* ctx, IJJSStream* s, IJS32 mode, IJU32 max) {
     if (!JS_IsUndefined(s->accept.result.p))
         return ijThrowErrno(ctx, UV_EBUSY);
+    if (s->accept.count == 0 && s->accept.paused) {
+        IJS32 r = ijStreamAcceptOne(s);
+        if (r < 0 && r != UV_EAGAIN)
+            return ijThrowErrno(ctx, r);
+    }
+    if (s->accept.count > 0) {
+        JSValue arg = ijStreamAcceptTake(s, mode, max);
+        return ijNewResolvedPromise(ctx, 1, (JSValueConst*)&arg);
+    }
+    if (mode == ACCEPT_ITER && (s->closed || uv_is_closing(&s->h.handle))) {
+        JSValue arg = JS_NewObjectProto(ctx, JS_NULL);
+        JS_DefinePropertyValueStr(ctx, arg, "done", JS_TRUE, JS_PROP_C_W_E);
+        return ijNewResolvedPromise(ctx, 1, (JSValueConst*)&arg);
+    }
+    s->accept.mode = mode;
+    s->accept.max = max;
     return ijInitPromise(ctx, &s->accept.result);
 }
 
+static JSValue ijStreamAccept(JSContext* ctx, IJJSStream* s, IJS32 argc, JSValueConst* argv) {
+    if (!s)
+        return JS_EXCEPTION;
+    return ijStreamAcceptInternal(ctx, s, ACCEPT_ONE, 1);
+}
+
+static JSValue ijStreamAcceptMany(JSContext* ctx, IJJSStream* s, IJS32 argc, JSValueConst* argv) {
+    if (!s)
+        return JS_EXCEPTION;
+    IJU32 max = IJJS_ACCEPT_QUEUE_SIZE;
+    if (!JS_IsUndefined(argv[0]) && JS_ToUint32(ctx, &max, argv[0]))
+        return JS_EXCEPTION;
+    if (max == 0)
+        return ijThrowErrno(ctx, UV_EINVAL);
+    return ijStreamAcceptInternal(ctx, s, ACCEPT_MANY, max);
+}
+
+static JSValue ijStreamConnectionsNext(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv, IJS32 magic, JSValue* func_data) {
+    IJJSStream* s = ijStreamGet(ctx, func_data[0]);
+    if (!s)
+        return JS_EXCEPTION;
+    return ijStreamAcceptInternal(ctx, s, ACCEPT_ITER, 1);
+}
+
+static JSValue ijStreamConnections(JSContext* ctx, IJJSStream* s, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    if (!s)
+        return JS_EXCEPTION;
+    JSValue iter = JS_NewObject(ctx);
+    if (JS_IsException(iter))
+        return iter;
+    JS_SetPropertyFunctionList(ctx, iter, ijjs_stream_iterator_funcs, countof(ijjs_stream_iterator_funcs));
+    JS_DefinePropertyValueStr(ctx, iter, "next", JS_NewCFunctionData(ctx, ijStreamConnectionsNext, 0, 0, 1, &this_val), JS_PROP_C_W_E);
+    return iter;
+}
+
+static JSValue ijStreamAcceptStats(JSContext* ctx, IJJSStream* s, IJS32 argc, JSValueConst* argv) {
+    if (!s)
+        return JS_EXCEPTION;
+    JSValue obj = JS_NewObjectProto(ctx, JS_NULL);
+    JS_DefinePropertyValueStr(ctx, obj, "queued", JS_NewUint32(ctx, s->accept.count), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "peak", JS_NewUint32(ctx, s->accept.peak), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "accepted", JS_NewInt64(ctx, s->accept.accepted), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "paused", JS_NewBool(ctx, s->accept.paused), JS_PROP_C_W_E);
+    return obj;
+}
+
 static JSValue ijInitStream(JSContext* ctx, JSValue obj, IJJSStream* s) {
     s->ctx = ctx;
     s->closed = 0;
@@ -329,6 +822,10 @@ static JSValue ijInitStream(JSContext* ctx, JSValue obj, IJJSStream* s) {
     s->h.handle.data = s;
     ijClearPromise(ctx, &s->read.result);
     ijClearPromise(ctx, &s->accept.result);
+    ijClearPromise(ctx, &s->flow.result);
+    init_list_head(&s->flow.chunks);
+    ijClearPromise(ctx, &s->cork.result);
+    dbuf_init2(&s->cork.dbuf, JS_GetRuntime(ctx), (DynBufReallocFunc*)js_realloc_rt);
     JS_SetOpaque(obj, s);
     return obj;
 }
@@ -336,7 +833,14 @@ static JSValue ijInitStream(JSContext* ctx, JSValue obj, IJJSStream* s) {
 static IJVoid ijStreamFinalizer(JSRuntime* rt, IJJSStream* s) {
     if (s) {
         ijFreePromiseRT(rt, &s->accept.result);
+        for (IJU32 i = 0; i < s->accept.count; i++)
+            JS_FreeValueRT(rt, s->accept.queue[(s->accept.head + i) % IJJS_ACCEPT_QUEUE_SIZE]);
+        js_free_rt(rt, s->accept.queue);
         ijFreePromiseRT(rt, &s->read.result);
+        ijFreePromiseRT(rt, &s->flow.result);
+        ijFreePromiseRT(rt, &s->cork.result);
+        dbuf_free(&s->cork.dbuf);
+        ijStreamFlowClear(rt, s);
         s->finalized = 1;
         if (s->closed)
             je_free(s);
@@ -349,6 +853,10 @@ static IJVoid ijStreamMark(JSRuntime* rt, IJJSStream* s, JS_MarkFunc* mark_func)
     if (s) {
         ijMarkPromise(rt, &s->read.result, mark_func);
         ijMarkPromise(rt, &s->accept.result, mark_func);
+        for (IJU32 i = 0; i < s->accept.count; i++)
+            JS_MarkValue(rt, s->accept.queue[(s->accept.head + i) % IJJS_ACCEPT_QUEUE_SIZE], mark_func);
+        ijMarkPromise(rt, &s->flow.result, mark_func);
+        ijMarkPromise(rt, &s->cork.result, mark_func);
     }
 }
 
@@ -366,7 +874,7 @@ static IJVoid ijTcpMark(JSRuntime* rt, JSValueConst val, JS_MarkFunc* mark_func)
 
 static JSClassDef ijjs_tcp_class = { "TCP", .finalizer = ijTcpFinalizer, .gc_mark = ijTcpMark };
 
-static JSValue ijNewTcp(JSContext* ctx, IJS32 af) {
+JSValue ijNewTcp(JSContext* ctx, IJS32 af) {
     IJJSStream* s;
     JSValue obj;
     IJS32 r;
@@ -436,6 +944,31 @@ static JSValue ijTcpConnect(JSContext* ctx, JSValueConst this_val, IJS32 argc, J
     return ijInitPromise(ctx, &cr->result);
 }
 
+IJS32 ijTcpSetReusePort(uv_tcp_t* tcp, IJS32 family) {
+#if defined(SO_REUSEPORT) && !defined(_WIN32)
+    uv_os_fd_t fd;
+    IJS32 r = uv_fileno((uv_handle_t*)tcp, &fd);
+    if (r == UV_EBADF) {
+        fd = socket(family, SOCK_STREAM, 0);
+        if (fd < 0)
+            return uv_translate_sys_error(errno);
+        r = uv_tcp_open(tcp, fd);
+        if (r != 0) {
+            close(fd);
+            return r;
+        }
+    } else if (r != 0) {
+        return r;
+    }
+    IJS32 yes = 1;
+    if (setsockopt(fd, SOL_SOCKET, SO_REUSEPORT, &yes, sizeof(yes)))
+        return uv_translate_sys_error(errno);
+    return 0;
+#else
+    return UV_ENOTSUP;
+#endif
+}
+
 static JSValue ijTcpBind(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
     IJJSStream* t = ijTcpGet(ctx, this_val);
     if (!t)
@@ -448,12 +981,159 @@ static JSValue ijTcpBind(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSVa
     IJS32 flags = 0;
     if (!JS_IsUndefined(argv[1]) && JS_ToInt32(ctx, &flags, argv[1]))
         return JS_EXCEPTION;
+    if (flags & IJJS_TCP_REUSEPORT) {
+        r = ijTcpSetReusePort(&t->h.tcp, ss.ss_family);
+        if (r != 0)
+            return ijThrowErrno(ctx, r);
+        flags &= ~IJJS_TCP_REUSEPORT;
+    }
     r = uv_tcp_bind(&t->h.tcp, (struct sockaddr*)&ss, flags);
     if (r != 0)
         return ijThrowErrno(ctx, r);
     return JS_UNDEFINED;
 }
 
+#if IJJS_PLATFORM == IJJS_PLATFORM_LINUX
+typedef struct {
+    struct tcp_info base;
+    uint64_t tcpi_pacing_rate;
+    uint64_t tcpi_max_pacing_rate;
+    uint64_t tcpi_bytes_acked;
+    uint64_t tcpi_bytes_received;
+    uint32_t tcpi_segs_out;
+    uint32_t tcpi_segs_in;
+    uint32_t tcpi_notsent_bytes;
+    uint32_t tcpi_min_rtt;
+    uint32_t tcpi_data_segs_in;
+    uint32_t tcpi_data_segs_out;
+    uint64_t tcpi_delivery_rate;
+} IJJSTcpInfo;
+#endif
+
+static JSValue ijTcpGetInfo(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJJSStream* t = ijTcpGet(ctx, this_val);
+    if (!t)
+        return JS_EXCEPTION;
+#if IJJS_PLATFORM == IJJS_PLATFORM_LINUX
+    uv_os_fd_t fd;
+    IJS32 r = uv_fileno(&t->h.handle, &fd);
+    if (r != 0)
+        return ijThrowErrno(ctx, r);
+    IJJSTcpInfo info;
+    socklen_t len = sizeof(info);
+    memset(&info, 0, sizeof(info));
+    if (getsockopt(fd, IPPROTO_TCP, TCP_INFO, &info, &len))
+        return ijThrowErrno(ctx, uv_translate_sys_error(errno));
+    JSValue obj = JS_NewObjectProto(ctx, JS_NULL);
+#define SET_U32_FIELD(name, x)                                                                                         \
+    JS_DefinePropertyValueStr(ctx, obj, name, JS_NewUint32(ctx, info.base.x), JS_PROP_C_W_E)
+    SET_U32_FIELD("state", tcpi_state);
+    SET_U32_FIELD("caState", tcpi_ca_state);
+    SET_U32_FIELD("rtt", tcpi_rtt);
+    SET_U32_FIELD("rttvar", tcpi_rttvar);
+    SET_U32_FIELD("rto", tcpi_rto);
+    SET_U32_FIELD("retransmits", tcpi_retransmits);
+    SET_U32_FIELD("retrans", tcpi_retrans);
+    SET_U32_FIELD("totalRetrans", tcpi_total_retrans);
+    SET_U32_FIELD("lost", tcpi_lost);
+    SET_U32_FIELD("unacked", tcpi_unacked);
+    SET_U32_FIELD("sndCwnd", tcpi_snd_cwnd);
+    SET_U32_FIELD("sndSsthresh", tcpi_snd_ssthresh);
+    SET_U32_FIELD("sndMss", tcpi_snd_mss);
+    SET_U32_FIELD("rcvMss", tcpi_rcv_mss);
+    SET_U32_FIELD("pmtu", tcpi_pmtu);
+    SET_U32_FIELD("lastDataSent", tcpi_last_data_sent);
+    SET_U32_FIELD("lastDataRecv", tcpi_last_data_recv);
+#undef SET_U32_FIELD
+    if (len >= offsetof(IJJSTcpInfo, tcpi_segs_out)) {
+        JS_DefinePropertyValueStr(ctx, obj, "bytesAcked", JS_NewInt64(ctx, info.tcpi_bytes_acked), JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, obj, "bytesReceived", JS_NewInt64(ctx, info.tcpi_bytes_received), JS_PROP_C_W_E);
+    }
+    if (len >= offsetof(IJJSTcpInfo, tcpi_data_segs_in)) {
+        JS_DefinePropertyValueStr(ctx, obj, "notsentBytes", JS_NewUint32(ctx, info.tcpi_notsent_bytes), JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, obj, "minRtt", JS_NewUint32(ctx, info.tcpi_min_rtt), JS_PROP_C_W_E);
+    }
+    if (len >= sizeof(IJJSTcpInfo))
+        JS_DefinePropertyValueStr(ctx, obj, "deliveryRate", JS_NewInt64(ctx, info.tcpi_delivery_rate), JS_PROP_C_W_E);
+    return obj;
+#else
+    return ijThrowErrno(ctx, UV_ENOTSUP);
+#endif
+}
+
+static JSValue ijTcpSetNoDelay(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJJSStream* t = ijTcpGet(ctx, this_val);
+    if (!t)
+        return JS_EXCEPTION;
+    IJS32 enable = JS_IsUndefined(argv[0]) ? 1 : JS_ToBool(ctx, argv[0]);
+    IJS32 r = uv_tcp_nodelay(&t->h.tcp, enable);
+    if (r != 0)
+        return ijThrowErrno(ctx, r);
+    return JS_UNDEFINED;
+}
+
+static JSValue ijTcpSetKeepAlive(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJJSStream* t = ijTcpGet(ctx, this_val);
+    if (!t)
+        return JS_EXCEPTION;
+    IJS32 enable = JS_IsUndefined(argv[0]) ? 1 : JS_ToBool(ctx, argv[0]);
+    IJU32 delay = 0;
+    if (!JS_IsUndefined(argv[1]) && JS_ToUint32(ctx, &delay, argv[1]))
+        return JS_EXCEPTION;
+    if (enable && delay == 0)
+        return ijThrowErrno(ctx, UV_EINVAL);
+    IJS32 r = uv_tcp_keepalive(&t->h.tcp, enable, delay);
+    if (r != 0)
+        return ijThrowErrno(ctx, r);
+    return JS_UNDEFINED;
+}
+
+static JSValue ijTcpSetNotSentLowat(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJJSStream* t = ijTcpGet(ctx, this_val);
+    if (!t)
+        return JS_EXCEPTION;
+    IJU32 lowat;
+    if (JS_ToUint32(ctx, &lowat, argv[0]))
+        return JS_EXCEPTION;
+#if defined(TCP_NOTSENT_LOWAT) && IJJS_PLATFORM != IJJS_PLATFORM_WIN32
+    uv_os_fd_t fd;
+    IJS32 r = uv_fileno(&t->h.handle, &fd);
+    if (r != 0)
+        return ijThrowErrno(ctx, r);
+    if (setsockopt(fd, IPPROTO_TCP, TCP_NOTSENT_LOWAT, &lowat, sizeof(lowat)))
+        return ijThrowErrno(ctx, uv_translate_sys_error(errno));
+    return JS_UNDEFINED;
+#else
+    return ijThrowErrno(ctx, UV_ENOTSUP);
+#endif
+}
+
+static JSValue ijTcpBufferSizeGet(JSContext* ctx, JSValueConst this_val, IJS32 magic) {
+    IJJSStream* t = ijTcpGet(ctx, this_val);
+    if (!t)
+        return JS_EXCEPTION;
+    IJS32 value = 0;
+    IJS32 r = magic ? uv_recv_buffer_size(&t->h.handle, &value) : uv_send_buffer_size(&t->h.handle, &value);
+    if (r != 0)
+        return ijThrowErrno(ctx, r);
+    return JS_NewInt32(ctx, value);
+}
+
+static JSValue ijTcpBufferSizeSet(JSContext* ctx, JSValueConst this_val, JSValueConst val, IJS32 magic) {
+    IJJSStream* t = ijTcpGet(ctx, this_val);
+    if (!t)
+        return JS_EXCEPTION;
+    IJS32 value;
+    if (JS_ToInt32(ctx, &value, val))
+        return JS_EXCEPTION;
+    if (value <= 0)
+        return ijThrowErrno(ctx, UV_EINVAL);
+    IJS32 r = magic ? uv_recv_buffer_size(&t->h.handle, &value) : uv_send_buffer_size(&t->h.handle, &value);
+    if (r != 0)
+        return ijThrowErrno(ctx, r);
+    return JS_UNDEFINED;
+}
+
 static JSValue ijTcpClose(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
     IJJSStream* t = ijTcpGet(ctx, this_val);
     return ijStreamClose(ctx, t, argc, argv);
@@ -464,11 +1144,36 @@ static JSValue ijTcpRead(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSVa
     return ijStreamRead(ctx, t, argc, argv);
 }
 
+static JSValue ijTcpReadable(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJJSStream* t = ijTcpGet(ctx, this_val);
+    return ijStreamReadable(ctx, t, this_val, argc, argv);
+}
+
 static JSValue ijTcpWrite(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
     IJJSStream* t = ijTcpGet(ctx, this_val);
     return ijStreamWrite(ctx, t, argc, argv);
 }
 
+static JSValue ijTcpWritev(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJJSStream* t = ijTcpGet(ctx, this_val);
+    return ijStreamWritev(ctx, t, argc, argv);
+}
+
+static JSValue ijTcpCork(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJJSStream* t = ijTcpGet(ctx, this_val);
+    return ijStreamCork(ctx, t, argc, argv);
+}
+
+static JSValue ijTcpUncork(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJJSStream* t = ijTcpGet(ctx, this_val);
+    return ijStreamUncork(ctx, t, argc, argv);
+}
+
+static JSValue ijTcpWriteQueueSizeGet(JSContext* ctx, JSValueConst this_val) {
+    IJJSStream* t = ijTcpGet(ctx, this_val);
+    return ijStreamWriteQueueSizeGet(ctx, t);
+}
+
 static JSValue ijTcpShutdown(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
     IJJSStream* t = ijTcpGet(ctx, this_val);
     return ijStreamShutdown(ctx, t, argc, argv);
@@ -489,6 +1194,21 @@ static JSValue ijTcpAccept(JSContext* ctx, JSValueConst this_val, IJS32 argc, JS
     return ijStreamAccept(ctx, t, argc, argv);
 }
 
+static JSValue ijTcpAcceptMany(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJJSStream* t = ijTcpGet(ctx, this_val);
+    return ijStreamAcceptMany(ctx, t, argc, argv);
+}
+
+static JSValue ijTcpConnections(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJJSStream* t = ijTcpGet(ctx, this_val);
+    return ijStreamConnections(ctx, t, this_val, argc, argv);
+}
+
+static JSValue ijTcpAcceptStats(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJJSStream* t = ijTcpGet(ctx, this_val);
+    return ijStreamAcceptStats(ctx, t, argc, argv);
+}
+
 static JSClassID ijjs_tty_class_id;
 
 static IJVoid ijTtyFinalizer(JSRuntime* rt, JSValue val) {
@@ -569,11 +1289,36 @@ static JSValue ijTtyRead(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSVa
     return ijStreamRead(ctx, t, argc, argv);
 }
 
+static JSValue ijTtyReadable(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJJSStream* t = ijTtyGet(ctx, this_val);
+    return ijStreamReadable(ctx, t, this_val, argc, argv);
+}
+
 static JSValue ijTtyWrite(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
     IJJSStream* t = ijTtyGet(ctx, this_val);
     return ijStreamWrite(ctx, t, argc, argv);
 }
 
+static JSValue ijTtyWritev(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJJSStream* t = ijTtyGet(ctx, this_val);
+    return ijStreamWritev(ctx, t, argc, argv);
+}
+
+static JSValue ijTtyCork(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJJSStream* t = ijTtyGet(ctx, this_val);
+    return ijStreamCork(ctx, t, argc, argv);
+}
+
+static JSValue ijTtyUncork(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJJSStream* t = ijTtyGet(ctx, this_val);
+    return ijStreamUncork(ctx, t, argc, argv);
+}
+
+static JSValue ijTtyWriteQueueSizeGet(JSContext* ctx, JSValueConst this_val) {
+    IJJSStream* t = ijTtyGet(ctx, this_val);
+    return ijStreamWriteQueueSizeGet(ctx, t);
+}
+
 static JSValue ijTtyFileno(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
     IJJSStream* t = ijTtyGet(ctx, this_val);
     return ijStreamFileno(ctx, t, argc, argv);
@@ -622,6 +1367,26 @@ static IJJSStream* ijPipeGet(JSContext* ctx, JSValueConst obj) {
     return JS_GetOpaque2(ctx, obj, ijjs_pipe_class_id);
 }
 
+static IJJSStream* ijStreamGetNoThrow(JSValueConst obj) {
+    IJJSStream* s = JS_GetOpaque(obj, ijjs_tcp_class_id);
+    if (!s)
+        s = JS_GetOpaque(obj, ijjs_pipe_class_id);
+    if (!s)
+        s = JS_GetOpaque(obj, ijjs_tty_class_id);
+    return s;
+}
+
+static IJJSStream* ijStreamGet(JSContext* ctx, JSValueConst obj) {
+    IJJSStream* s = JS_GetOpaque(obj, ijjs_tcp_class_id);
+    if (!s)
+        s = JS_GetOpaque(obj, ijjs_pipe_class_id);
+    if (!s)
+        s = JS_GetOpaque(obj, ijjs_tty_class_id);
+    if (!s)
+        JS_ThrowTypeError(ctx, "not a stream");
+    return s;
+}
+
 uv_stream_t* ijPipeGetStream(JSContext* ctx, JSValueConst obj) {
     IJJSStream* s = ijPipeGet(ctx, obj);
     if (s)
@@ -629,6 +1394,542 @@ uv_stream_t* ijPipeGetStream(JSContext* ctx, JSValueConst obj) {
     return NULL;
 }
 
+uv_stream_t* ijSocketGetStream(JSContext* ctx, JSValueConst obj) {
+    IJJSStream* s = JS_GetOpaque(obj, ijjs_tcp_class_id);
+    if (!s)
+        s = JS_GetOpaque(obj, ijjs_pipe_class_id);
+    if (s)
+        return &s->h.stream;
+    JS_ThrowTypeError(ctx, "expected a TCP or Pipe object");
+    return NULL;
+}
+
+uv_stream_t* ijStreamAcquire(JSContext* ctx, JSValueConst obj, IJJSStreamOwner* owner) {
+    IJJSStream* s = JS_GetOpaque(obj, ijjs_tcp_class_id);
+    if (!s)
+        s = JS_GetOpaque(obj, ijjs_pipe_class_id);
+    if (!s) {
+        JS_ThrowTypeError(ctx, "expected a TCP or Pipe object");
+        return NULL;
+    }
+    if (!JS_IsUndefined(s->read.result.p) || s->flow.active || s->pump || s->owner || uv_is_closing(&s->h.handle)) {
+        ijThrowErrno(ctx, UV_EBUSY);
+        return NULL;
+    }
+    s->owner = owner;
+    return &s->h.stream;
+}
+
+IJVoid ijStreamRelease(uv_stream_t* handle, IJJSStreamOwner* owner) {
+    IJJSStream* s = handle->data;
+    CHECK_NOT_NULL(s);
+    if (s->owner != owner)
+        return;
+    s->owner = NULL;
+    if (!uv_is_closing(&s->h.handle))
+        uv_read_stop(handle);
+}
+
+// Native code writing to the stream directly (e.g. File.sendTo) keeps
+// write(), writev() and shutdown() out until ijStreamReleaseWriter().
+uv_stream_t* ijStreamAcquireWriter(JSContext* ctx, JSValueConst obj) {
+    IJJSStream* s = JS_GetOpaque(obj, ijjs_tcp_class_id);
+    if (!s)
+        s = JS_GetOpaque(obj, ijjs_pipe_class_id);
+    if (!s) {
+        JS_ThrowTypeError(ctx, "expected a TCP or Pipe object");
+        return NULL;
+    }
+    if (ijStreamWriteBusy(s) || ijIsPromisePending(ctx, &s->cork.result) || uv_is_closing(&s->h.handle)) {
+        ijThrowErrno(ctx, UV_EBUSY);
+        return NULL;
+    }
+    s->writer = true;
+    return &s->h.stream;
+}
+
+IJVoid ijStreamReleaseWriter(uv_stream_t* handle) {
+    IJJSStream* s = handle->data;
+    CHECK_NOT_NULL(s);
+    s->writer = false;
+}
+
+IJJSStreamOwner* ijStreamGetOwner(uv_stream_t* handle) {
+    IJJSStream* s = handle->data;
+    CHECK_NOT_NULL(s);
+    return s->owner;
+}
+
+struct IJJSPump {
+    JSContext* ctx;
+    JSValue objs[2];
+    IJJSStream* src;
+    IJJSStream* dst;
+    uv_file src_fd;
+    uv_file dst_fd;
+    size_t highwater;
+    size_t queued;
+    IJU64 nread;
+    IJU64 nwritten;
+    IJS32 inflight;
+    IJS32 pending;
+    IJS32 error;
+    IJBool end;
+    IJBool eof;
+    IJBool dst_ended;
+    IJBool reading;
+    IJBool finishing;
+    IJBool spliced;
+    uv_fs_t fsreq;
+    IJU8* fsbuf;
+    uv_shutdown_t shutdown;
+#if IJJS_PLATFORM == IJJS_PLATFORM_LINUX
+    IJS32 fds[2];
+    IJS32 pipefd[2];
+    size_t pipe_size;
+    uv_poll_t polls[2];
+#endif
+    IJJSPromise result;
+};
+
+static IJBool ijPumpWritesTo(IJJSPump* p, IJJSStream* s) {
+    return p && p->dst == s;
+}
+
+typedef struct {
+    union {
+        uv_write_t write;
+        uv_fs_t fs;
+    } req;
+    IJJSPump* p;
+    IJU8* data;
+    size_t size;
+    size_t cap;
+} IJJSPumpWriteReq;
+
+static IJVoid ijPumpSettle(IJJSPump* p) {
+    JSContext* ctx = p->ctx;
+#if IJJS_PLATFORM == IJJS_PLATFORM_LINUX
+    if (p->spliced) {
+        close(p->fds[0]);
+        close(p->fds[1]);
+        close(p->pipefd[0]);
+        close(p->pipefd[1]);
+    }
+#endif
+    JSValue arg;
+    IJBool is_reject = p->error != 0;
+    if (is_reject) {
+        arg = ijNewError(ctx, p->error);
+    } else {
+        arg = JS_NewObjectProto(ctx, JS_NULL);
+        JS_DefinePropertyValueStr(ctx, arg, "read", JS_NewInt64(ctx, p->nread), JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, arg, "written", JS_NewInt64(ctx, p->nwritten), JS_PROP_C_W_E);
+    }
+    /* a pump can fail before pipe() returns, so a rejection must not be reported before the caller can handle it */
+    if (is_reject)
+        ijSettlePromiseLater(ctx, &p->result, true, 1, (JSValueConst*)&arg);
+    else
+        ijSettlePromise(ctx, &p->result, false, 1, (JSValueConst*)&arg);
+    if (!p->src)
+        ijFileRelease(p->objs[0]);
+    if (!p->dst)
+        ijFileRelease(p->objs[1]);
+    JS_FreeValue(ctx, p->objs[0]);
+    JS_FreeValue(ctx, p->objs[1]);
+    js_free(ctx, p);
+}
+
+static IJVoid ijPumpStepDone(IJJSPump* p) {
+    if (--p->pending == 0)
+        ijPumpSettle(p);
+}
+
+static IJVoid uvPumpShutdownCb(uv_shutdown_t* req, IJS32 status) {
+    ijPumpStepDone(req->data);
+}
+
+#if IJJS_PLATFORM == IJJS_PLATFORM_LINUX
+static IJVoid uvPumpPollCloseCb(uv_handle_t* handle) {
+    ijPumpStepDone(handle->data);
+}
+#endif
+
+static IJVoid ijPumpMaybeFinish(IJJSPump* p) {
+    if (p->finishing || p->inflight > 0)
+        return;
+    if (!p->error && !p->dst_ended && !(p->eof && p->queued == 0))
+        return;
+    p->finishing = true;
+    p->pending = 1;
+    if (p->src) {
+        if (p->reading && !p->spliced)
+            uv_read_stop(&p->src->h.stream);
+        p->src->pump = NULL;
+    }
+    if (p->dst)
+        p->dst->pump = NULL;
+#if IJJS_PLATFORM == IJJS_PLATFORM_LINUX
+    if (p->spliced) {
+        for (IJS32 i = 0; i < 2; i++) {
+            p->pending++;
+            uv_close((uv_handle_t*)&p->polls[i], uvPumpPollCloseCb);
+        }
+    }
+#endif
+    if (p->end && p->eof && !p->error && !p->dst_ended && p->dst && !uv_is_closing(&p->dst->h.handle)) {
+        p->shutdown.data = p;
+        if (uv_shutdown(&p->shutdown, &p->dst->h.stream, uvPumpShutdownCb) == 0)
+            p->pending++;
+    }
+    ijPumpStepDone(p);
+}
+
+static IJVoid ijPumpAbort(IJJSPump* p, IJS32 err) {
+    if (!p->error)
+        p->error = err;
+#if IJJS_PLATFORM == IJJS_PLATFORM_LINUX
+    if (p->spliced) {
+        uv_poll_stop(&p->polls[0]);
+        uv_poll_stop(&p->polls[1]);
+    }
+#endif
+    ijPumpMaybeFinish(p);
+}
+
+static IJBool ijPumpIsEnd(IJS32 err) {
+    return err == UV_EOF || err == UV_EPIPE || err == UV_ECONNRESET || err == UV_ECANCELED;
+}
+
+static IJVoid ijPumpResume(IJJSPump* p);
+
+static IJVoid ijPumpWriteDone(IJJSPump* p, IJJSPumpWriteReq* wr, IJS32 status) {
+    p->inflight--;
+    p->queued -= wr->size;
+    if (status < 0) {
+        if (ijPumpIsEnd(status))
+            p->dst_ended = true;
+        else if (!p->error)
+            p->error = status;
+    } else {
+        p->nwritten += wr->size;
+    }
+    ijReadBufFree(p->ctx, wr->data, wr->cap);
+    js_free(p->ctx, wr);
+    if (!p->error && !p->dst_ended && !p->eof && p->queued <= p->highwater / 2)
+        ijPumpResume(p);
+    ijPumpMaybeFinish(p);
+}
+
+static IJVoid uvPumpWriteCb(uv_write_t* req, IJS32 status) {
+    IJJSPumpWriteReq* wr = req->data;
+    ijPumpWriteDone(wr->p, wr, status);
+}
+
+static IJVoid uvPumpFsWriteCb(uv_fs_t* req) {
+    IJJSPumpWriteReq* wr = req->data;
+    IJS32 status = req->result < 0 ? req->result : 0;
+    uv_fs_req_cleanup(req);
+    ijPumpWriteDone(wr->p, wr, status);
+}
+
+static IJVoid ijPumpWrite(IJJSPump* p, IJU8* data, size_t size, size_t cap) {
+    IJJSPumpWriteReq* wr = js_malloc(p->ctx, sizeof(*wr));
+    if (!wr) {
+        ijReadBufFree(p->ctx, data, cap);
+        p->error = UV_ENOMEM;
+        return;
+    }
+    wr->p = p;
+    wr->data = data;
+    wr->size = size;
+    wr->cap = cap;
+    uv_buf_t b = uv_buf_init((IJAnsi*)data, size);
+    IJS32 r;
+    if (p->dst) {
+        wr->req.write.data = wr;
+        r = uv_write(&wr->req.write, &p->dst->h.stream, &b, 1, uvPumpWriteCb);
+    } else {
+        wr->req.fs.data = wr;
+        r = uv_fs_write(ijGetLoop(p->ctx), &wr->req.fs, p->dst_fd, &b, 1, -1, uvPumpFsWriteCb);
+    }
+    if (r != 0) {
+        ijReadBufFree(p->ctx, data, cap);
+        js_free(p->ctx, wr);
+        p->error = r;
+        return;
+    }
+    p->inflight++;
+    p->queued += size;
+}
+
+static IJVoid ijPumpAfterRead(IJJSPump* p, IJU8* data, ssize_t nread, size_t cap) {
+    if (nread < 0) {
+        ijReadBufFree(p->ctx, data, cap);
+        if (ijPumpIsEnd(nread))
+            p->eof = true;
+        else
+            p->error = nread;
+        return;
+    }
+    if (nread == 0) {
+        ijReadBufFree(p->ctx, data, cap);
+        return;
+    }
+    p->nread += nread;
+    ijPumpWrite(p, data, nread, cap);
+}
+
+static IJVoid uvPumpReadCb(uv_stream_t* handle, ssize_t nread, const uv_buf_t* buf) {
+    IJJSStream* s = handle->data;
+    CHECK_NOT_NULL(s);
+    IJJSPump* p = s->pump;
+    CHECK_NOT_NULL(p);
+    ijPumpAfterRead(p, (IJU8*)buf->base, nread, buf->len);
+    if (p->eof || p->error || p->dst_ended || p->queued >= p->highwater) {
+        uv_read_stop(handle);
+        p->reading = false;
+    }
+    ijPumpMaybeFinish(p);
+}
+
+static IJVoid uvPumpFsReadCb(uv_fs_t* req) {
+    IJJSPump* p = req->data;
+    IJU8* data = p->fsbuf;
+    ssize_t nread = req->result == 0 ? UV_EOF : req->result;
+    uv_fs_req_cleanup(req);
+    p->inflight--;
+    p->reading = false;
+    ijPumpAfterRead(p, data, nread, IJJS_DEFAULt_READ_SIZE);
+    if (!p->eof && !p->error && !p->dst_ended && p->queued < p->highwater)
+        ijPumpResume(p);
+    ijPumpMaybeFinish(p);
+}
+
+static IJVoid ijPumpResume(IJJSPump* p) {
+    if (p->reading || p->finishing)
+        return;
+    IJS32 r;
+    if (p->src) {
+        r = uv_read_start(&p->src->h.stream, uvStreamAllocCb, uvPumpReadCb);
+    } else {
+        p->fsbuf = ijReadBufAlloc(p->ctx, IJJS_DEFAULt_READ_SIZE);
+        uv_buf_t b = uv_buf_init((IJAnsi*)p->fsbuf, IJJS_DEFAULt_READ_SIZE);
+        p->fsreq.data = p;
+        r = uv_fs_read(ijGetLoop(p->ctx), &p->fsreq, p->src_fd, &b, 1, -1, uvPumpFsReadCb);
+        if (r != 0)
+            ijReadBufFree(p->ctx, p->fsbuf, IJJS_DEFAULt_READ_SIZE);
+        else
+            p->inflight++;
+    }
+    if (r != 0)
+        p->error = r;
+    else
+        p->reading = true;
+}
+
+#if IJJS_PLATFORM == IJJS_PLATFORM_LINUX
+static ssize_t ijPumpSplice(IJS32 fd_in, IJS32 fd_out, size_t len) {
+    sigset_t set, old;
+    sigemptyset(&set);
+    sigaddset(&set, SIGPIPE);
+    pthread_sigmask(SIG_BLOCK, &set, &old);
+    ssize_t n = splice(fd_in, NULL, fd_out, NULL, len, SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
+    IJS32 err = errno;
+    if (n < 0 && err == EPIPE) {
+        struct timespec ts = { 0, 0 };
+        sigtimedwait(&set, NULL, &ts);
+    }
+    pthread_sigmask(SIG_SETMASK, &old, NULL);
+    errno = err;
+    return n;
+}
+
+static IJVoid uvPumpPollCb(uv_poll_t* handle, IJS32 status, IJS32 events);
+
+static IJVoid ijPumpSpliceStep(IJJSPump* p) {
+    IJBool progress = true;
+    IJBool src_wait = false;
+    IJBool dst_wait = false;
+    size_t cap = p->pipe_size < p->highwater ? p->pipe_size : p->highwater;
+    while (progress && !p->error && !p->dst_ended) {
+        progress = false;
+        src_wait = false;
+        dst_wait = false;
+        if (!p->eof && p->queued < cap) {
+            ssize_t n = ijPumpSplice(p->fds[0], p->pipefd[1], cap - p->queued);
+            if (n > 0) {
+                p->queued += n;
+                p->nread += n;
+                progress = true;
+            } else if (n == 0) {
+                p->eof = true;
+            } else if (errno == EAGAIN) {
+                // With bytes queued the pipe itself may be full, only the
+                // destination draining it can make progress then.
+                src_wait = p->queued == 0;
+            } else if (errno == ECONNRESET) {
+                p->eof = true;
+            } else {
+                p->error = uv_translate_sys_error(errno);
+            }
+        }
+        if (p->queued > 0 && !p->error) {
+            ssize_t n = ijPumpSplice(p->pipefd[0], p->fds[1], p->queued);
+            if (n > 0) {
+                p->queued -= n;
+                p->nwritten += n;
+                progress = true;
+            } else if (n < 0 && errno == EAGAIN) {
+                dst_wait = true;
+            } else if (n < 0 && (errno == EPIPE || errno == ECONNRESET)) {
+                p->dst_ended = true;
+            } else if (n < 0) {
+                p->error = uv_translate_sys_error(errno);
+            }
+        }
+    }
+    if (p->error || p->dst_ended || (p->eof && p->queued == 0)) {
+        uv_poll_stop(&p->polls[0]);
+        uv_poll_stop(&p->polls[1]);
+        ijPumpMaybeFinish(p);
+        return;
+    }
+    if (src_wait)
+        uv_poll_start(&p->polls[0], UV_READABLE, uvPumpPollCb);
+    else
+        uv_poll_stop(&p->polls[0]);
+    if (dst_wait)
+        uv_poll_start(&p->polls[1], UV_WRITABLE, uvPumpPollCb);
+    else
+        uv_poll_stop(&p->polls[1]);
+}
+
+static IJVoid uvPumpPollCb(uv_poll_t* handle, IJS32 status, IJS32 events) {
+    IJJSPump* p = handle->data;
+    if (status < 0 && !p->error)
+        p->error = status;
+    ijPumpSpliceStep(p);
+}
+
+static IJS32 ijPumpSpliceInit(IJJSPump* p) {
+    uv_os_fd_t fds[2];
+    if (!p->src || !p->dst || p->src->h.handle.type == UV_TTY || p->dst->h.handle.type == UV_TTY)
+        return -1;
+    if (uv_stream_get_write_queue_size(&p->dst->h.stream) > 0)
+        return -1;
+    if (uv_fileno(&p->src->h.handle, &fds[0]) || uv_fileno(&p->dst->h.handle, &fds[1]))
+        return -1;
+    if (pipe2(p->pipefd, O_NONBLOCK | O_CLOEXEC))
+        return -1;
+    // Unprivileged processes are capped by pipe-max-size, use what we got.
+    fcntl(p->pipefd[1], F_SETPIPE_SZ, (IJS32)(p->highwater < INT32_MAX ? p->highwater : INT32_MAX));
+    IJS32 size = fcntl(p->pipefd[1], F_GETPIPE_SZ);
+    p->pipe_size = size > 0 ? size : 65536;
+    p->fds[0] = fcntl(fds[0], F_DUPFD_CLOEXEC, 0);
+    p->fds[1] = fcntl(fds[1], F_DUPFD_CLOEXEC, 0);
+    uv_loop_t* loop = ijGetLoop(p->ctx);
+    if (p->fds[0] < 0 || p->fds[1] < 0 || uv_poll_init(loop, &p->polls[0], p->fds[0])) {
+        if (p->fds[0] >= 0)
+            close(p->fds[0]);
+        if (p->fds[1] >= 0)
+            close(p->fds[1]);
+        close(p->pipefd[0]);
+        close(p->pipefd[1]);
+        return -1;
+    }
+    if (uv_poll_init(loop, &p->polls[1], p->fds[1])) {
+        p->polls[0].data = NULL;
+        uv_close((uv_handle_t*)&p->polls[0], NULL);
+        close(p->fds[0]);
+        close(p->fds[1]);
+        close(p->pipefd[0]);
+        close(p->pipefd[1]);
+        return -1;
+    }
+    p->polls[0].data = p;
+    p->polls[1].data = p;
+    p->spliced = true;
+    return 0;
+}
+#endif
+
+static JSValue ijStreamPipe(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJJSStream* src = ijStreamGetNoThrow(argv[0]);
+    IJJSStream* dst = ijStreamGetNoThrow(argv[1]);
+    if ((!src && ijFileGetFd(argv[0]) < 0) || (!dst && ijFileGetFd(argv[1]) < 0))
+        return JS_ThrowTypeError(ctx, "expected a stream or a file");
+    if (src && (!JS_IsUndefined(src->read.result.p) || src->flow.active || src->pump || src->owner))
+        return ijThrowErrno(ctx, UV_EBUSY);
+    if (dst && (dst->pump || dst->owner || dst->writer || ijIsPromisePending(ctx, &dst->cork.result)))
+        return ijThrowErrno(ctx, UV_EBUSY);
+    IJU64 highwater = IJJS_DEFAULT_HIGH_WATER_MARK;
+    IJBool end = true;
+    IJBool use_splice = true;
+    if (JS_IsObject(argv[2])) {
+        JSValue val = JS_GetPropertyStr(ctx, argv[2], "highWaterMark");
+        IJS32 r = !JS_IsUndefined(val) && JS_ToIndex(ctx, &highwater, val);
+        JS_FreeValue(ctx, val);
+        if (r)
+            return JS_EXCEPTION;
+        val = JS_GetPropertyStr(ctx, argv[2], "end");
+        if (!JS_IsUndefined(val))
+            end = JS_ToBool(ctx, val);
+        JS_FreeValue(ctx, val);
+        val = JS_GetPropertyStr(ctx, argv[2], "splice");
+        if (!JS_IsUndefined(val))
+            use_splice = JS_ToBool(ctx, val);
+        JS_FreeValue(ctx, val);
+    }
+    if (highwater == 0)
+        return ijThrowErrno(ctx, UV_EINVAL);
+    // Files stay open for the whole pump, close() waits for it to finish.
+    uv_file src_fd = -1;
+    uv_file dst_fd = -1;
+    IJS32 r = src ? 0 : ijFileAcquire(argv[0], &src_fd);
+    if (r == 0 && !dst) {
+        r = ijFileAcquire(argv[1], &dst_fd);
+        if (r != 0 && !src)
+            ijFileRelease(argv[0]);
+    }
+    if (r != 0)
+        return ijThrowErrno(ctx, r);
+    IJJSPump* p = js_mallocz(ctx, sizeof(*p));
+    if (!p) {
+        if (!src)
+            ijFileRelease(argv[0]);
+        if (!dst)
+            ijFileRelease(argv[1]);
+        return JS_EXCEPTION;
+    }
+    p->ctx = ctx;
+    p->objs[0] = JS_DupValue(ctx, argv[0]);
+    p->objs[1] = JS_DupValue(ctx, argv[1]);
+    p->src = src;
+    p->dst = dst;
+    p->src_fd = src_fd;
+    p->dst_fd = dst_fd;
+    p->highwater = highwater;
+    p->end = end;
+    if (src) {
+        src->pump = p;
+        src->read.size = IJJS_DEFAULt_READ_SIZE;
+    }
+    if (dst)
+        dst->pump = p;
+    JSValue ret = ijInitPromise(ctx, &p->result);
+#if IJJS_PLATFORM == IJJS_PLATFORM_LINUX
+    if (use_splice && ijPumpSpliceInit(p) == 0) {
+        ijPumpSpliceStep(p);
+        return ret;
+    }
+#endif
+    ijPumpResume(p);
+    ijPumpMaybeFinish(p);
+    return ret;
+}
+
+
 static JSValue ijPipeGetSockPeerName(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv, IJS32 magic) {
     IJJSStream* t = ijPipeGet(ctx, this_val);
     if (!t)
@@ -687,11 +1988,36 @@ static JSValue ijPipeRead(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSV
     return ijStreamRead(ctx, t, argc, argv);
 }
 
+static JSValue ijPipeReadable(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJJSStream* t = ijPipeGet(ctx, this_val);
+    return ijStreamReadable(ctx, t, this_val, argc, argv);
+}
+
 static JSValue ijPipeWrite(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
     IJJSStream* t = ijPipeGet(ctx, this_val);
     return ijStreamWrite(ctx, t, argc, argv);
 }
 
+static JSValue ijPipeWritev(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJJSStream* t = ijPipeGet(ctx, this_val);
+    return ijStreamWritev(ctx, t, argc, argv);
+}
+
+static JSValue ijPipeCork(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJJSStream* t = ijPipeGet(ctx, this_val);
+    return ijStreamCork(ctx, t, argc, argv);
+}
+
+static JSValue ijPipeUncork(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJJSStream* t = ijPipeGet(ctx, this_val);
+    return ijStreamUncork(ctx, t, argc, argv);
+}
+
+static JSValue ijPipeWriteQueueSizeGet(JSContext* ctx, JSValueConst this_val) {
+    IJJSStream* t = ijPipeGet(ctx, this_val);
+    return ijStreamWriteQueueSizeGet(ctx, t);
+}
+
 static JSValue ijPipeFileno(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
     IJJSStream* t = ijPipeGet(ctx, this_val);
     return ijStreamFileno(ctx, t, argc, argv);
@@ -707,29 +2033,64 @@ static JSValue ijPipeAccept(JSContext* ctx, JSValueConst this_val, IJS32 argc, J
     return ijStreamAccept(ctx, t, argc, argv);
 }
 
+static JSValue ijPipeAcceptMany(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJJSStream* t = ijPipeGet(ctx, this_val);
+    return ijStreamAcceptMany(ctx, t, argc, argv);
+}
+
+static JSValue ijPipeConnections(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJJSStream* t = ijPipeGet(ctx, this_val);
+    return ijStreamConnections(ctx, t, this_val, argc, argv);
+}
+
+static JSValue ijPipeAcceptStats(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJJSStream* t = ijPipeGet(ctx, this_val);
+    return ijStreamAcceptStats(ctx, t, argc, argv);
+}
+
 static const JSCFunctionListEntry ijjs_tcp_proto_funcs[] = {
     JS_CFUNC_DEF("close", 0, ijTcpClose),
     JS_CFUNC_DEF("read", 1, ijTcpRead),
+    JS_CFUNC_DEF("readable", 1, ijTcpReadable),
     JS_CFUNC_DEF("write", 1, ijTcpWrite),
+    JS_CFUNC_DEF("writev", 1, ijTcpWritev),
+    JS_CFUNC_DEF("cork", 0, ijTcpCork),
+    JS_CFUNC_DEF("uncork", 0, ijTcpUncork),
+    JS_CGETSET_DEF("writeQueueSize", ijTcpWriteQueueSizeGet, NULL),
     JS_CFUNC_DEF("shutdown", 0, ijTcpShutdown),
     JS_CFUNC_DEF("fileno", 0, ijTcpFileno),
     JS_CFUNC_DEF("listen", 1, ijTcpListen),
     JS_CFUNC_DEF("accept", 0, ijTcpAccept),
+    JS_CFUNC_DEF("acceptMany", 1, ijTcpAcceptMany),
+    JS_CFUNC_DEF("connections", 0, ijTcpConnections),
+    JS_CFUNC_DEF("acceptStats", 0, ijTcpAcceptStats),
     JS_CFUNC_MAGIC_DEF("getsockname", 0, ijTcpGetSockPeerName, 0),
     JS_CFUNC_MAGIC_DEF("getpeername", 0, ijTcpGetSockPeerName, 1),
     JS_CFUNC_DEF("connect", 1, ijTcpConnect),
     JS_CFUNC_DEF("bind", 1, ijTcpBind),
+    JS_CFUNC_DEF("getInfo", 0, ijTcpGetInfo),
+    JS_CFUNC_DEF("setNoDelay", 1, ijTcpSetNoDelay),
+    JS_CFUNC_DEF("setKeepAlive", 2, ijTcpSetKeepAlive),
+    JS_CFUNC_DEF("setNotSentLowat", 1, ijTcpSetNotSentLowat),
+    JS_CGETSET_MAGIC_DEF("sendBufferSize", ijTcpBufferSizeGet, ijTcpBufferSizeSet, 0),
+    JS_CGETSET_MAGIC_DEF("recvBufferSize", ijTcpBufferSizeGet, ijTcpBufferSizeSet, 1),
     JS_PROP_STRING_DEF("[Symbol.toStringTag]", "TCP", JS_PROP_CONFIGURABLE),
 };
 
 static const JSCFunctionListEntry ijjs_tcp_class_funcs[] = {
     JS_PROP_INT32_DEF("IPV6ONLY", UV_TCP_IPV6ONLY, 0),
+    JS_PROP_INT32_DEF("REUSEPORT", IJJS_TCP_REUSEPORT, 0),
 };
 
 static const JSCFunctionListEntry ijjs_tty_proto_funcs[] = {
     JS_CFUNC_DEF("close", 0, ijTtyClose),
     JS_CFUNC_DEF("read", 1, ijTtyRead),
+    JS_CFUNC_DEF("readable", 1, ijTtyReadable),
     JS_CFUNC_DEF("write", 1, ijTtyWrite),
+    JS_CFUNC_DEF("writev", 1, ijTtyWritev),
+    JS_CFUNC_DEF("cork", 0, ijTtyCork),
+    JS_CFUNC_DEF("uncork", 0, ijTtyUncork),
+    JS_CGETSET_DEF("writeQueueSize", ijTtyWriteQueueSizeGet, NULL),
     JS_CFUNC_DEF("fileno", 0, ijTtyFileno),
     JS_CFUNC_DEF("setMode", 1, ijTtySetMode),
     JS_CFUNC_DEF("getWinSize", 0, ijTtyGetWinSize),
@@ -745,10 +2106,18 @@ static const JSCFunctionListEntry ijjs_tty_class_funcs[] = {
 static const JSCFunctionListEntry ijjs_pipe_proto_funcs[] = {
     JS_CFUNC_DEF("close", 0, ijPipeClose),
     JS_CFUNC_DEF("read", 1, ijPipeRead),
+    JS_CFUNC_DEF("readable", 1, ijPipeReadable),
     JS_CFUNC_DEF("write", 1, ijPipeWrite),
+    JS_CFUNC_DEF("writev", 1, ijPipeWritev),
+    JS_CFUNC_DEF("cork", 0, ijPipeCork),
+    JS_CFUNC_DEF("uncork", 0, ijPipeUncork),
+    JS_CGETSET_DEF("writeQueueSize", ijPipeWriteQueueSizeGet, NULL),
     JS_CFUNC_DEF("fileno", 0, ijPipeFileno),
     JS_CFUNC_DEF("listen", 1, ijPipeListen),
     JS_CFUNC_DEF("accept", 0, ijPipeAccept),
+    JS_CFUNC_DEF("acceptMany", 1, ijPipeAcceptMany),
+    JS_CFUNC_DEF("connections", 0, ijPipeConnections),
+    JS_CFUNC_DEF("acceptStats", 0, ijPipeAcceptStats),
     JS_CFUNC_MAGIC_DEF("getsockname", 0, ijPipeGetSockPeerName, 0),
     JS_CFUNC_MAGIC_DEF("getpeername", 0, ijPipeGetSockPeerName, 1),
     JS_CFUNC_DEF("connect", 1, ijPipeConnect),
@@ -756,6 +2125,10 @@ static const JSCFunctionListEntry ijjs_pipe_proto_funcs[] = {
     JS_PROP_STRING_DEF("[Symbol.toStringTag]", "Pipe", JS_PROP_CONFIGURABLE),
 };
 
+static const JSCFunctionListEntry ijjs_streams_funcs[] = {
+    JS_CFUNC_DEF("pipe", 3, ijStreamPipe),
+};
+
 IJVoid ijModStreamsInit(JSContext *ctx, JSModuleDef *m) {
     JSValue proto, obj;
     JS_NewClassID(&ijjs_tcp_class_id);
@@ -781,10 +2154,12 @@ IJVoid ijModStreamsInit(JSContext *ctx, JSModuleDef *m) {
     JS_SetClassProto(ctx, ijjs_pipe_class_id, proto);
     obj = JS_NewCFunction2(ctx, ijPipeConstructor, "Pipe", 1, JS_CFUNC_constructor, 0);
     JS_SetModuleExport(ctx, m, "Pipe", obj);
+    JS_SetModuleExportList(ctx, m, ijjs_streams_funcs, countof(ijjs_streams_funcs));
 }
 
 IJVoid ijModStreamsExport(JSContext *ctx, JSModuleDef *m) {
     JS_AddModuleExport(ctx, m, "TCP");
     JS_AddModuleExport(ctx, m, "TTY");
     JS_AddModuleExport(ctx, m, "Pipe");
+    JS_AddModuleExportList(ctx, m, ijjs_streams_funcs, countof(ijjs_streams_funcs));
 }
@@ -24,6 +24,7 @@
 
 typedef struct {
     JSContext* ctx;
+    struct list_head link;
     uv_timer_t handle;
     IJS32 interval;
     JSValue obj;
@@ -34,6 +35,8 @@ typedef struct {
 
 static IJVoid ijClearTimer(IJJSTimer* th) {
     JSContext* ctx = th->ctx;
+    if (th->link.next)
+        list_del(&th->link);
     JS_FreeValue(ctx, th->func);
     th->func = JS_UNDEFINED;
     for (IJS32 i = 0; i < th->argc; i++) {
@@ -122,6 +125,7 @@ static JSValue ijSetTimeout(JSContext* ctx, JSValueConst this_val, IJS32 argc, J
     for (IJS32 i = 0; i < nargs; i++)
         th->argv[i] = JS_DupValue(ctx, argv[i + 2]);
     CHECK_EQ(uv_timer_start(&th->handle, uvTimerCb, delay, magic ? delay : 0 /* repeat */), 0);
+    list_add_tail(&th->link, &ijGetRuntime(ctx)->timers);
     JS_SetOpaque(obj, th);
     return obj;
 }
@@ -143,6 +147,16 @@ static const JSCFunctionListEntry ijjs_timer_funcs[] = {
     JS_PROP_STRING_DEF("[Symbol.toStringTag]", "Timer", JS_PROP_CONFIGURABLE),
 };
 
+// A stopped runtime (e.g. a terminated worker) can still have timers armed,
+// release what they hold so the runtime can be freed.
+IJVoid ijTimersClose(IJJSRuntime* qrt) {
+    while (!list_empty(&qrt->timers)) {
+        IJJSTimer* th = list_entry(qrt->timers.next, IJJSTimer, link);
+        CHECK_EQ(uv_timer_stop(&th->handle), 0);
+        ijClearTimer(th);
+    }
+}
+
 IJVoid ijModTimersInit(JSContext* ctx, JSModuleDef* m) {
     JS_NewClassID(&ijjs_timer_class_id);
     JS_NewClass(JS_GetRuntime(ctx), ijjs_timer_class_id, &ijjs_timer_class);
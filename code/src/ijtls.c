@@ -0,0 +1,837 @@
+/*
+ ijjs javascript runtime engine
+ Copyright (C) 2010-2017 Trix
+
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include "ijjs.h"
+#include <mbedtls/ssl.h>
+#include <mbedtls/ssl_internal.h>
+#include <mbedtls/ssl_cache.h>
+#include <mbedtls/ssl_ticket.h>
+#include <mbedtls/entropy.h>
+#include <mbedtls/ctr_drbg.h>
+#include <mbedtls/error.h>
+
+#define IJJS_TLS_SESSION_SLOTS 16
+#define IJJS_TLS_MAX_ALPN 8
+
+typedef struct {
+    IJAnsi* key;
+    mbedtls_ssl_session session;
+    IJU64 stamp;
+} IJJSTlsSession;
+
+typedef struct {
+    JSRuntime* rt;
+    IJS32 refs;
+    IJBool server;
+    IJBool verify;
+    IJBool cache_sessions;
+    mbedtls_ssl_config conf;
+    mbedtls_entropy_context entropy;
+    mbedtls_ctr_drbg_context drbg;
+    mbedtls_x509_crt crt;
+    mbedtls_x509_crt ca;
+    mbedtls_pk_context key;
+    mbedtls_ssl_cache_context cache;
+    mbedtls_ssl_ticket_context ticket;
+    IJAnsi* alpn[IJJS_TLS_MAX_ALPN + 1];
+    IJJSTlsSession sessions[IJJS_TLS_SESSION_SLOTS];
+    IJU64 clock;
+    IJU64 handshakes;
+    IJU64 resumed;
+} IJJSTlsContext;
+
+typedef struct {
+    IJJSStreamOwner owner;
+    JSContext* ctx;
+    IJJSTlsContext* tc;
+    JSValue sock_obj;
+    uv_stream_t* stream;
+    mbedtls_ssl_context ssl;
+    IJAnsi* session_key;
+    DynBuf in;
+    size_t in_pos;
+    DynBuf out;
+    IJS32 error;
+    IJBool attached;
+    IJBool reading;
+    IJBool eof;
+    IJBool established;
+    IJBool resumed;
+    IJBool peer_closed;
+    struct {
+        IJJSPromise result;
+    } handshake;
+    struct {
+        IJJSPromise result;
+    } read;
+} IJJSTls;
+
+typedef struct {
+    uv_write_t req;
+    JSContext* ctx;
+    IJJSPromise result;
+    IJU8* data;
+} IJJSTlsWriteReq;
+
+static const mbedtls_ecp_group_id ijjs_tls_curves[] = {
+    MBEDTLS_ECP_DP_SECP256R1,
+    MBEDTLS_ECP_DP_SECP384R1,
+    MBEDTLS_ECP_DP_NONE,
+};
+
+static JSClassID ijjs_tls_context_class_id;
+static JSClassID ijjs_tls_class_id;
+
+static IJVoid ijTlsContextUnref(IJJSTlsContext* tc) {
+    if (--tc->refs > 0)
+        return;
+    for (IJS32 i = 0; i < IJJS_TLS_SESSION_SLOTS; i++) {
+        js_free_rt(tc->rt, tc->sessions[i].key);
+        mbedtls_ssl_session_free(&tc->sessions[i].session);
+    }
+    for (IJS32 i = 0; tc->alpn[i]; i++)
+        js_free_rt(tc->rt, tc->alpn[i]);
+    mbedtls_ssl_ticket_free(&tc->ticket);
+    mbedtls_ssl_cache_free(&tc->cache);
+    mbedtls_ssl_config_free(&tc->conf);
+    mbedtls_pk_free(&tc->key);
+    mbedtls_x509_crt_free(&tc->ca);
+    mbedtls_x509_crt_free(&tc->crt);
+    mbedtls_ctr_drbg_free(&tc->drbg);
+    mbedtls_entropy_free(&tc->entropy);
+    js_free_rt(tc->rt, tc);
+}
+
+static JSValue ijTlsNewError(JSContext* ctx, IJS32 ret) {
+    IJAnsi msg[256];
+    mbedtls_strerror(ret, msg, sizeof(msg));
+    JSValue obj = JS_NewError(ctx);
+    JS_DefinePropertyValueStr(ctx, obj, "message", JS_NewString(ctx, msg), JS_PROP_WRITABLE | JS_PROP_CONFIGURABLE);
+    JS_DefinePropertyValueStr(ctx, obj, "code", JS_NewInt32(ctx, ret), JS_PROP_WRITABLE | JS_PROP_CONFIGURABLE);
+    return obj;
+}
+
+static JSValue ijTlsConnError(IJJSTls* t, IJS32 ret) {
+    if (t->error)
+        return ijNewError(t->ctx, t->error);
+    if (ret == MBEDTLS_ERR_SSL_CONN_EOF || ret == MBEDTLS_ERR_SSL_WANT_READ)
+        return ijNewError(t->ctx, UV_ECONNRESET);
+    return ijTlsNewError(t->ctx, ret);
+}
+
+static IJVoid ijTlsSettle(JSContext* ctx, IJJSPromise* p, IJBool is_reject, JSValue arg) {
+    ijSettlePromise(ctx, p, is_reject, 1, (JSValueConst*)&arg);
+    ijClearPromise(ctx, p);
+}
+
+static IJS32 ijTlsSend(IJVoid* opaque, const IJU8* buf, size_t len) {
+    IJJSTls* t = opaque;
+    if (dbuf_put(&t->out, buf, len))
+        return MBEDTLS_ERR_SSL_ALLOC_FAILED;
+    return (IJS32)len;
+}
+
+static IJS32 ijTlsRecv(IJVoid* opaque, IJU8* buf, size_t len) {
+    IJJSTls* t = opaque;
+    size_t avail = t->in.size - t->in_pos;
+    if (avail == 0)
+        return t->eof ? 0 : MBEDTLS_ERR_SSL_WANT_READ;
+    if (len > avail)
+        len = avail;
+    memcpy(buf, t->in.buf + t->in_pos, len);
+    t->in_pos += len;
+    return (IJS32)len;
+}
+
+static IJVoid uvTlsWriteCb(uv_write_t* req, IJS32 status) {
+    IJJSTlsWriteReq* wr = req->data;
+    JSContext* ctx = wr->ctx;
+    if (ijIsPromisePending(ctx, &wr->result)) {
+        IJS32 is_reject = 0;
+        JSValue arg;
+        if (status < 0) {
+            arg = ijNewError(ctx, status);
+            is_reject = 1;
+        } else {
+            arg = JS_UNDEFINED;
+        }
+        ijSettlePromise(ctx, &wr->result, is_reject, 1, (JSValueConst*)&arg);
+    }
+    js_free(ctx, wr->data);
+    js_free(ctx, wr);
+}
+
+static IJS32 ijTlsFlush(IJJSTls* t, JSValue* promise) {
+    JSContext* ctx = t->ctx;
+    if (t->out.size == 0 && !promise)
+        return 0;
+    if (!t->attached)
+        return UV_EBADF;
+    IJJSTlsWriteReq* wr = js_malloc(ctx, sizeof(*wr));
+    if (!wr)
+        return UV_ENOMEM;
+    wr->req.data = wr;
+    wr->ctx = ctx;
+    wr->data = t->out.buf;
+    uv_buf_t b = uv_buf_init((IJAnsi*)t->out.buf, t->out.size);
+    dbuf_init2(&t->out, JS_GetRuntime(ctx), (DynBufReallocFunc*)js_realloc_rt);
+    IJS32 r = uv_write(&wr->req, t->stream, &b, 1, uvTlsWriteCb);
+    if (r != 0) {
+        js_free(ctx, wr->data);
+        js_free(ctx, wr);
+        return r;
+    }
+    if (promise)
+        *promise = ijInitPromise(ctx, &wr->result);
+    else
+        ijClearPromise(ctx, &wr->result);
+    return 0;
+}
+
+static IJJSTlsSession* ijTlsFindSession(IJJSTlsContext* tc, const IJAnsi* key) {
+    for (IJS32 i = 0; i < IJJS_TLS_SESSION_SLOTS; i++) {
+        if (tc->sessions[i].key && strcmp(tc->sessions[i].key, key) == 0)
+            return &tc->sessions[i];
+    }
+    return NULL;
+}
+
+static IJVoid ijTlsSaveSession(IJJSTls* t) {
+    IJJSTlsContext* tc = t->tc;
+    if (!t->session_key || !tc->cache_sessions)
+        return;
+    IJJSTlsSession* slot = ijTlsFindSession(tc, t->session_key);
+    if (!slot) {
+        slot = &tc->sessions[0];
+        for (IJS32 i = 1; i < IJJS_TLS_SESSION_SLOTS && slot->key; i++) {
+            if (!tc->sessions[i].key || tc->sessions[i].stamp < slot->stamp)
+                slot = &tc->sessions[i];
+        }
+        js_free_rt(tc->rt, slot->key);
+        slot->key = NULL;
+    }
+    mbedtls_ssl_session_free(&slot->session);
+    mbedtls_ssl_session_init(&slot->session);
+    if (mbedtls_ssl_get_session(&t->ssl, &slot->session) != 0) {
+        js_free_rt(tc->rt, slot->key);
+        slot->key = NULL;
+        return;
+    }
+    if (!slot->key)
+        slot->key = js_strdup(t->ctx, t->session_key);
+    slot->stamp = ++tc->clock;
+}
+
+static IJVoid ijTlsDoHandshake(IJJSTls* t) {
+    JSContext* ctx = t->ctx;
+    IJS32 r = 0;
+    if (t->established) {
+        ijTlsSettle(ctx, &t->handshake.result, false, JS_UNDEFINED);
+        return;
+    }
+    while (t->ssl.state != MBEDTLS_SSL_HANDSHAKE_OVER) {
+        if (t->ssl.handshake)
+            t->resumed = t->ssl.handshake->resume != 0;
+        r = mbedtls_ssl_handshake_step(&t->ssl);
+        if (r != 0)
+            break;
+    }
+    IJS32 w = ijTlsFlush(t, NULL);
+    if (w != 0 && !t->error)
+        t->error = w;
+    if (r == MBEDTLS_ERR_SSL_WANT_READ && !t->eof && w == 0)
+        return;
+    if (r == 0 && w == 0) {
+        t->established = true;
+        t->tc->handshakes++;
+        if (t->resumed)
+            t->tc->resumed++;
+        if (!t->tc->server)
+            ijTlsSaveSession(t);
+        ijTlsSettle(ctx, &t->handshake.result, false, JS_UNDEFINED);
+    } else {
+        ijTlsSettle(ctx, &t->handshake.result, true, ijTlsConnError(t, r));
+    }
+}
+
+static IJVoid ijTlsDoRead(IJJSTls* t) {
+    JSContext* ctx = t->ctx;
+    IJU8* buf = ijReadBufAlloc(ctx, IJJS_DEFAULt_READ_SIZE);
+    if (!buf) {
+        ijTlsSettle(ctx, &t->read.result, true, ijNewError(ctx, UV_ENOMEM));
+        return;
+    }
+    IJS32 r = mbedtls_ssl_read(&t->ssl, buf, IJJS_DEFAULt_READ_SIZE);
+    ijTlsFlush(t, NULL);
+    if (r > 0) {
+        ijTlsSettle(ctx, &t->read.result, false, ijNewReadBuffer(ctx, buf, IJJS_DEFAULt_READ_SIZE, r));
+        return;
+    }
+    ijReadBufFree(ctx, buf, IJJS_DEFAULt_READ_SIZE);
+    if (r == MBEDTLS_ERR_SSL_WANT_READ && !t->eof)
+        return;
+    if (r == 0 || r == MBEDTLS_ERR_SSL_PEER_CLOSE_NOTIFY) {
+        t->peer_closed = true;
+        ijTlsSettle(ctx, &t->read.result, false, JS_UNDEFINED);
+    } else {
+        ijTlsSettle(ctx, &t->read.result, true, ijTlsConnError(t, r));
+    }
+}
+
+static IJVoid uvTlsAllocCb(uv_handle_t* handle, size_t suggested_size, uv_buf_t* buf) {
+    IJJSTls* t = (IJJSTls*)ijStreamGetOwner((uv_stream_t*)handle);
+    CHECK_NOT_NULL(t);
+    if (t->in_pos == t->in.size) {
+        t->in.size = 0;
+        t->in_pos = 0;
+    } else if (t->in_pos >= t->in.size / 2) {
+        memmove(t->in.buf, t->in.buf + t->in_pos, t->in.size - t->in_pos);
+        t->in.size -= t->in_pos;
+        t->in_pos = 0;
+    }
+    if (t->in.allocated_size - t->in.size < IJJS_DEFAULt_READ_SIZE / 4 &&
+        dbuf_realloc(&t->in, t->in.size + IJJS_DEFAULt_READ_SIZE)) {
+        buf->base = NULL;
+        buf->len = 0;
+        return;
+    }
+    buf->base = (IJAnsi*)t->in.buf + t->in.size;
+    buf->len = t->in.allocated_size - t->in.size;
+}
+
+static IJVoid ijTlsProcess(IJJSTls* t);
+
+static IJVoid uvTlsReadCb(uv_stream_t* handle, ssize_t nread, const uv_buf_t* buf) {
+    IJJSTls* t = (IJJSTls*)ijStreamGetOwner(handle);
+    CHECK_NOT_NULL(t);
+    if (nread < 0) {
+        t->eof = true;
+        if (nread != UV_EOF)
+            t->error = (IJS32)nread;
+    } else {
+        t->in.size += nread;
+    }
+    ijTlsProcess(t);
+}
+
+static IJVoid ijTlsUpdateReading(IJJSTls* t) {
+    JSContext* ctx = t->ctx;
+    IJBool want = t->attached && !t->eof &&
+                  (ijIsPromisePending(ctx, &t->handshake.result) || ijIsPromisePending(ctx, &t->read.result));
+    if (want && !t->reading) {
+        if (uv_read_start(t->stream, uvTlsAllocCb, uvTlsReadCb) == 0)
+            t->reading = true;
+    } else if (!want && t->reading) {
+        uv_read_stop(t->stream);
+        t->reading = false;
+    }
+}
+
+static IJVoid ijTlsProcess(IJJSTls* t) {
+    JSContext* ctx = t->ctx;
+    if (ijIsPromisePending(ctx, &t->handshake.result))
+        ijTlsDoHandshake(t);
+    if (t->established && ijIsPromisePending(ctx, &t->read.result))
+        ijTlsDoRead(t);
+    ijTlsUpdateReading(t);
+}
+
+static IJVoid ijTlsStreamClosed(IJJSStreamOwner* owner) {
+    IJJSTls* t = (IJJSTls*)owner;
+    JSContext* ctx = t->ctx;
+    t->attached = false;
+    t->reading = false;
+    if (ijIsPromisePending(ctx, &t->handshake.result))
+        ijTlsSettle(ctx, &t->handshake.result, true, ijNewError(ctx, UV_ECANCELED));
+    if (ijIsPromisePending(ctx, &t->read.result))
+        ijTlsSettle(ctx, &t->read.result, false, JS_UNDEFINED);
+}
+
+static IJVoid ijTlsFinalizer(JSRuntime* rt, JSValue val) {
+    IJJSTls* t = JS_GetOpaque(val, ijjs_tls_class_id);
+    if (t) {
+        if (t->attached)
+            ijStreamRelease(t->stream, &t->owner);
+        ijFreePromiseRT(rt, &t->handshake.result);
+        ijFreePromiseRT(rt, &t->read.result);
+        mbedtls_ssl_free(&t->ssl);
+        dbuf_free(&t->in);
+        dbuf_free(&t->out);
+        js_free_rt(rt, t->session_key);
+        JS_FreeValueRT(rt, t->sock_obj);
+        ijTlsContextUnref(t->tc);
+        js_free_rt(rt, t);
+    }
+}
+
+static IJVoid ijTlsMark(JSRuntime* rt, JSValueConst val, JS_MarkFunc* mark_func) {
+    IJJSTls* t = JS_GetOpaque(val, ijjs_tls_class_id);
+    if (t) {
+        JS_MarkValue(rt, t->sock_obj, mark_func);
+        ijMarkPromise(rt, &t->handshake.result, mark_func);
+        ijMarkPromise(rt, &t->read.result, mark_func);
+    }
+}
+
+static JSClassDef ijjs_tls_class = { "TLS", .finalizer = ijTlsFinalizer, .gc_mark = ijTlsMark };
+
+static IJJSTls* ijTlsGet(JSContext* ctx, JSValueConst obj) {
+    return JS_GetOpaque2(ctx, obj, ijjs_tls_class_id);
+}
+
+static JSValue ijTlsHandshake(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJJSTls* t = ijTlsGet(ctx, this_val);
+    if (!t)
+        return JS_EXCEPTION;
+    if (ijIsPromisePending(ctx, &t->handshake.result))
+        return ijThrowErrno(ctx, UV_EBUSY);
+    if (!t->attached)
+        return ijThrowErrno(ctx, UV_EBADF);
+    JSValue promise = ijInitPromise(ctx, &t->handshake.result);
+    ijTlsProcess(t);
+    return promise;
+}
+
+static JSValue ijTlsRead(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJJSTls* t = ijTlsGet(ctx, this_val);
+    if (!t)
+        return JS_EXCEPTION;
+    if (ijIsPromisePending(ctx, &t->read.result))
+        return ijThrowErrno(ctx, UV_EBUSY);
+    if (!t->established)
+        return ijThrowErrno(ctx, UV_ENOTCONN);
+    JSValue promise = ijInitPromise(ctx, &t->read.result);
+    if (t->peer_closed || !t->attached)
+        ijTlsSettle(ctx, &t->read.result, false, JS_UNDEFINED);
+    else
+        ijTlsProcess(t);
+    return promise;
+}
+
+static JSValue ijTlsWrite(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJJSTls* t = ijTlsGet(ctx, this_val);
+    if (!t)
+        return JS_EXCEPTION;
+    if (!t->established)
+        return ijThrowErrno(ctx, UV_ENOTCONN);
+    if (!t->attached)
+        return ijThrowErrno(ctx, UV_EBADF);
+    uv_buf_t b;
+    IJJSWriteBuf pin;
+    if (ijStreamGetData(ctx, argv[0], &b, &pin))
+        return JS_EXCEPTION;
+    size_t off = 0;
+    IJS32 r = 0;
+    while (off < b.len) {
+        r = mbedtls_ssl_write(&t->ssl, (const IJU8*)b.base + off, b.len - off);
+        if (r < 0)
+            break;
+        off += r;
+    }
+    ijStreamReleaseBufs(ctx, &pin, 1);
+    if (r < 0)
+        return JS_Throw(ctx, ijTlsNewError(ctx, r));
+    JSValue promise;
+    r = ijTlsFlush(t, &promise);
+    if (r != 0)
+        return ijThrowErrno(ctx, r);
+    return promise;
+}
+
+static JSValue ijTlsCallSocket(JSContext* ctx, IJJSTls* t, const IJAnsi* name) {
+    JSValue func = JS_GetPropertyStr(ctx, t->sock_obj, name);
+    if (JS_IsException(func))
+        return func;
+    JSValue ret = JS_Call(ctx, func, t->sock_obj, 0, NULL);
+    JS_FreeValue(ctx, func);
+    return ret;
+}
+
+static JSValue ijTlsShutdown(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJJSTls* t = ijTlsGet(ctx, this_val);
+    if (!t)
+        return JS_EXCEPTION;
+    if (!t->attached)
+        return ijThrowErrno(ctx, UV_EBADF);
+    if (t->established) {
+        IJS32 r = mbedtls_ssl_close_notify(&t->ssl);
+        if (r < 0)
+            return JS_Throw(ctx, ijTlsNewError(ctx, r));
+    }
+    IJS32 r = ijTlsFlush(t, NULL);
+    if (r != 0)
+        return ijThrowErrno(ctx, r);
+    return ijTlsCallSocket(ctx, t, "shutdown");
+}
+
+static JSValue ijTlsClose(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJJSTls* t = ijTlsGet(ctx, this_val);
+    if (!t)
+        return JS_EXCEPTION;
+    return ijTlsCallSocket(ctx, t, "close");
+}
+
+static JSValue ijTlsGetAlpnProtocol(JSContext* ctx, JSValueConst this_val) {
+    IJJSTls* t = ijTlsGet(ctx, this_val);
+    if (!t)
+        return JS_EXCEPTION;
+    const IJAnsi* proto = t->established ? mbedtls_ssl_get_alpn_protocol(&t->ssl) : NULL;
+    return proto ? JS_NewString(ctx, proto) : JS_UNDEFINED;
+}
+
+static JSValue ijTlsGetCipher(JSContext* ctx, JSValueConst this_val) {
+    IJJSTls* t = ijTlsGet(ctx, this_val);
+    if (!t)
+        return JS_EXCEPTION;
+    return t->established ? JS_NewString(ctx, mbedtls_ssl_get_ciphersuite(&t->ssl)) : JS_UNDEFINED;
+}
+
+static JSValue ijTlsGetSessionReused(JSContext* ctx, JSValueConst this_val) {
+    IJJSTls* t = ijTlsGet(ctx, this_val);
+    if (!t)
+        return JS_EXCEPTION;
+    return JS_NewBool(ctx, t->established && t->resumed);
+}
+
+static IJVoid ijTlsContextFinalizer(JSRuntime* rt, JSValue val) {
+    IJJSTlsContext* tc = JS_GetOpaque(val, ijjs_tls_context_class_id);
+    if (tc)
+        ijTlsContextUnref(tc);
+}
+
+static JSClassDef ijjs_tls_context_class = { "TLSContext", .finalizer = ijTlsContextFinalizer };
+
+static IJJSTlsContext* ijTlsContextGet(JSContext* ctx, JSValueConst obj) {
+    return JS_GetOpaque2(ctx, obj, ijjs_tls_context_class_id);
+}
+
+static IJS32 ijTlsGetBool(JSContext* ctx, JSValueConst opts, const IJAnsi* name, IJBool def, IJBool* out) {
+    *out = def;
+    if (!JS_IsObject(opts))
+        return 0;
+    JSValue v = JS_GetPropertyStr(ctx, opts, name);
+    if (JS_IsException(v))
+        return -1;
+    if (!JS_IsUndefined(v))
+        *out = JS_ToBool(ctx, v);
+    JS_FreeValue(ctx, v);
+    return 0;
+}
+
+static IJS32 ijTlsGetUint(JSContext* ctx, JSValueConst opts, const IJAnsi* name, IJU32* out) {
+    if (!JS_IsObject(opts))
+        return 0;
+    JSValue v = JS_GetPropertyStr(ctx, opts, name);
+    if (JS_IsException(v))
+        return -1;
+    IJS32 r = JS_IsUndefined(v) ? 0 : JS_ToUint32(ctx, out, v);
+    JS_FreeValue(ctx, v);
+    return r;
+}
+
+static const IJAnsi* ijTlsGetString(JSContext* ctx, JSValueConst opts, const IJAnsi* name, size_t* len, IJBool* failed) {
+    *failed = false;
+    if (!JS_IsObject(opts))
+        return NULL;
+    JSValue v = JS_GetPropertyStr(ctx, opts, name);
+    const IJAnsi* s = NULL;
+    if (JS_IsException(v)) {
+        *failed = true;
+    } else if (JS_IsString(v)) {
+        s = JS_ToCStringLen(ctx, len, v);
+        *failed = !s;
+    } else if (!JS_IsUndefined(v)) {
+        JS_ThrowTypeError(ctx, "%s must be a string", name);
+        *failed = true;
+    }
+    JS_FreeValue(ctx, v);
+    return s;
+}
+
+static IJS32 ijTlsLoadPem(JSContext* ctx, IJJSTlsContext* tc, JSValueConst opts, const IJAnsi* name, IJBool* found) {
+    size_t len;
+    IJBool failed;
+    const IJAnsi* pem = ijTlsGetString(ctx, opts, name, &len, &failed);
+    *found = pem != NULL;
+    if (failed)
+        return -1;
+    if (!pem)
+        return 0;
+    IJS32 r;
+    if (strcmp(name, "key") == 0)
+        r = mbedtls_pk_parse_key(&tc->key, (const IJU8*)pem, len + 1, NULL, 0);
+    else
+        r = mbedtls_x509_crt_parse(strcmp(name, "ca") == 0 ? &tc->ca : &tc->crt, (const IJU8*)pem, len + 1);
+    JS_FreeCString(ctx, pem);
+    if (r != 0) {
+        JS_Throw(ctx, ijTlsNewError(ctx, r));
+        return -1;
+    }
+    return 0;
+}
+
+static IJS32 ijTlsLoadAlpn(JSContext* ctx, IJJSTlsContext* tc, JSValueConst opts) {
+    if (!JS_IsObject(opts))
+        return 0;
+    JSValue v = JS_GetPropertyStr(ctx, opts, "alpn");
+    if (JS_IsException(v))
+        return -1;
+    if (JS_IsUndefined(v))
+        return 0;
+    IJS32 r = -1;
+    IJU32 n;
+    JSValue jslen = JS_GetPropertyStr(ctx, v, "length");
+    if (!JS_IsArray(ctx, v) || JS_ToUint32(ctx, &n, jslen) || n > IJJS_TLS_MAX_ALPN) {
+        JS_ThrowTypeError(ctx, "alpn must be an array of at most %d strings", IJJS_TLS_MAX_ALPN);
+        goto done;
+    }
+    for (IJU32 i = 0; i < n; i++) {
+        JSValue item = JS_GetPropertyUint32(ctx, v, i);
+        const IJAnsi* s = JS_ToCString(ctx, item);
+        JS_FreeValue(ctx, item);
+        if (!s)
+            goto done;
+        tc->alpn[i] = js_strdup(ctx, s);
+        JS_FreeCString(ctx, s);
+        if (!tc->alpn[i])
+            goto done;
+    }
+    if (n > 0 && mbedtls_ssl_conf_alpn_protocols(&tc->conf, (const IJAnsi**)tc->alpn) != 0) {
+        JS_ThrowRangeError(ctx, "invalid alpn protocol");
+        goto done;
+    }
+    r = 0;
+done:
+    JS_FreeValue(ctx, jslen);
+    JS_FreeValue(ctx, v);
+    return r;
+}
+
+static JSValue ijTlsContextConstructor(JSContext* ctx, JSValueConst new_target, IJS32 argc, JSValueConst* argv) {
+    JSValueConst opts = argv[0];
+    IJJSTlsContext* tc = js_mallocz(ctx, sizeof(*tc));
+    if (!tc)
+        return JS_EXCEPTION;
+    tc->rt = JS_GetRuntime(ctx);
+    tc->refs = 1;
+    mbedtls_ssl_config_init(&tc->conf);
+    mbedtls_entropy_init(&tc->entropy);
+    mbedtls_ctr_drbg_init(&tc->drbg);
+    mbedtls_x509_crt_init(&tc->crt);
+    mbedtls_x509_crt_init(&tc->ca);
+    mbedtls_pk_init(&tc->key);
+    mbedtls_ssl_cache_init(&tc->cache);
+    mbedtls_ssl_ticket_init(&tc->ticket);
+    for (IJS32 i = 0; i < IJJS_TLS_SESSION_SLOTS; i++)
+        mbedtls_ssl_session_init(&tc->sessions[i].session);
+    JSValue obj = JS_NewObjectClass(ctx, ijjs_tls_context_class_id);
+    if (JS_IsException(obj)) {
+        ijTlsContextUnref(tc);
+        return obj;
+    }
+    JS_SetOpaque(obj, tc);
+    IJBool verify, tickets, cache, has_cert, has_key, has_ca;
+    IJU32 cache_size = MBEDTLS_SSL_CACHE_DEFAULT_MAX_ENTRIES;
+    IJU32 lifetime = 86400;
+    if (ijTlsGetBool(ctx, opts, "server", false, &tc->server) ||
+        ijTlsGetBool(ctx, opts, "verify", !tc->server, &verify) ||
+        ijTlsGetBool(ctx, opts, "tickets", true, &tickets) ||
+        ijTlsGetBool(ctx, opts, "cache", true, &cache) ||
+        ijTlsGetUint(ctx, opts, "cacheSize", &cache_size) ||
+        ijTlsGetUint(ctx, opts, "ticketLifetime", &lifetime))
+        goto fail;
+    IJS32 r = mbedtls_ctr_drbg_seed(&tc->drbg, mbedtls_entropy_func, &tc->entropy, (const IJU8*)"ijjs", 4);
+    if (r == 0)
+        r = mbedtls_ssl_config_defaults(&tc->conf, tc->server ? MBEDTLS_SSL_IS_SERVER : MBEDTLS_SSL_IS_CLIENT,
+                                        MBEDTLS_SSL_TRANSPORT_STREAM, MBEDTLS_SSL_PRESET_DEFAULT);
+    if (r != 0) {
+        JS_Throw(ctx, ijTlsNewError(ctx, r));
+        goto fail;
+    }
+    mbedtls_ssl_conf_rng(&tc->conf, mbedtls_ctr_drbg_random, &tc->drbg);
+    mbedtls_ssl_conf_min_version(&tc->conf, MBEDTLS_SSL_MAJOR_VERSION_3, MBEDTLS_SSL_MINOR_VERSION_3);
+    mbedtls_ssl_conf_curves(&tc->conf, ijjs_tls_curves);
+    tc->verify = verify;
+    mbedtls_ssl_conf_authmode(&tc->conf, verify ? MBEDTLS_SSL_VERIFY_REQUIRED : MBEDTLS_SSL_VERIFY_NONE);
+    if (ijTlsLoadPem(ctx, tc, opts, "cert", &has_cert) ||
+        ijTlsLoadPem(ctx, tc, opts, "key", &has_key) ||
+        ijTlsLoadPem(ctx, tc, opts, "ca", &has_ca) ||
+        ijTlsLoadAlpn(ctx, tc, opts))
+        goto fail;
+    if (has_cert != has_key || (tc->server && !has_cert)) {
+        JS_ThrowTypeError(ctx, tc->server ? "a server context needs a cert and a key" : "cert and key go together");
+        goto fail;
+    }
+    if (has_cert && (r = mbedtls_ssl_conf_own_cert(&tc->conf, &tc->crt, &tc->key)) != 0) {
+        JS_Throw(ctx, ijTlsNewError(ctx, r));
+        goto fail;
+    }
+    if (has_ca)
+        mbedtls_ssl_conf_ca_chain(&tc->conf, &tc->ca, NULL);
+    if (tc->server) {
+        if (cache) {
+            mbedtls_ssl_cache_set_max_entries(&tc->cache, (IJS32)cache_size);
+            mbedtls_ssl_cache_set_timeout(&tc->cache, (IJS32)lifetime);
+            mbedtls_ssl_conf_session_cache(&tc->conf, &tc->cache, mbedtls_ssl_cache_get, mbedtls_ssl_cache_set);
+        }
+        if (tickets) {
+            r = mbedtls_ssl_ticket_setup(&tc->ticket, mbedtls_ctr_drbg_random, &tc->drbg, MBEDTLS_CIPHER_AES_256_GCM, lifetime);
+            if (r != 0) {
+                JS_Throw(ctx, ijTlsNewError(ctx, r));
+                goto fail;
+            }
+            mbedtls_ssl_conf_session_tickets_cb(&tc->conf, mbedtls_ssl_ticket_write, mbedtls_ssl_ticket_parse, &tc->ticket);
+        }
+    } else {
+        tc->cache_sessions = cache;
+        mbedtls_ssl_conf_session_tickets(&tc->conf, tickets ? MBEDTLS_SSL_SESSION_TICKETS_ENABLED : MBEDTLS_SSL_SESSION_TICKETS_DISABLED);
+    }
+    return obj;
+fail:
+    JS_FreeValue(ctx, obj);
+    return JS_EXCEPTION;
+}
+
+static IJAnsi* ijTlsPeerKey(JSContext* ctx, uv_stream_t* stream) {
+    if (stream->type != UV_TCP)
+        return NULL;
+    struct sockaddr_storage addr;
+    IJS32 namelen = sizeof(addr);
+    if (uv_tcp_getpeername((uv_tcp_t*)stream, (struct sockaddr*)&addr, &namelen) != 0)
+        return NULL;
+    IJAnsi ip[INET6_ADDRSTRLEN];
+    IJAnsi key[INET6_ADDRSTRLEN + 8];
+    if (addr.ss_family == AF_INET6) {
+        struct sockaddr_in6* a6 = (struct sockaddr_in6*)&addr;
+        uv_ip6_name(a6, ip, sizeof(ip));
+        snprintf(key, sizeof(key), "[%s]:%d", ip, ntohs(a6->sin6_port));
+    } else {
+        struct sockaddr_in* a4 = (struct sockaddr_in*)&addr;
+        uv_ip4_name(a4, ip, sizeof(ip));
+        snprintf(key, sizeof(key), "%s:%d", ip, ntohs(a4->sin_port));
+    }
+    return js_strdup(ctx, key);
+}
+
+static JSValue ijTlsContextWrap(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJJSTlsContext* tc = ijTlsContextGet(ctx, this_val);
+    if (!tc)
+        return JS_EXCEPTION;
+    size_t len;
+    IJBool failed;
+    const IJAnsi* servername = ijTlsGetString(ctx, argv[1], "servername", &len, &failed);
+    if (failed)
+        return JS_EXCEPTION;
+    // Without a name the chain is verified but not who it belongs to.
+    if (!servername && tc->verify && !tc->server)
+        return JS_ThrowTypeError(ctx, "servername is required when verifying the peer");
+    JSValue obj = JS_NewObjectClass(ctx, ijjs_tls_class_id);
+    IJJSTls* t = JS_IsException(obj) ? NULL : js_mallocz(ctx, sizeof(*t));
+    if (!t) {
+        JS_FreeCString(ctx, servername);
+        JS_FreeValue(ctx, obj);
+        return JS_EXCEPTION;
+    }
+    t->owner.closed = ijTlsStreamClosed;
+    t->ctx = ctx;
+    t->tc = tc;
+    tc->refs++;
+    t->sock_obj = JS_UNDEFINED;
+    mbedtls_ssl_init(&t->ssl);
+    dbuf_init2(&t->in, JS_GetRuntime(ctx), (DynBufReallocFunc*)js_realloc_rt);
+    dbuf_init2(&t->out, JS_GetRuntime(ctx), (DynBufReallocFunc*)js_realloc_rt);
+    ijClearPromise(ctx, &t->handshake.result);
+    ijClearPromise(ctx, &t->read.result);
+    JS_SetOpaque(obj, t);
+    IJS32 r = mbedtls_ssl_setup(&t->ssl, &tc->conf);
+    if (r == 0 && servername && !tc->server)
+        r = mbedtls_ssl_set_hostname(&t->ssl, servername);
+    if (r != 0) {
+        JS_FreeCString(ctx, servername);
+        JS_FreeValue(ctx, obj);
+        return JS_Throw(ctx, ijTlsNewError(ctx, r));
+    }
+    mbedtls_ssl_set_bio(&t->ssl, t, ijTlsSend, ijTlsRecv, NULL);
+    t->stream = ijStreamAcquire(ctx, argv[0], &t->owner);
+    if (!t->stream) {
+        JS_FreeCString(ctx, servername);
+        JS_FreeValue(ctx, obj);
+        return JS_EXCEPTION;
+    }
+    t->attached = true;
+    t->sock_obj = JS_DupValue(ctx, argv[0]);
+    if (!tc->server && tc->cache_sessions) {
+        t->session_key = servername ? js_strdup(ctx, servername) : ijTlsPeerKey(ctx, t->stream);
+        IJJSTlsSession* slot = t->session_key ? ijTlsFindSession(tc, t->session_key) : NULL;
+        if (slot)
+            mbedtls_ssl_set_session(&t->ssl, &slot->session);
+    }
+    JS_FreeCString(ctx, servername);
+    return obj;
+}
+
+static JSValue ijTlsContextStats(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJJSTlsContext* tc = ijTlsContextGet(ctx, this_val);
+    if (!tc)
+        return JS_EXCEPTION;
+    JSValue obj = JS_NewObjectProto(ctx, JS_NULL);
+    JS_DefinePropertyValueStr(ctx, obj, "handshakes", JS_NewInt64(ctx, tc->handshakes), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "resumed", JS_NewInt64(ctx, tc->resumed), JS_PROP_C_W_E);
+    return obj;
+}
+
+static const JSCFunctionListEntry ijjs_tls_context_proto_funcs[] = {
+    JS_CFUNC_DEF("wrap", 2, ijTlsContextWrap),
+    JS_CFUNC_DEF("stats", 0, ijTlsContextStats),
+    JS_PROP_STRING_DEF("[Symbol.toStringTag]", "TLSContext", JS_PROP_CONFIGURABLE),
+};
+
+static const JSCFunctionListEntry ijjs_tls_proto_funcs[] = {
+    JS_CFUNC_DEF("handshake", 0, ijTlsHandshake),
+    JS_CFUNC_DEF("read", 0, ijTlsRead),
+    JS_CFUNC_DEF("write", 1, ijTlsWrite),
+    JS_CFUNC_DEF("shutdown", 0, ijTlsShutdown),
+    JS_CFUNC_DEF("close", 0, ijTlsClose),
+    JS_CGETSET_DEF("alpnProtocol", ijTlsGetAlpnProtocol, NULL),
+    JS_CGETSET_DEF("cipher", ijTlsGetCipher, NULL),
+    JS_CGETSET_DEF("sessionReused", ijTlsGetSessionReused, NULL),
+    JS_PROP_STRING_DEF("[Symbol.toStringTag]", "TLS", JS_PROP_CONFIGURABLE),
+};
+
+IJVoid ijModTlsInit(JSContext* ctx, JSModuleDef* m) {
+    JSValue proto, obj;
+    JS_NewClassID(&ijjs_tls_class_id);
+    JS_NewClass(JS_GetRuntime(ctx), ijjs_tls_class_id, &ijjs_tls_class);
+    proto = JS_NewObject(ctx);
+    JS_SetPropertyFunctionList(ctx, proto, ijjs_tls_proto_funcs, countof(ijjs_tls_proto_funcs));
+    JS_SetClassProto(ctx, ijjs_tls_class_id, proto);
+    JS_NewClassID(&ijjs_tls_context_class_id);
+    JS_NewClass(JS_GetRuntime(ctx), ijjs_tls_context_class_id, &ijjs_tls_context_class);
+    proto = JS_NewObject(ctx);
+    JS_SetPropertyFunctionList(ctx, proto, ijjs_tls_context_proto_funcs, countof(ijjs_tls_context_proto_funcs));
+    JS_SetClassProto(ctx, ijjs_tls_context_class_id, proto);
+    obj = JS_NewCFunction2(ctx, ijTlsContextConstructor, "TLSContext", 1, JS_CFUNC_constructor, 0);
+    JS_SetModuleExport(ctx, m, "TLSContext", obj);
+}
+
+IJVoid ijModTlsExport(JSContext* ctx, JSModuleDef* m) {
+    JS_AddModuleExport(ctx, m, "TLSContext");
+}
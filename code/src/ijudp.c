@@ -36,7 +36,7 @@ typedef struct {
 typedef struct {
     uv_udp_send_t req;
     IJJSPromise result;
-    size_t size;
+    IJJSWriteBuf pin;
 } IJJSSendReq;
 
 static JSClassID ijjs_udp_class_id;
@@ -96,7 +96,7 @@ static JSValue ijUdpClose(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSV
 static IJVoid uvUdpAllocCb(uv_handle_t* handle, size_t suggested_size, uv_buf_t* buf) {
     IJJSUdp* u = handle->data;
     CHECK_NOT_NULL(u);
-    buf->base = js_malloc(u->ctx, u->read.size);
+    buf->base = (IJAnsi*)ijReadBufAlloc(u->ctx, u->read.size);
     buf->len = u->read.size;
 }
 
@@ -104,7 +104,7 @@ static IJVoid uvUdpRecvCb(uv_udp_t* handle, ssize_t nread, const uv_buf_t* buf,
     IJJSUdp* u = handle->data;
     CHECK_NOT_NULL(u);
     if (nread == 0 && addr == NULL) {
-        js_free(u->ctx, buf->base);
+        ijReadBufFree(u->ctx, (IJU8*)buf->base, buf->len);
         return;
     }
     uv_udp_recv_stop(handle);
@@ -114,10 +114,10 @@ static IJVoid uvUdpRecvCb(uv_udp_t* handle, ssize_t nread, const uv_buf_t* buf,
     if (nread < 0) {
         arg = ijNewError(ctx, nread);
         is_reject = 1;
-        js_free(ctx, buf->base);
+        ijReadBufFree(ctx, (IJU8*)buf->base, buf->len);
     } else {
         arg = JS_NewObjectProto(ctx, JS_NULL);
-        JS_DefinePropertyValueStr(ctx, arg, "data", ijNewUint8Array(ctx, (IJU8*)buf->base, nread), JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, arg, "data", ijNewReadBuffer(ctx, (IJU8*)buf->base, buf->len, nread), JS_PROP_C_W_E);
         JS_DefinePropertyValueStr(ctx, arg, "flags", JS_NewInt32(ctx, flags), JS_PROP_C_W_E);
         JS_DefinePropertyValueStr(ctx, arg, "addr", ijAddr2Obj(ctx, addr), JS_PROP_C_W_E);
     }
@@ -155,6 +155,7 @@ static IJVoid uvUdpSendCb(uv_udp_send_t* req, IJS32 status) {
         arg = JS_UNDEFINED;
     }
     ijSettlePromise(ctx, &sr->result, is_reject, 1, (JSValueConst*)&arg);
+    ijStreamReleaseBufs(ctx, &sr->pin, 1);
     js_free(ctx, sr);
 }
 
@@ -162,63 +163,50 @@ static JSValue ijUdpSend(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSVa
     IJJSUdp* u = ijUdpGet(ctx, this_val);
     if (!u)
         return JS_EXCEPTION;
-    JSValue jsData = argv[0];
-    IJBool is_string = false;
-    size_t size;
-    IJAnsi* buf;
-    if (JS_IsString(jsData)) {
-        is_string = true;
-        buf = (IJAnsi*) JS_ToCStringLen(ctx, &size, jsData);
-        if (!buf)
-            return JS_EXCEPTION;
-    } else {
-        size_t aoffset, asize;
-        JSValue abuf = JS_GetTypedArrayBuffer(ctx, jsData, &aoffset, &asize, NULL);
-        if (JS_IsException(abuf))
-            return JS_EXCEPTION;
-        buf = (IJAnsi*) JS_GetArrayBuffer(ctx, &size, abuf);
-        JS_FreeValue(ctx, abuf);
-        if (!buf)
-            return JS_EXCEPTION;
-        buf += aoffset;
-        size = asize;
-    }
+    uv_buf_t b;
+    IJJSWriteBuf pin;
+    if (ijStreamGetData(ctx, argv[0], &b, &pin))
+        return JS_EXCEPTION;
     struct sockaddr_storage ss;
     struct sockaddr* sa = NULL;
     IJS32 r;
     if (!JS_IsUndefined(argv[1])) {
         r = ijObj2Addr(ctx, argv[1], &ss);
-        if (r != 0)
+        if (r != 0) {
+            ijStreamReleaseBufs(ctx, &pin, 1);
             return JS_EXCEPTION;
+        }
         sa = (struct sockaddr*) &ss;
     }
-    uv_buf_t b;
-    b = uv_buf_init(buf, size);
     r = uv_udp_try_send(&u->udp, &b, 1, sa);
-    if (r == size) {
-        if (is_string)
-            JS_FreeCString(ctx, buf);
+    if (r == b.len) {
+        ijStreamReleaseBufs(ctx, &pin, 1);
         return ijNewResolvedPromise(ctx, 0, NULL);
     }
-    if (r >= 0) {
-        buf += r;
-        size -= r;
-    }
     IJJSSendReq* sr = js_malloc(ctx, sizeof(*sr));
-    if (!sr)
+    if (!sr) {
+        ijStreamReleaseBufs(ctx, &pin, 1);
         return JS_EXCEPTION;
+    }
     sr->req.data = sr;
-    if (is_string)
-        JS_FreeCString(ctx, buf);
-    b = uv_buf_init(buf, size);
+    // the pin keeps the buffer in place until the kernel has the datagram
+    sr->pin = pin;
     r = uv_udp_send(&sr->req, &u->udp, &b, 1, sa, uvUdpSendCb);
     if (r != 0) {
+        ijStreamReleaseBufs(ctx, &sr->pin, 1);
         js_free(ctx, sr);
         return ijThrowErrno(ctx, r);
     }
     return ijInitPromise(ctx, &sr->result);
 }
 
+static JSValue ijUdpSendQueueSizeGet(JSContext* ctx, JSValueConst this_val) {
+    IJJSUdp* u = ijUdpGet(ctx, this_val);
+    if (!u)
+        return JS_EXCEPTION;
+    return JS_NewInt64(ctx, uv_udp_get_send_queue_size(&u->udp));
+}
+
 static JSValue ijUdpFileno(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
     IJJSUdp* u = ijUdpGet(ctx, this_val);
     if (!u)
@@ -330,6 +318,7 @@ static const JSCFunctionListEntry ijjs_udp_proto_funcs[] = {
     JS_CFUNC_MAGIC_DEF("getpeername", 0, ijUdpGetSockPeerName, 1),
     JS_CFUNC_DEF("connect", 1, ijUdpConnect),
     JS_CFUNC_DEF("bind", 2, ijUdpBind),
+    JS_CGETSET_DEF("sendQueueSize", ijUdpSendQueueSizeGet, NULL),
     JS_PROP_STRING_DEF("[Symbol.toStringTag]", "UDP", JS_PROP_CONFIGURABLE),
 };
 
@@ -0,0 +1,597 @@
+/*
+ ijjs javascript runtime engine
+ Copyright (C) 2010-2017 Trix
+
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include "ijjs.h"
+#if IJJS_PLATFORM == IJJS_PLATFORM_LINUX
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <limits.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/sysmacros.h>
+#include <sys/uio.h>
+#endif
+
+#if IJJS_PLATFORM == IJJS_PLATFORM_LINUX && defined(__NR_io_uring_setup)
+
+#define IJJS_URING_ENTRIES 256
+
+typedef struct {
+    IJS64 tv_sec;
+    IJU32 tv_nsec;
+    IJS32 reserved;
+} IJJSStatxTime;
+
+typedef struct {
+    IJU32 stx_mask;
+    IJU32 stx_blksize;
+    IJU64 stx_attributes;
+    IJU32 stx_nlink;
+    IJU32 stx_uid;
+    IJU32 stx_gid;
+    IJU16 stx_mode;
+    IJU16 spare0;
+    IJU64 stx_ino;
+    IJU64 stx_size;
+    IJU64 stx_blocks;
+    IJU64 stx_attributes_mask;
+    IJJSStatxTime stx_atime;
+    IJJSStatxTime stx_btime;
+    IJJSStatxTime stx_ctime;
+    IJJSStatxTime stx_mtime;
+    IJU32 stx_rdev_major;
+    IJU32 stx_rdev_minor;
+    IJU32 stx_dev_major;
+    IJU32 stx_dev_minor;
+    IJU64 spare[14];
+} IJJSStatx;
+
+typedef struct IJJSUring {
+    IJS32 fd;
+    IJS32 efd;
+    uv_poll_t poll;
+    uv_prepare_t flush;
+    uv_idle_t retry;
+    IJS32 closing;
+    IJBool cur_pos;
+    IJU32 entries;
+    IJU32 cq_entries;
+    IJU32 queued;
+    IJU32 unsubmitted;
+    IJU32* sq_head;
+    IJU32* sq_tail;
+    IJU32* sq_mask;
+    IJU32* sq_array;
+    IJU32* cq_head;
+    IJU32* cq_tail;
+    IJU32* cq_mask;
+    struct io_uring_sqe* sqes;
+    struct io_uring_cqe* cqes;
+    IJVoid* sq_ring;
+    size_t sq_ring_len;
+    IJVoid* cq_ring;
+    size_t cq_ring_len;
+    size_t sqes_len;
+} IJJSUring;
+
+typedef struct {
+    uv_fs_t* req;
+    uv_fs_cb cb;
+    IJAnsi* path;
+    IJJSStatx stx;
+    struct iovec iov[];
+} IJJSUringOp;
+
+static IJS32 ijUringSetup(IJU32 entries, struct io_uring_params* p) {
+    return syscall(__NR_io_uring_setup, entries, p);
+}
+
+static IJS32 ijUringEnter(IJS32 fd, IJU32 to_submit) {
+    return syscall(__NR_io_uring_enter, fd, to_submit, 0, 0, NULL, 0);
+}
+
+static IJS32 ijUringRegister(IJS32 fd, IJU32 opcode, const IJVoid* arg, IJU32 nr_args) {
+    return syscall(__NR_io_uring_register, fd, opcode, arg, nr_args);
+}
+
+static IJBool ijUringProbe(IJS32 fd) {
+    static const IJU8 needed[] = {
+        IORING_OP_OPENAT, IORING_OP_CLOSE, IORING_OP_READV, IORING_OP_WRITEV, IORING_OP_STATX, IORING_OP_FSYNC
+    };
+    size_t len = sizeof(struct io_uring_probe) + 256 * sizeof(struct io_uring_probe_op);
+    struct io_uring_probe* probe = je_calloc(1, len);
+    if (!probe)
+        return false;
+    IJBool ok = ijUringRegister(fd, IORING_REGISTER_PROBE, probe, 256) == 0;
+    for (size_t i = 0; ok && i < countof(needed); i++)
+        ok = needed[i] <= probe->last_op && (probe->ops[needed[i]].flags & IO_URING_OP_SUPPORTED);
+    je_free(probe);
+    return ok;
+}
+
+static IJVoid ijUringUnmap(IJJSUring* u) {
+    if (u->sqes)
+        munmap(u->sqes, u->sqes_len);
+    if (u->cq_ring && u->cq_ring != u->sq_ring)
+        munmap(u->cq_ring, u->cq_ring_len);
+    if (u->sq_ring)
+        munmap(u->sq_ring, u->sq_ring_len);
+}
+
+static IJS32 ijUringMap(IJJSUring* u, struct io_uring_params* p) {
+    u->sq_ring_len = p->sq_off.array + p->sq_entries * sizeof(IJU32);
+    u->cq_ring_len = p->cq_off.cqes + p->cq_entries * sizeof(struct io_uring_cqe);
+    if (p->features & IORING_FEAT_SINGLE_MMAP) {
+        if (u->cq_ring_len > u->sq_ring_len)
+            u->sq_ring_len = u->cq_ring_len;
+        u->cq_ring_len = u->sq_ring_len;
+    }
+    u->sq_ring = mmap(NULL, u->sq_ring_len, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, u->fd, IORING_OFF_SQ_RING);
+    if (u->sq_ring == MAP_FAILED) {
+        u->sq_ring = NULL;
+        return -1;
+    }
+    if (p->features & IORING_FEAT_SINGLE_MMAP) {
+        u->cq_ring = u->sq_ring;
+    } else {
+        u->cq_ring = mmap(NULL, u->cq_ring_len, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, u->fd, IORING_OFF_CQ_RING);
+        if (u->cq_ring == MAP_FAILED) {
+            u->cq_ring = NULL;
+            return -1;
+        }
+    }
+    u->sqes_len = p->sq_entries * sizeof(struct io_uring_sqe);
+    u->sqes = mmap(NULL, u->sqes_len, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, u->fd, IORING_OFF_SQES);
+    if (u->sqes == MAP_FAILED) {
+        u->sqes = NULL;
+        return -1;
+    }
+    IJU8* sq = u->sq_ring;
+    IJU8* cq = u->cq_ring;
+    u->sq_head = (IJU32*)(sq + p->sq_off.head);
+    u->sq_tail = (IJU32*)(sq + p->sq_off.tail);
+    u->sq_mask = (IJU32*)(sq + p->sq_off.ring_mask);
+    u->sq_array = (IJU32*)(sq + p->sq_off.array);
+    u->cq_head = (IJU32*)(cq + p->cq_off.head);
+    u->cq_tail = (IJU32*)(cq + p->cq_off.tail);
+    u->cq_mask = (IJU32*)(cq + p->cq_off.ring_mask);
+    u->cqes = (struct io_uring_cqe*)(cq + p->cq_off.cqes);
+    u->entries = p->sq_entries;
+    u->cq_entries = p->cq_entries;
+    return 0;
+}
+
+static IJVoid uvUringRetryCb(uv_idle_t* handle) {
+    // Only here so the loop polls instead of blocking and the flush
+    // prepare handle gets to submit again.
+}
+
+static IJS32 ijUringSubmit(IJJSUring* u) {
+    IJS32 err = 0;
+    while (u->unsubmitted > 0) {
+        IJS32 r = ijUringEnter(u->fd, u->unsubmitted);
+        if (r < 0) {
+            if (errno == EINTR)
+                continue;
+            err = -errno;
+            break;
+        }
+        u->unsubmitted -= r;
+        if (r == 0)
+            break;
+    }
+    if (u->unsubmitted == 0) {
+        uv_prepare_stop(&u->flush);
+        uv_idle_stop(&u->retry);
+    } else if (u->queued == u->unsubmitted) {
+        // No completion is in flight to wake the loop for the retry.
+        uv_idle_start(&u->retry, uvUringRetryCb);
+    }
+    return err;
+}
+
+static IJVoid ijUringComplete(IJJSUringOp* op, IJS32 res);
+
+static IJVoid ijUringFailUnsubmitted(IJJSUring* u, IJS32 err) {
+    IJJSUringOp* ops[IJJS_URING_ENTRIES];
+    IJU32 n = u->unsubmitted;
+    IJU32 tail = *u->sq_tail - n;
+    // The kernel only reads the tail on enter, so the entries can be taken back.
+    for (IJU32 i = 0; i < n; i++)
+        ops[i] = (IJJSUringOp*)(uintptr_t)u->sqes[(tail + i) & *u->sq_mask].user_data;
+    __atomic_store_n(u->sq_tail, tail, __ATOMIC_RELEASE);
+    u->unsubmitted = 0;
+    uv_prepare_stop(&u->flush);
+    uv_idle_stop(&u->retry);
+    for (IJU32 i = 0; i < n; i++) {
+        if (--u->queued == 0)
+            uv_unref((uv_handle_t*)&u->poll);
+        ijUringComplete(ops[i], err);
+    }
+}
+
+static IJVoid ijUringStatConvert(IJJSStatx* stx, uv_stat_t* st) {
+    st->st_dev = makedev(stx->stx_dev_major, stx->stx_dev_minor);
+    st->st_mode = stx->stx_mode;
+    st->st_nlink = stx->stx_nlink;
+    st->st_uid = stx->stx_uid;
+    st->st_gid = stx->stx_gid;
+    st->st_rdev = makedev(stx->stx_rdev_major, stx->stx_rdev_minor);
+    st->st_ino = stx->stx_ino;
+    st->st_size = stx->stx_size;
+    st->st_blksize = stx->stx_blksize;
+    st->st_blocks = stx->stx_blocks;
+    st->st_flags = 0;
+    st->st_gen = 0;
+    st->st_atim.tv_sec = stx->stx_atime.tv_sec;
+    st->st_atim.tv_nsec = stx->stx_atime.tv_nsec;
+    st->st_mtim.tv_sec = stx->stx_mtime.tv_sec;
+    st->st_mtim.tv_nsec = stx->stx_mtime.tv_nsec;
+    st->st_ctim.tv_sec = stx->stx_ctime.tv_sec;
+    st->st_ctim.tv_nsec = stx->stx_ctime.tv_nsec;
+    st->st_birthtim.tv_sec = stx->stx_btime.tv_sec;
+    st->st_birthtim.tv_nsec = stx->stx_btime.tv_nsec;
+}
+
+static IJVoid ijUringComplete(IJJSUringOp* op, IJS32 res) {
+    uv_fs_t* req = op->req;
+    req->result = res;
+    if (res >= 0) {
+        switch (req->fs_type) {
+            case UV_FS_STAT:
+            case UV_FS_LSTAT:
+            case UV_FS_FSTAT:
+                ijUringStatConvert(&op->stx, &req->statbuf);
+                req->ptr = &req->statbuf;
+                req->result = 0;
+                break;
+            case UV_FS_OPEN:
+                req->path = op->path;
+                break;
+            default:
+                break;
+        }
+    }
+    op->cb(req);
+    je_free(op);
+}
+
+static IJVoid uvUringPollCb(uv_poll_t* handle, IJS32 status, IJS32 events) {
+    IJJSUring* u = handle->data;
+    IJU64 n;
+    while (read(u->efd, &n, sizeof(n)) < 0 && errno == EINTR)
+        ;
+    IJU32 head = *u->cq_head;
+    for (;;) {
+        IJU32 tail = __atomic_load_n(u->cq_tail, __ATOMIC_ACQUIRE);
+        if (head == tail)
+            break;
+        struct io_uring_cqe* cqe = &u->cqes[head & *u->cq_mask];
+        IJJSUringOp* op = (IJJSUringOp*)(uintptr_t)cqe->user_data;
+        IJS32 res = cqe->res;
+        __atomic_store_n(u->cq_head, ++head, __ATOMIC_RELEASE);
+        if (--u->queued == 0)
+            uv_unref((uv_handle_t*)&u->poll);
+        ijUringComplete(op, res);
+        head = *u->cq_head;
+    }
+}
+
+static IJVoid uvUringFlushCb(uv_prepare_t* handle) {
+    IJJSUring* u = handle->data;
+    IJS32 err = ijUringSubmit(u);
+    // EAGAIN and EBUSY clear up once memory or completions are released.
+    if (err < 0 && err != -EAGAIN && err != -EBUSY)
+        ijUringFailUnsubmitted(u, uv_translate_sys_error(-err));
+}
+
+static IJVoid uvUringCloseCb(uv_handle_t* handle) {
+    IJJSUring* u = handle->data;
+    if (--u->closing > 0)
+        return;
+    ijUringUnmap(u);
+    close(u->efd);
+    close(u->fd);
+    je_free(u);
+}
+
+IJVoid ijUringInit(IJJSRuntime* qrt) {
+    struct io_uring_params p;
+    IJJSUring* u = je_calloc(1, sizeof(*u));
+    if (!u)
+        return;
+    memset(&p, 0, sizeof(p));
+    u->efd = -1;
+    u->fd = ijUringSetup(IJJS_URING_ENTRIES, &p);
+    if (u->fd < 0)
+        goto fail;
+    if (!(p.features & IORING_FEAT_NODROP) || !ijUringProbe(u->fd) || ijUringMap(u, &p) != 0)
+        goto fail;
+    u->cur_pos = (p.features & IORING_FEAT_RW_CUR_POS) != 0;
+    u->efd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (u->efd < 0 || ijUringRegister(u->fd, IORING_REGISTER_EVENTFD, &u->efd, 1) != 0)
+        goto fail;
+    if (uv_poll_init(&qrt->loop, &u->poll, u->efd) != 0)
+        goto fail;
+    u->poll.data = u;
+    CHECK_EQ(uv_prepare_init(&qrt->loop, &u->flush), 0);
+    u->flush.data = u;
+    uv_unref((uv_handle_t*)&u->flush);
+    CHECK_EQ(uv_idle_init(&qrt->loop, &u->retry), 0);
+    u->retry.data = u;
+    uv_unref((uv_handle_t*)&u->retry);
+    CHECK_EQ(uv_poll_start(&u->poll, UV_READABLE, uvUringPollCb), 0);
+    uv_unref((uv_handle_t*)&u->poll);
+    qrt->uring = u;
+    return;
+fail:
+    ijUringUnmap(u);
+    if (u->efd >= 0)
+        close(u->efd);
+    if (u->fd >= 0)
+        close(u->fd);
+    je_free(u);
+}
+
+IJVoid ijUringFree(IJJSRuntime* qrt) {
+    IJJSUring* u = qrt->uring;
+    if (!u)
+        return;
+    qrt->uring = NULL;
+    u->closing = 3;
+    uv_close((uv_handle_t*)&u->flush, uvUringCloseCb);
+    uv_close((uv_handle_t*)&u->retry, uvUringCloseCb);
+    uv_close((uv_handle_t*)&u->poll, uvUringCloseCb);
+}
+
+static IJJSUring* ijUringGet(JSContext* ctx) {
+    IJJSUring* u = ijGetRuntime(ctx)->uring;
+    if (!u || u->queued >= u->cq_entries)
+        return NULL;
+    if (*u->sq_tail - __atomic_load_n(u->sq_head, __ATOMIC_ACQUIRE) >= u->entries) {
+        ijUringSubmit(u);
+        if (*u->sq_tail - __atomic_load_n(u->sq_head, __ATOMIC_ACQUIRE) >= u->entries)
+            return NULL;
+    }
+    return u;
+}
+
+static IJJSUringOp* ijUringOpNew(uv_loop_t* loop, uv_fs_t* req, uv_fs_type type, uv_fs_cb cb, size_t extra) {
+    IJJSUringOp* op = je_malloc(sizeof(*op) + extra);
+    if (!op)
+        return NULL;
+    op->req = req;
+    op->cb = cb;
+    op->path = NULL;
+    req->type = UV_FS;
+    req->fs_type = type;
+    req->loop = loop;
+    req->cb = NULL;
+    req->result = 0;
+    req->ptr = NULL;
+    req->path = NULL;
+    req->new_path = NULL;
+    req->bufs = NULL;
+    return op;
+}
+
+static IJVoid ijUringQueue(IJJSUring* u, IJJSUringOp* op, struct io_uring_sqe* src) {
+    IJU32 tail = *u->sq_tail;
+    IJU32 idx = tail & *u->sq_mask;
+    struct io_uring_sqe* sqe = &u->sqes[idx];
+    memcpy(sqe, src, sizeof(*sqe));
+    sqe->user_data = (IJU64)(uintptr_t)op;
+    u->sq_array[idx] = idx;
+    __atomic_store_n(u->sq_tail, tail + 1, __ATOMIC_RELEASE);
+    if (u->queued++ == 0)
+        uv_ref((uv_handle_t*)&u->poll);
+    if (u->unsubmitted++ == 0)
+        uv_prepare_start(&u->flush, uvUringFlushCb);
+}
+
+static IJS32 ijUringRw(JSContext* ctx, uv_fs_t* req, uv_file fd, const uv_buf_t bufs[], IJU32 nbufs, IJS64 off, uv_fs_cb cb, IJBool write) {
+    IJJSUring* u = ijUringGet(ctx);
+    if (!u || (off < 0 && !u->cur_pos) || nbufs > IOV_MAX)
+        return UV_ENOSYS;
+    IJJSUringOp* op = ijUringOpNew(ijGetLoop(ctx), req, write ? UV_FS_WRITE : UV_FS_READ, cb, nbufs * sizeof(struct iovec));
+    if (!op)
+        return UV_ENOMEM;
+    for (IJU32 i = 0; i < nbufs; i++) {
+        op->iov[i].iov_base = bufs[i].base;
+        op->iov[i].iov_len = bufs[i].len;
+    }
+    struct io_uring_sqe sqe;
+    memset(&sqe, 0, sizeof(sqe));
+    sqe.opcode = write ? IORING_OP_WRITEV : IORING_OP_READV;
+    sqe.fd = fd;
+    sqe.addr = (IJU64)(uintptr_t)op->iov;
+    sqe.len = nbufs;
+    sqe.off = off < 0 ? (IJU64)-1 : (IJU64)off;
+    ijUringQueue(u, op, &sqe);
+    return 0;
+}
+
+static IJS32 ijUringStatx(JSContext* ctx, uv_fs_t* req, uv_fs_type type, IJS32 dfd, const IJAnsi* path, IJS32 flags, uv_fs_cb cb) {
+    IJJSUring* u = ijUringGet(ctx);
+    if (!u)
+        return UV_ENOSYS;
+    size_t len = strlen(path) + 1;
+    IJJSUringOp* op = ijUringOpNew(ijGetLoop(ctx), req, type, cb, len);
+    if (!op)
+        return UV_ENOMEM;
+    op->path = (IJAnsi*)op->iov;
+    memcpy(op->path, path, len);
+    struct io_uring_sqe sqe;
+    memset(&sqe, 0, sizeof(sqe));
+    sqe.opcode = IORING_OP_STATX;
+    sqe.fd = dfd;
+    sqe.addr = (IJU64)(uintptr_t)op->path;
+    sqe.len = 0xfff;
+    sqe.off = (IJU64)(uintptr_t)&op->stx;
+    sqe.statx_flags = flags;
+    ijUringQueue(u, op, &sqe);
+    return 0;
+}
+
+static IJS32 ijUringFdOp(JSContext* ctx, uv_fs_t* req, uv_fs_type type, uv_file fd, IJU8 opcode, IJU32 flags, uv_fs_cb cb) {
+    IJJSUring* u = ijUringGet(ctx);
+    if (!u)
+        return UV_ENOSYS;
+    IJJSUringOp* op = ijUringOpNew(ijGetLoop(ctx), req, type, cb, 0);
+    if (!op)
+        return UV_ENOMEM;
+    struct io_uring_sqe sqe;
+    memset(&sqe, 0, sizeof(sqe));
+    sqe.opcode = opcode;
+    sqe.fd = fd;
+    sqe.fsync_flags = flags;
+    ijUringQueue(u, op, &sqe);
+    return 0;
+}
+
+const IJAnsi* ijUringEngine(JSContext* ctx) {
+    return ijGetRuntime(ctx)->uring ? "io_uring" : "threadpool";
+}
+
+IJBool ijUringSupported(IJVoid) {
+    struct io_uring_params p;
+    memset(&p, 0, sizeof(p));
+    IJS32 fd = ijUringSetup(IJJS_URING_ENTRIES, &p);
+    if (fd < 0)
+        return false;
+    IJBool ok = (p.features & IORING_FEAT_NODROP) && ijUringProbe(fd);
+    close(fd);
+    return ok;
+}
+
+IJS32 ijUringOpen(JSContext* ctx, uv_fs_t* req, const IJAnsi* path, IJS32 flags, IJS32 mode, uv_fs_cb cb) {
+    IJJSUring* u = ijUringGet(ctx);
+    if (!u)
+        return uv_fs_open(ijGetLoop(ctx), req, path, flags, mode, cb);
+    size_t len = strlen(path) + 1;
+    IJJSUringOp* op = ijUringOpNew(ijGetLoop(ctx), req, UV_FS_OPEN, cb, len);
+    if (!op)
+        return UV_ENOMEM;
+    op->path = (IJAnsi*)op->iov;
+    memcpy(op->path, path, len);
+    struct io_uring_sqe sqe;
+    memset(&sqe, 0, sizeof(sqe));
+    sqe.opcode = IORING_OP_OPENAT;
+    sqe.fd = AT_FDCWD;
+    sqe.addr = (IJU64)(uintptr_t)op->path;
+    sqe.len = mode;
+    sqe.open_flags = flags | O_CLOEXEC;
+    ijUringQueue(u, op, &sqe);
+    return 0;
+}
+
+IJS32 ijUringClose(JSContext* ctx, uv_fs_t* req, uv_file fd, uv_fs_cb cb) {
+    IJS32 r = ijUringFdOp(ctx, req, UV_FS_CLOSE, fd, IORING_OP_CLOSE, 0, cb);
+    return r == UV_ENOSYS ? uv_fs_close(ijGetLoop(ctx), req, fd, cb) : r;
+}
+
+IJS32 ijUringRead(JSContext* ctx, uv_fs_t* req, uv_file fd, const uv_buf_t bufs[], IJU32 nbufs, IJS64 off, uv_fs_cb cb) {
+    IJS32 r = ijUringRw(ctx, req, fd, bufs, nbufs, off, cb, false);
+    return r == UV_ENOSYS ? uv_fs_read(ijGetLoop(ctx), req, fd, bufs, nbufs, off, cb) : r;
+}
+
+IJS32 ijUringWrite(JSContext* ctx, uv_fs_t* req, uv_file fd, const uv_buf_t bufs[], IJU32 nbufs, IJS64 off, uv_fs_cb cb) {
+    IJS32 r = ijUringRw(ctx, req, fd, bufs, nbufs, off, cb, true);
+    return r == UV_ENOSYS ? uv_fs_write(ijGetLoop(ctx), req, fd, bufs, nbufs, off, cb) : r;
+}
+
+IJS32 ijUringStat(JSContext* ctx, uv_fs_t* req, const IJAnsi* path, uv_fs_cb cb) {
+    IJS32 r = ijUringStatx(ctx, req, UV_FS_STAT, AT_FDCWD, path, 0, cb);
+    return r == UV_ENOSYS ? uv_fs_stat(ijGetLoop(ctx), req, path, cb) : r;
+}
+
+IJS32 ijUringLstat(JSContext* ctx, uv_fs_t* req, const IJAnsi* path, uv_fs_cb cb) {
+    IJS32 r = ijUringStatx(ctx, req, UV_FS_LSTAT, AT_FDCWD, path, AT_SYMLINK_NOFOLLOW, cb);
+    return r == UV_ENOSYS ? uv_fs_lstat(ijGetLoop(ctx), req, path, cb) : r;
+}
+
+IJS32 ijUringFstat(JSContext* ctx, uv_fs_t* req, uv_file fd, uv_fs_cb cb) {
+    IJS32 r = ijUringStatx(ctx, req, UV_FS_FSTAT, fd, "", AT_EMPTY_PATH, cb);
+    return r == UV_ENOSYS ? uv_fs_fstat(ijGetLoop(ctx), req, fd, cb) : r;
+}
+
+IJS32 ijUringFsync(JSContext* ctx, uv_fs_t* req, uv_file fd, IJBool datasync, uv_fs_cb cb) {
+    uv_fs_type type = datasync ? UV_FS_FDATASYNC : UV_FS_FSYNC;
+    IJS32 r = ijUringFdOp(ctx, req, type, fd, IORING_OP_FSYNC, datasync ? IORING_FSYNC_DATASYNC : 0, cb);
+    if (r != UV_ENOSYS)
+        return r;
+    if (datasync)
+        return uv_fs_fdatasync(ijGetLoop(ctx), req, fd, cb);
+    return uv_fs_fsync(ijGetLoop(ctx), req, fd, cb);
+}
+
+#else
+
+IJVoid ijUringInit(IJJSRuntime* qrt) {
+}
+
+IJVoid ijUringFree(IJJSRuntime* qrt) {
+}
+
+const IJAnsi* ijUringEngine(JSContext* ctx) {
+    return "threadpool";
+}
+
+IJBool ijUringSupported(IJVoid) {
+    return false;
+}
+
+IJS32 ijUringOpen(JSContext* ctx, uv_fs_t* req, const IJAnsi* path, IJS32 flags, IJS32 mode, uv_fs_cb cb) {
+    return uv_fs_open(ijGetLoop(ctx), req, path, flags, mode, cb);
+}
+
+IJS32 ijUringClose(JSContext* ctx, uv_fs_t* req, uv_file fd, uv_fs_cb cb) {
+    return uv_fs_close(ijGetLoop(ctx), req, fd, cb);
+}
+
+IJS32 ijUringRead(JSContext* ctx, uv_fs_t* req, uv_file fd, const uv_buf_t bufs[], IJU32 nbufs, IJS64 off, uv_fs_cb cb) {
+    return uv_fs_read(ijGetLoop(ctx), req, fd, bufs, nbufs, off, cb);
+}
+
+IJS32 ijUringWrite(JSContext* ctx, uv_fs_t* req, uv_file fd, const uv_buf_t bufs[], IJU32 nbufs, IJS64 off, uv_fs_cb cb) {
+    return uv_fs_write(ijGetLoop(ctx), req, fd, bufs, nbufs, off, cb);
+}
+
+IJS32 ijUringStat(JSContext* ctx, uv_fs_t* req, const IJAnsi* path, uv_fs_cb cb) {
+    return uv_fs_stat(ijGetLoop(ctx), req, path, cb);
+}
+
+IJS32 ijUringLstat(JSContext* ctx, uv_fs_t* req, const IJAnsi* path, uv_fs_cb cb) {
+    return uv_fs_lstat(ijGetLoop(ctx), req, path, cb);
+}
+
+IJS32 ijUringFstat(JSContext* ctx, uv_fs_t* req, uv_file fd, uv_fs_cb cb) {
+    return uv_fs_fstat(ijGetLoop(ctx), req, fd, cb);
+}
+
+IJS32 ijUringFsync(JSContext* ctx, uv_fs_t* req, uv_file fd, IJBool datasync, uv_fs_cb cb) {
+    if (datasync)
+        return uv_fs_fdatasync(ijGetLoop(ctx), req, fd, cb);
+    return uv_fs_fsync(ijGetLoop(ctx), req, fd, cb);
+}
+
+#endif
@@ -207,6 +207,28 @@ IJVoid ijSettlePromise(JSContext* ctx, IJJSPromise* p, IJBool is_reject, IJS32 a
     ijFreePromise(ctx, p);
 }
 
+static JSValue ijSettleJob(JSContext* ctx, IJS32 argc, JSValueConst* argv) {
+    return JS_Call(ctx, argv[0], JS_UNDEFINED, argc - 1, argv + 1);
+}
+
+IJVoid ijSettlePromiseLater(JSContext* ctx, IJJSPromise* p, IJBool is_reject, IJS32 argc, JSValueConst* argv) {
+    /* the rejection tracker reports at reject time, so settling from a job lets a caller
+     * that has not received the promise yet attach its handler first */
+    JSValue args[3];
+    CHECK_LT(argc, 3);
+    if (!p->valid)
+        return;
+    args[0] = p->rfuncs[is_reject];
+    for (IJS32 i = 0; i < argc; i++)
+        args[i + 1] = argv[i];
+    CHECK_EQ(JS_EnqueueJob(ctx, ijSettleJob, argc + 1, (JSValueConst*)args), 0);
+    for (IJS32 i = 0; i < argc; i++)
+        JS_FreeValue(ctx, argv[i]);
+    JS_FreeValue(ctx, p->rfuncs[0]);
+    JS_FreeValue(ctx, p->rfuncs[1]);
+    ijFreePromise(ctx, p);
+}
+
 IJVoid ijResolvePromise(JSContext* ctx, IJJSPromise* p, IJS32 argc, JSValueConst* argv) {
     ijSettlePromise(ctx, p, false, argc, argv);
 }
@@ -234,7 +256,12 @@ JSValue ijNewResolvedPromise(JSContext* ctx, IJS32 argc, JSValueConst* argv) {
 }
 
 JSValue ijNewRejectedPromise(JSContext* ctx, IJS32 argc, JSValueConst* argv) {
-    return ijSettledPromise(ctx, true, argc, argv);
+    IJJSPromise p;
+    JSValue promise = ijInitPromise(ctx, &p);
+    if (JS_IsException(promise))
+        return JS_EXCEPTION;
+    ijSettlePromiseLater(ctx, &p, true, argc, argv);
+    return promise;
 }
 
 static IJVoid ijBufFree(JSRuntime* rt, IJVoid* opaque, IJVoid* ptr) {
@@ -252,6 +279,70 @@ JSValue ijNewUint8Array(JSContext* ctx, IJU8* data, size_t size) {
     return buf;
 }
 
+IJU8* ijReadBufAlloc(JSContext* ctx, size_t size) {
+    IJJSRuntime* qrt = ijGetRuntime(ctx);
+    CHECK_NOT_NULL(qrt);
+    if (size == IJJS_DEFAULt_READ_SIZE && qrt->pool.count > 0) {
+        qrt->pool.hits++;
+        return qrt->pool.slabs[--qrt->pool.count];
+    }
+    qrt->pool.misses++;
+    return js_malloc(ctx, size);
+}
+
+static IJVoid ijReadBufRelease(JSRuntime* rt, IJJSRuntime* qrt, IJU8* data, size_t size) {
+    if (!data)
+        return;
+    if (size == IJJS_DEFAULt_READ_SIZE && !qrt->pool.closed && qrt->pool.count < IJJS_READ_POOL_SLABS)
+        qrt->pool.slabs[qrt->pool.count++] = data;
+    else
+        js_free_rt(rt, data);
+}
+
+IJVoid ijReadBufFree(JSContext* ctx, IJU8* data, size_t size) {
+    IJJSRuntime* qrt = ijGetRuntime(ctx);
+    CHECK_NOT_NULL(qrt);
+    ijReadBufRelease(JS_GetRuntime(ctx), qrt, data, size);
+}
+
+IJU8* ijReadBufShrink(JSContext* ctx, IJU8* data, size_t size, size_t nread) {
+    if (nread > size / 2)
+        return data;
+    IJU8* copy = js_malloc(ctx, nread > 0 ? nread : 1);
+    if (!copy)
+        return data;
+    memcpy(copy, data, nread);
+    ijReadBufFree(ctx, data, size);
+    ijGetRuntime(ctx)->pool.copied++;
+    return copy;
+}
+
+static IJVoid ijPoolBufFree(JSRuntime* rt, IJVoid* opaque, IJVoid* ptr) {
+    IJJSRuntime* qrt = JS_GetRuntimeOpaque(rt);
+    CHECK_NOT_NULL(qrt);
+    ijReadBufRelease(rt, qrt, ptr, IJJS_DEFAULt_READ_SIZE);
+}
+
+JSValue ijNewReadBuffer(JSContext* ctx, IJU8* data, size_t size, size_t nread) {
+    IJU8* buf = ijReadBufShrink(ctx, data, size, nread);
+    if (buf != data || size != IJJS_DEFAULt_READ_SIZE)
+        return ijNewUint8Array(ctx, buf, nread);
+    ijGetRuntime(ctx)->pool.handed++;
+    JSValue abuf = JS_NewArrayBuffer(ctx, buf, nread, ijPoolBufFree, NULL, false);
+    if (JS_IsException(abuf))
+        return abuf;
+    IJJSRuntime* qrt = ijGetRuntime(ctx);
+    JSValue u8 = JS_CallConstructor(ctx, qrt->builtins.u8array_ctor, 1, &abuf);
+    JS_FreeValue(ctx, abuf);
+    return u8;
+}
+
+IJVoid ijReadBufPoolFree(IJJSRuntime* qrt) {
+    qrt->pool.closed = true;
+    while (qrt->pool.count > 0)
+        js_free_rt(qrt->rt, qrt->pool.slabs[--qrt->pool.count]);
+}
+
 static IJAnsi* je_strdup(IJAnsi* s)
 {
     IJAnsi* t = NULL;
@@ -21,6 +21,8 @@
 #include "ijjs.h"
 #include "jemalloc/jemalloc.h"
 #include <string.h>
+#include <stdatomic.h>
+#include <signal.h>
 #include <curl/curl.h>
 #if IJJS_PLATFORM == IJJS_PLATFORM_OSX
 #   include <malloc/malloc.h>
@@ -55,9 +57,13 @@ static IJS32 ijInit(JSContext* ctx, JSModuleDef* m) {
     ijModUdpInit(ctx, m);
     ijModWasmInit(ctx, m);
     ijModWorkerInit(ctx, m);
+    ijModChannelInit(ctx, m);
+    ijModPoolInit(ctx, m);
     ijModXhrInit(ctx, m);
     ijModLogInit(ctx, m);
     ijModKcpInit(ctx, m);
+    ijModHttpInit(ctx, m);
+    ijModTlsInit(ctx, m);
     return 0;
 }
 
@@ -78,9 +84,13 @@ JSModuleDef* ijInitModuleUV(JSContext* ctx, const IJAnsi* name) {
     ijModUdpExport(ctx, m);
     ijModWasmExport(ctx, m);
     ijModWorkerExport(ctx, m);
+    ijModChannelExport(ctx, m);
+    ijModPoolExport(ctx, m);
     ijModXhrExport(ctx, m);
     ijModLogExport(ctx, m);
     ijModKcpExport(ctx, m);
+    ijModHttpExport(ctx, m);
+    ijModTlsExport(ctx, m);
     return m;
 }
 
@@ -137,7 +147,9 @@ static IJVoid uvStop(uv_async_t* handle) {
 IJVoid ijDefaultOptions(IJJSRunOptions* options) {
     static IJJSRunOptions default_options = {
         .abort_on_unhandled_rejection = false,
-        .stack_size = IJJS_DEFAULT_STACK_SIZE
+        .stack_size = IJJS_DEFAULT_STACK_SIZE,
+        .io_uring = false,
+        .threads = { 0 }
     };
     memcpy(options, &default_options, sizeof(*options));
 }
@@ -210,6 +222,29 @@ static IJVoid* je_def_realloc(JSMallocState* s, void* ptr, size_t size)
     s->malloc_size += je_def_malloc_usable_size(ptr) - old_size;
     return ptr;
 }
+typedef struct {
+    atomic_int ref_count;
+    IJU64 buf[];
+} IJJSSharedBuffer;
+static IJVoid* ijSabAlloc(IJVoid* opaque, size_t size)
+{
+    IJJSSharedBuffer* sab = je_malloc(sizeof(*sab) + size);
+    if (!sab)
+        return NULL;
+    atomic_init(&sab->ref_count, 1);
+    return sab->buf;
+}
+IJVoid ijSabFree(IJVoid* opaque, IJVoid* ptr)
+{
+    IJJSSharedBuffer* sab = (IJJSSharedBuffer*)((IJU8*)ptr - offsetof(IJJSSharedBuffer, buf));
+    if (atomic_fetch_sub(&sab->ref_count, 1) == 1)
+        je_free(sab);
+}
+IJVoid ijSabDup(IJVoid* opaque, IJVoid* ptr)
+{
+    IJJSSharedBuffer* sab = (IJJSSharedBuffer*)((IJU8*)ptr - offsetof(IJJSSharedBuffer, buf));
+    atomic_fetch_add(&sab->ref_count, 1);
+}
 IJJSRuntime* ijNewRuntimeInternal(IJBool is_worker, IJJSRunOptions* options) {
     IJJSRuntime* qrt = je_calloc(1, sizeof(*qrt));
     memcpy(&qrt->options, options, sizeof(*options));
@@ -219,8 +254,16 @@ IJJSRuntime* ijNewRuntimeInternal(IJBool is_worker, IJJSRunOptions* options) {
         je_def_realloc,
         je_def_malloc_usable_size
     };
+    JSSharedArrayBufferFunctions sab_funcs = {
+        ijSabAlloc,
+        ijSabFree,
+        ijSabDup,
+        NULL
+    };
     qrt->rt = JS_NewRuntime2(&je_malloc_funcs, NULL);
     CHECK_NOT_NULL(qrt->rt);
+    JS_SetSharedArrayBufferFunctions(qrt->rt, &sab_funcs);
+    JS_SetCanBlock(qrt->rt, is_worker);
     qrt->ctx = JS_NewContext(qrt->rt);
     CHECK_NOT_NULL(qrt->ctx);
     JS_SetRuntimeOpaque(qrt->rt, qrt);
@@ -239,6 +282,19 @@ IJJSRuntime* ijNewRuntimeInternal(IJBool is_worker, IJJSRunOptions* options) {
     qrt->jobs.check.data = qrt;
     CHECK_EQ(uv_async_init(&qrt->loop, &qrt->stop, uvStop), 0);
     qrt->stop.data = qrt;
+    init_list_head(&qrt->timers);
+    if (!is_worker) {
+        ijExecConfigure(options->threads);
+#if IJJS_PLATFORM != IJJS_PLATFORM_WIN32
+        /* a write to a closed socket or worker channel reports EPIPE instead of killing the process */
+        struct sigaction sa;
+        if (sigaction(SIGPIPE, NULL, &sa) == 0 && sa.sa_handler == SIG_DFL)
+            signal(SIGPIPE, SIG_IGN);
+#endif
+    }
+    ijExecInit(qrt);
+    if (options->io_uring)
+        ijUringInit(qrt);
     JS_SetModuleLoaderFunc(qrt->rt, ijModuleNormalizer, ijModuleLoader, qrt);
     JS_SetHostPromiseRejectionTracker(qrt->rt, ijPromiseRejectionTracker, NULL);
     qrt->in_bootstrap = true;
@@ -259,7 +315,9 @@ IJVoid ijFreeRuntime(IJJSRuntime* qrt) {
     uv_close((uv_handle_t*)&qrt->jobs.idle, NULL);
     uv_close((uv_handle_t*)&qrt->jobs.check, NULL);
     uv_close((uv_handle_t*)&qrt->stop, NULL);
+    ijTimersClose(qrt);
     JS_FreeValue(qrt->ctx, qrt->builtins.u8array_ctor);
+    ijReadBufPoolFree(qrt);
     JS_FreeContext(qrt->ctx);
     JS_FreeRuntime(qrt->rt);
     if (qrt->curl_ctx.curlm_h) {
@@ -267,6 +325,8 @@ IJVoid ijFreeRuntime(IJJSRuntime* qrt) {
         uv_close((uv_handle_t*)&qrt->curl_ctx.timer, NULL);
     }
     m3_FreeEnvironment(qrt->wasm_ctx.env);
+    ijUringFree(qrt);
+    ijExecFree(qrt);
     IJS32 closed = 0;
     for (IJS32 i = 0; i < 5; i++) {
         if (uv_loop_close(&qrt->loop) == 0) {
@@ -280,6 +340,7 @@ IJVoid ijFreeRuntime(IJJSRuntime* qrt) {
         uv_print_all_handles(&qrt->loop, stderr);
 #endif
     CHECK_EQ(closed, 1);
+    uv_mutex_destroy(&qrt->exec.lock);
     je_free(qrt);
 }
 
@@ -364,19 +425,32 @@ IJS32 ijLoadFile(JSContext* ctx, DynBuf* dbuf, const IJAnsi* filename) {
     if (r < 0)
         return r;
     fd = r;
-    IJAnsi buf[64 * 1024];
-    uv_buf_t b = uv_buf_init(buf, sizeof(buf));
+    size_t hint = 0;
+    r = uv_fs_fstat(NULL, &req, fd, NULL);
+    if (r == 0 && (req.statbuf.st_mode & S_IFMT) == S_IFREG)
+        hint = req.statbuf.st_size;
+    uv_fs_req_cleanup(&req);
     size_t offset = 0;
     do {
+        size_t avail = dbuf->allocated_size - dbuf->size;
+        if (avail == 0) {
+            size_t want = dbuf->size + (offset < hint ? hint - offset + 1 : 64 * 1024);
+            if (dbuf_realloc(dbuf, want)) {
+                r = -1;
+                break;
+            }
+            avail = dbuf->allocated_size - dbuf->size;
+        }
+        uv_buf_t b = uv_buf_init((IJAnsi*)dbuf->buf + dbuf->size, avail > INT32_MAX ? INT32_MAX : (IJU32)avail);
         r = uv_fs_read(NULL, &req, fd, &b, 1, offset, NULL);
         uv_fs_req_cleanup(&req);
         if (r <= 0)
             break;
         offset += r;
-        r = dbuf_put(dbuf, (const IJU8*)b.base, r);
-        if (r != 0)
-            break;
+        dbuf->size += r;
     } while (1);
+    uv_fs_close(NULL, &req, fd, NULL);
+    uv_fs_req_cleanup(&req);
     return r;
 }
 
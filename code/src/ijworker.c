@@ -29,9 +29,28 @@ enum {
     WORKER_EVENT_MESSAGE = 0,
     WORKER_EVENT_MESSAGE_ERROR,
     WORKER_EVENT_ERROR,
+    WORKER_EVENT_HANDLE,
     WORKER_EVENT_MAX,
 };
 
+enum {
+    WORKER_FRAME_MESSAGE = 0,
+    WORKER_FRAME_HANDLE,
+    WORKER_FRAME_TRANSFER,
+};
+
+typedef struct {
+    IJU32 len;
+    IJU32 type;
+    IJU32 nshared;
+    IJU32 nports;
+} IJJSWorkerFrameHeader;
+
+typedef struct {
+    IJJSWorkerFrameHeader hdr;
+    IJJSMessage msg;
+} IJJSWorkerFrame;
+
 static JSValue ijNewWorker(JSContext* ctx, uv_os_sock_t channel_fd, IJBool is_main);
 
 static JSClassID ijjs_worker_class_id;
@@ -58,11 +77,24 @@ typedef struct {
     uv_thread_t tid;
     IJJSRuntime* wrt;
     IJBool is_main;
+    IJU8* rbuf;
+    size_t rlen;
+    size_t rcap;
+    IJBool rbuf_read;
+    IJJSWorkerFrame* outq;
+    IJU32 outq_len;
+    IJU32 outq_cap;
+    IJBool flush_pending;
+    IJBool terminated;
+    IJBool finalized;
 } IJJSWorker;
 
 typedef struct {
     uv_write_t req;
-    IJU8* data;
+    JSValue handle;
+    IJJSPromise result;
+    IJU32 nframes;
+    IJJSWorkerFrame frames[];
 } IJJSWorkerWriteReq;
 
 static JSValue ijWorkerEval(JSContext* ctx, IJS32 argc, JSValueConst* argv) {
@@ -94,6 +126,7 @@ static IJVoid ijWorkerEntry(IJVoid* arg) {
     IJJSWorkerData* wd = arg;
     IJJSRuntime* wrt = ijNewRuntimeWorker();
     CHECK_NOT_NULL(wrt);
+    JS_UpdateStackTop(wrt->rt);
     JSContext* ctx = ijGetJSContext(wrt);
     wrt->in_bootstrap = true;
     JSValue global_obj = JS_GetGlobalObject(ctx);
@@ -115,14 +148,24 @@ static IJVoid ijWorkerEntry(IJVoid* arg) {
 static IJVoid uvCloseCb(uv_handle_t* handle) {
     IJJSWorker* w = handle->data;
     CHECK_NOT_NULL(w);
+    je_free(w->rbuf);
+    je_free(w->outq);
     je_free(w);
 }
 
+static IJVoid ijWorkerDropQueue(JSRuntime* rt, IJJSWorker* w) {
+    for (IJU32 i = 0; i < w->outq_len; i++)
+        ijMessageFree(rt, &w->outq[i].msg, false);
+    w->outq_len = 0;
+}
+
 static IJVoid ijWorkerFinalizer(JSRuntime* rt, JSValue val) {
     IJJSWorker* w = JS_GetOpaque(val, ijjs_worker_class_id);
     if (w) {
         for (IJS32 i = 0; i < WORKER_EVENT_MAX; i++)
             JS_FreeValueRT(rt, w->events[i]);
+        ijWorkerDropQueue(rt, w);
+        w->finalized = true;
         uv_close(&w->h.handle, uvCloseCb);
     }
 }
@@ -142,18 +185,15 @@ static IJJSWorker* ijWorkerGet(JSContext* ctx, JSValueConst obj) {
 }
 
 static JSValue ijEmitEvent(JSContext* ctx, IJS32 argc, JSValueConst* argv) {
-    CHECK_EQ(argc, 2);
-    JSValue func = argv[0];
-    JSValue arg = argv[1];
-    JSValue ret = JS_Call(ctx, func, JS_UNDEFINED, 1, (JSValueConst*)&arg);
+    CHECK_GE(argc, 2);
+    JSValue ret = JS_Call(ctx, argv[0], JS_UNDEFINED, argc - 1, argv + 1);
     if (JS_IsException(ret))
         ijDumpError(ctx);
     JS_FreeValue(ctx, ret);
-    JS_FreeValue(ctx, func);
-    JS_FreeValue(ctx, arg);
+    for (IJS32 i = 0; i < argc; i++)
+        JS_FreeValue(ctx, (JSValue)argv[i]);
     return JS_UNDEFINED;
 }
-
 static IJVoid ijMaybeEmitEvent(IJJSWorker* w, IJS32 event, JSValue arg) {
     JSContext* ctx = w->ctx;
     JSValue event_func = w->events[event];
@@ -164,12 +204,142 @@ static IJVoid ijMaybeEmitEvent(IJJSWorker* w, IJS32 event, JSValue arg) {
     args[1] = JS_DupValue(ctx, arg);
     CHECK_EQ(JS_EnqueueJob(ctx, ijEmitEvent, 2, (JSValueConst*)&args), 0);
 }
+static IJVoid ijMaybeEmitMessage(IJJSWorker* w, JSValue obj, JSValue ports) {
+    JSContext* ctx = w->ctx;
+    JSValue event_func = w->events[WORKER_EVENT_MESSAGE];
+    if (!JS_IsFunction(ctx, event_func))
+        return;
+    JSValue args[3];
+    args[0] = JS_DupValue(ctx, event_func);
+    args[1] = JS_DupValue(ctx, obj);
+    args[2] = JS_DupValue(ctx, ports);
+    CHECK_EQ(JS_EnqueueJob(ctx, ijEmitEvent, 3, (JSValueConst*)&args), 0);
+}
+
+static IJS32 ijWorkerReserve(IJJSWorker* w, size_t size) {
+    if (size <= w->rcap)
+        return 0;
+    IJU8* rbuf = je_realloc(w->rbuf, size);
+    if (!rbuf)
+        return UV_ENOBUFS;
+    w->rbuf = rbuf;
+    w->rcap = size;
+    return 0;
+}
 
 static IJVoid uvAllocCb(uv_handle_t* handle, size_t suggested_size, uv_buf_t* buf) {
     IJJSWorker* w = handle->data;
     CHECK_NOT_NULL(w);
-    buf->base = js_malloc(w->ctx, suggested_size);
-    buf->len = suggested_size;
+    w->rbuf_read = w->rlen > 0;
+    if (!w->rbuf_read) {
+        buf->base = (IJAnsi*)ijReadBufAlloc(w->ctx, IJJS_DEFAULt_READ_SIZE);
+        buf->len = buf->base ? IJJS_DEFAULt_READ_SIZE : 0;
+        return;
+    }
+    size_t want = w->rlen + IJJS_DEFAULt_READ_SIZE;
+    if (w->rlen >= sizeof(IJJSWorkerFrameHeader)) {
+        IJJSWorkerFrameHeader hdr;
+        memcpy(&hdr, w->rbuf, sizeof(hdr));
+        size_t frame_len = sizeof(hdr) + ((size_t)hdr.nshared + hdr.nports) * sizeof(IJU8*) + hdr.len;
+        if (frame_len > want)
+            want = frame_len;
+    }
+    if (ijWorkerReserve(w, want) != 0) {
+        buf->base = NULL;
+        buf->len = 0;
+        return;
+    }
+    buf->base = (IJAnsi*)w->rbuf + w->rlen;
+    buf->len = w->rcap - w->rlen;
+}
+
+#if IJJS_PLATFORM != IJJS_PLATFORM_WIN32
+static IJVoid uvDropHandleCloseCb(uv_handle_t* handle) {
+    je_free(handle);
+}
+
+static IJVoid ijWorkerDropHandle(IJJSWorker* w) {
+    JSContext* ctx = w->ctx;
+    // Take the descriptor so it neither leaks nor pairs up with the next frame.
+    if (uv_pipe_pending_count(&w->h.pipe) > 0) {
+        uv_tcp_t* tmp = je_malloc(sizeof(*tmp));
+        if (tmp) {
+            CHECK_EQ(uv_tcp_init(ijGetLoop(ctx), tmp), 0);
+            uv_accept(&w->h.stream, (uv_stream_t*)tmp);
+            uv_close((uv_handle_t*)tmp, uvDropHandleCloseCb);
+        }
+    }
+    JSValue error = ijNewError(ctx, UV_ENOTSUP);
+    ijMaybeEmitEvent(w, WORKER_EVENT_MESSAGE_ERROR, error);
+    JS_FreeValue(ctx, error);
+}
+
+static IJVoid ijWorkerReceiveHandle(IJJSWorker* w, const IJU8* data, size_t size) {
+    JSContext* ctx = w->ctx;
+    JSValue handle;
+    switch (uv_pipe_pending_type(&w->h.pipe)) {
+        case UV_TCP:
+            handle = ijNewTcp(ctx, AF_UNSPEC);
+            break;
+        case UV_NAMED_PIPE:
+            handle = ijNewPipe(ctx);
+            break;
+        default:
+            ijWorkerDropHandle(w);
+            return;
+    }
+    if (JS_IsException(handle)) {
+        ijDumpError(ctx);
+        return;
+    }
+    IJS32 r = uv_accept(&w->h.stream, ijSocketGetStream(ctx, handle));
+    if (r != 0) {
+        JS_FreeValue(ctx, handle);
+        JSValue error = ijNewError(ctx, r);
+        ijMaybeEmitEvent(w, WORKER_EVENT_MESSAGE_ERROR, error);
+        JS_FreeValue(ctx, error);
+        return;
+    }
+    JSValue arg = JS_NewObjectProto(ctx, JS_NULL);
+    JS_DefinePropertyValueStr(ctx, arg, "handle", handle, JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, arg, "message", JS_ReadObject(ctx, data, size, 0), JS_PROP_C_W_E);
+    ijMaybeEmitEvent(w, WORKER_EVENT_HANDLE, arg);
+    JS_FreeValue(ctx, arg);
+}
+#endif
+
+static size_t ijWorkerDecode(IJJSWorker* w, const IJU8* data, size_t len) {
+    JSContext* ctx = w->ctx;
+    size_t pos = 0;
+    IJJSWorkerFrameHeader hdr;
+    while (len - pos >= sizeof(hdr)) {
+        memcpy(&hdr, data + pos, sizeof(hdr));
+        size_t tab_len = ((size_t)hdr.nshared + hdr.nports) * sizeof(IJU8*);
+        if (len - pos - sizeof(hdr) < tab_len + hdr.len)
+            break;
+        const IJU8* shared = data + pos + sizeof(hdr);
+        const IJU8* ports = shared + hdr.nshared * sizeof(IJU8*);
+        const IJU8* payload = shared + tab_len;
+        pos += sizeof(hdr) + tab_len + hdr.len;
+#if IJJS_PLATFORM != IJJS_PLATFORM_WIN32
+        if (hdr.type == WORKER_FRAME_HANDLE) {
+            ijWorkerReceiveHandle(w, payload, hdr.len);
+            continue;
+        }
+#endif
+        JSValue port_list;
+        JSValue obj = ijMessageRead(ctx, payload, hdr.len, hdr.type == WORKER_FRAME_TRANSFER,
+                                    shared, hdr.nshared, ports, hdr.nports, &port_list);
+        if (JS_IsException(obj)) {
+            obj = JS_GetException(ctx);
+            ijMaybeEmitEvent(w, WORKER_EVENT_MESSAGE_ERROR, obj);
+        } else {
+            ijMaybeEmitMessage(w, obj, port_list);
+        }
+        JS_FreeValue(ctx, obj);
+        JS_FreeValue(ctx, port_list);
+    }
+    return pos;
 }
 
 static IJVoid uvReadCb(uv_stream_t* handle, ssize_t nread, const uv_buf_t* buf) {
@@ -178,7 +348,8 @@ static IJVoid uvReadCb(uv_stream_t* handle, ssize_t nread, const uv_buf_t* buf)
     JSContext* ctx = w->ctx;
     if (nread < 0) {
         uv_read_stop(&w->h.stream);
-        js_free(ctx, buf->base);
+        if (!w->rbuf_read)
+            ijReadBufFree(ctx, (IJU8*)buf->base, buf->len);
         if (nread != UV_EOF) {
             JSValue error = ijNewError(ctx, nread);
             ijMaybeEmitEvent(w, WORKER_EVENT_ERROR, error);
@@ -186,10 +357,32 @@ static IJVoid uvReadCb(uv_stream_t* handle, ssize_t nread, const uv_buf_t* buf)
         }
         return;
     }
-    JSValue obj = JS_ReadObject(ctx, (const IJU8*)buf->base, buf->len, 0);
-    ijMaybeEmitEvent(w, WORKER_EVENT_MESSAGE, obj);
-    JS_FreeValue(ctx, obj);
-    js_free(ctx, buf->base);
+    if (w->rbuf_read) {
+        w->rlen += nread;
+        size_t used = ijWorkerDecode(w, w->rbuf, w->rlen);
+        w->rlen -= used;
+        if (w->rlen > 0 && used > 0)
+            memmove(w->rbuf, w->rbuf + used, w->rlen);
+    } else {
+        size_t used = ijWorkerDecode(w, (const IJU8*)buf->base, nread);
+        if (used < (size_t)nread) {
+            if (ijWorkerReserve(w, nread - used + IJJS_DEFAULt_READ_SIZE) == 0) {
+                memcpy(w->rbuf, buf->base + used, nread - used);
+                w->rlen = nread - used;
+            } else {
+                JSValue error = ijNewError(ctx, UV_ENOBUFS);
+                ijMaybeEmitEvent(w, WORKER_EVENT_ERROR, error);
+                JS_FreeValue(ctx, error);
+                uv_read_stop(&w->h.stream);
+            }
+        }
+        ijReadBufFree(ctx, (IJU8*)buf->base, buf->len);
+    }
+    if (w->rlen == 0 && w->rcap > IJJS_DEFAULT_HIGH_WATER_MARK) {
+        je_free(w->rbuf);
+        w->rbuf = NULL;
+        w->rcap = 0;
+    }
 }
 
 static JSValue ijNewWorker(JSContext* ctx, uv_os_sock_t channel_fd, IJBool is_main) {
@@ -208,13 +401,14 @@ static JSValue ijNewWorker(JSContext* ctx, uv_os_sock_t channel_fd, IJBool is_ma
     CHECK_EQ(uv_tcp_init(ijGetLoop(ctx), &w->h.tcp), 0);
     CHECK_EQ(uv_tcp_open(&w->h.tcp, channel_fd), 0);
 #else
-    CHECK_EQ(uv_pipe_init(ijGetLoop(ctx), &w->h.pipe, 0), 0);
+    CHECK_EQ(uv_pipe_init(ijGetLoop(ctx), &w->h.pipe, 1), 0);
     CHECK_EQ(uv_pipe_open(&w->h.pipe, channel_fd), 0);
 #endif
     CHECK_EQ(uv_read_start(&w->h.stream, uvAllocCb, uvReadCb), 0);
     w->events[0] = JS_UNDEFINED;
     w->events[1] = JS_UNDEFINED;
     w->events[2] = JS_UNDEFINED;
+    w->events[3] = JS_UNDEFINED;
     JS_SetOpaque(obj, w);
     return obj;
 }
@@ -305,39 +499,173 @@ static IJVoid uvWriteCb(uv_write_t* req, IJS32 status) {
     CHECK_NOT_NULL(wr);
     IJJSWorker* w = req->handle->data;
     CHECK_NOT_NULL(w);
+    if (w->finalized) {
+        /* cancelled by the close in the finalizer, which may run as the runtime is freed */
+        for (IJU32 i = 0; i < wr->nframes; i++)
+            ijMessageFree(NULL, &wr->frames[i].msg, false);
+        je_free(wr);
+        return;
+    }
     JSContext* ctx = w->ctx;
     if (status < 0) {
         JSValue error = ijNewError(ctx, status);
         ijMaybeEmitEvent(w, WORKER_EVENT_MESSAGE_ERROR, error);
         JS_FreeValue(ctx, error);
     }
-    js_free(ctx, wr->data);
-    js_free(ctx, wr);
+    if (ijIsPromisePending(ctx, &wr->result)) {
+        JSValue arg = status < 0 ? ijNewError(ctx, status) : JS_UNDEFINED;
+        ijSettlePromise(ctx, &wr->result, status < 0, 1, (JSValueConst*)&arg);
+    }
+    JS_FreeValue(ctx, wr->handle);
+    for (IJU32 i = 0; i < wr->nframes; i++)
+        ijMessageFree(JS_GetRuntime(ctx), &wr->frames[i].msg, status == 0);
+    je_free(wr);
+}
+
+static IJS32 ijWorkerWrite(JSContext* ctx, IJJSWorker* w, IJJSWorkerWriteReq* wr, uv_stream_t* send_handle) {
+    if (w->terminated)
+        return UV_EPIPE;
+    uv_buf_t* bufs = js_malloc(ctx, wr->nframes * 4 * sizeof(*bufs));
+    if (!bufs)
+        return UV_ENOMEM;
+    IJU32 nbufs = 0;
+    for (IJU32 i = 0; i < wr->nframes; i++) {
+        IJJSWorkerFrame* frame = &wr->frames[i];
+        bufs[nbufs++] = uv_buf_init((IJAnsi*)&frame->hdr, sizeof(frame->hdr));
+        if (frame->hdr.nshared > 0)
+            bufs[nbufs++] = uv_buf_init((IJAnsi*)frame->msg.shared, frame->hdr.nshared * sizeof(IJU8*));
+        if (frame->hdr.nports > 0)
+            bufs[nbufs++] = uv_buf_init((IJAnsi*)frame->msg.ports, frame->hdr.nports * sizeof(IJU8*));
+        bufs[nbufs++] = uv_buf_init((IJAnsi*)frame->msg.data, frame->hdr.len);
+    }
+    wr->req.data = wr;
+    IJS32 r;
+    if (send_handle)
+        r = uv_write2(&wr->req, &w->h.stream, bufs, nbufs, send_handle, uvWriteCb);
+    else
+        r = uv_write(&wr->req, &w->h.stream, bufs, nbufs, uvWriteCb);
+    js_free(ctx, bufs);
+    return r;
+}
+
+static IJVoid ijWorkerFlush(JSContext* ctx, IJJSWorker* w) {
+    IJU32 n = w->outq_len;
+    if (n == 0 || w->terminated)
+        return;
+    w->outq_len = 0;
+    IJJSWorkerWriteReq* wr = je_malloc(sizeof(*wr) + n * sizeof(IJJSWorkerFrame));
+    IJS32 r = UV_ENOMEM;
+    if (wr) {
+        wr->handle = JS_UNDEFINED;
+        wr->nframes = n;
+        ijClearPromise(ctx, &wr->result);
+        memcpy(wr->frames, w->outq, n * sizeof(IJJSWorkerFrame));
+        r = ijWorkerWrite(ctx, w, wr, NULL);
+        if (r == 0)
+            return;
+        je_free(wr);
+    }
+    for (IJU32 i = 0; i < n; i++)
+        ijMessageFree(JS_GetRuntime(ctx), &w->outq[i].msg, false);
+    JSValue error = ijNewError(ctx, r);
+    ijMaybeEmitEvent(w, WORKER_EVENT_MESSAGE_ERROR, error);
+    JS_FreeValue(ctx, error);
+}
+
+static JSValue ijWorkerFlushJob(JSContext* ctx, IJS32 argc, JSValueConst* argv) {
+    IJJSWorker* w = JS_GetOpaque(argv[0], ijjs_worker_class_id);
+    if (w) {
+        w->flush_pending = false;
+        ijWorkerFlush(ctx, w);
+    }
+    return JS_UNDEFINED;
+}
+
+static IJS32 ijWorkerSerialize(JSContext* ctx, JSValueConst message, JSValueConst transfer, IJJSWorkerFrame* frame) {
+    if (ijMessageWrite(ctx, message, transfer, NULL, &frame->msg) != 0)
+        return -1;
+    if (frame->msg.len > UINT32_MAX) {
+        ijMessageFree(JS_GetRuntime(ctx), &frame->msg, false);
+        ijThrowErrno(ctx, UV_E2BIG);
+        return -1;
+    }
+    frame->hdr.len = frame->msg.len;
+    frame->hdr.type = frame->msg.transfer ? WORKER_FRAME_TRANSFER : WORKER_FRAME_MESSAGE;
+    frame->hdr.nshared = frame->msg.nshared;
+    frame->hdr.nports = frame->msg.nports;
+    return 0;
 }
 
 static JSValue ijWorkerPostMessage(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
     IJJSWorker* w = ijWorkerGet(ctx, this_val);
     if (!w)
         return JS_EXCEPTION;
-    IJJSWorkerWriteReq* wr = js_malloc(ctx, sizeof(*wr));
-    if (!wr)
+    if (w->terminated)
+        return JS_UNDEFINED;
+    if (w->outq_len == w->outq_cap) {
+        IJU32 cap = w->outq_cap ? w->outq_cap * 2 : 16;
+        IJJSWorkerFrame* outq = je_realloc(w->outq, cap * sizeof(*outq));
+        if (!outq)
+            return JS_ThrowOutOfMemory(ctx);
+        w->outq = outq;
+        w->outq_cap = cap;
+    }
+    if (ijWorkerSerialize(ctx, argv[0], argc > 1 ? argv[1] : JS_UNDEFINED, &w->outq[w->outq_len]) != 0)
         return JS_EXCEPTION;
+    w->outq_len++;
+    if (!w->flush_pending) {
+        w->flush_pending = true;
+        CHECK_EQ(JS_EnqueueJob(ctx, ijWorkerFlushJob, 1, &this_val), 0);
+    }
+    return JS_UNDEFINED;
+}
+
+static JSValue ijWorkerFlushMessages(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJJSWorker* w = ijWorkerGet(ctx, this_val);
+    if (!w)
+        return JS_EXCEPTION;
+    ijWorkerFlush(ctx, w);
+    return JS_UNDEFINED;
+}
+
+static JSValue ijWorkerSendHandle(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJJSWorker* w = ijWorkerGet(ctx, this_val);
+    if (!w)
+        return JS_EXCEPTION;
+#if IJJS_PLATFORM == IJJS_PLATFORM_WIN32
+    return ijThrowErrno(ctx, UV_ENOTSUP);
+#else
+    uv_stream_t* stream = ijSocketGetStream(ctx, argv[0]);
+    if (!stream)
+        return JS_EXCEPTION;
+    IJJSWorkerWriteReq* wr = je_malloc(sizeof(*wr) + sizeof(IJJSWorkerFrame));
+    if (!wr)
+        return JS_ThrowOutOfMemory(ctx);
     size_t len;
-    IJU8* buf = JS_WriteObject(ctx, &len, argv[0], 0);
+    IJU8* buf = JS_WriteObject(ctx, &len, argv[1], 0);
     if (!buf) {
-        js_free(ctx, wr);
+        je_free(wr);
         return JS_EXCEPTION;
     }
-    wr->req.data = wr;
-    wr->data = buf;
-    uv_buf_t b = uv_buf_init((IJAnsi*)buf, len);
-    IJS32 r = uv_write(&wr->req, &w->h.stream, &b, 1, uvWriteCb);
+    ijWorkerFlush(ctx, w);
+    wr->nframes = 1;
+    wr->frames[0].hdr.len = len;
+    wr->frames[0].hdr.type = WORKER_FRAME_HANDLE;
+    wr->frames[0].hdr.nshared = 0;
+    wr->frames[0].hdr.nports = 0;
+    memset(&wr->frames[0].msg, 0, sizeof(IJJSMessage));
+    wr->frames[0].msg.data = buf;
+    wr->frames[0].msg.len = len;
+    wr->handle = JS_DupValue(ctx, argv[0]);
+    IJS32 r = ijWorkerWrite(ctx, w, wr, stream);
     if (r != 0) {
+        JS_FreeValue(ctx, wr->handle);
         js_free(ctx, buf);
-        js_free(ctx, wr);
-        return JS_EXCEPTION;
+        je_free(wr);
+        return ijThrowErrno(ctx, r);
     }
-    return JS_UNDEFINED;
+    return ijInitPromise(ctx, &wr->result);
+#endif
 }
 
 static JSValue ijWorkerTerminate(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
@@ -349,6 +677,10 @@ static JSValue ijWorkerTerminate(JSContext* ctx, JSValueConst this_val, IJS32 ar
         CHECK_EQ(uv_thread_join(&w->tid), 0);
         uv_update_time(ijGetLoop(ctx));
         w->wrt = NULL;
+        /* the worker end of the channel is gone: queued messages have nowhere to go */
+        w->terminated = true;
+        w->flush_pending = false;
+        ijWorkerDropQueue(JS_GetRuntime(ctx), w);
     }
     return JS_UNDEFINED;
 }
@@ -373,10 +705,13 @@ static JSValue ijWorkerEventSet(JSContext* ctx, JSValueConst this_val, JSValueCo
 
 static const JSCFunctionListEntry ijjs_worker_proto_funcs[] = {
     JS_CFUNC_DEF("postMessage", 1, ijWorkerPostMessage),
+    JS_CFUNC_DEF("flush", 0, ijWorkerFlushMessages),
+    JS_CFUNC_DEF("sendHandle", 2, ijWorkerSendHandle),
     JS_CFUNC_DEF("terminate", 0, ijWorkerTerminate),
     JS_CGETSET_MAGIC_DEF("onmessage", ijWorkerEventGet, ijWorkerEventSet, WORKER_EVENT_MESSAGE),
     JS_CGETSET_MAGIC_DEF("onmessageerror", ijWorkerEventGet, ijWorkerEventSet, WORKER_EVENT_MESSAGE_ERROR),
     JS_CGETSET_MAGIC_DEF("onerror", ijWorkerEventGet, ijWorkerEventSet, WORKER_EVENT_ERROR),
+    JS_CGETSET_MAGIC_DEF("onhandle", ijWorkerEventGet, ijWorkerEventSet, WORKER_EVENT_HANDLE),
     JS_PROP_STRING_DEF("[Symbol.toStringTag]", "Worker", JS_PROP_CONFIGURABLE),
 };
 
@@ -137,6 +137,10 @@ interface MessageEvent extends Event {
      * Returns the data of the message.
      */
     readonly data: any;
+    /**
+     * Returns the MessagePort objects transferred with the message.
+     */
+    readonly ports: ReadonlyArray<MessagePort>;
 }
 interface MessageEventInit extends EventInit {
     data?: any;
@@ -392,11 +396,35 @@ declare var crypto: {
 };
 
 
+type Transferable = ArrayBuffer | MessagePort;
+
+interface MessagePort extends EventTarget {
+    onmessage: ((this: MessagePort, ev: MessageEvent) => any) | null;
+    onmessageerror: ((this: MessagePort, ev: MessageEvent) => any) | null;
+    postMessage(message: any, transfer?: Transferable[] | { transfer?: Transferable[] }): void;
+    start(): void;
+    close(): void;
+}
+declare var MessagePort: {
+    prototype: MessagePort;
+};
+
+interface MessageChannel {
+    readonly port1: MessagePort;
+    readonly port2: MessagePort;
+}
+declare var MessageChannel: {
+    prototype: MessageChannel;
+    new(): MessageChannel;
+};
+
 interface Worker extends EventTarget {
     onmessage: ((this: Worker, ev: MessageEvent) => any) | null;
     onmessageerror: ((this: Worker, ev: MessageEvent) => any) | null;
     onerror: ((this: Worker, ev: ErrorEvent) => any) | null;
-    postMessage(message: any): void;
+    onhandle: ((this: Worker, ev: MessageEvent) => any) | null;
+    postMessage(message: any, transfer?: Transferable[] | { transfer?: Transferable[] }): void;
+    sendHandle(handle: ijjs.TCP | ijjs.Pipe, message?: any): Promise<void>;
     terminate(): void;
 }
 declare var Worker: {
@@ -102,15 +102,96 @@ declare namespace ijjs {
         readonly path:string;
         read(len?:number, pos?:number):Promise<ArrayBuffer>;
         write(data:string|ArrayBuffer, pos?:number):Promise<number>;
+        readv(buffers:ArrayBufferView[], pos?:number):Promise<number>;
+        writev(buffers:(string|ArrayBufferView)[], pos?:number):Promise<number>;
         close():Promise<Exception>;
         fileno():number;
         stat():Promise<Stat>;
+        fsync():Promise<void>;
+        fdatasync():Promise<void>;
+        sendTo(stream:TCP|Pipe, offset?:number, length?:number, onProgress?:(sent:number) => void):Promise<number>;
+        readable(options?:FileReadableOptions):StreamIterator;
+        writable(options?:FileWritableOptions):FileWritable;
+    }
+
+    interface FileReadableOptions {
+        chunkSize?:number;
+        readAhead?:number;
+        position?:number;
+    }
+
+    interface FileWritableOptions {
+        highWaterMark?:number;
+        position?:number;
+    }
+
+    interface FileWritable {
+        readonly writeQueueSize:number;
+        write(data:string|ArrayBufferView):Promise<void>;
+        end():Promise<number>;
+    }
+
+    interface DirEnt {
+        name:string;
+        type:number;
+        stat?:Stat|null;
     }
 
     interface Dir {
         readonly path:string;
         close():Promise<Exception>;
-        next():Promise<{done:boolean, value?:{name:string, type:number}}>;
+        next():Promise<{done:boolean, value?:DirEnt}>;
+        read():Promise<DirEnt[]|undefined>;
+    }
+
+    interface ReadDirOptions {
+        batch?:number;
+        withStats?:boolean;
+    }
+
+    interface ReadFileOptions {
+        mmap?:boolean;
+    }
+
+    type BatchOp =
+        { op:'open', path:string, flags?:string, mode?:number } |
+        { op:'write', data:string|ArrayBufferView, position?:number, file?:File } |
+        { op:'fsync'|'fdatasync', file?:File } |
+        { op:'close' } |
+        { op:'rename', from:string, to:string } |
+        { op:'unlink', path:string };
+
+    interface MmapOptions {
+        offset?:number;
+        length?:number;
+        writable?:boolean;
+        shared?:boolean;
+    }
+
+    interface WalkEntry {
+        path:string;
+        type:number;
+        depth:number;
+        stat?:Stat;
+        /**
+         * set on a directory that could not be opened, its contents are skipped
+         */
+        error?:Error;
+    }
+
+    interface Walker {
+        close():void;
+        next():Promise<{done:boolean, value?:WalkEntry}>;
+        read():Promise<WalkEntry[]|undefined>;
+    }
+
+    interface WalkOptions {
+        maxDepth?:number;
+        batch?:number;
+        followSymlinks?:boolean;
+        withStats?:boolean;
+        include?:string|string[];
+        exclude?:string|string[];
     }
 
     
@@ -154,6 +235,7 @@ declare namespace ijjs {
         bind(addr:Addr, flags?:number):void;
         send(data:string|ArrayBuffer|number, addr?:Addr):Promise<Exception>;
         recv(size?:number):Promise<{data:Uint8Array, flags:number, addr:Addr}>;
+        readonly sendQueueSize:number;
     }
     
     interface UDPConstructor {
@@ -197,19 +279,76 @@ declare namespace ijjs {
      * TCP
      */
 
+    interface ReadableOptions {
+        size?:number;
+        highWaterMark?:number;
+    }
+
+    interface StreamIterator extends AsyncIterableIterator<Uint8Array> {
+        next():Promise<IteratorResult<Uint8Array>>;
+        return():Promise<IteratorResult<Uint8Array>>;
+    }
+
+    interface AcceptStats {
+        queued:number;
+        peak:number;
+        accepted:number;
+        paused:boolean;
+    }
+
+    interface TCPInfo {
+        state:number;
+        caState:number;
+        rtt:number;
+        rttvar:number;
+        rto:number;
+        retransmits:number;
+        retrans:number;
+        totalRetrans:number;
+        lost:number;
+        unacked:number;
+        sndCwnd:number;
+        sndSsthresh:number;
+        sndMss:number;
+        rcvMss:number;
+        pmtu:number;
+        lastDataSent:number;
+        lastDataRecv:number;
+        bytesAcked?:number;
+        bytesReceived?:number;
+        notsentBytes?:number;
+        minRtt?:number;
+        deliveryRate?:number;
+    }
+
     interface TCP {
         readonly IPV6ONLY:number;
+        readonly REUSEPORT:number;
         close():void;
         read(size?:number):Promise<Uint8Array>;
+        readable(options?:ReadableOptions):StreamIterator;
         write(data:string|ArrayBuffer|number):Promise<Exception>;
+        writev(data:Array<string|ArrayBuffer>):Promise<Exception>;
+        cork():void;
+        uncork():void;
+        readonly writeQueueSize:number;
         shutdown():Promise<Exception>;
         fileno():number;
         listen(backlog?:number):void;
         accept():Promise<TCP>;
+        acceptMany(max?:number):Promise<TCP[]>;
+        connections():AsyncIterableIterator<TCP>;
+        acceptStats():AcceptStats;
         getsockname():Addr;
         getpeername():Addr;
         connect(addr:Addr):Promise<Exception>;
         bind(addr:Addr, flags?:number):void;
+        getInfo():TCPInfo;
+        setNoDelay(enable?:boolean):void;
+        setKeepAlive(enable:boolean, delay?:number):void;
+        setNotSentLowat(bytes:number):void;
+        sendBufferSize:number;
+        recvBufferSize:number;
     }
     
     interface TCPConstructor {
@@ -218,6 +357,93 @@ declare namespace ijjs {
     
     export var TCP: TCPConstructor;
 
+
+    /**
+     * HTTP server
+     */
+
+    interface HttpRequest {
+        readonly method:string;
+        readonly url:string;
+        readonly version:string;
+        readonly headers:{[name:string]:string};
+        readonly body?:Uint8Array;
+        readonly keepAlive:boolean;
+        respond(status?:number, headers?:{[name:string]:string|string[]}, body?:string|ArrayBufferView|Array<string|ArrayBufferView>):void;
+    }
+
+    interface HttpServerStats {
+        connections:number;
+        accepted:number;
+        requests:number;
+    }
+
+    interface HttpServer {
+        onrequest:(req:HttpRequest) => void;
+        bind(addr:Addr, flags?:number):void;
+        listen(backlog?:number):void;
+        close():void;
+        getsockname():Addr;
+        stats():HttpServerStats;
+    }
+
+    interface HttpServerOptions {
+        /**
+         * largest request body in bytes, larger ones are answered with 413 (default 1 MiB)
+         */
+        maxBodySize?:number;
+    }
+
+    interface HttpServerConstructor {
+        new(af?: number, options?: HttpServerOptions): HttpServer;
+    }
+
+    export var HttpServer: HttpServerConstructor;
+
+    /**
+     * TLS
+     */
+
+    interface TLSContextOptions {
+        server?:boolean;
+        cert?:string;
+        key?:string;
+        ca?:string;
+        verify?:boolean;
+        alpn?:string[];
+        tickets?:boolean;
+        cache?:boolean;
+        cacheSize?:number;
+        ticketLifetime?:number;
+    }
+
+    interface TLSStats {
+        handshakes:number;
+        resumed:number;
+    }
+
+    interface TLS {
+        readonly alpnProtocol?:string;
+        readonly cipher?:string;
+        readonly sessionReused:boolean;
+        handshake():Promise<void>;
+        read():Promise<Uint8Array|undefined>;
+        write(data:string|ArrayBufferView):Promise<void>;
+        shutdown():Promise<void>;
+        close():void;
+    }
+
+    interface TLSContext {
+        wrap(sock:TCP|Pipe, options?:{servername?:string}):TLS;
+        stats():TLSStats;
+    }
+
+    interface TLSContextConstructor {
+        new(options?:TLSContextOptions): TLSContext;
+    }
+
+    export var TLSContext: TLSContextConstructor;
+
     
     /**
      * TTY
@@ -229,7 +455,12 @@ declare namespace ijjs {
         readonly MODE_IO:number;
         close():void;
         read(size?:number):Promise<Uint8Array>;
+        readable(options?:ReadableOptions):StreamIterator;
         write(data:string|ArrayBuffer|number):Promise<Exception>;
+        writev(data:Array<string|ArrayBuffer>):Promise<Exception>;
+        cork():void;
+        uncork():void;
+        readonly writeQueueSize:number;
         fileno():number;
         setMode(mode:number):void;
         getWinSize():{width:number, height:number};
@@ -249,10 +480,18 @@ declare namespace ijjs {
     interface Pipe {
         close():void;
         read(size?:number):Promise<Uint8Array>;
+        readable(options?:ReadableOptions):StreamIterator;
         write(data:string|ArrayBuffer|number):Promise<Exception>;
+        writev(data:Array<string|ArrayBuffer>):Promise<Exception>;
+        cork():void;
+        uncork():void;
+        readonly writeQueueSize:number;
         fileno():number;
         listen(backlog?:number):void;
         accept():Promise<Pipe>;
+        acceptMany(max?:number):Promise<Pipe[]>;
+        connections():AsyncIterableIterator<Pipe>;
+        acceptStats():AcceptStats;
         getsockname():Addr;
         getpeername():Addr;
         connect(name:string):Promise<Exception>;
@@ -329,6 +568,19 @@ declare namespace ijjs {
         S_IFBLK:number;
         S_IFREG:number;
         S_IFLNK:number;
+        MADV_NORMAL:number;
+        MADV_RANDOM:number;
+        MADV_SEQUENTIAL:number;
+        MADV_WILLNEED:number;
+        MADV_DONTNEED:number;
+        /**
+         * file I/O engine: 'io_uring' when started with --io-uring on a kernel that supports it
+         */
+        readonly engine:'io_uring'|'threadpool';
+        /**
+         * whether this kernel offers the io_uring operations --io-uring needs
+         */
+        uringSupported():boolean;
         /**
          * open file
          */
@@ -372,11 +624,35 @@ declare namespace ijjs {
         /**
          * read dir
          */
-        readdir(path:string):Promise<Dir>;
+        readdir(path:string, options?:ReadDirOptions):Promise<Dir>;
+        /**
+         * walk a directory tree
+         */
+        walk(root:string, options?:WalkOptions):Walker;
         /**
          * read file
          */
-        readFile(path:string):Promise<ArrayBuffer>;
+        readFile(path:string, options?:ReadFileOptions):Promise<ArrayBuffer>;
+        /**
+         * run a sequence of file operations in one threadpool job
+         */
+        batch(ops:BatchOp[]):Promise<(number|undefined)[]>;
+        /**
+         * map a file into memory, writes reach the file only for shared writable mappings
+         */
+        mmap(file:string|File, options?:MmapOptions):Promise<ArrayBuffer>;
+        /**
+         * flush a shared mapping to disk
+         */
+        msync(buf:ArrayBuffer, offset?:number, length?:number):Promise<Exception>;
+        /**
+         * give the kernel an access pattern hint, one of the MADV_* constants
+         */
+        madvise(buf:ArrayBuffer, advice:number, offset?:number, length?:number):void;
+        /**
+         * release a mapping now, detaching the buffer
+         */
+        unmap(buf:ArrayBuffer):void;
     }
     /**
      * ipv4 socket
@@ -482,6 +758,77 @@ declare namespace ijjs {
      * high resolution time function
      */
     export function hrtime():bigInt;
+    /**
+     * number of logical cpus
+     */
+    export function cpucount(): number;
+    /**
+     * read buffer pool counters
+     */
+    export function readPoolStats(): {hits:number, misses:number, copied:number, handed:number, pooled:number};
+    interface LaneStats {
+        threads:number;
+        queued:number;
+        maxQueued:number;
+        busy:number;
+        submitted:number;
+        completed:number;
+        waitMs:number;
+        maxWaitMs:number;
+        runMs:number;
+    }
+    /**
+     * per-lane executor metrics; thread counts are set with --threads fs=N,db=N,cpu=N,dns=N
+     */
+    export function executorStats(): {fs:LaneStats, db:LaneStats, cpu:LaneStats, dns:LaneStats};
+    interface WorkerPoolOptions {
+        /** number of worker threads, defaults to the cpu count */
+        size?: number;
+        /** module whose exported functions the workers run */
+        module: string;
+    }
+    interface WorkerPoolStats {
+        size:number;
+        queued:number;
+        maxQueued:number;
+        queues:number[];
+        busy:number;
+        submitted:number;
+        completed:number;
+        failed:number;
+        stolen:number;
+        waitMs:number;
+        maxWaitMs:number;
+        runMs:number;
+        maxRunMs:number;
+    }
+    /**
+     * fixed set of worker threads sharing per-worker task queues; idle workers steal queued tasks
+     */
+    export class WorkerPool {
+        constructor(options: WorkerPoolOptions);
+        /**
+         * call an exported function of the pool module on a worker, resolves with its (awaited) result
+         */
+        run(fnName: string, args?: any[], options?: { transfer?: ArrayBuffer[] }): Promise<any>;
+        stats(): WorkerPoolStats;
+        /**
+         * stop the workers; queued and unfinished tasks are rejected
+         */
+        terminate(): void;
+    }
+    /**
+     * pipe options
+     */
+    interface PipeOptions {
+        highWaterMark?: number;
+        end?: boolean;
+        splice?: boolean;
+    }
+    /**
+     * move data from src to dst natively, resolves with the byte counts
+     */
+    export function pipe(src: TCP | Pipe | TTY | File, dst: TCP | Pipe | TTY | File, options?: PipeOptions): Promise<{read:number, written:number}>;
     /**
      * get writable dir
      */
@@ -31,7 +31,7 @@ typedef struct {
     IJAnsi* dbName;
     IJAnsi* login;
     IJAnsi* pwd;
-    uv_work_t req;
+    IJJSWork req;
     JSContext* ctx;
     IJS32 r;
     IJJSPromise result;
@@ -43,7 +43,7 @@ typedef struct {
     IJS32* formats;
     IJS32 rfmt;
     Oid* oids;
-    uv_work_t req;
+    IJJSWork req;
     JSContext* ctx;
     IJS32 r;
     IJS32 params;
@@ -60,7 +60,7 @@ typedef struct {
     IJS32 rfmt;
     Oid* oids;
     IJBool ext;
-    uv_work_t req;
+    IJJSWork req;
     JSContext* ctx;
     IJS32 r;
     IJJSPromise result;
@@ -69,7 +69,7 @@ typedef struct {
     IJAnsi* buffer;
     IJU32 length;
     IJS32 type;
-    uv_work_t req;
+    IJJSWork req;
     JSContext* ctx;
     IJS32 r;
     IJJSPromise result;
@@ -108,7 +108,7 @@ static JSValue js_pg_usessl(JSContext* ctx, JSValueConst this_val, IJS32 argc, J
     PQinitOpenSSL(ssl, crypto);
     return JS_UNDEFINED;
 }
-static IJVoid ijDBConnWorkCb(uv_work_t* req) {
+static IJVoid ijDBConnWorkCb(IJJSWork* req) {
     IJJSDBConnReq* dr = req->data;
     CHECK_NOT_NULL(dr);
     JSContext* ctx = dr->ctx;
@@ -123,7 +123,7 @@ static IJVoid ijDBConnWorkCb(uv_work_t* req) {
     js_free(ctx, dr->login);
     js_free(ctx, dr->pwd);
 }
-static IJVoid ijDBConnAfterWorkCb(uv_work_t* req, IJS32 status) {
+static IJVoid ijDBConnAfterWorkCb(IJJSWork* req, IJS32 status) {
     IJJSDBConnReq* dr = req->data;
     CHECK_NOT_NULL(dr);
     JSContext* ctx = dr->ctx;
@@ -160,7 +160,7 @@ static JSValue js_pg_connect(JSContext* ctx, JSValueConst this_val, IJS32 argc,
     dr->req.data = dr;
     dr->ctx = ctx;
     dr->r = -1;
-    IJS32 r = uv_queue_work(ijGetLoop(ctx), &dr->req, ijDBConnWorkCb, ijDBConnAfterWorkCb);
+    IJS32 r = ijQueueWork(ctx, IJJS_LANE_DB, &dr->req, ijDBConnWorkCb, ijDBConnAfterWorkCb);
     if (r != 0) {
         js_free(ctx, dr->pghost);
         js_free(ctx, dr->pgport);
@@ -183,7 +183,7 @@ static JSValue js_pg_error(JSContext* ctx, JSValueConst this_val, IJS32 argc, JS
 {
     return JS_NewString(ctx, PQerrorMessage(g_conn));
 }
-static IJVoid ijDBExecWorkCb(uv_work_t* req) {
+static IJVoid ijDBExecWorkCb(IJJSWork* req) {
     IJJSDBExecReq* dr = req->data;
     CHECK_NOT_NULL(dr);
     JSContext* ctx = dr->ctx;
@@ -222,7 +222,7 @@ clean:
             js_free(ctx, dr->oids);
     }
 }
-static IJVoid ijDBExecAfterWorkCb(uv_work_t* req, IJS32 status) {
+static IJVoid ijDBExecAfterWorkCb(IJJSWork* req, IJS32 status) {
     IJJSDBExecReq* dr = req->data;
     CHECK_NOT_NULL(dr);
     JSContext* ctx = dr->ctx;
@@ -252,7 +252,7 @@ static JSValue js_pg_exec(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSV
     dr->r = -1;
     dr->ext = false;
     dr->cmd = JS_ToCString(ctx, argv[0]);
-    IJS32 r = uv_queue_work(ijGetLoop(ctx), &dr->req, ijDBExecWorkCb, ijDBExecAfterWorkCb);
+    IJS32 r = ijQueueWork(ctx, IJJS_LANE_DB, &dr->req, ijDBExecWorkCb, ijDBExecAfterWorkCb);
     if (r != 0) {
         js_free(ctx, dr->cmd);
         js_free(ctx, dr);
@@ -297,7 +297,7 @@ static JSValue js_pg_execParams(JSContext* ctx, JSValueConst this_val, IJS32 arg
         }
     }
     dr->ext = true;
-    IJS32 r = uv_queue_work(ijGetLoop(ctx), &dr->req, ijDBExecWorkCb, ijDBExecAfterWorkCb);
+    IJS32 r = ijQueueWork(ctx, IJJS_LANE_DB, &dr->req, ijDBExecWorkCb, ijDBExecAfterWorkCb);
     if (r != 0) {
         js_free(ctx, dr->cmd);
         for (IJS32 i = 0; i < dr->params; ++i) 
@@ -312,7 +312,7 @@ static JSValue js_pg_execParams(JSContext* ctx, JSValueConst this_val, IJS32 arg
     }
     return ijInitPromise(ctx, &dr->result);
 }
-static IJVoid ijPrepareWorkCb(uv_work_t* req) {
+static IJVoid ijPrepareWorkCb(IJJSWork* req) {
     IJJSPrepareReq* pr = req->data;
     CHECK_NOT_NULL(pr);
     JSContext* ctx = pr->ctx;
@@ -355,7 +355,7 @@ clean:
             js_free(ctx, pr->oids);
     }
 }
-static IJVoid ijPrepareAfterWorkCb(uv_work_t* req, IJS32 status) {
+static IJVoid ijPrepareAfterWorkCb(IJJSWork* req, IJS32 status) {
     IJJSPrepareReq* pr = req->data;
     CHECK_NOT_NULL(pr);
     JSContext* ctx = pr->ctx;
@@ -397,7 +397,7 @@ static JSValue js_pg_prepare(JSContext* ctx, JSValueConst this_val, IJS32 argc,
             JS_ToUint32(ctx, &pr->oids[i], v);
         }
     }
-    IJS32 r = uv_queue_work(ijGetLoop(ctx), &pr->req, ijPrepareWorkCb, ijPrepareAfterWorkCb);
+    IJS32 r = ijQueueWork(ctx, IJJS_LANE_DB, &pr->req, ijPrepareWorkCb, ijPrepareAfterWorkCb);
     if (r != 0) {
         js_free(ctx, pr->stmt);
         js_free(ctx, pr->query);
@@ -435,7 +435,7 @@ static JSValue js_pg_execPrepared(JSContext* ctx, JSValueConst this_val, IJS32 a
         JS_ToInt32(ctx, &pr->formats[i], v);
     }
     JS_ToInt32(ctx, &pr->rfmt, argv[5]);
-    IJS32 r = uv_queue_work(ijGetLoop(ctx), &pr->req, ijPrepareWorkCb, ijPrepareAfterWorkCb);
+    IJS32 r = ijQueueWork(ctx, IJJS_LANE_DB, &pr->req, ijPrepareWorkCb, ijPrepareAfterWorkCb);
     if (r != 0) {
         js_free(ctx, pr->stmt);
         for (IJS32 i = 0; i < pr->params; ++i)
@@ -481,7 +481,7 @@ static JSValue js_pg_escapeIdentifier(JSContext* ctx, JSValueConst this_val, IJS
     PQfreemem(result);
     return obj;
 }
-static IJVoid ijDBCopyWorkCb(uv_work_t* req) {
+static IJVoid ijDBCopyWorkCb(IJJSWork* req) {
     IJJSCopyReq* cr = req->data;
     CHECK_NOT_NULL(cr);
     JSContext* ctx = cr->ctx;
@@ -503,7 +503,7 @@ static IJVoid ijDBCopyWorkCb(uv_work_t* req) {
         cr->r = 0;
     js_free(ctx, cr->buffer);
 }
-static IJVoid ijDBCopyAfterWorkCb(uv_work_t* req, IJS32 status) {
+static IJVoid ijDBCopyAfterWorkCb(IJJSWork* req, IJS32 status) {
     IJJSCopyReq* cr = req->data;
     CHECK_NOT_NULL(cr);
     JSContext* ctx = cr->ctx;
@@ -543,7 +543,7 @@ static JSValue js_pg_putCopyData(JSContext* ctx, JSValueConst this_val, IJS32 ar
     JSValue jdata = JS_GetPropertyStr(ctx, argv[0], "buffer");
     JS_ToInt32(ctx, &cr->length, jlen);
     cr->buffer = JS_GetArrayBuffer(ctx, &cr->length, jdata);
-    IJS32 r = uv_queue_work(ijGetLoop(ctx), &cr->req, ijDBCopyWorkCb, ijDBCopyAfterWorkCb);
+    IJS32 r = ijQueueWork(ctx, IJJS_LANE_DB, &cr->req, ijDBCopyWorkCb, ijDBCopyAfterWorkCb);
     if (r != 0) {
         js_free(ctx, cr);
         return ijThrowErrno(ctx, r);
@@ -560,7 +560,7 @@ static JSValue js_pg_putCopyEnd(JSContext* ctx, JSValueConst this_val, IJS32 arg
     cr->r = -1;
     cr->type = 1;
     cr->buffer = JS_ToCString(ctx, argv[0]);
-    IJS32 r = uv_queue_work(ijGetLoop(ctx), &cr->req, ijDBCopyWorkCb, ijDBCopyAfterWorkCb);
+    IJS32 r = ijQueueWork(ctx, IJJS_LANE_DB, &cr->req, ijDBCopyWorkCb, ijDBCopyAfterWorkCb);
     if (r != 0) {
         js_free(ctx, cr->buffer);
         js_free(ctx, cr);
@@ -578,7 +578,7 @@ static JSValue js_pg_getCopyData(JSContext* ctx, JSValueConst this_val, IJS32 ar
     cr->r = -1;
     cr->type = 2;
     cr->buffer = JS_ToCString(ctx, argv[0]);
-    IJS32 r = uv_queue_work(ijGetLoop(ctx), &cr->req, ijDBCopyWorkCb, ijDBCopyAfterWorkCb);
+    IJS32 r = ijQueueWork(ctx, IJJS_LANE_DB, &cr->req, ijDBCopyWorkCb, ijDBCopyAfterWorkCb);
     if (r != 0) {
         js_free(ctx, cr->buffer);
         js_free(ctx, cr);
@@ -0,0 +1,38 @@
+// Sequential file read throughput: File.read() awaited one call at a
+// time versus File.readable() with read-ahead.
+// Usage: ijjs tests/bench/file-read.js <path> [readAhead]
+
+const [ path, readAhead = 8 ] = ijjs.args.slice(2);
+
+async function serial() {
+    const f = await ijjs.fs.open(path, 'r');
+    let total = 0;
+    let data;
+    while ((data = await f.read(65536, total)) && data.length > 0) {
+        total += data.length;
+    }
+    await f.close();
+    return total;
+}
+
+async function streamed() {
+    const f = await ijjs.fs.open(path, 'r');
+    let total = 0;
+    for await (const chunk of f.readable({ readAhead: Number(readAhead) })) {
+        total += chunk.length;
+    }
+    await f.close();
+    return total;
+}
+
+async function run(label, fn) {
+    const start = Date.now();
+    const total = await fn();
+    const elapsed = (Date.now() - start) / 1000;
+    console.log(`${label}: ${(total / elapsed / 1048576).toFixed(1)} MB/s (${total} bytes)`);
+}
+
+(async () => {
+    await run('read()', serial);
+    await run('readable()', streamed);
+})();
@@ -0,0 +1,43 @@
+// "Write temp + rename" updates per second, issued as four separate fs
+// calls versus one ijjs.fs.batch() submission. Pass --fsync to add an
+// fsync to the batched variant (File has no fsync() to compare with).
+// Usage: ijjs tests/bench/fs-batch.js [iterations] [--fsync]
+
+const args = ijjs.args.slice(2);
+const sync = args.includes('--fsync');
+const iterations = Number(args.find(a => a !== '--fsync') || 2000);
+const payload = 'x'.repeat(4096);
+
+async function separate(dir, i) {
+    const f = await ijjs.fs.open(`${dir}/tmp`, 'w', 0o644);
+    await f.write(payload);
+    await f.close();
+    await ijjs.fs.rename(`${dir}/tmp`, `${dir}/file${i % 8}`);
+}
+
+async function batched(dir, i) {
+    await ijjs.fs.batch([
+        { op: 'open', path: `${dir}/tmp`, flags: 'w' },
+        { op: 'write', data: payload },
+        ...(sync ? [ { op: 'fsync' } ] : []),
+        { op: 'close' },
+        { op: 'rename', from: `${dir}/tmp`, to: `${dir}/file${i % 8}` },
+    ]);
+}
+
+async function run(label, dir, fn) {
+    const start = Date.now();
+    for (let i = 0; i < iterations; i++) {
+        await fn(dir, i);
+    }
+    const elapsed = (Date.now() - start) / 1000;
+    console.log(`${label}: ${Math.round(iterations / elapsed)} updates/sec`);
+}
+
+(async () => {
+    const dir = await ijjs.fs.mkdtemp('/tmp/ijjs_batchXXXXXX');
+    await run('separate', dir, separate);
+    await run('batch', dir, batched);
+    await ijjs.fs.batch(Array.from({ length: 8 }, (_, i) => ({ op: 'unlink', path: `${dir}/file${i}` })));
+    await ijjs.fs.rmdir(dir);
+})();
@@ -0,0 +1,39 @@
+// Small random reads at a high queue depth: 4 KB File.read() calls at
+// random offsets, with `depth` of them in flight at once. Run it twice to
+// compare the engines:
+//   ijjs tests/bench/fs-random-read.js [seconds] [depth] [size MB]
+//   ijjs --io-uring tests/bench/fs-random-read.js [seconds] [depth] [size MB]
+
+const script = ijjs.args.findIndex(a => a.endsWith('fs-random-read.js'));
+const [ seconds = 5, depth = 64, sizeMB = 64 ] = ijjs.args.slice(script + 1).map(Number);
+const BLOCK = 4096;
+
+(async () => {
+    const dir = await ijjs.fs.mkdtemp('/tmp/bench_randreadXXXXXX');
+    const path = `${dir}/data`;
+    const size = sizeMB * 1024 * 1024;
+    let f = await ijjs.fs.open(path, 'w');
+    const chunk = new Uint8Array(1024 * 1024).fill(0x5a);
+    for (let off = 0; off < size; off += chunk.length) {
+        await f.write(chunk, off);
+    }
+    await f.close();
+
+    f = await ijjs.fs.open(path, 'r');
+    const blocks = size / BLOCK;
+    const deadline = Date.now() + seconds * 1000;
+    let count = 0;
+    const worker = async () => {
+        while (Date.now() < deadline) {
+            await f.read(BLOCK, Math.floor(Math.random() * blocks) * BLOCK);
+            count++;
+        }
+    };
+    const start = Date.now();
+    await Promise.all(Array.from({ length: depth }, worker));
+    const elapsed = (Date.now() - start) / 1000;
+    await f.close();
+    await ijjs.fs.unlink(path);
+    await ijjs.fs.rmdir(dir);
+    console.log(`${ijjs.fs.engine}: ${Math.round(count / elapsed)} reads/sec (depth ${depth})`);
+})();
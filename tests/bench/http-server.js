@@ -0,0 +1,110 @@
+// Requests/sec of the native HttpServer versus an HTTP parser written in JS
+// over TCP. Clients and server share one event loop, so the figures are per
+// core. Usage: ijjs tests/bench/http-server.js [seconds] [connections] [pipeline]
+
+const [ seconds = 5, connections = 16, pipeline = 8 ] = ijjs.args.slice(2).map(Number);
+
+const BODY = 'hello world';
+const REQUEST = 'GET /plaintext HTTP/1.1\r\nHost: localhost\r\nUser-Agent: bench\r\nAccept: */*\r\n\r\n';
+const RESPONSE = `HTTP/1.1 200 OK\r\nContent-Type: text/plain\r\nContent-Length: ${BODY.length}\r\n\r\n${BODY}`;
+
+function nativeServer() {
+    const server = new ijjs.HttpServer();
+    server.bind({ ip: '127.0.0.1' });
+    server.listen();
+    server.onrequest = req => {
+        req.respond(200, { 'Content-Type': 'text/plain' }, BODY);
+    };
+    return server;
+}
+
+function parseRequest(buf, start, end) {
+    const lines = buf.slice(start, end).split('\r\n');
+    const [ method, url, version ] = lines[0].split(' ');
+    const headers = {};
+    for (let i = 1; i < lines.length; i++) {
+        const colon = lines[i].indexOf(':');
+        headers[lines[i].slice(0, colon).toLowerCase()] = lines[i].slice(colon + 1).trim();
+    }
+    return { method, url, version, headers };
+}
+
+async function jsConnection(conn) {
+    const decoder = new TextDecoder();
+    let buf = '';
+    let data;
+    while ((data = await conn.read())) {
+        buf += decoder.decode(data);
+        let start = 0;
+        let end;
+        const out = [];
+        while ((end = buf.indexOf('\r\n\r\n', start)) !== -1) {
+            const req = parseRequest(buf, start, end);
+            if (req.method === 'GET') {
+                out.push(RESPONSE);
+            }
+            start = end + 4;
+        }
+        buf = buf.slice(start);
+        if (out.length) {
+            conn.write(out.join(''));
+        }
+    }
+    conn.close();
+}
+
+function jsServer() {
+    const server = new ijjs.TCP();
+    server.bind({ ip: '127.0.0.1' });
+    server.listen();
+    (async () => {
+        try {
+            for await (const conn of server.connections()) {
+                jsConnection(conn);
+            }
+        } catch (e) {
+            // Listener closed.
+        }
+    })();
+    return server;
+}
+
+async function client(addr, deadline, counter) {
+    const conn = new ijjs.TCP();
+    await conn.connect(addr);
+    const batch = REQUEST.repeat(pipeline);
+    const expected = RESPONSE.length * pipeline;
+    while (performance.now() < deadline) {
+        conn.write(batch);
+        let received = 0;
+        while (received < expected) {
+            const data = await conn.read();
+            if (!data) {
+                throw new Error('connection closed');
+            }
+            received += data.length;
+        }
+        counter.requests += pipeline;
+    }
+    conn.close();
+}
+
+async function run(name, server) {
+    const addr = server.getsockname();
+    const counter = { requests: 0 };
+    const start = performance.now();
+    const deadline = start + seconds * 1000;
+    const clients = [];
+    for (let i = 0; i < connections; i++) {
+        clients.push(client(addr, deadline, counter));
+    }
+    await Promise.all(clients);
+    const elapsed = (performance.now() - start) / 1000;
+    server.close();
+    console.log(`${name}: ${Math.round(counter.requests / elapsed)} req/s (${counter.requests} requests, ${connections} connections, pipeline ${pipeline})`);
+}
+
+(async () => {
+    await run('native HttpServer', nativeServer());
+    await run('JS parser over TCP', jsServer());
+})();
@@ -0,0 +1,59 @@
+// Worker.postMessage compared with a MessagePort handed to the worker:
+// round-trip latency of one message at a time, then throughput of bursts
+// that the worker counts and acknowledges.
+// Usage: ijjs tests/bench/message-channel.js [round trips] [burst size]
+
+const script = ijjs.args.findIndex(a => a.endsWith('message-channel.js'));
+const [ count = 20000, burst = 512 ] = ijjs.args.slice(script + 1).map(Number);
+
+const w = new Worker(ijjs.join(ijjs.dirname(ijjs.args[script]), 'port-echo.js'));
+const { port1, port2 } = new MessageChannel();
+let reply;
+w.onmessage = event => reply(event.data);
+port1.onmessage = event => reply(event.data);
+
+function pingPong(target, n) {
+    return new Promise(resolve => {
+        let left = n;
+        reply = () => {
+            if (--left === 0) {
+                resolve();
+            } else {
+                target.postMessage(left);
+            }
+        };
+        target.postMessage(left);
+    });
+}
+
+function flood(target, n) {
+    return new Promise(resolve => {
+        reply = resolve;
+        for (let i = 0; i < n; i++) {
+            target.postMessage(i);
+        }
+        target.postMessage('end');
+    });
+}
+
+async function measure(name, target) {
+    await pingPong(target, 1000);
+    let start = performance.now();
+    await pingPong(target, count);
+    const latency = (performance.now() - start) * 1000 / count;
+    start = performance.now();
+    let sent = 0;
+    while (sent < count * 10) {
+        sent += await flood(target, burst);
+    }
+    const rate = sent * 1000 / (performance.now() - start);
+    console.log(`${name}: ${latency.toFixed(1)} us/round trip, ${Math.round(rate)} messages/sec`);
+}
+
+(async () => {
+    w.postMessage('port', [ port2 ]);
+    await measure('Worker.postMessage', w);
+    await measure('MessagePort', port1);
+    port1.close();
+    w.terminate();
+})();
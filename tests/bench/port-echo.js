@@ -0,0 +1,26 @@
+// Worker side of message-channel.js: echoes numbers and counts bursts on
+// whichever channel the message came from.
+function serve(post) {
+    let count = 0;
+    return event => {
+        if (event.data === 'end') {
+            post(count);
+            count = 0;
+        } else if (count > 0 || event.data === 0) {
+            count++;
+        } else {
+            post(event.data);
+        }
+    };
+}
+
+const onWorkerMessage = serve(data => self.postMessage(data));
+
+self.onmessage = event => {
+    if (event.ports.length > 0) {
+        const [ port ] = event.ports;
+        port.onmessage = serve(data => port.postMessage(data));
+        return;
+    }
+    onWorkerMessage(event);
+};
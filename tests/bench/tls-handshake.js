@@ -0,0 +1,49 @@
+// TLS handshakes/sec over loopback, full handshakes versus resumed ones
+// (session tickets plus the server session cache). Client and
+// server share one event loop. Usage: ijjs tests/bench/tls-handshake.js [seconds] [connections]
+
+import { cert, key } from '../fixtures/tls-localhost.js';
+
+const [ seconds = 5, connections = 8 ] = ijjs.args.slice(2).map(Number);
+
+async function serve(server, ctx) {
+    for await (const conn of server.connections()) {
+        const tls = ctx.wrap(conn);
+        tls.handshake().then(() => tls.close(), () => tls.close());
+    }
+}
+
+async function run(label, clientOptions) {
+    const serverCtx = new ijjs.TLSContext({ server: true, cert, key });
+    const clientCtx = new ijjs.TLSContext({ ca: cert, ...clientOptions });
+    const server = new ijjs.TCP();
+    server.bind({ ip: '127.0.0.1' });
+    server.listen(1024);
+    serve(server, serverCtx);
+
+    const addr = server.getsockname();
+    const deadline = Date.now() + seconds * 1000;
+    let count = 0;
+    let reused = 0;
+    const worker = async () => {
+        while (Date.now() < deadline) {
+            const conn = new ijjs.TCP();
+            await conn.connect(addr);
+            const tls = clientCtx.wrap(conn, { servername: 'localhost' });
+            await tls.handshake();
+            count++;
+            reused += tls.sessionReused ? 1 : 0;
+            tls.close();
+        }
+    };
+    const start = Date.now();
+    await Promise.all(Array.from({ length: connections }, worker));
+    const elapsed = (Date.now() - start) / 1000;
+    server.close();
+    console.log(`${label}: ${Math.round(count / elapsed)} handshakes/sec (${reused}/${count} resumed)`);
+}
+
+(async () => {
+    await run('full', { cache: false });
+    await run('resumed', {});
+})();
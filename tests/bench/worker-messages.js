@@ -0,0 +1,38 @@
+// Worker postMessage throughput across payload sizes: posts a burst of
+// Uint8Array messages to a worker that counts them and reports back.
+// Usage: ijjs tests/bench/worker-messages.js [seconds per size]
+
+const script = ijjs.args.findIndex(a => a.endsWith('worker-messages.js'));
+const [ seconds = 2 ] = ijjs.args.slice(script + 1).map(Number);
+const SIZES = [ 16, 256, 4096, 65536, 1024 * 1024 ];
+const BURST = 64;
+
+const w = new Worker(ijjs.join(ijjs.dirname(ijjs.args[script]), 'worker-sink.js'));
+let reply;
+w.onmessage = event => reply(event.data);
+
+function roundTrip(payload, n) {
+    return new Promise(resolve => {
+        reply = resolve;
+        for (let i = 0; i < n; i++) {
+            w.postMessage(payload);
+        }
+        w.postMessage('end');
+    });
+}
+
+(async () => {
+    for (const size of SIZES) {
+        const payload = new Uint8Array(size);
+        const deadline = Date.now() + seconds * 1000;
+        const start = Date.now();
+        let count = 0;
+        while (Date.now() < deadline) {
+            count += await roundTrip(payload, BURST);
+        }
+        const elapsed = (Date.now() - start) / 1000;
+        const rate = count / elapsed;
+        console.log(`${size} bytes: ${Math.round(rate)} messages/sec, ${(rate * size / 1048576).toFixed(1)} MB/s`);
+    }
+    w.terminate();
+})();
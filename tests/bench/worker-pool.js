@@ -0,0 +1,43 @@
+// WorkerPool throughput on tiny tasks, then latency of short tasks mixed
+// with long ones, where work stealing keeps the short ones moving.
+// Usage: ijjs tests/bench/worker-pool.js [pool size] [tasks]
+
+const script = ijjs.args.findIndex(a => a.endsWith('worker-pool.js'));
+const [ size = 0, count = 20000 ] = ijjs.args.slice(script + 1).map(Number);
+const module = ijjs.join(ijjs.dirname(ijjs.args[script]), '..', 'helpers', 'pool-tasks.js');
+
+function percentile(sorted, p) {
+    return sorted[Math.min(sorted.length - 1, Math.floor(sorted.length * p))];
+}
+
+(async () => {
+    const pool = new ijjs.WorkerPool({ size: size || undefined, module });
+
+    let start = performance.now();
+    const batch = [];
+    for (let i = 0; i < count; i++) {
+        batch.push(pool.run('add', [ i, 1 ]));
+    }
+    await Promise.all(batch);
+    let elapsed = performance.now() - start;
+    console.log(`size ${pool.stats().size}: ${Math.round(count * 1000 / elapsed)} tasks/sec`);
+
+    const latencies = [];
+    const tasks = [];
+    start = performance.now();
+    for (let i = 0; i < 200; i++) {
+        if (i % 20 === 0) {
+            tasks.push(pool.run('spin', [ 50 ]));
+        }
+        const queued = performance.now();
+        tasks.push(pool.run('add', [ i, 1 ]).then(() => latencies.push(performance.now() - queued)));
+    }
+    await Promise.all(tasks);
+    elapsed = performance.now() - start;
+    latencies.sort((a, b) => a - b);
+    console.log(`mixed: ${elapsed.toFixed(0)} ms, short task p50 ${percentile(latencies, 0.5).toFixed(2)} ms, p99 ${percentile(latencies, 0.99).toFixed(2)} ms`);
+
+    const stats = pool.stats();
+    console.log(`stolen ${stats.stolen}, max queued ${stats.maxQueued}, mean wait ${(stats.waitMs / stats.completed).toFixed(3)} ms, max wait ${stats.maxWaitMs.toFixed(2)} ms`);
+    pool.terminate();
+})();
@@ -0,0 +1,11 @@
+// Worker side of worker-messages.js: counts messages and reports the
+// total when it sees the end marker.
+let count = 0;
+self.onmessage = event => {
+    if (event.data === 'end') {
+        self.postMessage(count);
+        count = 0;
+    } else {
+        count++;
+    }
+};
@@ -0,0 +1,3 @@
+self.onmessage = event => {
+    self.postMessage(event.data);
+};
@@ -0,0 +1,65 @@
+import assert from '../assert.js';
+
+
+const SIZE = 256 * 1024;
+
+(async () => {
+    const dir = await ijjs.fs.mkdtemp('test_uringXXXXXX');
+    const path = `${dir}/data`;
+    const data = new Uint8Array(SIZE);
+    for (let i = 0; i < SIZE; i++) {
+        data[i] = i * 7 & 0xff;
+    }
+
+    let f = await ijjs.fs.open(path, 'w+');
+    assert.eq(await f.write(data, 0), SIZE, 'positional write');
+    await f.fsync();
+    await f.fdatasync();
+    assert.eq((await f.stat()).st_size, BigInt(SIZE), 'fstat sees the written size');
+    assert.eq((await ijjs.fs.stat(path)).st_size, BigInt(SIZE), 'stat by path');
+    assert.ok(((await ijjs.fs.lstat(path)).st_mode & BigInt(ijjs.fs.S_IFMT)) === BigInt(ijjs.fs.S_IFREG), 'lstat mode');
+
+    const offsets = Array.from({ length: 128 }, (_, i) => (i * 7919) % (SIZE - 512));
+    const chunks = await Promise.all(offsets.map(off => f.read(512, off)));
+    let good = true;
+    chunks.forEach((chunk, i) => {
+        for (let j = 0; j < chunk.length; j++) {
+            good = good && chunk[j] === ((offsets[i] + j) * 7 & 0xff);
+        }
+    });
+    assert.ok(good && chunks.every(c => c.length === 512), 'concurrent random reads return the right bytes');
+
+    const a = new Uint8Array(3);
+    const b = new Uint8Array(5);
+    assert.eq(await f.readv([ a, b ], 10), 8, 'readv through the engine');
+    assert.eq(b[4], 17 * 7 & 0xff, 'readv fills buffers in order');
+
+    let total = 0;
+    for await (const chunk of f.readable({ chunkSize: 16384, readAhead: 16 })) {
+        total += chunk.length;
+    }
+    assert.eq(total, SIZE, 'readable stream reads the whole file');
+    await f.close();
+
+    f = await ijjs.fs.open(path, 'r');
+    assert.eq((await f.read(4)).length, 4, 'read at the current position');
+    assert.eq((await f.read(4))[0], 4 * 7 & 0xff, 'current position advances');
+    await f.close();
+
+    try {
+        await ijjs.fs.open(`${dir}/missing`, 'r');
+        assert.ok(false, 'opening a missing file fails');
+    } catch (e) {
+        assert.eq(e.errno, ijjs.Error.UV_ENOENT, 'open reports ENOENT');
+    }
+    try {
+        await ijjs.fs.stat(`${dir}/missing`);
+        assert.ok(false, 'stat of a missing file fails');
+    } catch (e) {
+        assert.eq(e.errno, ijjs.Error.UV_ENOENT, 'stat reports ENOENT');
+    }
+
+    await ijjs.fs.unlink(path);
+    await ijjs.fs.rmdir(dir);
+    console.log(`done ${ijjs.fs.engine}`);
+})();
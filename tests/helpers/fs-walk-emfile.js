@@ -0,0 +1,24 @@
+// Walks the tree given on the command line with every descriptor but one in
+// use, so only the root can be opened. Run with a low `ulimit -n`.
+
+const [ root, thisFile ] = [ ijjs.args[ijjs.args.length - 1], ijjs.args[ijjs.args.length - 2] ];
+
+(async () => {
+    const files = [];
+    for (;;) {
+        try {
+            files.push(await ijjs.fs.open(thisFile, 'r'));
+        } catch (e) {
+            break;
+        }
+    }
+    await files.pop().close();
+    const found = [];
+    for await (const item of ijjs.fs.walk(root)) {
+        found.push({ path: item.path, errno: item.error ? item.error.errno : 0 });
+    }
+    for (const f of files) {
+        await f.close();
+    }
+    console.log(JSON.stringify(found));
+})();
@@ -0,0 +1,6 @@
+self.onhandle = async event => {
+    const { handle, message } = event.data;
+    const data = await handle.read();
+    await handle.write(message.prefix + new TextDecoder().decode(data));
+    handle.close();
+};
@@ -0,0 +1,31 @@
+export function add(a, b) {
+    return a + b;
+}
+
+export async function delayed(value, ms) {
+    await new Promise(resolve => setTimeout(resolve, ms));
+    return value;
+}
+
+export function spin(ms) {
+    const end = Date.now() + ms;
+    while (Date.now() < end) {
+    }
+    return ms;
+}
+
+export function sum(view) {
+    let total = 0;
+    for (const v of view) {
+        total += v;
+    }
+    return total;
+}
+
+export function fail(message) {
+    throw new RangeError(message);
+}
+
+export function unclonable() {
+    return () => {};
+}
@@ -0,0 +1,16 @@
+self.onmessage = event => {
+    const [ port ] = event.ports;
+    port.onmessage = e => {
+        if (e.data === 'close') {
+            port.close();
+            return;
+        }
+        if (e.data === 'port') {
+            e.ports[0].postMessage('via port');
+            e.ports[0].close();
+            return;
+        }
+        port.postMessage({ echo: e.data, buffer: e.data.buffer }, e.data.buffer ? [ e.data.buffer ] : []);
+    };
+    self.postMessage('ready');
+};
@@ -0,0 +1,23 @@
+let server;
+
+async function serve(port) {
+    server = new ijjs.TCP();
+    server.bind({ ip: '127.0.0.1', port }, ijjs.TCP.REUSEPORT);
+    server.listen();
+    self.postMessage({ ready: true });
+    for await (const conn of server.connections()) {
+        await conn.write("x");
+        conn.close();
+    }
+}
+
+self.onmessage = event => {
+    const msg = event.data;
+    if (msg.port) {
+        serve(msg.port);
+    } else if (msg.stats) {
+        const { accepted } = server.acceptStats();
+        server.close();
+        self.postMessage({ accepted });
+    }
+};
@@ -0,0 +1,10 @@
+self.onmessage = event => {
+    const { sab, iterations } = event.data;
+    const i32 = new Int32Array(sab);
+    for (let i = 0; i < iterations; i++) {
+        Atomics.add(i32, 0, 1);
+    }
+    self.postMessage({ seen: i32[1] });
+    const woke = Atomics.wait(i32, 2, 0, 10000);
+    self.postMessage({ woke });
+};
@@ -0,0 +1,5 @@
+self.onmessage = event => {
+    const { view, tag } = event.data;
+    view[0] += 1;
+    self.postMessage({ view, tag, sameBuffer: event.data.buffer === view.buffer }, [ view.buffer ]);
+};
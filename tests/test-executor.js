@@ -0,0 +1,37 @@
+import assert from './assert.js';
+
+
+(async () => {
+    const before = ijjs.executorStats();
+    for (const lane of [ 'fs', 'db', 'cpu', 'dns' ]) {
+        assert.ok(before[lane].threads > 0, `${lane} lane has threads`);
+    }
+
+    const thisFile = import.meta.url.slice(7);   // strip "file://"
+    await ijjs.fs.readFile(thisFile);
+    await ijjs.dns.getaddrinfo('localhost');
+    const after = ijjs.executorStats();
+    assert.eq(after.fs.completed, before.fs.completed + 1, 'readFile runs on the fs lane');
+    assert.eq(after.dns.completed, before.dns.completed + 1, 'getaddrinfo runs on the dns lane');
+    assert.eq(after.db.submitted, before.db.submitted, 'other lanes are untouched');
+    assert.ok(after.fs.maxQueued >= 1, 'queue depth is tracked');
+    assert.ok(after.fs.waitMs >= 0 && after.fs.runMs >= 0, 'latency is tracked');
+
+    try {
+        await ijjs.dns.getaddrinfo('nonexistent.invalid');
+        assert.ok(false, 'resolving an invalid name fails');
+    } catch (e) {
+        assert.ok(e.errno < 0, 'resolver errors carry an errno');
+    }
+
+    // host names go through IDNA like uv_getaddrinfo(), ideographic full stops are label separators
+    const [ loopback ] = await ijjs.dns.getaddrinfo('127\u30020\u30020\u30021', { family: ijjs.AF_INET });
+    assert.eq(loopback.addr.ip, '127.0.0.1', 'a non-ASCII host name is converted before resolving');
+    assert.throws(() => { ijjs.dns.getaddrinfo('\u00fc.'.repeat(100)); }, Error, 'a host name too long to encode is rejected');
+
+    const proc = ijjs.spawn([ ijjs.exepath(), '--threads', 'fs=1,dns=3', '-e', 'console.log(JSON.stringify(ijjs.executorStats()))' ], { stdout: 'pipe' });
+    const out = JSON.parse(new TextDecoder().decode(await proc.stdout.read()));
+    await proc.wait();
+    assert.eq(out.fs.threads, 1, '--threads sizes the fs lane');
+    assert.eq(out.dns.threads, 3, '--threads sizes the dns lane');
+})();
@@ -0,0 +1,61 @@
+import assert from './assert.js';
+
+
+const decoder = new TextDecoder();
+const encoder = new TextEncoder();
+
+async function readText(path) {
+    return decoder.decode(await ijjs.fs.readFile(path));
+}
+
+(async () => {
+    const dir = await ijjs.fs.mkdtemp('test_batchXXXXXX');
+    const path = `${dir}/data`;
+
+    const f = await ijjs.fs.open(path, 'w+', 0o644);
+    assert.eq(await f.writev([ 'record:', encoder.encode('42'), '\n' ]), 10, 'writev writes all buffers');
+    assert.eq(await f.writev([ 'XY' ], 7), 2, 'writev honours the position');
+    const head = new Uint8Array(7);
+    const tail = new Uint8Array(10);
+    assert.eq(await f.readv([ head, tail ], 0), 10, 'readv fills the buffers in order');
+    assert.eq(decoder.decode(head), 'record:', 'first buffer is filled');
+    assert.eq(decoder.decode(tail.subarray(0, 3)), 'XY\n', 'second buffer continues the read');
+    assert.throws(() => { f.readv([ 'text' ], 0); }, TypeError, 'readv needs typed arrays');
+
+    const results = await ijjs.fs.batch([
+        { op: 'open', path: `${dir}/tmp`, flags: 'w' },
+        { op: 'write', data: 'hello ' },
+        { op: 'write', data: encoder.encode('world') },
+        { op: 'write', file: f, data: 'index\n', position: 10 },
+        { op: 'fsync' },
+        { op: 'fdatasync', file: f },
+        { op: 'close' },
+        { op: 'rename', from: `${dir}/tmp`, to: `${dir}/final` },
+    ]);
+    assert.eq(results.length, 8, 'one result per op');
+    assert.eq(results[1], 6, 'write reports the bytes written');
+    assert.eq(results[2], 5, 'typed arrays are written');
+    assert.eq(await readText(`${dir}/final`), 'hello world', 'the file was written and renamed');
+    await f.close();
+    assert.eq(await readText(path), 'record:XY\nindex\n', 'existing files can join a batch');
+
+    let error;
+    try {
+        await ijjs.fs.batch([
+            { op: 'open', path: `${dir}/other`, flags: 'w' },
+            { op: 'write', data: 'partial' },
+            { op: 'rename', from: `${dir}/missing`, to: `${dir}/nowhere` },
+            { op: 'unlink', path: `${dir}/final` },
+        ]);
+    } catch (e) {
+        error = e;
+    }
+    assert.eq(error && error.errno, ijjs.Error.UV_ENOENT, 'a failing op rejects the batch');
+    assert.eq(error && error.index, 2, 'the error names the failing op');
+    assert.eq(await readText(`${dir}/final`), 'hello world', 'ops after the failure do not run');
+    assert.eq(await readText(`${dir}/other`), 'partial', 'ops before the failure have run');
+
+    assert.throws(() => { ijjs.fs.batch([ { op: 'chmod' } ]); }, TypeError, 'unknown ops are rejected');
+    await ijjs.fs.batch([ { op: 'unlink', path: `${dir}/final` }, { op: 'unlink', path: `${dir}/other` }, { op: 'unlink', path } ]);
+    await ijjs.fs.rmdir(dir);
+})();
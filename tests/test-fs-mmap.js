@@ -0,0 +1,115 @@
+import assert from './assert.js';
+
+
+const SIZE = 3 * 65536 + 123;
+
+async function expectError(promise, errno, message) {
+    let error;
+    try {
+        await promise;
+    } catch (e) {
+        error = e;
+    }
+    assert.eq(error && error.errno, errno, message);
+}
+
+(async () => {
+    const dir = await ijjs.fs.mkdtemp('test_mmapXXXXXX');
+    const path = `${dir}/data`;
+    const data = new Uint8Array(SIZE);
+    for (let i = 0; i < SIZE; i++) {
+        data[i] = i * 7 & 0xff;
+    }
+    let f = await ijjs.fs.open(path, 'w');
+    await f.write(data);
+    await f.close();
+
+    const whole = await ijjs.fs.mmap(path);
+    assert.eq(whole.byteLength, SIZE, 'the whole file is mapped by default');
+    assert.eq(new Uint8Array(whole)[SIZE - 1], (SIZE - 1) * 7 & 0xff, 'mapped bytes match');
+    ijjs.fs.madvise(whole, ijjs.fs.MADV_SEQUENTIAL);
+    ijjs.fs.madvise(whole, ijjs.fs.MADV_WILLNEED, 4096, 4096);
+    new Uint8Array(whole)[0] = 0xff;
+    await ijjs.fs.msync(whole);
+    ijjs.fs.unmap(whole);
+    assert.throws(() => whole.byteLength, TypeError, 'unmap detaches the buffer');
+    assert.throws(() => { ijjs.fs.unmap(whole); }, TypeError, 'a buffer can only be unmapped once');
+    assert.throws(() => { ijjs.fs.unmap(new ArrayBuffer(8)); }, TypeError, 'plain buffers are rejected');
+
+    const slice = await ijjs.fs.mmap(path, { offset: 65536 + 5, length: 100 });
+    assert.eq(slice.byteLength, 100, 'length is honoured');
+    assert.eq(new Uint8Array(slice)[0], (65536 + 5) * 7 & 0xff, 'unaligned offsets are supported');
+    ijjs.fs.madvise(slice, ijjs.fs.MADV_RANDOM);
+
+    f = await ijjs.fs.open(path, 'r+');
+    const rw = await ijjs.fs.mmap(f, { writable: true, offset: 10, length: 10 });
+    new Uint8Array(rw).fill(0x41);
+    const syncing = ijjs.fs.msync(rw);
+    let syncBusy;
+    try {
+        ijjs.fs.unmap(rw);
+    } catch (e) {
+        syncBusy = e;
+    }
+    assert.eq(syncBusy && syncBusy.errno, ijjs.Error.UV_EBUSY, 'a mapping cannot be unmapped while msync flushes it');
+    await syncing;
+    ijjs.fs.unmap(rw);
+    await f.close();
+    const check = new Uint8Array(await ijjs.fs.readFile(path));
+    assert.eq(check[0], 0, 'private mappings do not write back');
+    assert.eq(check[10], 0x41, 'shared writable mappings write back');
+    assert.eq(check[19], 0x41, 'the whole range is written back');
+    assert.eq(check[20], 20 * 7 & 0xff, 'bytes past the range are untouched');
+
+    assert.throws(() => { ijjs.fs.mmap(path, { shared: true }); }, TypeError, 'a shared mapping must be writable');
+    await expectError(ijjs.fs.mmap(path, { offset: SIZE + 1 }), ijjs.Error.UV_EINVAL, 'offset past the end rejects');
+    await expectError(ijjs.fs.mmap(path, { offset: SIZE - 10, length: 11 }), ijjs.Error.UV_EINVAL, 'a range past the end rejects');
+    await expectError(ijjs.fs.mmap(`${dir}/missing`), ijjs.Error.UV_ENOENT, 'a missing file rejects');
+
+    f = await ijjs.fs.open(path, 'r');
+    const pending = ijjs.fs.mmap(f, { length: 10 });
+    const closed = f.close();
+    const mapped = await pending;
+    await closed;
+    assert.eq(new Uint8Array(mapped)[1], 7, 'close() waits for a pending mmap of the file');
+    ijjs.fs.unmap(mapped);
+    assert.throws(() => { ijjs.fs.mmap(f); }, Error, 'a closed file cannot be mapped');
+
+    const source = await ijjs.fs.mmap(path);
+    f = await ijjs.fs.open(`${dir}/copy`, 'w');
+    const written = f.writev([ new Uint8Array(source) ]);
+    let busy;
+    try {
+        ijjs.fs.unmap(source);
+    } catch (e) {
+        busy = e;
+    }
+    assert.eq(busy && busy.errno, ijjs.Error.UV_EBUSY, 'a mapping cannot be unmapped while a write uses it');
+    await written;
+    await f.close();
+    ijjs.fs.unmap(source);
+    assert.eq(Number((await ijjs.fs.stat(`${dir}/copy`)).st_size), SIZE, 'the write saw the whole mapping');
+    await ijjs.fs.unlink(`${dir}/copy`);
+
+    const datagram = await ijjs.fs.mmap(path, { length: 16 });
+    const udp = new ijjs.UDP();
+    udp.bind({ ip: '127.0.0.1' });
+    const sender = new ijjs.UDP();
+    const tooBig = sender.send(new Uint8Array(70000), udp.getsockname());
+    const sent = sender.send(new Uint8Array(datagram), udp.getsockname());
+    busy = undefined;
+    try {
+        ijjs.fs.unmap(datagram);
+    } catch (e) {
+        busy = e;
+    }
+    assert.eq(busy && busy.errno, ijjs.Error.UV_EBUSY, 'a mapping cannot be unmapped while a UDP send uses it');
+    await tooBig.catch(() => {});
+    await sent;
+    ijjs.fs.unmap(datagram);
+    sender.close();
+    udp.close();
+
+    await ijjs.fs.unlink(path);
+    await ijjs.fs.rmdir(dir);
+})();
@@ -0,0 +1,61 @@
+import assert from './assert.js';
+
+
+const FILES = 100;
+
+async function makeTree() {
+    const dir = await ijjs.fs.mkdtemp('test_dirXXXXXX');
+    for (let i = 0; i < FILES; i++) {
+        const f = await ijjs.fs.open(`${dir}/f${i}`, 'w');
+        await f.write('x'.repeat(i));
+        await f.close();
+    }
+    return dir;
+}
+
+async function removeTree(dir) {
+    for (let i = 0; i < FILES; i++) {
+        await ijjs.fs.unlink(`${dir}/f${i}`);
+    }
+    await ijjs.fs.rmdir(dir);
+}
+
+(async () => {
+    const dir = await makeTree();
+
+    const names = new Set();
+    for await (const item of await ijjs.fs.readdir(dir, { batch: 16 })) {
+        assert.eq(item.type, ijjs.fs.UV_DIRENT_FILE, 'entry has a type');
+        names.add(item.name);
+    }
+    assert.eq(names.size, FILES, 'async iterator flattens every batch');
+
+    const d = await ijjs.fs.readdir(dir, { batch: 32 });
+    let batches = 0;
+    let total = 0;
+    let items;
+    while ((items = await d.read())) {
+        assert.ok(items.length > 0 && items.length <= 32, 'read() returns one batch');
+        batches++;
+        total += items.length;
+    }
+    assert.eq(total, FILES, 'read() returns every entry');
+    assert.eq(batches, Math.ceil(FILES / 32), 'entries come in full batches');
+    assert.eq(await d.read(), undefined, 'read() stays done');
+    await d.close();
+
+    const ds = await ijjs.fs.readdir(dir, { batch: 64, withStats: true });
+    const pending = ds.next();
+    assert.throws(() => { ds.close(); }, Error, 'close() waits for the pending batch');
+    const first = await pending;
+    assert.eq(first.done, false, 'next() works with stats');
+    let sizes = 0n + first.value.stat.st_size;
+    for await (const item of ds) {
+        sizes += item.stat.st_size;
+    }
+    await ds.close();
+    assert.eq(sizes, BigInt(FILES * (FILES - 1) / 2), 'stats come from the same batch');
+
+    assert.throws(() => { ijjs.fs.readdir(dir, { batch: 0 }); }, RangeError, 'batch must be positive');
+    await removeTree(dir);
+})();
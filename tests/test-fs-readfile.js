@@ -0,0 +1,58 @@
+import assert from './assert.js';
+
+
+const SIZE = 1024 * 1024 + 7;
+
+function matches(buf) {
+    const view = new Uint8Array(buf);
+    if (view.length !== SIZE) {
+        return false;
+    }
+    for (let i = 0; i < SIZE; i++) {
+        if (view[i] !== (i * 31 & 0xff)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+async function writeFile(path, data) {
+    const f = await ijjs.fs.open(path, 'w');
+    await f.write(data);
+    await f.close();
+}
+
+(async () => {
+    const dir = await ijjs.fs.mkdtemp('test_readfileXXXXXX');
+    const path = `${dir}/data`;
+    const data = new Uint8Array(SIZE);
+    for (let i = 0; i < SIZE; i++) {
+        data[i] = i * 31 & 0xff;
+    }
+    await writeFile(path, data);
+
+    assert.ok(matches(await ijjs.fs.readFile(path)), 'readFile returns the whole file');
+
+    const mapped = await ijjs.fs.readFile(path, { mmap: true });
+    assert.ok(matches(mapped), 'mapped file matches the contents');
+    const view = new Uint8Array(mapped);
+    view[1] = 0x7a;
+    assert.eq(view[1], 0x7a, 'mapped buffer can be written');
+    assert.ok(matches(await ijjs.fs.readFile(path)), 'writes do not reach the file');
+
+    await writeFile(`${path}_empty`, '');
+    assert.eq((await ijjs.fs.readFile(`${path}_empty`)).byteLength, 0, 'empty file reads as empty');
+    assert.eq((await ijjs.fs.readFile(`${path}_empty`, { mmap: true })).byteLength, 0, 'empty file maps as empty');
+
+    let error;
+    try {
+        await ijjs.fs.readFile(`${path}_missing`, { mmap: true });
+    } catch (e) {
+        error = e;
+    }
+    assert.eq(error && error.errno, ijjs.Error.UV_ENOENT, 'a missing file rejects');
+
+    await ijjs.fs.unlink(path);
+    await ijjs.fs.unlink(`${path}_empty`);
+    await ijjs.fs.rmdir(dir);
+})();
@@ -0,0 +1,76 @@
+import assert from './assert.js';
+
+
+const FILE_SIZE = 4 * 1024 * 1024 + 123;
+
+async function readAll(conn, delay) {
+    let total = 0;
+    let sum = 0;
+    let data;
+    while ((data = await conn.read())) {
+        for (let i = 0; i < data.length; i++) {
+            sum = (sum + data[i]) % 65521;
+        }
+        total += data.length;
+        if (delay) {
+            await new Promise(resolve => setTimeout(resolve, delay));
+        }
+    }
+    return { total, sum };
+}
+
+function checksum(buf, start, end) {
+    let sum = 0;
+    for (let i = start; i < end; i++) {
+        sum = (sum + buf[i]) % 65521;
+    }
+    return sum;
+}
+
+(async () => {
+    const f = await ijjs.fs.mkstemp('test_fileXXXXXX');
+    const path = f.path;
+    const buf = new Uint8Array(FILE_SIZE);
+    for (let i = 0; i < buf.length; i++) {
+        buf[i] = (i * 7) % 253;
+    }
+    await f.write(buf);
+
+    assert.throws(() => { f.sendTo({}); }, TypeError, 'sendTo() needs a TCP or Pipe');
+
+    const server = new ijjs.TCP();
+    server.bind({ ip: '127.0.0.1' });
+    server.listen();
+    const client = new ijjs.TCP();
+    await client.connect(server.getsockname());
+    const conn = await server.accept();
+
+    const received = readAll(conn, 1);
+    await client.write('HEAD');
+    const progress = [];
+    const sending = f.sendTo(client, undefined, undefined, sent => progress.push(sent));
+    assert.throws(() => { client.write('X'); }, Error, 'write() is busy during sendTo()');
+    assert.throws(() => { f.sendTo(client); }, Error, 'a stream takes one sendTo() at a time');
+    const sent = await sending;
+    assert.eq(sent, FILE_SIZE, 'whole file was sent');
+    assert.ok(progress.length > 1, 'progress is reported between chunks');
+    assert.ok(progress.every((n, i) => i === 0 || n > progress[i - 1]), 'progress only grows');
+    assert.eq(progress[progress.length - 1], FILE_SIZE, 'the last report is the total');
+    const sendingRange = f.sendTo(client, 100, 1000);
+    const closed = f.close();
+    assert.eq(await sendingRange, 1000, 'close() waits for a pending sendTo()');
+    await closed;
+    assert.throws(() => { f.sendTo(client); }, Error, 'a closed file cannot be sent');
+    await client.write('TAIL');
+    client.shutdown();
+
+    const result = await received;
+    assert.eq(result.total, FILE_SIZE + 1008, 'peer received queued writes and the file');
+    const expected = (checksum(new TextEncoder().encode('HEADTAIL'), 0, 8) + checksum(buf, 0, FILE_SIZE) + checksum(buf, 100, 1100)) % 65521;
+    assert.eq(result.sum, expected, 'peer received the file contents');
+
+    await ijjs.fs.unlink(path);
+    client.close();
+    conn.close();
+    server.close();
+})();
@@ -0,0 +1,108 @@
+import assert from './assert.js';
+
+
+const SIZE = 1024 * 1024 + 1000;
+
+function pattern(offset, length) {
+    const buf = new Uint8Array(length);
+    for (let i = 0; i < length; i++) {
+        buf[i] = (offset + i) % 251;
+    }
+    return buf;
+}
+
+async function verify(path) {
+    const f = await ijjs.fs.open(path, 'r');
+    let offset = 0;
+    let ok = true;
+    for await (const chunk of f.readable({ chunkSize: 65536, readAhead: 8 })) {
+        for (let i = 0; i < chunk.length; i++) {
+            if (chunk[i] !== (offset + i) % 251) {
+                ok = false;
+            }
+        }
+        offset += chunk.length;
+    }
+    await f.close();
+    return ok && offset === SIZE;
+}
+
+async function copyOverTcp(src, dst) {
+    const server = new ijjs.TCP();
+    server.bind({ ip: '127.0.0.1' });
+    server.listen();
+    const client = new ijjs.TCP();
+    await client.connect(server.getsockname());
+    const conn = await server.accept();
+
+    const receiving = (async () => {
+        const out = dst.writable({ highWaterMark: 256 * 1024 });
+        for await (const chunk of conn.readable()) {
+            await out.write(chunk);
+        }
+        return out.end();
+    })();
+    for await (const chunk of src.readable({ readAhead: 4 })) {
+        await client.write(chunk);
+    }
+    client.shutdown();
+    const written = await receiving;
+    client.close();
+    conn.close();
+    server.close();
+    return written;
+}
+
+(async () => {
+    const dir = await ijjs.fs.mkdtemp('test_streamsXXXXXX');
+    const path = `${dir}/data`;
+
+    let f = await ijjs.fs.open(path, 'w');
+    const out = f.writable({ highWaterMark: 64 * 1024 });
+    let offset = 0;
+    let pending;
+    while (offset < SIZE) {
+        const length = Math.min(30000, SIZE - offset);
+        await pending;
+        pending = out.write(pattern(offset, length));
+        offset += length;
+    }
+    assert.ok(out.writeQueueSize > 0, 'writes are still in flight');
+    const closed = f.close();
+    assert.throws(() => { out.write('x'); }, Error, 'write() after close() throws');
+    await pending;
+    await closed;
+    assert.eq(out.writeQueueSize, 0, 'close() waits for in-flight writes');
+    assert.eq(await out.end(), SIZE, 'end() resolves with the bytes written');
+    assert.throws(() => { out.write('x'); }, Error, 'write() after end() throws');
+    assert.ok(await verify(path), 'read-ahead delivers the file in order');
+
+    f = await ijjs.fs.open(path, 'r');
+    const it = f.readable({ chunkSize: 1000, readAhead: 16, position: 500 });
+    const first = await it.next();
+    assert.eq(first.value.length, 1000, 'chunks have the requested size');
+    assert.eq(first.value[0], 500 % 251, 'reading starts at the position');
+    await it.return();
+    assert.ok((await it.next()).done, 'return() ends the iteration');
+    assert.throws(() => { f.readable({ readAhead: 0 }); }, Error, 'readAhead must be positive');
+
+    const copyPath = `${dir}/copy`;
+    const dst = await ijjs.fs.open(copyPath, 'w');
+    assert.eq(await copyOverTcp(f, dst), SIZE, 'file streams compose with TCP streams');
+    await dst.close();
+    assert.ok(await verify(copyPath), 'the copy matches the source');
+
+    await f.close();
+    let error;
+    try {
+        for await (const chunk of f.readable()) {
+        }
+    } catch (e) {
+        error = e;
+    }
+    assert.eq(error && error.errno, ijjs.Error.UV_EBADF, 'reading a closed file rejects next()');
+
+    await ijjs.fs.unlink(path);
+    await ijjs.fs.unlink(copyPath);
+    await ijjs.fs.rmdir(dir);
+})();
@@ -0,0 +1,31 @@
+import assert from './assert.js';
+
+const thisFile = import.meta.url.slice(7);   // strip "file://"
+
+
+(async () => {
+    assert.eq(ijjs.fs.engine, 'threadpool', 'the threadpool is the default engine');
+
+    const helper = ijjs.join(ijjs.dirname(thisFile), 'helpers', 'fs-uring.js');
+    const run = async args => {
+        const proc = ijjs.spawn([ ijjs.exepath(), ...args, helper ], { stdout: 'pipe' });
+        let out = '';
+        let chunk;
+        while ((chunk = await proc.stdout.read())) {
+            out += new TextDecoder().decode(chunk);
+        }
+        const status = await proc.wait();
+        assert.eq(status.exit_status, 0, 'helper exits cleanly');
+        const m = out.match(/done (\w+)/);
+        assert.ok(m !== null, 'all file operations pass');
+        return m[1];
+    };
+
+    const engine = await run([ '--io-uring' ]);
+    if (ijjs.fs.uringSupported()) {
+        assert.eq(engine, 'io_uring', '--io-uring uses io_uring when the kernel supports it');
+    } else {
+        assert.eq(engine, 'threadpool', '--io-uring falls back without kernel support');
+    }
+    assert.eq(await run([]), 'threadpool', 'the same operations pass on the threadpool');
+})();
@@ -0,0 +1,94 @@
+import assert from './assert.js';
+
+
+async function touch(path, data = '') {
+    const f = await ijjs.fs.open(path, 'w');
+    await f.write(data);
+    await f.close();
+}
+
+async function collect(root, options) {
+    const found = [];
+    for await (const item of ijjs.fs.walk(root, options)) {
+        found.push(item);
+    }
+    return found;
+}
+
+function rel(root, items) {
+    return items.map(item => item.path.slice(root.length + 1).replace(/[^/]*XXXX/g, '')).sort();
+}
+
+(async () => {
+    const root = await ijjs.fs.mkdtemp('test_walkXXXXXX');
+    const a = await ijjs.fs.mkdtemp(`${root}/aXXXXXX`);
+    const b = await ijjs.fs.mkdtemp(`${a}/bXXXXXX`);
+    const skip = await ijjs.fs.mkdtemp(`${root}/skipXXXXXX`);
+    const files = [ `${root}/top.txt`, `${a}/one.js`, `${b}/two.js`, `${b}/three.txt`, `${skip}/x.js` ];
+    for (const f of files) {
+        await touch(f, 'data');
+    }
+
+    const all = await collect(root);
+    assert.eq(all.length, 8, 'every file and directory is visited');
+    const two = all.find(item => item.path === `${b}/two.js`);
+    assert.eq(two.depth, 3, 'depth is relative to the root');
+    assert.eq(two.type, ijjs.fs.UV_DIRENT_FILE, 'entries carry their type');
+    assert.eq(all.find(item => item.path === b).type, ijjs.fs.UV_DIRENT_DIR, 'directories are reported');
+
+    const js = await collect(root, { include: '*.js' });
+    assert.eq(js.length, 3, 'include globs filter entries but still descend');
+    const pruned = await collect(root, { include: [ '**/*.js' ], exclude: [ 'skip*' ] });
+    assert.eq(pruned.length, 2, 'exclude globs prune whole subtrees');
+    assert.eq((await collect(root, { include: 'a*/b*/t?o.[jk]s' })).length, 1, 'path globs match from the root');
+
+    const shallow = await collect(root, { maxDepth: 1 });
+    assert.eq(shallow.length, 3, 'maxDepth stops the descent');
+
+    const w = ijjs.fs.walk(root, { batch: 3, withStats: true });
+    let total = 0;
+    let items;
+    while ((items = await w.read())) {
+        assert.ok(items.length <= 3, 'read() returns one batch');
+        for (const item of items) {
+            assert.ok(item.stat, 'withStats attaches a stat');
+        }
+        total += items.length;
+    }
+    assert.eq(total, 8, 'batches cover the whole tree');
+
+    const early = ijjs.fs.walk(root, { batch: 1 });
+    await early.next();
+    early.close();
+    assert.eq((await early.next()).done, true, 'a closed walker is done');
+
+    let error;
+    try {
+        await ijjs.fs.walk(`${root}/missing`).next();
+    } catch (e) {
+        error = e;
+    }
+    assert.eq(error && error.errno, ijjs.Error.UV_ENOENT, 'a missing root rejects');
+
+    // a directory that cannot be opened is reported instead of silently skipped
+    const helper = ijjs.join(ijjs.dirname(import.meta.url.slice(7)), 'helpers', 'fs-walk-emfile.js');
+    const proc = ijjs.spawn([ '/bin/sh', '-c', 'ulimit -n 64 && exec "$0" "$@"', ijjs.exepath(), helper, helper, root ], { stdout: 'pipe' });
+    let out = '';
+    let chunk;
+    while ((chunk = await proc.stdout.read())) {
+        out += new TextDecoder().decode(chunk);
+    }
+    await proc.wait();
+    const limited = JSON.parse(out);
+    const failed = limited.find(item => item.path === a);
+    assert.eq(failed && failed.errno, ijjs.Error.UV_EMFILE, 'the directory carries the open error');
+    assert.ok(!limited.some(item => item.path === `${a}/one.js`), 'its contents are skipped');
+    assert.ok(limited.some(item => item.path === `${root}/top.txt`), 'the rest of the walk continues');
+
+    for (const f of files) {
+        await ijjs.fs.unlink(f);
+    }
+    for (const d of [ b, a, skip, root ]) {
+        await ijjs.fs.rmdir(d);
+    }
+})();
@@ -0,0 +1,205 @@
+import assert from './assert.js';
+
+
+const decoder = new TextDecoder();
+
+class ResponseReader {
+    constructor(conn) {
+        this.conn = conn;
+        this.buf = '';
+    }
+
+    async next() {
+        while (true) {
+            const end = this.buf.indexOf('\r\n\r\n');
+            if (end !== -1) {
+                const head = this.buf.slice(0, end).split('\r\n');
+                const [ , status ] = head[0].split(' ');
+                const headers = {};
+                for (const line of head.slice(1)) {
+                    const i = line.indexOf(':');
+                    headers[line.slice(0, i).toLowerCase()] = line.slice(i + 1).trim();
+                }
+                const length = headers['content-length'] ? parseInt(headers['content-length'], 10) : 0;
+                const bodyLength = this.method === 'HEAD' ? 0 : length;
+                if (this.buf.length >= end + 4 + bodyLength) {
+                    const body = this.buf.slice(end + 4, end + 4 + bodyLength);
+                    this.buf = this.buf.slice(end + 4 + bodyLength);
+                    return { status: parseInt(status, 10), headers, body };
+                }
+            }
+            const data = await this.conn.read();
+            if (!data) {
+                return null;
+            }
+            this.buf += decoder.decode(data);
+        }
+    }
+}
+
+async function connect(server) {
+    const conn = new ijjs.TCP();
+    await conn.connect(server.getsockname());
+    return [ conn, new ResponseReader(conn) ];
+}
+
+async function bodyLimits() {
+    const server = new ijjs.HttpServer(undefined, { maxBodySize: 16 });
+    server.bind({ ip: '127.0.0.1' });
+    server.listen();
+    server.onrequest = req => {
+        req.respond(200, {}, req.body ? req.body : '');
+    };
+
+    let [ conn, reader ] = await connect(server);
+    await conn.write('POST / HTTP/1.1\r\nContent-Length: 16\r\n\r\n0123456789abcdef');
+    assert.eq((await reader.next()).body, '0123456789abcdef', 'a body at the limit is accepted');
+    await conn.write('POST / HTTP/1.1\r\nContent-Length: 17\r\n\r\n');
+    assert.eq((await reader.next()).status, 413, 'a content length over the limit answers 413');
+    assert.eq(await reader.next(), null, 'an oversized request closes the connection');
+    conn.close();
+
+    [ conn, reader ] = await connect(server);
+    await conn.write('POST / HTTP/1.1\r\nTransfer-Encoding: chunked\r\n\r\na\r\n0123456789\r\na\r\n');
+    assert.eq((await reader.next()).status, 413, 'a chunked body over the limit answers 413');
+    conn.close();
+
+    // a client that disconnects mid-body must not leak the half-parsed request
+    [ conn, reader ] = await connect(server);
+    await conn.write('POST / HTTP/1.1\r\nContent-Length: 10\r\n\r\n01234');
+    conn.close();
+    await new Promise(resolve => setTimeout(resolve, 20));
+    assert.eq(server.stats().connections, 0, 'the aborted connection is closed');
+    assert.eq(server.stats().requests, 1, 'only the complete request was dispatched');
+    server.close();
+}
+
+(async () => {
+    await bodyLimits();
+    const server = new ijjs.HttpServer();
+    server.bind({ ip: '127.0.0.1' });
+    server.listen();
+    server.onrequest = req => {
+        switch (req.url) {
+            case '/hello':
+                req.respond(200, { 'Content-Type': 'text/plain' }, 'hello');
+                break;
+            case '/echo':
+                req.respond(200, { 'X-Method': req.method }, req.body ? req.body : '');
+                break;
+            case '/slow':
+                setTimeout(() => req.respond(200, {}, 'slow'), 20);
+                break;
+            case '/vector':
+                req.respond(200, {}, [ 'a', new TextEncoder().encode('b'), 'c' ]);
+                break;
+            case '/headers':
+                req.respond(200, { 'Set-Cookie': [ 'a=1', 'b=2' ] }, req.headers['x-multi']);
+                break;
+            case '/bad-header':
+                assert.throws(() => req.respond(200, { 'X Bad': '1' }, ''), TypeError, 'a header name must be a token');
+                assert.throws(() => req.respond(200, { 'X-Bad': 'a\r\nX-Injected: 1' }, ''), TypeError, 'a header value cannot contain CRLF');
+                assert.throws(() => req.respond(200, { 'X-Bad': 'a\0b' }, ''), TypeError, 'a header value cannot contain NUL');
+                req.respond(200, { 'X-Good': 'ok' }, 'checked');
+                break;
+            case '/throw':
+                throw new Error('handler failure');
+            default:
+                req.respond(404);
+                break;
+        }
+    };
+
+    let [ conn, reader ] = await connect(server);
+    await conn.write('GET /hello HTTP/1.1\r\nHost: x\r\n\r\n');
+    let res = await reader.next();
+    assert.eq(res.status, 200, 'simple request succeeds');
+    assert.eq(res.body, 'hello', 'simple request body');
+    assert.eq(res.headers['content-type'], 'text/plain', 'response headers are sent');
+    assert.eq(res.headers['content-length'], '5', 'content length is computed');
+
+    await conn.write('GET /slow HTTP/1.1\r\n\r\nGET /hello HTTP/1.1\r\n\r\nGET /missing HTTP/1.1\r\n\r\n');
+    assert.eq((await reader.next()).body, 'slow', 'pipelined responses keep their order');
+    assert.eq((await reader.next()).body, 'hello', 'second pipelined response');
+    assert.eq((await reader.next()).status, 404, 'third pipelined response');
+
+    await conn.write('POST /echo HTTP/1.1\r\nContent-Length: 11\r\n\r\nhello');
+    await conn.write(' world');
+    res = await reader.next();
+    assert.eq(res.body, 'hello world', 'content-length body is read across writes');
+    assert.eq(res.headers['x-method'], 'POST', 'method is parsed');
+
+    await conn.write('POST /echo HTTP/1.1\r\nTransfer-Encoding: chunked\r\n\r\n5;ext=1\r\nhello\r\n');
+    await conn.write('6\r\n world\r\n0\r\nX-Trailer: 1\r\n\r\n');
+    assert.eq((await reader.next()).body, 'hello world', 'chunked body is decoded');
+
+    await conn.write('GET /vector HTTP/1.1\r\n\r\n');
+    assert.eq((await reader.next()).body, 'abc', 'vectored body is written in order');
+
+    await conn.write('GET /headers HTTP/1.1\r\nX-Multi: 1\r\nX-Multi: 2\r\n\r\n');
+    res = await reader.next();
+    assert.eq(res.body, '1, 2', 'repeated request headers are joined');
+
+    await conn.write('GET /bad-header HTTP/1.1\r\n\r\n');
+    res = await reader.next();
+    assert.eq(res.body, 'checked', 'a rejected respond() can be retried');
+    assert.eq(res.headers['x-injected'], undefined, 'no header is injected');
+
+    reader.method = 'HEAD';
+    await conn.write('HEAD /hello HTTP/1.1\r\n\r\n');
+    res = await reader.next();
+    assert.eq(res.headers['content-length'], '5', 'HEAD keeps the content length');
+    assert.eq(res.body, '', 'HEAD has no body');
+    reader.method = undefined;
+
+    await conn.write('GET /hello HTTP/1.1\r\nConnection: close\r\n\r\n');
+    res = await reader.next();
+    assert.eq(res.headers['connection'], 'close', 'connection close is acknowledged');
+    assert.eq(await reader.next(), null, 'server closes the connection');
+    conn.close();
+
+    [ conn, reader ] = await connect(server);
+    await conn.write('GET /hello HTTP/1.0\r\n\r\n');
+    res = await reader.next();
+    assert.eq(res.body, 'hello', 'HTTP/1.0 request succeeds');
+    assert.eq(await reader.next(), null, 'HTTP/1.0 closes without keep-alive');
+    conn.close();
+
+    [ conn, reader ] = await connect(server);
+    await conn.write('GET /throw HTTP/1.1\r\n\r\n');
+    assert.eq((await reader.next()).status, 500, 'a throwing handler answers 500');
+    conn.close();
+
+    [ conn, reader ] = await connect(server);
+    await conn.write('NOT A REQUEST\r\n\r\n');
+    assert.eq((await reader.next()).status, 400, 'malformed request answers 400');
+    assert.eq(await reader.next(), null, 'malformed request closes the connection');
+    conn.close();
+
+    [ conn, reader ] = await connect(server);
+    await conn.write('POST /echo HTTP/1.1\r\nTransfer-Encoding: chunked, gzip\r\n\r\n');
+    assert.eq((await reader.next()).status, 400, 'chunked that is not the final coding answers 400');
+    assert.eq(await reader.next(), null, 'a misframed request closes the connection');
+    conn.close();
+
+    [ conn, reader ] = await connect(server);
+    await conn.write('POST /echo HTTP/1.1\r\nTransfer-Encoding: gzip\r\n\r\n');
+    assert.eq((await reader.next()).status, 501, 'an unknown final coding answers 501');
+    conn.close();
+
+    [ conn, reader ] = await connect(server);
+    await conn.write('POST /echo HTTP/1.1\r\nContent-Length: 5\r\nTransfer-Encoding: chunked\r\n\r\n0\r\n\r\n');
+    assert.eq((await reader.next()).status, 400, 'content length together with transfer encoding answers 400');
+    assert.eq(await reader.next(), null, 'an ambiguously framed request closes the connection');
+    conn.close();
+
+    [ conn, reader ] = await connect(server);
+    await conn.write('POST /echo HTTP/1.1\r\nTransfer-Encoding: gzip\r\nTransfer-Encoding: chunked\r\n\r\n0\r\n\r\n');
+    assert.eq((await reader.next()).status, 501, 'stacked codings we cannot decode answer 501');
+    conn.close();
+
+    const stats = server.stats();
+    assert.eq(stats.requests, 13, 'requests are counted');
+    assert.eq(stats.accepted, 8, 'connections are counted');
+    server.close();
+})();
@@ -0,0 +1,65 @@
+import assert from './assert.js';
+
+const thisFile = import.meta.url.slice(7);   // strip "file://"
+
+
+function nextMessage(port) {
+    return new Promise(resolve => {
+        port.onmessage = event => resolve(event);
+    });
+}
+
+(async () => {
+    const { port1, port2 } = new MessageChannel();
+    assert.ok(port1 instanceof MessagePort, 'port1 is a MessagePort');
+    assert.throws(() => { new MessagePort(); }, TypeError, 'MessagePort cannot be constructed');
+
+    const count = 5000;
+    const received = [];
+    const done = new Promise(resolve => {
+        port2.onmessage = event => {
+            received.push(event.data);
+            if (received.length === count) {
+                resolve();
+            }
+        };
+    });
+    for (let i = 0; i < count; i++) {
+        port1.postMessage(i);
+    }
+    await done;
+    assert.ok(received.every((v, i) => v === i), 'messages arrive in order past the ring size');
+
+    assert.throws(() => { port1.postMessage(null, [ port1 ]); }, TypeError, 'a port cannot be sent through itself');
+
+    const w = new Worker(ijjs.join(ijjs.dirname(thisFile), 'helpers', 'port-worker.js'));
+    const channel = new MessageChannel();
+    const ready = new Promise(resolve => {
+        w.onmessage = event => resolve(event.data);
+    });
+    w.postMessage(null, [ channel.port2 ]);
+    assert.throws(() => { w.postMessage(null, [ channel.port2 ]); }, TypeError, 'a port can only be transferred once');
+    assert.eq(await ready, 'ready', 'the worker got the port');
+
+    let p = nextMessage(channel.port1);
+    channel.port1.postMessage('hello');
+    assert.eq((await p).data.echo, 'hello', 'messages cross threads over the port');
+
+    const view = new Uint8Array(1024);
+    view[0] = 7;
+    p = nextMessage(channel.port1);
+    channel.port1.postMessage(view, [ view.buffer ]);
+    assert.eq(view.length, 0, 'buffers transfer over ports');
+    const reply = (await p).data;
+    assert.eq(reply.echo[0], 7, 'the buffer round trips over the port');
+
+    const inner = new MessageChannel();
+    p = nextMessage(inner.port2);
+    channel.port1.postMessage('port', [ inner.port1 ]);
+    assert.eq((await p).data, 'via port', 'ports can be sent over ports');
+
+    channel.port1.postMessage('close');
+    w.terminate();
+    inner.port2.close();
+    port1.close();
+})();
@@ -0,0 +1,37 @@
+import assert from './assert.js';
+
+
+async function doEchoServer(server) {
+    const conn = await server.accept();
+    let data;
+    while (true) {
+        data = await conn.read();
+        if (!data) {
+            break;
+        }
+        await conn.write(data);
+    }
+}
+
+(async () => {
+    const server = new ijjs.TCP();
+    server.bind({ ip: '127.0.0.1' });
+    server.listen();
+    doEchoServer(server);
+
+    const client = new ijjs.TCP();
+    await client.connect(server.getsockname());
+    const before = ijjs.readPoolStats();
+    let data;
+    for (let i = 0; i < 10; i++) {
+        await client.write("PING");
+        data = await client.read();
+        assert.eq(data.length, 4, "small reads are sized to the data");
+        assert.eq(data.buffer.byteLength, 4, "small reads don't pin the read buffer");
+    }
+    const after = ijjs.readPoolStats();
+    assert.ok(after.copied - before.copied >= 20, "small reads are copied");
+    assert.ok(after.hits > before.hits, "read buffers are reused");
+    client.close();
+    server.close();
+})();
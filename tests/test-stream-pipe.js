@@ -0,0 +1,155 @@
+import assert from './assert.js';
+
+
+const PAYLOAD_SIZE = 4 * 1024 * 1024;
+
+async function readAll(conn) {
+    let total = 0;
+    let sum = 0;
+    let data;
+    while ((data = await conn.read())) {
+        for (let i = 0; i < data.length; i++) {
+            sum = (sum + data[i]) % 65521;
+        }
+        total += data.length;
+    }
+    return { total, sum };
+}
+
+function makePayload() {
+    const buf = new Uint8Array(PAYLOAD_SIZE);
+    let sum = 0;
+    for (let i = 0; i < buf.length; i++) {
+        buf[i] = i % 251;
+        sum = (sum + buf[i]) % 65521;
+    }
+    return { buf, sum };
+}
+
+async function pipeTcp(options) {
+    const { buf, sum } = makePayload();
+    const server = new ijjs.TCP();
+    server.bind({ ip: '127.0.0.1' });
+    server.listen();
+    const sink = new ijjs.TCP();
+    sink.bind({ ip: '127.0.0.1' });
+    sink.listen();
+
+    const source = new ijjs.TCP();
+    await source.connect(server.getsockname());
+    const upstream = await server.accept();
+    const target = new ijjs.TCP();
+    await target.connect(sink.getsockname());
+    const downstream = await sink.accept();
+
+    const received = readAll(downstream);
+    const piped = ijjs.pipe(upstream, target, options);
+    assert.throws(() => { upstream.read(); }, Error, 'read() is busy while piping');
+    await source.write(buf);
+    source.shutdown();
+
+    const stats = await piped;
+    assert.eq(stats.read, PAYLOAD_SIZE, 'all bytes were read');
+    assert.eq(stats.written, PAYLOAD_SIZE, 'all bytes were written');
+    const result = await received;
+    assert.eq(result.total, PAYLOAD_SIZE, 'destination received everything');
+    assert.eq(result.sum, sum, 'destination received the same bytes');
+
+    for (const h of [source, upstream, target, downstream, server, sink]) {
+        h.close();
+    }
+}
+
+async function pipeFile() {
+    const f = await ijjs.fs.mkstemp('test_fileXXXXXX');
+    const path = f.path;
+    const { buf, sum } = makePayload();
+    await f.write(buf);
+    await f.close();
+
+    const server = new ijjs.TCP();
+    server.bind({ ip: '127.0.0.1' });
+    server.listen();
+    const client = new ijjs.TCP();
+    await client.connect(server.getsockname());
+    const conn = await server.accept();
+
+    const received = readAll(conn);
+    const src = await ijjs.fs.open(path, 'r');
+    const stats = await ijjs.pipe(src, client, { highWaterMark: 65536 });
+    assert.eq(stats.read, PAYLOAD_SIZE, 'whole file was read');
+    const result = await received;
+    assert.eq(result.total, PAYLOAD_SIZE, 'socket received the whole file');
+    assert.eq(result.sum, sum, 'socket received the file contents');
+
+    await src.close();
+    await ijjs.fs.unlink(path);
+    client.close();
+    conn.close();
+    server.close();
+}
+
+async function pipeFileClose() {
+    const f = await ijjs.fs.mkstemp('test_fileXXXXXX');
+    const path = f.path;
+    const { buf } = makePayload();
+    await f.write(buf);
+    await f.close();
+
+    const src = await ijjs.fs.open(path, 'r');
+    const dst = await ijjs.fs.open(`${path}.copy`, 'w');
+    const piped = ijjs.pipe(src, dst);
+    const closed = Promise.all([ src.close(), dst.close() ]);
+    const stats = await piped;
+    await closed;
+    assert.eq(stats.written, PAYLOAD_SIZE, 'closing the files waits for the pipe');
+    assert.eq(Number((await ijjs.fs.stat(`${path}.copy`)).st_size), PAYLOAD_SIZE, 'the copy is complete');
+    assert.throws(() => { ijjs.pipe(src, dst); }, Error, 'a closed file cannot be piped');
+
+    await ijjs.fs.unlink(`${path}.copy`);
+    await ijjs.fs.unlink(path);
+}
+
+async function pipeBusy() {
+    const server = new ijjs.TCP();
+    server.bind({ ip: '127.0.0.1' });
+    server.listen();
+    const source = new ijjs.TCP();
+    await source.connect(server.getsockname());
+    const upstream = await server.accept();
+    const target = new ijjs.TCP();
+    await target.connect(server.getsockname());
+    const downstream = await server.accept();
+
+    let error;
+    try {
+        await ijjs.pipe(new ijjs.TCP(), target);
+    } catch (e) {
+        error = e;
+    }
+    assert.ok(error instanceof Error, 'a pipe that fails to start rejects');
+
+    const received = readAll(downstream);
+    const piped = ijjs.pipe(upstream, target);
+    assert.throws(() => { target.write(new Uint8Array(1)); }, Error, 'write() is busy while piping into the stream');
+    assert.throws(() => { target.writev([new Uint8Array(1)]); }, Error, 'writev() is busy while piping into the stream');
+    assert.throws(() => { target.shutdown(); }, Error, 'shutdown() is busy while piping into the stream');
+    await source.write(new Uint8Array(16));
+    source.shutdown();
+    const stats = await piped;
+    assert.eq(stats.written, 16, 'only the piped bytes were written');
+    assert.eq((await received).total, 16, 'destination received only the piped bytes');
+
+    for (const h of [source, upstream, target, downstream, server]) {
+        h.close();
+    }
+}
+
+(async () => {
+    assert.throws(() => { ijjs.pipe({}, {}); }, TypeError, 'pipe() needs streams or files');
+    await pipeBusy();
+    await pipeTcp({ splice: false, highWaterMark: 65536 });
+    await pipeTcp();
+    await pipeFile();
+    await pipeFileClose();
+})();
@@ -0,0 +1,58 @@
+import assert from './assert.js';
+
+
+(async () => {
+    const server = new ijjs.TCP();
+    server.bind({ ip: '127.0.0.1' });
+    server.listen();
+    const addr = server.getsockname();
+
+    const clients = [];
+    for (let i = 0; i < 8; i++) {
+        const client = new ijjs.TCP();
+        await client.connect(addr);
+        clients.push(client);
+    }
+    let conns = [];
+    while (conns.length < 8) {
+        conns = conns.concat(await server.acceptMany(8));
+    }
+    assert.eq(conns.length, 8, "acceptMany hands over a batch");
+    const stats = server.acceptStats();
+    assert.eq(stats.accepted, 8, "accepted connections are counted");
+    assert.eq(stats.queued, 0, "the accept queue is drained");
+    assert.ok(stats.peak >= 1, "queue depth peak is tracked");
+
+    const client = new ijjs.TCP();
+    await client.connect(addr);
+    clients.push(client);
+    const it = server.connections();
+    const { done, value } = await it.next();
+    assert.ok(!done, "the iterator yields connections");
+    conns.push(value);
+    const p = it.next();
+    server.close();
+    assert.ok((await p).done, "closing the listener ends the iterator");
+
+    for (const c of conns.concat(clients)) {
+        c.close();
+    }
+
+    // closing a listener closes the connections still waiting in its queue
+    const listener = new ijjs.TCP();
+    listener.bind({ ip: '127.0.0.1' });
+    listener.listen();
+    const waiting = new ijjs.TCP();
+    await waiting.connect(listener.getsockname());
+    while (listener.acceptStats().queued === 0) {
+        await new Promise(resolve => setTimeout(resolve, 5));
+    }
+    listener.close();
+    assert.eq(listener.acceptStats().queued, 0, 'close() empties the accept queue');
+    try {
+        assert.eq(await waiting.read(), undefined, 'a queued connection is closed with the listener');
+    } catch (e) {
+        assert.eq(e.errno, ijjs.Error.UV_ECONNRESET, 'a queued connection is reset with the listener');
+    }
+    waiting.close();
+})();
@@ -0,0 +1,38 @@
+import assert from './assert.js';
+
+
+(async () => {
+    const server = new ijjs.TCP();
+    server.bind({ ip: '127.0.0.1' });
+    server.listen();
+    const client = new ijjs.TCP();
+    await client.connect(server.getsockname());
+    const conn = await server.accept();
+
+    client.setNoDelay(true);
+    client.setKeepAlive(true, 60);
+    client.setKeepAlive(false);
+    assert.throws(() => { client.setKeepAlive(true, 0); }, Error, 'keep-alive needs a delay');
+
+    client.sendBufferSize = 65536;
+    assert.ok(client.sendBufferSize >= 65536, 'send buffer size was applied');
+    conn.recvBufferSize = 65536;
+    assert.ok(conn.recvBufferSize >= 65536, 'receive buffer size was applied');
+
+    if (ijjs.platform === 'Linux') {
+        client.setNotSentLowat(16384);
+        await client.write('hello');
+        assert.eq(new TextDecoder().decode(await conn.read()), 'hello');
+        const info = client.getInfo();
+        assert.eq(typeof info.rtt, 'number', 'rtt is reported');
+        assert.eq(typeof info.sndCwnd, 'number', 'cwnd is reported');
+        if (info.bytesAcked !== undefined) {
+            assert.ok(info.bytesAcked >= 5, 'acked bytes are counted');
+            assert.ok(conn.getInfo().bytesReceived >= 5, 'received bytes are counted');
+        }
+    }
+
+    client.close();
+    conn.close();
+    server.close();
+})();
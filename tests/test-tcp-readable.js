@@ -0,0 +1,67 @@
+import assert from './assert.js';
+
+
+async function doServer(server, payload) {
+    const conn = await server.accept();
+    await conn.write(payload);
+    conn.close();
+}
+
+(async () => {
+    const payload = new Uint8Array(1024 * 1024);
+    for (let i = 0; i < payload.length; i++) {
+        payload[i] = i & 0xff;
+    }
+    const server = new ijjs.TCP();
+    server.bind({ ip: '127.0.0.1' });
+    server.listen();
+    doServer(server, payload);
+
+    const client = new ijjs.TCP();
+    await client.connect(server.getsockname());
+    const it = client.readable({ highWaterMark: 65536 });
+    assert.throws(() => { client.read(); }, Error, "read() is busy while flowing");
+    let received = 0;
+    let ok = true;
+    for await (const chunk of it) {
+        for (let i = 0; i < chunk.length; i++) {
+            if (chunk[i] !== ((received + i) & 0xff)) {
+                ok = false;
+            }
+        }
+        received += chunk.length;
+    }
+    assert.eq(received, payload.length, "all data is received");
+    assert.ok(ok, "data arrives in order");
+    const end = await it.next();
+    assert.ok(end.done, "iterator stays done");
+    client.close();
+    server.close();
+
+    await readError();
+})();
+
+async function readError() {
+    const server = new ijjs.TCP();
+    server.bind({ ip: '127.0.0.1' });
+    server.listen();
+    const client = new ijjs.TCP();
+    await client.connect(server.getsockname());
+    const conn = await server.accept();
+    const it = client.readable();
+    await client.write(new Uint8Array(16));
+    await new Promise(resolve => setTimeout(resolve, 50));
+    // closing with unread data resets the connection; the error is stored before next() is called
+    conn.close();
+    await new Promise(resolve => setTimeout(resolve, 100));
+    let error;
+    try {
+        for await (const chunk of it) {
+        }
+    } catch (e) {
+        error = e;
+    }
+    assert.ok(error instanceof Error, "a stored read error rejects next()");
+    client.close();
+    server.close();
+}
@@ -0,0 +1,53 @@
+import assert from './assert.js';
+
+const thisFile = import.meta.url.slice(7);   // strip "file://"
+const workerFile = ijjs.join(ijjs.dirname(thisFile), 'helpers', 'reuseport-worker.js');
+
+
+function nextMessage(w) {
+    return new Promise(resolve => {
+        w.onmessage = event => resolve(event.data);
+    });
+}
+
+(async () => {
+    if (ijjs.platform === 'windows') {
+        return;
+    }
+    assert.ok(ijjs.cpucount() >= 1, "cpu count is known");
+
+    const server = new ijjs.TCP();
+    server.bind({ ip: '127.0.0.1' }, ijjs.TCP.REUSEPORT);
+    const { port } = server.getsockname();
+
+    const workers = [];
+    for (let i = 0; i < 2; i++) {
+        const w = new Worker(workerFile);
+        const ready = nextMessage(w);
+        w.postMessage({ port });
+        assert.ok((await ready).ready, "worker listens on the shared port");
+        workers.push(w);
+    }
+
+    const total = 16;
+    for (let i = 0; i < total; i++) {
+        const client = new ijjs.TCP();
+        await client.connect({ ip: '127.0.0.1', port });
+        const data = await client.read();
+        assert.eq(new TextDecoder().decode(data), "x", "a worker answered");
+        client.close();
+    }
+
+    let accepted = 0;
+    for (const w of workers) {
+        const stats = nextMessage(w);
+        w.postMessage({ stats: true });
+        const n = (await stats).accepted;
+        // the kernel hashes each 4-tuple; 16 connections all landing on one worker is a 1 in 2^15 chance
+        assert.ok(n >= 1, "every worker accepted a connection");
+        accepted += n;
+        w.terminate();
+    }
+    assert.eq(accepted, total, "every connection was accepted by a worker");
+    server.close();
+})();
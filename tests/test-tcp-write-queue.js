@@ -0,0 +1,42 @@
+import assert from './assert.js';
+
+
+async function doSinkServer(server) {
+    const conn = await server.accept();
+    let total = 0;
+    let data;
+    while (true) {
+        data = await conn.read();
+        if (!data) {
+            break;
+        }
+        total += data.length;
+    }
+    conn.close();
+    return total;
+}
+
+(async () => {
+    const server = new ijjs.TCP();
+    server.bind({ ip: '127.0.0.1' });
+    server.listen();
+    const sink = doSinkServer(server);
+
+    const client = new ijjs.TCP();
+    await client.connect(server.getsockname());
+    assert.eq(client.writeQueueSize, 0, "nothing is queued initially");
+    const big = new Uint8Array(32 * 1024 * 1024);
+    big.fill(42);
+    const p = client.write(big);
+    assert.ok(client.writeQueueSize > 0, "unsent bytes are reported");
+    const { port1, port2 } = new MessageChannel();
+    assert.throws(() => { port1.postMessage(big, [ big.buffer ]); }, TypeError, "a pending write pins its buffer");
+    port1.close();
+    port2.close();
+    await p;
+    assert.eq(client.writeQueueSize, 0, "queue drains once the write completes");
+    await client.shutdown();
+    assert.eq(await sink, big.length, "all bytes arrive");
+    client.close();
+    server.close();
+})();
@@ -0,0 +1,47 @@
+import assert from './assert.js';
+
+
+async function doEchoServer(server) {
+    const conn = await server.accept();
+    let data;
+    while (true) {
+        data = await conn.read();
+        if (!data) {
+            break;
+        }
+        await conn.write(data);
+    }
+}
+
+async function readString(conn, length) {
+    const decoder = new TextDecoder();
+    let str = '';
+    while (str.length < length) {
+        str += decoder.decode(await conn.read());
+    }
+    return str;
+}
+
+(async () => {
+    const server = new ijjs.TCP();
+    server.bind({ ip: '127.0.0.1' });
+    server.listen();
+    doEchoServer(server);
+
+    const client = new ijjs.TCP();
+    await client.connect(server.getsockname());
+    await client.writev(["PI", new TextEncoder().encode("NG"), "!"]);
+    assert.eq(await readString(client, 5), "PING!", "writev sends all pieces in order");
+    assert.throws(() => { client.writev([1234]); }, TypeError, "writev rejects anything else");
+
+    client.cork();
+    const p1 = client.write("A");
+    const p2 = client.write("B");
+    client.writev(["C", "D"]);
+    assert.eq(p1, p2, "corked writes share a promise");
+    client.uncork();
+    await p1;
+    assert.eq(await readString(client, 4), "ABCD", "corked writes are flushed on uncork");
+    client.close();
+    server.close();
+})();
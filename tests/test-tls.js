@@ -0,0 +1,93 @@
+import assert from './assert.js';
+import { cert, key } from './fixtures/tls-localhost.js';
+
+
+const decoder = new TextDecoder();
+
+async function echo(tls) {
+    let data;
+    while ((data = await tls.read())) {
+        await tls.write(data);
+    }
+    await tls.shutdown();
+    tls.close();
+}
+
+async function connect(server, serverCtx, clientCtx, servername) {
+    const client = new ijjs.TCP();
+    await client.connect(server.getsockname());
+    const conn = await server.accept();
+    const s = serverCtx.wrap(conn);
+    const c = clientCtx.wrap(client, { servername });
+    await Promise.all([ s.handshake(), c.handshake() ]);
+    echo(s);
+    return c;
+}
+
+async function roundTrip(c, msg) {
+    await c.write(msg);
+    let got = '';
+    while (got.length < msg.length) {
+        got += decoder.decode(await c.read());
+    }
+    return got;
+}
+
+(async () => {
+    assert.throws(() => { new ijjs.TLSContext({ server: true }); }, TypeError, 'a server context needs a cert and key');
+    assert.throws(() => { new ijjs.TLSContext({ cert: 'garbage', key }); }, Error, 'invalid PEM is rejected');
+
+    const serverCtx = new ijjs.TLSContext({ server: true, cert, key, alpn: [ 'h2', 'http/1.1' ] });
+    const clientCtx = new ijjs.TLSContext({ ca: cert, alpn: [ 'http/1.1' ] });
+
+    const server = new ijjs.TCP();
+    server.bind({ ip: '127.0.0.1' });
+    server.listen();
+
+    const raw = new ijjs.TCP();
+    await raw.connect(server.getsockname());
+    const wrapped = clientCtx.wrap(raw, { servername: 'localhost' });
+    assert.throws(() => { raw.read(); }, Error, 'a wrapped socket cannot be read directly');
+    assert.throws(() => { clientCtx.wrap(raw, { servername: 'localhost' }); }, Error, 'a socket can only be wrapped once');
+    assert.throws(() => { clientCtx.wrap(new ijjs.TCP()); }, TypeError, 'a verifying client needs a servername');
+    assert.throws(() => { wrapped.write('x'); }, Error, 'write() needs a completed handshake');
+    wrapped.close();
+    (await server.accept()).close();
+
+    let c = await connect(server, serverCtx, clientCtx, 'localhost');
+    assert.eq(c.sessionReused, false, 'first handshake is a full one');
+    assert.eq(c.alpnProtocol, 'http/1.1', 'ALPN picks the common protocol');
+    assert.ok(c.cipher, 'cipher suite is reported');
+    assert.eq(await roundTrip(c, 'hello tls'), 'hello tls', 'data is echoed over TLS');
+    const big = 'x'.repeat(100000);
+    assert.eq(await roundTrip(c, big), big, 'large writes are split into records');
+    await c.shutdown();
+    assert.eq(await c.read(), undefined, 'close_notify ends the stream');
+    c.close();
+
+    c = await connect(server, serverCtx, clientCtx, 'localhost');
+    assert.eq(c.sessionReused, true, 'second handshake resumes the session');
+    assert.eq(await roundTrip(c, 'again'), 'again', 'resumed session carries data');
+    await c.shutdown();
+    assert.eq(await c.read(), undefined, 'resumed session closes cleanly');
+    c.close();
+
+    async function rejected(ctx, servername) {
+        const client = new ijjs.TCP();
+        await client.connect(server.getsockname());
+        const conn = await server.accept();
+        const s = serverCtx.wrap(conn);
+        const bad = ctx.wrap(client, { servername });
+        const results = await Promise.allSettled([ s.handshake(), bad.handshake() ]);
+        s.close();
+        bad.close();
+        return results[1].status === 'rejected';
+    }
+    assert.ok(await rejected(new ijjs.TLSContext(), 'localhost'), 'an untrusted certificate fails verification');
+    assert.ok(await rejected(new ijjs.TLSContext({ ca: cert }), 'example.com'), 'a trusted certificate for another name fails verification');
+
+    const stats = serverCtx.stats();
+    assert.eq(stats.handshakes, 2, 'server counts handshakes');
+    assert.eq(stats.resumed, 1, 'server counts resumed handshakes');
+    server.close();
+})();
@@ -0,0 +1,31 @@
+import assert from './assert.js';
+
+const thisFile = import.meta.url.slice(7);   // strip "file://"
+
+
+(async () => {
+    if (ijjs.platform === 'windows') {
+        return;
+    }
+    const w = new Worker(ijjs.join(ijjs.dirname(thisFile), 'helpers', 'handle-worker.js'));
+    const server = new ijjs.TCP();
+    server.bind({ ip: '127.0.0.1' });
+    server.listen();
+
+    const client = new ijjs.TCP();
+    await client.connect(server.getsockname());
+    const conn = await server.accept();
+    await w.sendHandle(conn, { prefix: 'worker: ' });
+    assert.throws(() => { w.sendHandle({}, null); }, TypeError, "only TCP and Pipe handles can be sent");
+
+    await client.write("PING");
+    let str = '';
+    let data;
+    while ((data = await client.read())) {
+        str += new TextDecoder().decode(data);
+    }
+    assert.eq(str, "worker: PING", "the worker serves the connection");
+    client.close();
+    server.close();
+    w.terminate();
+})();
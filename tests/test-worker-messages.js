@@ -0,0 +1,53 @@
+import assert from './assert.js';
+
+const thisFile = import.meta.url.slice(7);   // strip "file://"
+
+
+const w = new Worker(ijjs.join(ijjs.dirname(thisFile), 'helpers', 'echo-worker.js'));
+const received = [];
+let resolveAll;
+const all = new Promise(resolve => {
+    resolveAll = resolve;
+});
+w.onmessage = event => {
+    received.push(event.data);
+    if (received.length === 1002) {
+        resolveAll();
+    }
+};
+
+(async () => {
+    const big = new Uint8Array(3 * 1024 * 1024 + 13);
+    for (let i = 0; i < big.length; i++) {
+        big[i] = i * 13 & 0xff;
+    }
+    w.postMessage({ seq: -1, big });
+    for (let i = 0; i < 1000; i++) {
+        w.postMessage({ seq: i, text: 'x'.repeat(i % 50) });
+    }
+    w.postMessage({ seq: 1000, big: 'y'.repeat(200000) });
+
+    const timer = setTimeout(() => {
+        w.terminate();
+        assert.ok(false, `only ${received.length} messages arrived`);
+    }, 10000);
+    await all;
+    clearTimeout(timer);
+
+    const first = received[0];
+    assert.eq(first.seq, -1, 'a large message arrives first');
+    assert.eq(first.big.length, big.length, 'a message split across reads is reassembled');
+    let same = true;
+    for (let i = 0; i < big.length; i += 4093) {
+        same = same && first.big[i] === big[i];
+    }
+    assert.ok(same, 'the reassembled payload matches');
+    let ordered = true;
+    for (let i = 0; i < 1000; i++) {
+        const m = received[i + 1];
+        ordered = ordered && m.seq === i && m.text.length === i % 50;
+    }
+    assert.ok(ordered, 'small coalesced messages arrive intact and in order');
+    assert.eq(received[1001].big.length, 200000, 'a message after a burst is intact');
+    w.terminate();
+})();
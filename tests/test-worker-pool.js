@@ -0,0 +1,97 @@
+import assert from './assert.js';
+
+const thisFile = import.meta.url.slice(7);   // strip "file://"
+const module = ijjs.join(ijjs.dirname(thisFile), 'helpers', 'pool-tasks.js');
+
+
+(async () => {
+    assert.throws(() => { new ijjs.WorkerPool(); }, TypeError, 'options are required');
+    assert.throws(() => { new ijjs.WorkerPool({ size: 1 }); }, TypeError, 'a module is required');
+
+    const pool = new ijjs.WorkerPool({ size: 2, module });
+    assert.eq(pool.stats().size, 2, 'the pool has the requested size');
+    assert.eq(await pool.run('add', [ 1, 2 ]), 3, 'a task runs');
+    assert.eq(await pool.run('delayed', [ 'later', 10 ]), 'later', 'async tasks are awaited');
+
+    const results = await Promise.all(Array.from({ length: 50 }, (_, i) => pool.run('add', [ i, i ])));
+    assert.ok(results.every((v, i) => v === 2 * i), 'each task gets its own result');
+
+    const view = new Uint8Array(1024).fill(1);
+    const total = pool.run('sum', [ view ], { transfer: [ view.buffer ] });
+    assert.eq(view.length, 0, 'transferred buffers are detached');
+    assert.eq(await total, 1024, 'transferred buffers reach the worker');
+
+    try {
+        await pool.run('fail', [ 'boom' ]);
+        assert.ok(false, 'a throwing task rejects');
+    } catch (e) {
+        assert.ok(e instanceof Error, 'errors are rebuilt on this side');
+        assert.eq(e.name, 'RangeError', 'the error name is kept');
+        assert.eq(e.message, 'boom', 'the error message is kept');
+    }
+    try {
+        await pool.run('missing');
+        assert.ok(false, 'an unknown function rejects');
+    } catch (e) {
+        assert.ok(e instanceof TypeError, 'an unknown function rejects with a TypeError');
+    }
+    try {
+        await pool.run('unclonable');
+        assert.ok(false, 'an unclonable result rejects');
+    } catch (e) {
+        assert.ok(e instanceof Error, 'an unclonable result rejects');
+    }
+
+    // One worker is stuck on a long task, the short ones queued behind it
+    // must be stolen by the other worker.
+    const start = Date.now();
+    const long = pool.run('spin', [ 600 ]);
+    const short = [];
+    for (let i = 0; i < 6; i++) {
+        short.push(pool.run('add', [ i, 1 ]));
+    }
+    await Promise.all(short);
+    assert.ok(Date.now() - start < 450, 'short tasks do not wait for the long one');
+    await long;
+
+    const stats = pool.stats();
+    assert.ok(stats.stolen > 0, 'tasks were stolen');
+    assert.eq(stats.submitted, stats.completed, 'every task completed');
+    assert.eq(stats.failed, 3, 'failures are counted');
+    assert.eq(stats.queued, 0, 'the queues are empty');
+    assert.ok(stats.maxQueued > 0, 'the queue high-water mark is kept');
+    assert.ok(stats.maxRunMs >= 500, 'task latency is recorded');
+
+    const single = new ijjs.WorkerPool({ size: 1, module });
+    const running = single.run('spin', [ 5000 ]);
+    const queued = single.run('add', [ 1, 1 ]);
+    await new Promise(resolve => setTimeout(resolve, 50));
+    const stopAt = Date.now();
+    single.terminate();
+    assert.ok(Date.now() - stopAt < 100, 'terminate does not wait for a running task');
+    const [ interrupted, cancelled ] = await Promise.allSettled([ running, queued ]);
+    assert.eq(interrupted.reason && interrupted.reason.errno, ijjs.Error.UV_ECANCELED, 'a running task is interrupted');
+    assert.eq(cancelled.status, 'rejected', 'terminate cancels queued tasks');
+    assert.throws(() => { single.run('add', [ 1, 1 ]); }, TypeError, 'a terminated pool rejects new work');
+    pool.terminate();
+
+    const sleeper = new ijjs.WorkerPool({ size: 1, module });
+    const sleeping = sleeper.run('delayed', [ 'later', 2000 ]);
+    await new Promise(resolve => setTimeout(resolve, 50));
+    sleeper.terminate();
+    try {
+        await sleeping;
+        assert.ok(false, 'a task awaiting a timer is cancelled');
+    } catch (e) {
+        assert.eq(e.errno, ijjs.Error.UV_ECANCELED, 'a task awaiting a timer is cancelled');
+    }
+
+    const broken = ijjs.WorkerPool({ size: 1, module: ijjs.join(ijjs.dirname(thisFile), 'helpers', 'does-not-exist.js') });
+    try {
+        await broken.run('add', [ 1, 1 ]);
+        assert.ok(false, 'a missing module rejects');
+    } catch (e) {
+        assert.ok(e instanceof ReferenceError, 'a missing module rejects');
+    }
+    broken.terminate();
+})();
@@ -0,0 +1,55 @@
+import assert from './assert.js';
+
+const thisFile = import.meta.url.slice(7);   // strip "file://"
+
+
+const workerPath = ijjs.join(ijjs.dirname(thisFile), 'helpers', 'shared-worker.js');
+const sleep = ms => new Promise(resolve => setTimeout(resolve, ms));
+
+function spawn() {
+    const w = new Worker(workerPath);
+    const queue = [];
+    let waiting;
+    w.onmessage = event => {
+        if (waiting) {
+            const resolve = waiting;
+            waiting = undefined;
+            resolve(event.data);
+        } else {
+            queue.push(event.data);
+        }
+    };
+    w.next = () => queue.length ? Promise.resolve(queue.shift()) : new Promise(resolve => {
+        waiting = resolve;
+    });
+    return w;
+}
+
+(async () => {
+    const sab = new SharedArrayBuffer(16);
+    const i32 = new Int32Array(sab);
+    i32[1] = 1234;
+    assert.throws(() => { Atomics.wait(i32, 3, 0, 0); }, TypeError, 'the main thread cannot block');
+
+    const iterations = 100000;
+    const workers = [ spawn(), spawn() ];
+    for (const w of workers) {
+        w.postMessage({ sab, iterations });
+    }
+    for (const w of workers) {
+        const msg = await w.next();
+        assert.eq(msg.seen, 1234, 'the worker sees memory written by the main thread');
+    }
+    assert.eq(Atomics.load(i32, 0), 2 * iterations, 'atomic increments from both workers land in shared memory');
+
+    let woken = 0;
+    while (woken < workers.length) {
+        woken += Atomics.notify(i32, 2);
+        await sleep(5);
+    }
+    for (const w of workers) {
+        const msg = await w.next();
+        assert.eq(msg.woke, 'ok', 'Atomics.notify wakes a worker blocked in Atomics.wait');
+        w.terminate();
+    }
+})();
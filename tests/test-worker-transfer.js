@@ -0,0 +1,96 @@
+import assert from './assert.js';
+
+const thisFile = import.meta.url.slice(7);   // strip "file://"
+
+
+const w = new Worker(ijjs.join(ijjs.dirname(thisFile), 'helpers', 'transfer-worker.js'));
+const replies = [];
+let next;
+w.onmessage = event => {
+    replies.push(event.data);
+    next();
+};
+const reply = () => new Promise(resolve => {
+    next = () => resolve(replies.shift());
+});
+
+(async () => {
+    const size = 16 * 1024 * 1024;
+    const view = new Uint8Array(size);
+    view[0] = 41;
+    view[size - 1] = 7;
+
+    assert.throws(() => { w.postMessage({ view }, [ view ]); }, TypeError, 'only ArrayBuffers can be transferred');
+    assert.throws(() => { w.postMessage({ view }, [ view.buffer, view.buffer ]); }, TypeError, 'a buffer cannot be listed twice');
+    assert.eq(view.buffer.byteLength, size, 'a rejected transfer leaves the buffer alone');
+
+    let p = reply();
+    w.postMessage({ view, buffer: view.buffer, tag: 'array' }, [ view.buffer ]);
+    assert.throws(() => view.buffer.byteLength, TypeError, 'the sender buffer is detached');
+    assert.eq(view.length, 0, 'views on the sender buffer are emptied');
+    assert.throws(() => { w.postMessage({}, [ view.buffer ]); }, TypeError, 'a detached buffer cannot be transferred');
+    let msg = await p;
+    assert.eq(msg.tag, 'array', 'message arrives');
+    assert.ok(msg.sameBuffer, 'references to the same buffer are preserved');
+    assert.eq(msg.view.length, size, 'the buffer comes back whole');
+    assert.eq(msg.view[0], 42, 'the worker saw and changed the data');
+    assert.eq(msg.view[size - 1], 7, 'the data is intact');
+
+    const back = msg.view;
+    p = reply();
+    w.postMessage({ view: back, tag: 'options' }, { transfer: [ back.buffer ] });
+    assert.eq(back.length, 0, 'the options form transfers too');
+    msg = await p;
+    assert.eq(msg.view[0], 43, 'the buffer survives a second round trip');
+
+    const unused = new ArrayBuffer(64);
+    p = reply();
+    w.postMessage({ view: new Uint8Array(4), tag: 'copy' }, [ unused ]);
+    assert.throws(() => unused.byteLength, TypeError, 'listed buffers are detached even when not in the message');
+    msg = await p;
+    assert.eq(msg.view[0], 1, 'the copied buffer arrives');
+
+    // a buffer that a pending write still reads from stays put
+    const server = new ijjs.TCP();
+    server.bind({ ip: '127.0.0.1' });
+    server.listen();
+    const sink = (async () => {
+        const conn = await server.accept();
+        while (await conn.read());
+        conn.close();
+    })();
+    const client = new ijjs.TCP();
+    await client.connect(server.getsockname());
+    const out = new Uint8Array(32 * 1024 * 1024);
+    const written = client.write(out);
+    assert.ok(client.writeQueueSize > 0, 'the write is pending');
+    assert.throws(() => { w.postMessage({ view: out, tag: 'busy' }, [ out.buffer ]); }, TypeError, 'a buffer being written cannot be transferred');
+    assert.eq(out.length, 32 * 1024 * 1024, 'the pending write keeps its data');
+    await written;
+    p = reply();
+    w.postMessage({ view: out, tag: 'written' }, [ out.buffer ]);
+    assert.eq(out.length, 0, 'the buffer is transferable once the write is done');
+    msg = await p;
+    assert.eq(msg.view[0], 1, 'the written buffer arrives');
+    await client.shutdown();
+    await sink;
+    client.close();
+    server.close();
+
+    // the same holds for a queued UDP send: an oversized datagram keeps the
+    // next one waiting in the send queue
+    const udp = new ijjs.UDP();
+    udp.bind({ ip: '127.0.0.1' });
+    const sender = new ijjs.UDP();
+    const tooBig = sender.send(new Uint8Array(70000), udp.getsockname());
+    const datagram = new Uint8Array(16);
+    const sent = sender.send(datagram, udp.getsockname());
+    assert.throws(() => { w.postMessage({ view: datagram, tag: 'busy' }, [ datagram.buffer ]); }, TypeError, 'a buffer being sent cannot be transferred');
+    await tooBig.catch(() => {});
+    await sent;
+    assert.eq(datagram.length, 16, 'the queued send keeps its data');
+    sender.close();
+    udp.close();
+
+    w.terminate();
+})();
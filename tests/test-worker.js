@@ -14,3 +14,16 @@ w.onmessage = event => {
     w.terminate();
     clearTimeout(timer);
 };
+
+// messages still queued at terminate() are dropped, not written to the dead channel
+const w2 = new Worker(ijjs.join(ijjs.dirname(thisFile), 'helpers', 'echo-worker.js'));
+let late = 0;
+w2.onmessage = () => {
+    late++;
+};
+w2.postMessage({a: 1});
+w2.terminate();
+w2.postMessage({a: 2});
+setTimeout(() => {
+    assert.eq(late, 0, 'no message arrives after terminate()');
+}, 200);